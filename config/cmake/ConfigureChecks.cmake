@@ -184,6 +184,22 @@ if (NOT WINDOWS)
   endif ()
 endif ()
 
+#-----------------------------------------------------------------------------
+#  Check if the io_uring driver can be built
+#-----------------------------------------------------------------------------
+if (NOT WINDOWS)
+  option (HDF5_ENABLE_IOURING_VFD "Build the io_uring Virtual File Driver" OFF)
+  if (HDF5_ENABLE_IOURING_VFD)
+    CHECK_INCLUDE_FILE ("linux/io_uring.h" ${HDF_PREFIX}_HAVE_LINUX_IO_URING_H)
+    CHECK_SYMBOL_EXISTS (__NR_io_uring_setup "sys/syscall.h" ${HDF_PREFIX}_HAVE_IO_URING_SETUP)
+    if (${HDF_PREFIX}_HAVE_LINUX_IO_URING_H AND ${HDF_PREFIX}_HAVE_IO_URING_SETUP)
+      set (${HDF_PREFIX}_HAVE_IOURING 1)
+    else ()
+      message (WARNING "The io_uring VFD was requested but cannot be built.\nPlease check that linux/io_uring.h and the io_uring system calls are available on your\nsystem, and/or re-configure without option HDF5_ENABLE_IOURING_VFD.")
+    endif ()
+  endif ()
+endif ()
+
 #-----------------------------------------------------------------------------
 #  Check if ROS3 driver can be built
 #-----------------------------------------------------------------------------
@@ -123,6 +123,40 @@ int __attribute__((unused)) x
 
 #endif /* HAVE_ATTRIBUTE */
 
+#ifdef HAVE_SIMD_DISPATCH
+
+#include <immintrin.h>
+
+__attribute__((target("sse2"))) static int
+test_sse2(const unsigned char *buf)
+{
+    __m128i v = _mm_loadu_si128((const __m128i *)buf);
+
+    return _mm_movemask_epi8(_mm_unpacklo_epi8(v, v));
+}
+
+__attribute__((target("avx2"))) static int
+test_avx2(const unsigned char *buf)
+{
+    __m256i v = _mm256_loadu_si256((const __m256i *)buf);
+
+    return _mm256_movemask_epi8(_mm256_unpacklo_epi8(v, v));
+}
+
+int
+main(void)
+{
+    unsigned char buf[32] = {0};
+
+    if (__builtin_cpu_supports("avx2"))
+        return test_avx2(buf);
+    if (__builtin_cpu_supports("sse2"))
+        return test_sse2(buf);
+    return 0;
+}
+
+#endif /* HAVE_SIMD_DISPATCH */
+
 #ifdef HAVE_FUNCTION
 
 #ifdef FC_DUMMY_MAIN
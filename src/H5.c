@@ -32,6 +32,8 @@
 #include "H5SLprivate.h" /* Skip lists                               */
 #include "H5Tprivate.h"  /* Datatypes                                */
 
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
 /****************/
 /* Local Macros */
 /****************/
@@ -313,6 +315,13 @@ H5_term_library(void)
     if (!(H5_INIT_GLOBAL))
         goto done;
 
+#ifdef H5VL_NATIVE_ASYNC
+    /* Finish the native VOL connector's asynchronous operations, before
+     *  anything is shut down
+     */
+    (void)H5VL_native_async_term();
+#endif /* H5VL_NATIVE_ASYNC */
+
     /* Indicate that the library is being shut down */
     H5_TERM_GLOBAL = TRUE;
 
@@ -399,6 +399,14 @@ H5AC_create(const H5F_t *f, H5AC_cache_config_t *config_ptr, H5AC_cache_image_co
     if (H5AC_set_cache_auto_resize_config(f->shared->cache, config_ptr) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTSET, FAIL, "auto resize configuration failed")
 
+    /* Metadata in files opened read only (including SWMR readers) is never
+     * modified, so use the CLOCK replacement policy, which doesn't move
+     * entries on the LRU list for every read only protect.
+     */
+    if (!(H5F_INTENT(f) & H5F_ACC_RDWR) && !H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        if (H5C_set_clock_rp(f->shared->cache, TRUE) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTSET, FAIL, "can't set cache replacement policy")
+
     /* Don't need to get the current H5C image config here since the
      * cache has just been created, and thus f->shared->cache->image_ctl
      * must still set to its initial value (H5C__DEFAULT_CACHE_IMAGE_CTL).
@@ -112,6 +112,8 @@ typedef H5C_cache_entry_t *H5C_cache_entry_ptr_t;
 
 static herr_t H5C__pin_entry_from_client(H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr);
 
+static herr_t H5C__unshare_protected_entry(H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr);
+
 static herr_t H5C__unpin_entry_real(H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr, hbool_t update_rp);
 
 static herr_t H5C__unpin_entry_from_client(H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr, hbool_t update_rp);
@@ -406,6 +408,10 @@ H5C_create(size_t max_cache_size, size_t min_clean_size, int max_type_id,
     cache_ptr->pl_head_ptr = NULL;
     cache_ptr->pl_tail_ptr = NULL;
 
+    cache_ptr->clock_rp      = FALSE;
+    cache_ptr->clock_pl_len  = 0;
+    cache_ptr->clock_pl_size = (size_t)0;
+
     cache_ptr->pel_len      = 0;
     cache_ptr->pel_size     = (size_t)0;
     cache_ptr->pel_head_ptr = NULL;
@@ -763,6 +769,7 @@ H5C_prep_for_file_close(H5F_t *f)
 
     /* Make certain there aren't any protected entries */
     HDassert(cache_ptr->pl_len == 0);
+    HDassert(cache_ptr->clock_pl_len == 0);
 
     /* Prepare cache image */
     if (H5C__prep_image_for_file_close(f, &image_generated) < 0)
@@ -1372,9 +1379,11 @@ H5C_insert_entry(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *thing, u
     entry_ptr->image_ptr        = NULL;
     entry_ptr->image_up_to_date = FALSE;
 
-    entry_ptr->is_protected = FALSE;
-    entry_ptr->is_read_only = FALSE;
-    entry_ptr->ro_ref_count = 0;
+    entry_ptr->is_protected     = FALSE;
+    entry_ptr->is_read_only     = FALSE;
+    entry_ptr->ro_ref_count     = 0;
+    entry_ptr->protected_in_lru = FALSE;
+    entry_ptr->clock_ref        = FALSE;
 
     entry_ptr->is_pinned          = insert_pinned;
     entry_ptr->pinned_from_client = insert_pinned;
@@ -2043,6 +2052,13 @@ H5C_resize_entry(void *thing, size_t new_size)
     if (entry_ptr->size != new_size) {
         hbool_t was_clean;
 
+        /* Entries protected in place on the LRU list must be on the
+         * protected list to have their size changed.
+         */
+        if (entry_ptr->protected_in_lru)
+            if (H5C__unshare_protected_entry(cache_ptr, entry_ptr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTRESIZE, FAIL, "can't move entry to protected list")
+
         /* make note of whether the entry was clean to begin with */
         was_clean = !entry_ptr->is_dirty;
 
@@ -2527,7 +2543,21 @@ H5C_protect(H5F_t *f, const H5C_class_t *type, haddr_t addr, void *udata, unsign
             HGOTO_ERROR(H5E_CACHE, H5E_CANTPROTECT, NULL, "Target already protected & not read only?!?")
     } /* end if */
     else {
-        H5C__UPDATE_RP_FOR_PROTECT(cache_ptr, entry_ptr, NULL)
+        /* When running with the CLOCK replacement policy, read only
+         * protects of clean, unpinned entries leave the entry in place
+         * on the LRU list.
+         */
+        if (read_only && cache_ptr->clock_rp && !entry_ptr->is_pinned && !entry_ptr->is_dirty) {
+            entry_ptr->protected_in_lru = TRUE;
+            cache_ptr->clock_pl_len++;
+            cache_ptr->clock_pl_size += entry_ptr->size;
+        } /* end if */
+        else {
+            H5C__UPDATE_RP_FOR_PROTECT(cache_ptr, entry_ptr, NULL)
+
+            /* The unprotect will move the entry to the head of the LRU list */
+            entry_ptr->clock_ref = FALSE;
+        } /* end else */
 
         entry_ptr->is_protected = TRUE;
 
@@ -2900,6 +2930,44 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_set_evictions_enabled() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5C_set_clock_rp()
+ *
+ * Purpose:     Set cache_ptr->clock_rp to the value of the clock_rp
+ *              parameter.
+ *
+ *              When clock_rp is TRUE, read only protects of clean,
+ *              unpinned entries leave the entries on the LRU list, and
+ *              the LRU ordering is approximated with the CLOCK policy.
+ *              This should only be enabled for caches whose entries are
+ *              never modified, i.e. for files opened read only.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_set_clock_rp(H5C_t *cache_ptr, hbool_t clock_rp)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if ((cache_ptr == NULL) || (cache_ptr->magic != H5C__H5C_T_MAGIC))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr on entry")
+
+    /* Entries protected in place on the LRU list depend on the policy
+     * staying in effect until they are unprotected.
+     */
+    if (cache_ptr->clock_pl_len > 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Can't change replacement policy with protected entries")
+
+    cache_ptr->clock_rp = clock_rp;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_set_clock_rp() */
+
 /*-------------------------------------------------------------------------
  *
  * Function:    H5C_set_slist_enabled()
@@ -3319,8 +3387,38 @@ H5C_unprotect(H5F_t *f, haddr_t addr, void *thing, unsigned flags)
 
         } /* end if */
     }
+    else if (entry_ptr->protected_in_lru && !dirtied && !entry_ptr->is_pinned && flags == H5C__NO_FLAGS_SET) {
+
+        /* Sanity check */
+        HDassert(entry_ptr->is_protected);
+        HDassert(entry_ptr->is_read_only);
+        HDassert(entry_ptr->ro_ref_count == 1);
+        HDassert(!entry_ptr->is_dirty);
+        HDassert(cache_ptr->clock_pl_len > 0);
+        HDassert(cache_ptr->clock_pl_size >= entry_ptr->size);
+
+        /* The entry is still on the LRU list, so all that is needed to
+         * unprotect it is to record the reference for the CLOCK
+         * replacement policy.
+         */
+        cache_ptr->clock_pl_len--;
+        cache_ptr->clock_pl_size -= entry_ptr->size;
+
+        entry_ptr->protected_in_lru = FALSE;
+        entry_ptr->is_protected     = FALSE;
+        entry_ptr->is_read_only     = FALSE;
+        entry_ptr->ro_ref_count     = 0;
+        entry_ptr->clock_ref        = TRUE;
+    }
     else {
 
+        /* Move entries protected in place on the LRU list to the
+         * protected list, so the regular unprotect code applies.
+         */
+        if (entry_ptr->protected_in_lru)
+            if (H5C__unshare_protected_entry(cache_ptr, entry_ptr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTUNPROTECT, FAIL, "can't move entry to protected list")
+
         if (entry_ptr->is_read_only) {
 
             /* Sanity check */
@@ -3915,6 +4013,11 @@ H5C_create_flush_dependency(void *parent_thing, void *child_thing)
         HDassert(!parent_entry->pinned_from_client);
         HDassert(!parent_entry->pinned_from_cache);
 
+        /* Pinned entries can't stay on the LRU list */
+        if (parent_entry->protected_in_lru)
+            if (H5C__unshare_protected_entry(cache_ptr, parent_entry) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTPIN, FAIL, "can't move entry to protected list")
+
         /* Pin the parent entry */
         parent_entry->is_pinned = TRUE;
         H5C__UPDATE_STATS_FOR_PIN(cache_ptr, parent_entry)
@@ -4139,12 +4242,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5C__pin_entry_from_client(H5C_t
-#if !H5C_COLLECT_CACHE_STATS
-                               H5_ATTR_UNUSED
-#endif
-                                   *          cache_ptr,
-                           H5C_cache_entry_t *entry_ptr)
+H5C__pin_entry_from_client(H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr)
 {
     herr_t ret_value = SUCCEED; /* Return value */
 
@@ -4162,6 +4260,11 @@ H5C__pin_entry_from_client(H5C_t
             HGOTO_ERROR(H5E_CACHE, H5E_CANTPIN, FAIL, "entry is already pinned")
     } /* end if */
     else {
+        /* Pinned entries can't stay on the LRU list */
+        if (entry_ptr->protected_in_lru)
+            if (H5C__unshare_protected_entry(cache_ptr, entry_ptr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTPIN, FAIL, "can't move entry to protected list")
+
         entry_ptr->is_pinned = TRUE;
 
         H5C__UPDATE_STATS_FOR_PIN(cache_ptr, entry_ptr)
@@ -4174,6 +4277,62 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__pin_entry_from_client() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5C__unshare_protected_entry()
+ *
+ * Purpose:     Move an entry that was protected read only in place on the
+ *              LRU list by the CLOCK replacement policy to the protected
+ *              list, as if it had been protected normally.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__unshare_protected_entry(H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+#if H5C_DO_SANITY_CHECKS
+    FUNC_ENTER_STATIC
+#else
+    FUNC_ENTER_STATIC_NOERR
+#endif
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(entry_ptr);
+    HDassert(entry_ptr->protected_in_lru);
+    HDassert(entry_ptr->is_protected);
+    HDassert(entry_ptr->is_read_only);
+    HDassert(!entry_ptr->is_pinned);
+    HDassert(!entry_ptr->is_dirty);
+    HDassert(cache_ptr->clock_pl_len > 0);
+    HDassert(cache_ptr->clock_pl_size >= entry_ptr->size);
+
+    /* Remove the entry from the LRU list(s) */
+    H5C__DLL_REMOVE(entry_ptr, cache_ptr->LRU_head_ptr, cache_ptr->LRU_tail_ptr, cache_ptr->LRU_list_len,
+                    cache_ptr->LRU_list_size, FAIL)
+#if H5C_MAINTAIN_CLEAN_AND_DIRTY_LRU_LISTS
+    H5C__AUX_DLL_REMOVE(entry_ptr, cache_ptr->cLRU_head_ptr, cache_ptr->cLRU_tail_ptr,
+                        cache_ptr->cLRU_list_len, cache_ptr->cLRU_list_size, FAIL)
+#endif /* H5C_MAINTAIN_CLEAN_AND_DIRTY_LRU_LISTS */
+
+    /* Add it to the protected list */
+    H5C__DLL_APPEND(entry_ptr, cache_ptr->pl_head_ptr, cache_ptr->pl_tail_ptr, cache_ptr->pl_len,
+                    cache_ptr->pl_size, FAIL)
+
+    cache_ptr->clock_pl_len--;
+    cache_ptr->clock_pl_size -= entry_ptr->size;
+    entry_ptr->protected_in_lru = FALSE;
+
+#if H5C_DO_SANITY_CHECKS
+done:
+#endif
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__unshare_protected_entry() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5C__unpin_entry_real()
  *
@@ -4803,9 +4962,9 @@ H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t *f, hbool_t write_permitte
             hbool_t skipping_entry = FALSE;
 
             HDassert(entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
-            HDassert(!(entry_ptr->is_protected));
-            HDassert(!(entry_ptr->is_read_only));
-            HDassert((entry_ptr->ro_ref_count) == 0);
+            HDassert(!(entry_ptr->is_protected) || entry_ptr->protected_in_lru);
+            HDassert(!(entry_ptr->is_read_only) || entry_ptr->protected_in_lru);
+            HDassert((entry_ptr->ro_ref_count) == 0 || entry_ptr->protected_in_lru);
 
             next_ptr = entry_ptr->next;
             prev_ptr = entry_ptr->prev;
@@ -4813,7 +4972,16 @@ H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t *f, hbool_t write_permitte
             if (prev_ptr != NULL)
                 prev_is_dirty = prev_ptr->is_dirty;
 
-            if (entry_ptr->is_dirty) {
+            if (entry_ptr->protected_in_lru)
+                /* entry protected in place by the CLOCK policy is skipped */
+                skipping_entry = TRUE;
+            else if (entry_ptr->clock_ref) {
+                /* referenced entry gets a second chance */
+                entry_ptr->clock_ref = FALSE;
+                H5C__UPDATE_RP_FOR_MOVE(cache_ptr, entry_ptr, entry_ptr->is_dirty, FAIL)
+                skipping_entry = TRUE;
+            } /* end else-if */
+            else if (entry_ptr->is_dirty) {
                 HDassert(!entry_ptr->prefetched_dirty);
 
                 /* dirty corked entry is skipped */
@@ -4858,7 +5026,8 @@ H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t *f, hbool_t write_permitte
                 if (skipping_entry)
                     entry_ptr = prev_ptr;
                 else if (restart_scan || (prev_ptr->is_dirty != prev_is_dirty) ||
-                         (prev_ptr->next != next_ptr) || (prev_ptr->is_protected) || (prev_ptr->is_pinned)) {
+                         (prev_ptr->next != next_ptr) ||
+                         (prev_ptr->is_protected && !prev_ptr->protected_in_lru) || (prev_ptr->is_pinned)) {
                     /* Something has happened to the LRU -- start over
                      * from the tail.
                      */
@@ -4908,11 +5077,19 @@ H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t *f, hbool_t write_permitte
         entry_ptr = cache_ptr->LRU_tail_ptr;
         while (entry_ptr != NULL && ((entry_ptr->type)->id != H5AC_EPOCH_MARKER_ID) &&
                (bytes_evicted < eviction_size_limit)) {
-            HDassert(!(entry_ptr->is_protected));
+            HDassert(!(entry_ptr->is_protected) || entry_ptr->protected_in_lru);
 
             prev_ptr = entry_ptr->prev;
 
-            if (!(entry_ptr->is_dirty) && !(entry_ptr->prefetched_dirty))
+            if (entry_ptr->protected_in_lru)
+                /* skip entry protected in place by the CLOCK policy */
+                ;
+            else if (entry_ptr->clock_ref) {
+                /* referenced entry gets a second chance */
+                entry_ptr->clock_ref = FALSE;
+                H5C__UPDATE_RP_FOR_MOVE(cache_ptr, entry_ptr, entry_ptr->is_dirty, FAIL)
+            } /* end else-if */
+            else if (!(entry_ptr->is_dirty) && !(entry_ptr->prefetched_dirty))
                 if (H5C__flush_single_entry(
                         f, entry_ptr, H5C__FLUSH_INVALIDATE_FLAG | H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
                     HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush clean entry")
@@ -5982,7 +6159,7 @@ H5C__flush_invalidate_ring(H5F_t *f, H5C_ring_t ring, unsigned flags)
                         (int)cur_ring_pel_len, (int)old_ring_pel_len, (int)ring)
         } /* end if */
 
-        HDassert(protected_entries == cache_ptr->pl_len);
+        HDassert(protected_entries == (cache_ptr->pl_len + cache_ptr->clock_pl_len));
 
         if ((protected_entries > 0) && (protected_entries == cache_ptr->index_len))
 
@@ -6005,7 +6182,7 @@ H5C__flush_invalidate_ring(H5F_t *f, H5C_ring_t ring, unsigned flags)
 
     } /* end for */
 
-    HDassert(protected_entries <= cache_ptr->pl_len);
+    HDassert(protected_entries <= (cache_ptr->pl_len + cache_ptr->clock_pl_len));
 
     if (protected_entries > 0) {
 
@@ -6309,9 +6486,10 @@ H5C__flush_ring(H5F_t *f, H5C_ring_t ring, unsigned flags)
 
     } /* while */
 
-    HDassert(protected_entries <= cache_ptr->pl_len);
+    HDassert(protected_entries <= (cache_ptr->pl_len + cache_ptr->clock_pl_len));
 
-    if (((cache_ptr->pl_len > 0) && (!ignore_protected)) || (tried_to_flush_protected_entry))
+    if ((((cache_ptr->pl_len + cache_ptr->clock_pl_len) > 0) && (!ignore_protected)) ||
+        (tried_to_flush_protected_entry))
 
         HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "cache has protected items")
 
@@ -7358,6 +7536,8 @@ H5C__load_entry(H5F_t *f,
     entry->is_protected     = FALSE;
     entry->is_read_only     = FALSE;
     entry->ro_ref_count     = 0;
+    entry->protected_in_lru = FALSE;
+    entry->clock_ref        = FALSE;
     entry->is_pinned        = FALSE;
     entry->in_slist         = FALSE;
     entry->flush_marker     = FALSE;
@@ -7518,9 +7698,9 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t write_permitted)
                 ((empty_space + cache_ptr->clean_index_size) < (cache_ptr->min_clean_size))) &&
                (entries_examined <= (2 * initial_list_len)) && (entry_ptr != NULL)) {
             HDassert(entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
-            HDassert(!(entry_ptr->is_protected));
-            HDassert(!(entry_ptr->is_read_only));
-            HDassert((entry_ptr->ro_ref_count) == 0);
+            HDassert(!(entry_ptr->is_protected) || entry_ptr->protected_in_lru);
+            HDassert(!(entry_ptr->is_read_only) || entry_ptr->protected_in_lru);
+            HDassert((entry_ptr->ro_ref_count) == 0 || entry_ptr->protected_in_lru);
 
             next_ptr = entry_ptr->next;
             prev_ptr = entry_ptr->prev;
@@ -7528,7 +7708,12 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t write_permitted)
             if (prev_ptr != NULL)
                 prev_is_dirty = prev_ptr->is_dirty;
 
-            if (entry_ptr->is_dirty && (entry_ptr->tag_info && entry_ptr->tag_info->corked)) {
+            if (entry_ptr->protected_in_lru) {
+
+                /* Skip entries protected in place by the CLOCK policy */
+                didnt_flush_entry = TRUE;
+            }
+            else if (entry_ptr->is_dirty && (entry_ptr->tag_info && entry_ptr->tag_info->corked)) {
 
                 /* Skip "dirty" corked entries.  */
                 ++num_corked_entries;
@@ -7576,9 +7761,19 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t write_permitted)
                     cache_ptr->entries_scanned_to_make_space++;
 #endif /* H5C_COLLECT_CACHE_STATS */
 
-                    if (H5C__flush_single_entry(f, entry_ptr,
-                                                H5C__FLUSH_INVALIDATE_FLAG |
-                                                    H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
+                    if (entry_ptr->clock_ref) {
+
+                        /* The entry was referenced since it was last
+                         * considered for eviction -- give it a second
+                         * chance at the head of the LRU list.
+                         */
+                        entry_ptr->clock_ref = FALSE;
+                        H5C__UPDATE_RP_FOR_MOVE(cache_ptr, entry_ptr, FALSE, FAIL)
+                        didnt_flush_entry = TRUE;
+                    }
+                    else if (H5C__flush_single_entry(f, entry_ptr,
+                                                     H5C__FLUSH_INVALIDATE_FLAG |
+                                                         H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
                         HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush entry")
                 }
                 else {
@@ -7620,7 +7815,8 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t write_permitted)
                     entry_ptr = prev_ptr;
                 }
                 else if ((restart_scan) || (prev_ptr->is_dirty != prev_is_dirty) ||
-                         (prev_ptr->next != next_ptr) || (prev_ptr->is_protected) || (prev_ptr->is_pinned)) {
+                         (prev_ptr->next != next_ptr) ||
+                         (prev_ptr->is_protected && !prev_ptr->protected_in_lru) || (prev_ptr->is_pinned)) {
 
                     /* something has happened to the LRU -- start over
                      * from the tail.
@@ -7676,8 +7872,8 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t write_permitted)
 
         /* NEED: work on a better assert for corked entries */
         HDassert((entries_examined > (2 * initial_list_len)) ||
-                 ((cache_ptr->pl_size + cache_ptr->pel_size + cache_ptr->min_clean_size) >
-                  cache_ptr->max_cache_size) ||
+                 ((cache_ptr->pl_size + cache_ptr->clock_pl_size + cache_ptr->pel_size +
+                   cache_ptr->min_clean_size) > cache_ptr->max_cache_size) ||
                  ((cache_ptr->clean_index_size + empty_space) >= cache_ptr->min_clean_size) ||
                  ((num_corked_entries)));
 #if H5C_MAINTAIN_CLEAN_AND_DIRTY_LRU_LISTS
@@ -7699,14 +7895,22 @@ H5C__make_space_in_cache(H5F_t *f, size_t space_needed, hbool_t write_permitted)
 
         while (((cache_ptr->index_size + space_needed) > cache_ptr->max_cache_size) &&
                (entries_examined <= initial_list_len) && (entry_ptr != NULL)) {
-            HDassert(!(entry_ptr->is_protected));
-            HDassert(!(entry_ptr->is_read_only));
-            HDassert((entry_ptr->ro_ref_count) == 0);
+            HDassert(!(entry_ptr->is_protected) || entry_ptr->protected_in_lru);
+            HDassert(!(entry_ptr->is_read_only) || entry_ptr->protected_in_lru);
+            HDassert((entry_ptr->ro_ref_count) == 0 || entry_ptr->protected_in_lru);
             HDassert(!(entry_ptr->is_dirty));
 
             prev_ptr = entry_ptr->aux_prev;
 
-            if ((!(entry_ptr->prefetched_dirty))
+            if (entry_ptr->protected_in_lru) {
+                /* Skip entries protected in place by the CLOCK policy */
+            } /* end if */
+            else if (entry_ptr->clock_ref) {
+                /* Give referenced entries a second chance */
+                entry_ptr->clock_ref = FALSE;
+                H5C__UPDATE_RP_FOR_MOVE(cache_ptr, entry_ptr, FALSE, FAIL)
+            } /* end else-if */
+            else if ((!(entry_ptr->prefetched_dirty))
 #ifdef H5_HAVE_PARALLEL
                 && (!(entry_ptr->coll_access))
 #endif /* H5_HAVE_PARALLEL */
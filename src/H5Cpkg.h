@@ -4014,6 +4014,28 @@ typedef struct H5C_tag_info_t {
  *
  *              This field is NULL if the list is empty.
  *
+ * When the cache is used for a file that is opened read only, entries are
+ * never modified, and moving each entry from the LRU list to the protected
+ * list and back again on every read only protect is wasted work.  In this
+ * case, the cache uses a CLOCK approximation of the LRU replacement policy:
+ * read only protects of clean, unpinned entries leave the entry on the LRU
+ * list (setting its protected_in_lru field), and the final unprotect sets
+ * the entry's clock_ref field instead of moving the entry to the head of
+ * the LRU list.  Eviction scans skip protected entries on the LRU list, and
+ * give referenced entries a second chance by resetting clock_ref and moving
+ * them to the head of the LRU list.
+ *
+ * clock_rp:    Boolean flag indicating whether the cache is using the CLOCK
+ *              replacement policy described above.  This field is set by
+ *              H5C_set_clock_rp(), and must not be changed while entries
+ *              are protected.
+ *
+ * clock_pl_len: Number of entries currently protected read only in place
+ *              on the LRU list.  These entries are not counted in pl_len.
+ *
+ * clock_pl_size: Number of bytes of cache entries currently protected
+ *              read only in place on the LRU list.
+ *
  *
  * For very frequently used entries, the protect/unprotect overhead can
  * become burdensome.  To avoid this overhead, I have modified the cache
@@ -4872,6 +4894,9 @@ struct H5C_t {
     size_t                      pl_size;
     H5C_cache_entry_t *            pl_head_ptr;
     H5C_cache_entry_t *      pl_tail_ptr;
+    hbool_t                     clock_rp;
+    uint32_t                    clock_pl_len;
+    size_t                      clock_pl_size;
 
     /* Fields for tracking pinned entries */
     uint32_t                    pel_len;
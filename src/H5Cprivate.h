@@ -1070,6 +1070,25 @@ typedef int H5C_ring_t;
  *         must be zero whenever either is_protected or is_read_only
  *         are TRUE.
  *
+ * protected_in_lru: Boolean flag that is only meaningful if is_protected
+ *         and is_read_only are both TRUE.  When the cache is running
+ *         with the CLOCK replacement policy (see the clock_rp field of
+ *         H5C_t), read only protects of clean, unpinned entries leave
+ *         the entry where it is on the LRU list instead of moving it to
+ *         the protected list.  This field is set when that is the case.
+ *
+ *         If anything happens to the entry while it is protected that
+ *         requires it to be on the protected list (i.e. it is pinned or
+ *         resized), the entry is moved to the protected list and this
+ *         field is reset.
+ *
+ * clock_ref: Boolean flag used by the CLOCK replacement policy.  It is
+ *         set when a read only protect of the entry ends without moving
+ *         the entry to the head of the LRU list.  Entries with this flag
+ *         set that are chosen for eviction are given a second chance:
+ *         the flag is reset and the entry is moved to the head of the
+ *         LRU list.
+ *
  * is_pinned:    Boolean flag indicating whether the entry has been pinned
  *         in the cache.
  *
@@ -1602,6 +1621,8 @@ typedef struct H5C_cache_entry_t {
     hbool_t            is_protected;
     hbool_t            is_read_only;
     int                ro_ref_count;
+    hbool_t            protected_in_lru;
+    hbool_t            clock_ref;
     hbool_t            is_pinned;
     hbool_t            in_slist;
     hbool_t            flush_marker;
@@ -2270,6 +2291,7 @@ H5_DLL herr_t H5C_resize_entry(void *thing, size_t new_size);
 H5_DLL herr_t H5C_set_cache_auto_resize_config(H5C_t *cache_ptr, H5C_auto_size_ctl_t *config_ptr);
 H5_DLL herr_t H5C_set_cache_image_config(const H5F_t *f, H5C_t *cache_ptr, H5C_cache_image_ctl_t *config_ptr);
 H5_DLL herr_t H5C_set_evictions_enabled(H5C_t *cache_ptr, hbool_t evictions_enabled);
+H5_DLL herr_t H5C_set_clock_rp(H5C_t *cache_ptr, hbool_t clock_rp);
 H5_DLL herr_t H5C_set_slist_enabled(H5C_t *cache_ptr, hbool_t slist_enabled, hbool_t clear_slist);
 H5_DLL herr_t H5C_set_prefix(H5C_t *cache_ptr, char *prefix);
 H5_DLL herr_t H5C_stats(H5C_t *cache_ptr, const char *cache_name, hbool_t display_detailed_stats);
@@ -27,6 +27,7 @@
 #include "H5ESprivate.h" /* Event Sets                               */
 #include "H5FLprivate.h" /* Free lists                               */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
 #include "H5VLnative_private.h" /* Native VOL connector                     */
@@ -881,6 +882,43 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dget_offset() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dget_mapped_data
+ *
+ * Purpose:     Returns a read-only pointer to the raw data of a contiguous
+ *              dataset in the memory mapping of its file, and the size of
+ *              the data.  *BUF is set to NULL when the data isn't mapped.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dget_mapped_data(hid_t dset_id, const void **buf /*out*/, hsize_t *size /*out*/)
+{
+    H5VL_object_t *vol_obj;             /* Dataset for this operation   */
+    herr_t         ret_value = SUCCEED; /* Return value                 */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", dset_id, buf, size);
+
+    /* Check args */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset identifier")
+    if (NULL == buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf parameter cannot be NULL")
+    if (NULL == size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "size parameter cannot be NULL")
+
+    /* Get the pointer */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_GET_MAPPED_DATA, H5P_DATASET_XFER_DEFAULT,
+                              H5_REQUEST_NULL, buf, size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get mapped data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dget_mapped_data() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__read_api_common
  *
@@ -1019,6 +1057,90 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread_async() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_multi
+ *
+ * Purpose:     Reads (part of) COUNT datasets from the file into
+ *              application memory BUFs.  Each dataset is described by
+ *              the entries at the same index in DSET_ID, MEM_TYPE_ID,
+ *              MEM_SPACE_ID, FILE_SPACE_ID and BUF, which have the same
+ *              meaning as the corresponding H5Dread() arguments.  All
+ *              of the datasets use the DXPL_ID transfer properties.
+ *
+ *              The native VOL connector gathers the raw data I/O for
+ *              all of the datasets into one request to the file driver
+ *              when it can.  Other VOL connectors read the datasets
+ *              one after another.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[], hid_t file_space_id[],
+              hid_t dxpl_id, void *buf[] /*out*/)
+{
+    H5VL_object_t **vol_obj   = NULL;    /* Dataset VOL objects */
+    hbool_t         is_native = TRUE;    /* Whether all datasets use the native VOL connector */
+    size_t          u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*iix", count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
+
+    /* Check arguments */
+    if (count == 0)
+        HGOTO_DONE(SUCCEED)
+    if (!dset_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dset_id array not provided")
+    if (!mem_type_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_type_id array not provided")
+    if (!mem_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_space_id array not provided")
+    if (!file_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file_space_id array not provided")
+    if (!buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf array not provided")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Get dataset pointers */
+    if (NULL == (vol_obj = (H5VL_object_t **)H5MM_malloc(count * sizeof(H5VL_object_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate dataset object array")
+    for (u = 0; u < count; u++) {
+        if (mem_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+        if (file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+        if (NULL == (vol_obj[u] = (H5VL_object_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+        if (vol_obj[u]->connector->cls->value != H5_VOL_NATIVE)
+            is_native = FALSE;
+    } /* end for */
+
+    if (is_native) {
+        /* Let the native VOL connector read all the datasets at once */
+        if (H5VL_dataset_optional(vol_obj[0], H5VL_NATIVE_DATASET_READ_MULTI, dxpl_id, H5_REQUEST_NULL, count,
+                                  dset_id, mem_type_id, mem_space_id, file_space_id, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end if */
+    else
+        /* Read each dataset in turn */
+        for (u = 0; u < count; u++)
+            if (H5VL_dataset_read(vol_obj[u], mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id,
+                                  buf[u], H5_REQUEST_NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+done:
+    H5MM_xfree(vol_obj);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dread_chunk
  *
@@ -1065,6 +1187,57 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread_chunk() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dread_chunks
+ *
+ * Purpose:     Reads several entire chunks from the file directly, packed
+ *              into one buffer in order of their addresses in the file.
+ *              With a NULL buffer, only the chunks' filter masks, sizes
+ *              and positions in the buffer are returned.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *---------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_chunks(hid_t dset_id, hid_t dxpl_id, size_t count, const hsize_t *offsets, uint32_t *filters /*out*/,
+               hsize_t *sizes /*out*/, hsize_t *buf_offsets /*out*/, size_t buf_size, void *buf /*out*/)
+{
+    H5VL_object_t *vol_obj   = NULL;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE9("e", "iiz*hxxxzx", dset_id, dxpl_id, count, offsets, filters, sizes, buf_offsets, buf_size, buf);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+    if (!offsets)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "offsets cannot be NULL")
+    if (!filters)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "filters cannot be NULL")
+    if (!sizes)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "sizes cannot be NULL")
+    if (!buf_offsets)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf_offsets cannot be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dxpl_id is not a dataset transfer property list ID")
+
+    /* Read the raw chunks */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_CHUNK_READ_MULTI, dxpl_id, H5_REQUEST_NULL, count,
+                              offsets, filters, sizes, buf_offsets, buf_size, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read unprocessed chunk data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_chunks() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__write_api_common
  *
@@ -1206,6 +1379,90 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite_async() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dwrite_multi
+ *
+ * Purpose:     Writes (part of) COUNT datasets from application memory
+ *              BUFs to the file.  Each dataset is described by
+ *              the entries at the same index in DSET_ID, MEM_TYPE_ID,
+ *              MEM_SPACE_ID, FILE_SPACE_ID and BUF, which have the same
+ *              meaning as the corresponding H5Dwrite() arguments.  All
+ *              of the datasets use the DXPL_ID transfer properties.
+ *
+ *              The native VOL connector gathers the raw data I/O for
+ *              all of the datasets into one request to the file driver
+ *              when it can.  Other VOL connectors write the datasets
+ *              one after another.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[], hid_t file_space_id[],
+               hid_t dxpl_id, const void *buf[])
+{
+    H5VL_object_t **vol_obj   = NULL;    /* Dataset VOL objects */
+    hbool_t         is_native = TRUE;    /* Whether all datasets use the native VOL connector */
+    size_t          u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "z*i*i*i*ii**x", count, dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
+
+    /* Check arguments */
+    if (count == 0)
+        HGOTO_DONE(SUCCEED)
+    if (!dset_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dset_id array not provided")
+    if (!mem_type_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_type_id array not provided")
+    if (!mem_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "mem_space_id array not provided")
+    if (!file_space_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file_space_id array not provided")
+    if (!buf)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf array not provided")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Get dataset pointers */
+    if (NULL == (vol_obj = (H5VL_object_t **)H5MM_malloc(count * sizeof(H5VL_object_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate dataset object array")
+    for (u = 0; u < count; u++) {
+        if (mem_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid memory dataspace ID")
+        if (file_space_id[u] < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file dataspace ID")
+        if (NULL == (vol_obj[u] = (H5VL_object_t *)H5I_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dset_id is not a dataset ID")
+        if (vol_obj[u]->connector->cls->value != H5_VOL_NATIVE)
+            is_native = FALSE;
+    } /* end for */
+
+    if (is_native) {
+        /* Let the native VOL connector write all the datasets at once */
+        if (H5VL_dataset_optional(vol_obj[0], H5VL_NATIVE_DATASET_WRITE_MULTI, dxpl_id, H5_REQUEST_NULL, count,
+                                  dset_id, mem_type_id, mem_space_id, file_space_id, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+    } /* end if */
+    else
+        /* Write each dataset in turn */
+        for (u = 0; u < count; u++)
+            if (H5VL_dataset_write(vol_obj[u], mem_type_id[u], mem_space_id[u], file_space_id[u], dxpl_id,
+                                  buf[u], H5_REQUEST_NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+done:
+    H5MM_xfree(vol_obj);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dwrite_chunk
  *
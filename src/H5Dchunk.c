@@ -76,6 +76,7 @@
     HDassert((H5D_CHUNK_IDX_EARRAY == (storage)->idx_type && H5D_COPS_EARRAY == (storage)->ops) ||           \
              (H5D_CHUNK_IDX_FARRAY == (storage)->idx_type && H5D_COPS_FARRAY == (storage)->ops) ||           \
              (H5D_CHUNK_IDX_BT2 == (storage)->idx_type && H5D_COPS_BT2 == (storage)->ops) ||                 \
+             (H5D_CHUNK_IDX_SHARD == (storage)->idx_type && H5D_COPS_SHARD == (storage)->ops) ||             \
              (H5D_CHUNK_IDX_BTREE == (storage)->idx_type && H5D_COPS_BTREE == (storage)->ops) ||             \
              (H5D_CHUNK_IDX_SINGLE == (storage)->idx_type && H5D_COPS_SINGLE == (storage)->ops) ||           \
              (H5D_CHUNK_IDX_NONE == (storage)->idx_type && H5D_COPS_NONE == (storage)->ops));
@@ -106,6 +107,45 @@
 
 /*#define H5D_CHUNK_DEBUG */
 
+/* Run the filter pipeline on several chunks at once in separate threads.
+ * (Needs per-thread error stacks, and the memory allocation sanity checks
+ *  keep a global list of blocks)
+ */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_MEMORY_ALLOC_SANITY_CHECK)
+#define H5D_CHUNK_FILTER_THREADS
+#endif /* defined(H5_HAVE_THREADSAFE) && !defined(H5_MEMORY_ALLOC_SANITY_CHECK) */
+
+/* Limits on the chunks gathered into one batch for the filter pipeline:
+ * # of chunks per filter thread, and total # of bytes of (unfiltered) chunks
+ */
+#define H5D_CHUNK_FILTER_BATCH_PER_THREAD 4
+#define H5D_CHUNK_FILTER_BATCH_NBYTES     (64 * 1024 * 1024)
+
+/* Initial # of hash buckets in a file's chunk index cache, as a power of two */
+#define H5D_CHUNK_IDX_CACHE_INIT_BITS 6
+
+/* Hash a chunk index cache key: the index address, then each scaled
+ * coordinate, mixed in with the Fibonacci hashing multiplier.  The top
+ * 'bits' bits of the hash select the bucket.
+ */
+#define H5D_CHUNK_IDX_CACHE_HASH_MULT       ((uint64_t)0x9E3779B97F4A7C15ULL)
+#define H5D_CHUNK_IDX_CACHE_BUCKET(h, bits) ((size_t)((h) >> (64 - (bits))))
+
+/* # of slots a chunk may be cached in, when the file's chunk cache is shared
+ * by its datasets (otherwise each chunk has one slot)
+ */
+#define H5D_CHUNK_CACHE_NWAYS 8
+
+/* Batched direct chunk reads find the chunks with one scan over the chunk
+ * index when at least 1/H5D_CHUNK_READ_MULTI_SCAN_RATIO of the dataset's
+ * chunks are requested, and look them up one at a time otherwise
+ */
+#define H5D_CHUNK_READ_MULTI_SCAN_RATIO 8
+
+/* Maximum # of bytes of chunks a dataset's chunk cache can hold */
+#define H5D_RDCC_NBYTES_MAX(rdcc)                                                                            \
+    ((rdcc)->shared_cache ? (rdcc)->shared_cache->nbytes_max : (rdcc)->nbytes_max)
+
 /* Flags for the "edge_chunk_state" field below */
 #define H5D_RDCC_DISABLE_FILTERS 0x01u /* Disable filters on this chunk */
 #define H5D_RDCC_NEWLY_DISABLED_FILTERS                                                                      \
@@ -133,9 +173,15 @@ typedef struct H5D_rdcc_ent_t {
     struct H5D_rdcc_ent_t *prev;                     /*previous item in doubly-linked list    */
     struct H5D_rdcc_ent_t *tmp_next;                 /*next item in temporary doubly-linked list */
     struct H5D_rdcc_ent_t *tmp_prev;                 /*previous item in temporary doubly-linked list */
+    H5D_shared_t *         owner;                    /*dataset the chunk belongs to (shared cache) */
+    uint64_t               stamp;                    /*time of last access (shared cache) */
+    struct H5D_rdcc_ent_t *shared_next;              /*next (less recently used) item in shared cache */
+    struct H5D_rdcc_ent_t *shared_prev;              /*previous item in shared cache */
 } H5D_rdcc_ent_t;
 typedef H5D_rdcc_ent_t *H5D_rdcc_ent_ptr_t; /* For free lists */
 
+typedef H5D_chunk_idx_cache_ent_t *H5D_chunk_idx_cache_ent_ptr_t; /* For free lists */
+
 /* Callback info for iteration to prune chunks */
 typedef struct H5D_chunk_it_ud1_t {
     H5D_chunk_common_ud_t     common;          /* Common info for B-tree user data (must be first) */
@@ -237,6 +283,75 @@ typedef struct H5D_chunk_file_iter_ud_t {
 #endif                            /* H5_HAVE_PARALLEL */
 } H5D_chunk_file_iter_ud_t;
 
+/* A chunk to run through the filter pipeline, possibly in another thread */
+typedef struct H5D_chunk_filter_job_t {
+    void *   buf;         /* Chunk buffer (NULL if nothing to do) */
+    size_t   nbytes;      /* # of valid bytes in buffer */
+    size_t   buf_alloc;   /* # of bytes allocated for buffer */
+    unsigned filter_mask; /* Filter mask for the chunk */
+    herr_t   status;      /* Whether the pipeline succeeded */
+} H5D_chunk_filter_job_t;
+
+/* Callback info for running a set of filter jobs */
+typedef struct H5D_chunk_filter_ud_t {
+    const H5O_pline_t *     pline;      /* I/O pipeline */
+    unsigned                flags;      /* Flags for H5Z_pipeline */
+    H5Z_EDC_t               err_detect; /* Error detection setting */
+    H5D_chunk_filter_job_t *jobs;       /* Jobs to run */
+} H5D_chunk_filter_ud_t;
+
+/* Chunks read from the file and filtered ahead of use in H5D__chunk_read() */
+typedef struct H5D_chunk_read_batch_t {
+    size_t                  nalloc;     /* # of chunks the batch can hold */
+    size_t                  nused;      /* # of chunks in the batch */
+    size_t                  next;       /* Index of next chunk to use */
+    H5SL_node_t *           scan_end;   /* Skip list node after the last one examined */
+    H5D_chunk_info_t **     chunk_info; /* Chunk information for each chunk */
+    H5D_chunk_ud_t *        udata;      /* Index information for each chunk */
+    H5D_chunk_filter_job_t *jobs;       /* Filter jobs for each chunk */
+} H5D_chunk_read_batch_t;
+
+/* A chunk read ahead of a scan in order in H5D__chunk_read() */
+typedef struct H5D_chunk_prefetch_ent_t {
+    hsize_t        scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of the chunk */
+    H5D_chunk_ud_t udata;                    /* Index information for the chunk */
+    hbool_t        current;                  /* Whether this is the chunk being read */
+} H5D_chunk_prefetch_ent_t;
+
+/* Chunks read ahead of a scan in order in H5D__chunk_read() */
+typedef struct H5D_chunk_prefetch_t {
+    size_t                    nused; /* # of chunks read */
+    H5D_chunk_prefetch_ent_t *ents;  /* Chunks read, in order of address */
+    H5D_chunk_filter_job_t *  jobs;  /* Buffer (& filter job) for each chunk */
+} H5D_chunk_prefetch_t;
+
+/* An uncached chunk read along with others in H5D__chunk_read() */
+typedef struct H5D_chunk_coalesce_ent_t {
+    H5D_chunk_info_t *chunk_info; /* Chunk information */
+    haddr_t           addr;       /* Address of the chunk in the file */
+    size_t            size;       /* Size of the chunk in the file */
+    size_t            pos;        /* Position of the chunk in the selection */
+} H5D_chunk_coalesce_ent_t;
+
+/* A chunk read by H5D__chunk_direct_read_multi() */
+typedef struct H5D_chunk_read_multi_ent_t {
+    hsize_t  scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of the chunk */
+    hsize_t  chunk_idx;                /* Linear index of the chunk in the dataset */
+    haddr_t  addr;                     /* Address of the chunk in the file */
+    hsize_t  nbytes;                   /* Size of the chunk in the file */
+    uint32_t filter_mask;              /* Excluded filters */
+    size_t   pos;                      /* Position of the chunk in the request */
+} H5D_chunk_read_multi_ent_t;
+
+/* Callback info for iteration to find the chunks of a batched direct read */
+typedef struct H5D_chunk_read_multi_ud_t {
+    const H5O_layout_chunk_t *  layout; /* Chunk layout */
+    unsigned                    ndims;  /* # of dimensions of the dataset */
+    H5D_chunk_read_multi_ent_t *ents;   /* Chunks, in order of linear index */
+    size_t                      nents;  /* # of chunks */
+    size_t                      nleft;  /* # of chunks not found yet */
+} H5D_chunk_read_multi_ud_t;
+
 #ifdef H5_HAVE_PARALLEL
 /* information to construct a collective I/O operation for filling chunks */
 typedef struct H5D_chunk_coll_info_t {
@@ -299,15 +414,46 @@ static herr_t   H5D__chunk_file_cb(void *elem, const H5T_t *type, unsigned ndims
 static herr_t   H5D__chunk_mem_cb(void *elem, const H5T_t *type, unsigned ndims, const hsize_t *coords,
                                   void *fm);
 static unsigned H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled);
-static herr_t   H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset);
+static unsigned H5D__chunk_cache_find_slot(const H5D_shared_t *shared, const hsize_t *scaled,
+                                           hbool_t *found);
+static herr_t   H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset,
+                                       H5D_chunk_filter_job_t *job);
+static herr_t   H5D__chunk_flush_entries(const H5D_t *dset, H5D_rdcc_ent_t **ents, size_t nents,
+                                         hbool_t reset);
+static size_t   H5D__chunk_filter_batch_size(const H5D_t *dset);
+static void     H5D__chunk_filter_job_cb(size_t job_idx, void *_udata);
+static herr_t   H5D__chunk_filter_jobs(const H5D_t *dset, unsigned flags, H5D_chunk_filter_job_t *jobs,
+                                       size_t njobs);
+static herr_t   H5D__chunk_read_batch_fill(const H5D_io_info_t *io_info, const H5D_chunk_map_t *fm,
+                                           H5SL_node_t *chunk_node, H5D_chunk_read_batch_t *batch);
+static herr_t   H5D__chunk_read_batch_free(const H5D_t *dset, H5D_chunk_read_batch_t *batch);
+static herr_t   H5D__chunk_prefetch(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
+                                    H5D_chunk_prefetch_t *prefetch, void **chunk);
+static int      H5D__chunk_prefetch_cmp_addr(const void *_ent1, const void *_ent2);
+static herr_t   H5D__chunk_prefetch_insert(const H5D_io_info_t *io_info, H5D_chunk_prefetch_t *prefetch);
+static herr_t   H5D__chunk_prefetch_free(const H5D_t *dset, H5D_chunk_prefetch_t *prefetch);
+static herr_t   H5D__chunk_read_coalesced(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                                          const H5D_chunk_map_t *fm, H5D_io_info_t *cpt_io_info,
+                                          hbool_t **done);
+static int      H5D__chunk_coalesce_cmp_addr(const void *_ent1, const void *_ent2);
+static int      H5D__chunk_read_multi_cmp_idx(const void *_ent1, const void *_ent2);
+static int      H5D__chunk_read_multi_cmp_addr(const void *_ent1, const void *_ent2);
+static size_t   H5D__chunk_read_multi_find(const H5D_chunk_read_multi_ent_t *ents, size_t nents,
+                                           hsize_t chunk_idx);
+static int      H5D__chunk_read_multi_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
 static herr_t   H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush);
 static hbool_t  H5D__chunk_is_partial_edge_chunk(unsigned dset_ndims, const uint32_t *chunk_dims,
                                                  const hsize_t *chunk_scaled, const hsize_t *dset_dims);
 static void *   H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t relax,
-                                hbool_t prev_unfilt_chunk);
+                                hbool_t prev_unfilt_chunk, void *filtered_chunk);
+static void     H5D__chunk_fake_ent_init(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
+                                         void *chunk, H5D_rdcc_ent_t *fake_ent);
 static herr_t   H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, hbool_t dirty,
                                   void *chunk, uint32_t naccessed);
 static herr_t   H5D__chunk_cache_prune(const H5D_t *dset, size_t size);
+static herr_t   H5D__chunk_shared_cache_prune(const H5D_t *dset, size_t size);
+static void     H5D__chunk_shared_cache_touch(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent);
+static void     H5D__chunk_shared_cache_remove(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent);
 static herr_t   H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk);
 #ifdef H5_HAVE_PARALLEL
 static herr_t H5D__chunk_collective_fill(const H5D_t *dset, H5D_chunk_coll_info_t *chunk_info,
@@ -315,6 +461,19 @@ static herr_t H5D__chunk_collective_fill(const H5D_t *dset, H5D_chunk_coll_info_
 static int    H5D__chunk_cmp_addr(const void *addr1, const void *addr2);
 #endif /* H5_HAVE_PARALLEL */
 
+/* Chunk index cache routines */
+static hbool_t  H5D__chunk_idx_cache_enabled(const H5F_t *f, const H5O_storage_chunk_t *sc);
+static uint64_t H5D__chunk_idx_cache_hash(const H5D_chunk_common_ud_t *common);
+static H5D_chunk_idx_cache_ent_t *H5D__chunk_idx_cache_lookup(H5D_chunk_idx_cache_t *      cache,
+                                                              const H5D_chunk_common_ud_t *common,
+                                                              uint64_t                     hash);
+static void    H5D__chunk_idx_cache_remove(H5D_chunk_idx_cache_t *cache, H5D_chunk_idx_cache_ent_t *ent);
+static hbool_t H5D__chunk_idx_cache_found(const H5F_t *f, H5D_chunk_ud_t *udata);
+static herr_t  H5D__chunk_idx_cache_add(H5F_t *f, const H5D_chunk_ud_t *udata);
+static void    H5D__chunk_idx_cache_update(const H5F_t *f, const H5D_chunk_ud_t *udata);
+static void    H5D__chunk_idx_cache_evict(const H5F_t *f, haddr_t idx_addr,
+                                          const H5D_chunk_common_ud_t *common);
+
 /* Debugging helper routine callback */
 static int H5D__chunk_dump_index_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
 
@@ -357,6 +516,17 @@ H5FL_BLK_DEFINE_STATIC(chunk);
 /* Declare extern free list to manage the H5S_sel_iter_t struct */
 H5FL_EXTERN(H5S_sel_iter_t);
 
+/* Declare a free list to manage the H5D_shared_chunk_cache_t struct */
+H5FL_DEFINE_STATIC(H5D_shared_chunk_cache_t);
+
+/* Declare free lists to manage the chunk index cache and its entries */
+H5FL_DEFINE_STATIC(H5D_chunk_idx_cache_t);
+H5FL_DEFINE_STATIC(H5D_chunk_idx_cache_ent_t);
+H5FL_SEQ_DEFINE_STATIC(H5D_chunk_idx_cache_ent_ptr_t);
+
+/* Declare extern free list to manage sequences of hsize_t */
+H5FL_SEQ_EXTERN(hsize_t);
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_direct_write
  *
@@ -467,6 +637,7 @@ H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset, ui
 
         if ((layout->storage.u.chunk.ops->insert)(&idx_info, &udata, dset) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+        H5D__chunk_idx_cache_update(idx_info.f, &udata);
     } /* end if */
 
 done:
@@ -568,6 +739,335 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__chunk_direct_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_read_multi_cmp_idx
+ *
+ * Purpose:    Compares the linear indices of two chunks of a batched
+ *        direct read, for qsort().
+ *
+ * Return:    -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_read_multi_cmp_idx(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_read_multi_ent_t *ent1      = (const H5D_chunk_read_multi_ent_t *)_ent1;
+    const H5D_chunk_read_multi_ent_t *ent2      = (const H5D_chunk_read_multi_ent_t *)_ent2;
+    int                               ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (ent1->chunk_idx < ent2->chunk_idx)
+        ret_value = -1;
+    else if (ent1->chunk_idx > ent2->chunk_idx)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_read_multi_cmp_idx() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_read_multi_cmp_addr
+ *
+ * Purpose:    Compares the file addresses of two chunks of a batched
+ *        direct read, given pointers to them, for qsort().
+ *
+ * Return:    -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_read_multi_cmp_addr(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_read_multi_ent_t *ent1 = *(const H5D_chunk_read_multi_ent_t *const *)_ent1;
+    const H5D_chunk_read_multi_ent_t *ent2 = *(const H5D_chunk_read_multi_ent_t *const *)_ent2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(ent1->addr, ent2->addr))
+} /* end H5D__chunk_read_multi_cmp_addr() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_read_multi_find
+ *
+ * Purpose:    Finds the first of the chunks ENTS, sorted by linear index,
+ *        with the linear index CHUNK_IDX.
+ *
+ * Return:    Position of the chunk in ENTS, or NENTS if it isn't there
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5D__chunk_read_multi_find(const H5D_chunk_read_multi_ent_t *ents, size_t nents, hsize_t chunk_idx)
+{
+    size_t lo = 0;     /* Low bound of the search */
+    size_t hi = nents; /* High bound of the search */
+    size_t ret_value;  /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (ents[mid].chunk_idx < chunk_idx)
+            lo = mid + 1;
+        else
+            hi = mid;
+    } /* end while */
+
+    ret_value = (lo < nents && ents[lo].chunk_idx == chunk_idx) ? lo : nents;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_read_multi_find() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_read_multi_cb
+ *
+ * Purpose:    Chunk index iteration callback for batched direct reads:
+ *        records the location of a chunk in the file if it's one of
+ *        the chunks requested.  Stops when they've all been found.
+ *
+ * Return:    H5_ITER_CONT or H5_ITER_STOP
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_read_multi_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
+{
+    H5D_chunk_read_multi_ud_t *udata = (H5D_chunk_read_multi_ud_t *)_udata; /* User data */
+    hsize_t                    chunk_idx;                                    /* Linear index of chunk */
+    unsigned                   u;                                            /* Local index variable */
+    size_t                     v;                                            /* Local index variable */
+    int                        ret_value = H5_ITER_CONT;                     /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Skip chunks outside the dataset's current extent */
+    for (u = 0; u < udata->ndims; u++)
+        if (chunk_rec->scaled[u] >= udata->layout->chunks[u])
+            HGOTO_DONE(H5_ITER_CONT)
+
+    /* Record the chunk's location for each request for it */
+    chunk_idx = H5VM_array_offset_pre(udata->ndims, udata->layout->down_chunks, chunk_rec->scaled);
+    for (v = H5D__chunk_read_multi_find(udata->ents, udata->nents, chunk_idx);
+         v < udata->nents && udata->ents[v].chunk_idx == chunk_idx; v++) {
+        udata->ents[v].addr        = chunk_rec->chunk_addr;
+        udata->ents[v].nbytes      = chunk_rec->nbytes;
+        udata->ents[v].filter_mask = chunk_rec->filter_mask;
+        udata->nleft--;
+    } /* end for */
+
+    if (0 == udata->nleft)
+        ret_value = H5_ITER_STOP;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_read_multi_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_read_multi
+ *
+ * Purpose:     Internal routine to read several chunks directly from the
+ *              file.  The chunks are located together and read with one
+ *              vector read, in order of address, into BUF, one after the
+ *              other.  Returns the filter mask, size and position in BUF
+ *              of each chunk; with a NULL BUF, nothing else is done.
+ *
+ *              Dirty chunks in the chunk cache are written to the file
+ *              first, but stay in the cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_direct_read_multi(const H5D_t *dset, size_t count, const hsize_t *offsets, uint32_t *filters,
+                             hsize_t *sizes, hsize_t *buf_offsets, size_t buf_size, void *buf)
+{
+    const H5O_layout_t *         layout    = &(dset->shared->layout);      /* Dataset layout */
+    const H5D_rdcc_t *           rdcc      = &(dset->shared->cache.chunk); /* raw data chunk cache */
+    unsigned                     ndims     = dset->shared->ndims;          /* # of dataset dimensions */
+    H5D_chunk_read_multi_ent_t * ents      = NULL;    /* Chunks requested, in order of linear index */
+    H5D_chunk_read_multi_ent_t **found     = NULL;    /* Chunks in the file, in order of address */
+    H5D_rdcc_ent_t *             rdcc_ent;            /* Chunk cache entry */
+    H5FD_mem_t *                 types     = NULL;    /* Memory types of chunks */
+    haddr_t *                    addrs     = NULL;    /* File addresses of chunks */
+    size_t *                     io_sizes  = NULL;    /* Sizes of chunks in the file */
+    void **                      bufs      = NULL;    /* Buffers for chunks */
+    size_t                       nvalid    = 0;       /* # of chunks within the dataset's extent */
+    size_t                       nfound    = 0;       /* # of chunks in the file */
+    hsize_t                      total     = 0;       /* Total size of the chunks in the file */
+    size_t                       u;                   /* Local index variable */
+    herr_t                       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Check args */
+    HDassert(dset && H5D_CHUNKED == layout->type);
+    HDassert(offsets);
+    HDassert(filters);
+    HDassert(sizes);
+    HDassert(buf_offsets);
+
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    if (NULL ==
+        (ents = (H5D_chunk_read_multi_ent_t *)H5MM_malloc(count * sizeof(H5D_chunk_read_multi_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk list")
+
+    /* Check the offsets and calculate the index of each chunk */
+    for (u = 0; u < count; u++) {
+        H5D_chunk_read_multi_ent_t *ent = &ents[u];
+        hsize_t                     offset_copy[H5O_LAYOUT_NDIMS]; /* Terminated copy of chunk offset */
+        unsigned                    v;                              /* Local index variable */
+
+        if (H5D__get_offset_copy(dset, offsets + u * ndims, offset_copy) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "invalid chunk offset")
+
+        H5VM_chunk_scaled(ndims, offset_copy, layout->u.chunk.dim, ent->scaled);
+        ent->scaled[ndims] = 0;
+        ent->addr          = HADDR_UNDEF;
+        ent->nbytes        = 0;
+        ent->filter_mask   = 0;
+        ent->pos           = u;
+
+        /* An offset at the end of a dimension names a chunk that can't exist */
+        ent->chunk_idx = H5VM_array_offset_pre(ndims, layout->u.chunk.down_chunks, ent->scaled);
+        for (v = 0; v < ndims; v++)
+            if (ent->scaled[v] >= layout->u.chunk.chunks[v]) {
+                ent->chunk_idx = HSIZE_UNDEF;
+                break;
+            } /* end if */
+        if (HSIZE_UNDEF != ent->chunk_idx)
+            nvalid++;
+    } /* end for */
+
+    /* Sort the chunks by index, to match them against the cache & index */
+    HDqsort(ents, count, sizeof(H5D_chunk_read_multi_ent_t), H5D__chunk_read_multi_cmp_idx);
+
+    /* Write out requested chunks that are dirty in the chunk cache, leaving
+     * them cached
+     */
+    for (rdcc_ent = rdcc->head; rdcc_ent; rdcc_ent = rdcc_ent->next)
+        if (rdcc_ent->dirty &&
+            H5D__chunk_read_multi_find(
+                ents, nvalid, H5VM_array_offset_pre(ndims, layout->u.chunk.down_chunks, rdcc_ent->scaled)) <
+                nvalid)
+            if (H5D__chunk_flush_entry(dset, rdcc_ent, FALSE, NULL) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
+
+    /* Find the chunks in the file */
+    if (nvalid > 0 && H5D__chunk_is_space_alloc(&layout->storage)) {
+        if ((hsize_t)nvalid >= layout->u.chunk.nchunks / H5D_CHUNK_READ_MULTI_SCAN_RATIO) {
+            H5D_chk_idx_info_t        idx_info; /* Chunked index info */
+            H5D_chunk_read_multi_ud_t udata;    /* User data for iteration callback */
+
+            /* Compose chunked index info struct */
+            idx_info.f       = dset->oloc.file;
+            idx_info.pline   = &dset->shared->dcpl_cache.pline;
+            idx_info.layout  = &dset->shared->layout.u.chunk;
+            idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+            /* Set up user data for iteration callback */
+            udata.layout = &layout->u.chunk;
+            udata.ndims  = ndims;
+            udata.ents   = ents;
+            udata.nents  = nvalid;
+            udata.nleft  = nvalid;
+
+            /* Scan the chunk index once for all of the chunks */
+            if ((layout->storage.u.chunk.ops->iterate)(&idx_info, H5D__chunk_read_multi_cb, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "unable to iterate over chunk index")
+        } /* end if */
+        else
+            /* Look the chunks up one at a time */
+            for (u = 0; u < nvalid; u++) {
+                if (u > 0 && ents[u].chunk_idx == ents[u - 1].chunk_idx) {
+                    ents[u].addr        = ents[u - 1].addr;
+                    ents[u].nbytes      = ents[u - 1].nbytes;
+                    ents[u].filter_mask = ents[u - 1].filter_mask;
+                } /* end if */
+                else {
+                    H5D_chunk_ud_t udata; /* User data for querying chunk info */
+
+                    /* Reset fields about the chunk we are looking for */
+                    udata.filter_mask        = 0;
+                    udata.chunk_block.offset = HADDR_UNDEF;
+                    udata.chunk_block.length = 0;
+                    udata.idx_hint           = UINT_MAX;
+
+                    if (H5D__chunk_lookup(dset, ents[u].scaled, &udata) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+                    ents[u].addr        = udata.chunk_block.offset;
+                    ents[u].nbytes      = udata.chunk_block.length;
+                    ents[u].filter_mask = udata.filter_mask;
+                } /* end else */
+            }     /* end for */
+    }             /* end if */
+
+    /* Put the chunks in the file in order of address */
+    if (NULL == (found = (H5D_chunk_read_multi_ent_t **)H5MM_malloc(
+                     count * sizeof(H5D_chunk_read_multi_ent_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk list")
+    for (u = 0; u < nvalid; u++)
+        if (H5F_addr_defined(ents[u].addr) && ents[u].nbytes > 0)
+            found[nfound++] = &ents[u];
+    if (nfound > 1)
+        HDqsort(found, nfound, sizeof(H5D_chunk_read_multi_ent_t *), H5D__chunk_read_multi_cmp_addr);
+
+    /* Return each chunk's filter mask & size, and its position in the buffer */
+    for (u = 0; u < count; u++) {
+        filters[ents[u].pos]     = ents[u].filter_mask;
+        sizes[ents[u].pos]       = ents[u].nbytes;
+        buf_offsets[ents[u].pos] = 0;
+    } /* end for */
+    for (u = 0; u < nfound; u++) {
+        buf_offsets[found[u]->pos] = total;
+        total += found[u]->nbytes;
+    } /* end for */
+
+    /* Read the chunks into the buffer */
+    if (buf && nfound > 0) {
+        if (total > (hsize_t)buf_size)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buffer too small for chunks")
+        if (nfound > UINT32_MAX)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "too many chunks to read at once")
+
+        /* Allocate the I/O vector */
+        if (NULL == (types = (H5FD_mem_t *)H5MM_malloc(nfound * sizeof(H5FD_mem_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O vector")
+        if (NULL == (addrs = (haddr_t *)H5MM_malloc(nfound * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O vector")
+        if (NULL == (io_sizes = (size_t *)H5MM_malloc(nfound * sizeof(size_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O vector")
+        if (NULL == (bufs = (void **)H5MM_malloc(nfound * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O vector")
+
+        for (u = 0; u < nfound; u++) {
+            types[u] = H5FD_MEM_DRAW;
+            addrs[u] = found[u]->addr;
+            H5_CHECKED_ASSIGN(io_sizes[u], size_t, found[u]->nbytes, hsize_t);
+            bufs[u] = (uint8_t *)buf + buf_offsets[found[u]->pos];
+        } /* end for */
+
+        if (H5F_shared_vector_read(H5F_SHARED(dset->oloc.file), (uint32_t)nfound, types, addrs, io_sizes,
+                                   bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+    } /* end if */
+
+done:
+    H5MM_xfree(ents);
+    H5MM_xfree(found);
+    H5MM_xfree(types);
+    H5MM_xfree(addrs);
+    H5MM_xfree(io_sizes);
+    H5MM_xfree(bufs);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_direct_read_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__get_chunk_storage_size
  *
@@ -932,6 +1432,22 @@ H5D__chunk_init(H5F_t *f, const H5D_t *const dset, hid_t dapl_id)
     if (rdcc->w0 < 0)
         rdcc->w0 = H5F_RDCC_W0(f);
 
+    if (H5P_get(dapl, H5D_ACS_FILTER_NTHREADS_NAME, &rdcc->filter_nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get number of chunk filter threads")
+
+    /* Get the read-ahead settings */
+    if (H5P_get(dapl, H5D_ACS_PREFETCH_NCHUNKS_NAME, &rdcc->prefetch.nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get number of chunks to read ahead")
+    if (H5P_get(dapl, H5D_ACS_PREFETCH_ALWAYS_NAME, &rdcc->prefetch.always) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get whether to always read ahead")
+    rdcc->prefetch.next = 0; /* Reads from the first chunk are in order */
+
+    /* Get the settings for reading uncached chunks together */
+    if (H5P_get(dapl, H5D_ACS_COALESCE_SIZE_NAME, &rdcc->coalesce.max_size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get largest read of several chunks")
+    if (H5P_get(dapl, H5D_ACS_COALESCE_GAP_NAME, &rdcc->coalesce.max_gap) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get largest gap between chunks read together")
+
     /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
     if (!rdcc->nbytes_max || !rdcc->nslots)
         rdcc->nbytes_max = rdcc->nslots = 0;
@@ -944,6 +1460,27 @@ H5D__chunk_init(H5F_t *f, const H5D_t *const dset, hid_t dapl_id)
         H5D__chunk_cinfo_cache_reset(&(rdcc->last));
     } /* end else */
 
+    /* Use the file's shared chunk cache, if it has one (not with MPI
+     * drivers, where the processes' caches must agree)
+     */
+    rdcc->nways = 1;
+    if (rdcc->nslots > 0 && H5F_SHARED_CHUNK_CACHE_NBYTES(f) > 0 && !H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI)) {
+        if (NULL == (rdcc->shared_cache = H5F_SHARED_CHUNK_CACHE(f))) {
+            if (NULL == (rdcc->shared_cache = H5FL_CALLOC(H5D_shared_chunk_cache_t)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate shared chunk cache")
+            rdcc->shared_cache->nbytes_max = H5F_SHARED_CHUNK_CACHE_NBYTES(f);
+            if (H5F_SET_SHARED_CHUNK_CACHE(f, rdcc->shared_cache) < 0) {
+                rdcc->shared_cache = H5FL_FREE(H5D_shared_chunk_cache_t, rdcc->shared_cache);
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set shared chunk cache")
+            } /* end if */
+        }     /* end if */
+
+        /* Let each chunk go in any of a set of slots, so that chunks whose
+         * hash values collide don't keep evicting each other */
+        rdcc->nways   = (unsigned)MIN(H5D_CHUNK_CACHE_NWAYS, rdcc->nslots);
+        rdcc->oh_addr = dset->oloc.addr;
+    } /* end if */
+
     /* Compute scaled dimension info, if dataset dims > 1 */
     if (dset->shared->ndims > 1) {
         unsigned u; /* Local index value */
@@ -2402,7 +2939,8 @@ H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr, hbool_t write_
              * cache, just write the data to it directly.
              */
             H5_CHECK_OVERFLOW(dataset->shared->layout.u.chunk.size, uint32_t, size_t);
-            if ((size_t)dataset->shared->layout.u.chunk.size > dataset->shared->cache.chunk.nbytes_max) {
+            if ((size_t)dataset->shared->layout.u.chunk.size >
+                H5D_RDCC_NBYTES_MAX(&dataset->shared->cache.chunk)) {
                 if (write_op && !H5F_addr_defined(caddr)) {
                     const H5O_fill_t *fill = &(dataset->shared->dcpl_cache.fill); /* Fill value info */
                     H5D_fill_value_t  fill_status;                                /* Fill value status */
@@ -2436,119 +2974,824 @@ done:
 } /* end H5D__chunk_cacheable() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__chunk_read
+ * Function:    H5D__chunk_read_batch_fill
  *
- * Purpose:    Read from a chunked dataset.
+ * Purpose:    Starting at CHUNK_NODE, gathers the next chunks to be read
+ *        that exist in the file but aren't in the chunk cache, reads
+ *        them from the file together and runs the filter pipeline on
+ *        them (see H5D__chunk_filter_jobs()).
  *
  * Return:    Non-negative on success/Negative on failure
  *
- * Programmer:    Raymond Lu
- *        Thursday, April 10, 2003
- *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t H5_ATTR_UNUSED nelmts,
-                const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
-                H5D_chunk_map_t *fm)
+H5D__chunk_read_batch_fill(const H5D_io_info_t *io_info, const H5D_chunk_map_t *fm, H5SL_node_t *chunk_node,
+                           H5D_chunk_read_batch_t *batch)
 {
-    H5SL_node_t * chunk_node;                    /* Current node in chunk skip list */
-    H5D_io_info_t nonexistent_io_info;           /* "nonexistent" I/O info object */
-    H5D_io_info_t ctg_io_info;                   /* Contiguous I/O info object */
-    H5D_storage_t ctg_store;                     /* Chunk storage information as contiguous dataset */
-    H5D_io_info_t cpt_io_info;                   /* Compact I/O info object */
-    H5D_storage_t cpt_store;                     /* Chunk storage information as compact dataset */
-    hbool_t       cpt_dirty;                     /* Temporary placeholder for compact storage "dirty" flag */
-    uint32_t      src_accessed_bytes  = 0;       /* Total accessed size in a chunk */
-    hbool_t       skip_missing_chunks = FALSE;   /* Whether to skip missing chunks */
-    herr_t        ret_value           = SUCCEED; /*return value        */
+    const H5D_t *       dset   = io_info->dset;                       /* Dataset */
+    const H5O_pline_t * pline  = &(dset->shared->dcpl_cache.pline);   /* I/O pipeline info */
+    const H5O_layout_t *layout = &(dset->shared->layout);             /* Dataset layout */
+    H5FD_mem_t *        types  = NULL;                                /* Memory types of chunks */
+    haddr_t *           addrs  = NULL;                                /* File addresses of chunks */
+    size_t *            sizes  = NULL;                                /* Sizes of chunks in the file */
+    void **             bufs   = NULL;                                /* Buffers for chunks */
+    size_t              u;                                            /* Local index variable */
+    herr_t              ret_value = SUCCEED;                          /* Return value */
 
     FUNC_ENTER_STATIC
 
     /* Sanity check */
-    HDassert(io_info);
-    HDassert(io_info->u.rbuf);
-    HDassert(type_info);
     HDassert(fm);
+    HDassert(batch);
+    HDassert(batch->next == batch->nused);
 
-    /* Set up "nonexistent" I/O info object */
-    H5MM_memcpy(&nonexistent_io_info, io_info, sizeof(nonexistent_io_info));
-    nonexistent_io_info.layout_ops = *H5D_LOPS_NONEXISTENT;
-
-    /* Set up contiguous I/O info object */
-    H5MM_memcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
-    ctg_io_info.store      = &ctg_store;
-    ctg_io_info.layout_ops = *H5D_LOPS_CONTIG;
+    /* Gather the chunks */
+    batch->nused = 0;
+    batch->next  = 0;
+    while (chunk_node && batch->nused < batch->nalloc) {
+        H5D_chunk_info_t *chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node); /* Chunk information */
+        H5D_chunk_ud_t *  udata      = &(batch->udata[batch->nused]);           /* Chunk index info */
 
-    /* Initialize temporary contiguous storage info */
-    H5_CHECKED_ASSIGN(ctg_store.contig.dset_size, hsize_t, io_info->dset->shared->layout.u.chunk.size,
-                      uint32_t);
+        /* Get the info for the chunk in the file */
+        if (H5D__chunk_lookup(dset, chunk_info->scaled, udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
 
-    /* Set up compact I/O info object */
-    H5MM_memcpy(&cpt_io_info, io_info, sizeof(cpt_io_info));
-    cpt_io_info.store      = &cpt_store;
-    cpt_io_info.layout_ops = *H5D_LOPS_COMPACT;
+        /* Skip chunks that aren't in the file, are cached already, or are
+         * partial edge chunks with filters disabled
+         */
+        if (H5F_addr_defined(udata->chunk_block.offset) && UINT_MAX == udata->idx_hint &&
+            !((layout->u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS) &&
+              H5D__chunk_is_partial_edge_chunk(dset->shared->ndims, layout->u.chunk.dim, chunk_info->scaled,
+                                               dset->shared->curr_dims)))
+            batch->chunk_info[batch->nused++] = chunk_info;
 
-    /* Initialize temporary compact storage info */
-    cpt_store.compact.dirty = &cpt_dirty;
+        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+    } /* end while */
+    batch->scan_end = chunk_node;
+
+    if (batch->nused > 0) {
+        /* Allocate the I/O vector */
+        if (NULL == (types = (H5FD_mem_t *)H5MM_malloc(batch->nused * sizeof(H5FD_mem_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O vector")
+        if (NULL == (addrs = (haddr_t *)H5MM_malloc(batch->nused * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O vector")
+        if (NULL == (sizes = (size_t *)H5MM_malloc(batch->nused * sizeof(size_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O vector")
+        if (NULL == (bufs = (void **)H5MM_malloc(batch->nused * sizeof(void *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O vector")
+
+        /* Set up a filter job & buffer for each chunk */
+        for (u = 0; u < batch->nused; u++) {
+            H5D_chunk_filter_job_t *job = &(batch->jobs[u]); /* Filter job for chunk */
+
+            H5_CHECKED_ASSIGN(job->nbytes, size_t, batch->udata[u].chunk_block.length, hsize_t);
+            job->buf_alloc   = job->nbytes;
+            job->filter_mask = batch->udata[u].filter_mask;
+            job->status      = FAIL;
+
+            /* Chunk size on disk isn't [likely] the same size as the final chunk
+             * size in memory, so allocate memory big enough. */
+            if (NULL == (job->buf = H5D__chunk_mem_alloc(job->nbytes, pline)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+
+            types[u] = H5FD_MEM_DRAW;
+            addrs[u] = batch->udata[u].chunk_block.offset;
+            sizes[u] = job->nbytes;
+            bufs[u]  = job->buf;
+        } /* end for */
 
-    {
-        const H5O_fill_t *fill = &(io_info->dset->shared->dcpl_cache.fill); /* Fill value info */
-        H5D_fill_value_t  fill_status;                                      /* Fill value status */
+        /* Read the chunks */
+        H5_CHECK_OVERFLOW(batch->nused, size_t, uint32_t);
+        if (H5F_shared_vector_read(H5F_SHARED(dset->oloc.file), (uint32_t)batch->nused, types, addrs, sizes,
+                                   bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
 
-        /* Check the fill value status */
-        if (H5P_is_fill_value_defined(fill, &fill_status) < 0)
-            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+        /* Run the filter pipeline on them */
+        if (H5D__chunk_filter_jobs(dset, H5Z_FLAG_REVERSE, batch->jobs, batch->nused) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "data pipeline read failed")
+    } /* end if */
 
-        /* If we are never to return fill values, or if we would return them
-         * but they aren't set, set the flag to skip missing chunks.
-         */
-        if (fill->fill_time == H5D_FILL_TIME_NEVER ||
-            (fill->fill_time == H5D_FILL_TIME_IFSET && fill_status != H5D_FILL_VALUE_USER_DEFINED &&
-             fill_status != H5D_FILL_VALUE_DEFAULT))
-            skip_missing_chunks = TRUE;
-    }
+done:
+    H5MM_xfree(types);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(bufs);
 
-    /* Iterate through nodes in chunk skip list */
-    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
-    while (chunk_node) {
-        H5D_chunk_info_t *chunk_info; /* Chunk information */
-        H5D_chunk_ud_t    udata;      /* Chunk index pass-through    */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_read_batch_fill() */
 
-        /* Get the actual chunk information from the skip list node */
-        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_read_batch_free
+ *
+ * Purpose:    Releases a batch of chunks for H5D__chunk_read(), including
+ *        the buffers for any chunks that weren't used.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_read_batch_free(const H5D_t *dset, H5D_chunk_read_batch_t *batch)
+{
+    size_t u; /* Local index variable */
 
-        /* Get the info for the chunk in the file */
-        if (H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+    FUNC_ENTER_STATIC_NOERR
 
-        /* Sanity check */
-        HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
-                 (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
+    /* Sanity check */
+    HDassert(dset);
+    HDassert(batch);
 
-        /* Check for non-existant chunk & skip it if appropriate */
-        if (H5F_addr_defined(udata.chunk_block.offset) || UINT_MAX != udata.idx_hint ||
-            !skip_missing_chunks) {
-            H5D_io_info_t *chk_io_info;  /* Pointer to I/O info object for this chunk */
-            void *         chunk = NULL; /* Pointer to locked chunk buffer */
-            htri_t         cacheable;    /* Whether the chunk is cacheable */
+    if (batch->jobs)
+        for (u = 0; u < batch->nused; u++)
+            if (batch->jobs[u].buf)
+                batch->jobs[u].buf =
+                    H5D__chunk_mem_xfree(batch->jobs[u].buf, &(dset->shared->dcpl_cache.pline));
 
-            /* Set chunk's [scaled] coordinates */
-            io_info->store->chunk.scaled = chunk_info->scaled;
+    batch->chunk_info = (H5D_chunk_info_t **)H5MM_xfree(batch->chunk_info);
+    batch->udata      = (H5D_chunk_ud_t *)H5MM_xfree(batch->udata);
+    batch->jobs       = (H5D_chunk_filter_job_t *)H5MM_xfree(batch->jobs);
 
-            /* Determine if we should use the chunk cache */
-            if ((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, FALSE)) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
-            if (cacheable) {
-                /* Load the chunk into cache and lock it. */
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__chunk_read_batch_free() */
 
-                /* Compute # of bytes accessed in chunk */
-                H5_CHECK_OVERFLOW(type_info->src_type_size, /*From:*/ size_t, /*To:*/ uint32_t);
-                src_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->src_type_size;
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_prefetch
+ *
+ * Purpose:    Reads ahead of a chunk that's being read from the file and
+ *        isn't in the chunk cache, when the dataset is being read in
+ *        order (or the dataset access property list says to always
+ *        read ahead, see H5Pset_chunk_prefetch()).
+ *
+ *        The chunks that follow the chunk in order of their linear
+ *        index, that are in the file but not in the chunk cache, are
+ *        read together with it: in order of their file addresses, in
+ *        one vector I/O request, so that the file driver can combine
+ *        adjacent chunks into single reads.  They're all run through
+ *        the filter pipeline at once (see H5D__chunk_filter_jobs()), so
+ *        the chunks read ahead are decompressed at the same time as
+ *        the chunk that's needed now when there are several filter
+ *        threads.
+ *
+ *        If *CHUNK is NULL on entry, the chunk being read is returned
+ *        in it, ready to be passed to H5D__chunk_lock(), unless the
+ *        pipeline failed for it.  Otherwise the caller has read the
+ *        chunk already, and only the chunks that follow it are read.
+ *        The chunks read ahead are left in PREFETCH, to be added to
+ *        the cache with H5D__chunk_prefetch_insert().
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_prefetch(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, H5D_chunk_prefetch_t *prefetch,
+                    void **chunk)
+{
+    const H5D_t *       dset   = io_info->dset;                     /* Dataset */
+    const H5O_pline_t * pline  = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info */
+    const H5O_layout_t *layout = &(dset->shared->layout);           /* Dataset layout */
+    H5D_rdcc_t *        rdcc   = &(dset->shared->cache.chunk);      /* Raw data chunk cache */
+    unsigned            ndims  = layout->u.chunk.ndims - 1;         /* # of dataspace dimensions */
+    H5FD_mem_t *        types  = NULL;                              /* Memory types of chunks */
+    haddr_t *           addrs  = NULL;                              /* File addresses of chunks */
+    size_t *            sizes  = NULL;                              /* Sizes of chunks in the file */
+    void **             bufs   = NULL;                              /* Buffers for chunks */
+    hsize_t             chunk_idx;                                  /* Linear index of the chunk */
+    size_t              chunk_size;                                 /* Size of a chunk */
+    size_t              nahead;                                     /* Max. # of chunks to read ahead */
+    size_t              nfirst;                                     /* # of chunks read, not ahead */
+    size_t              u;                                          /* Local index variable */
+    herr_t              ret_value = SUCCEED;                        /* Return value */
 
-                /* Lock the chunk into the cache */
-                if (NULL == (chunk = H5D__chunk_lock(io_info, &udata, FALSE, FALSE)))
-                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(udata);
+    HDassert(H5F_addr_defined(udata->chunk_block.offset));
+    HDassert(UINT_MAX == udata->idx_hint);
+    HDassert(prefetch);
+    HDassert(0 == prefetch->nused);
+    HDassert(chunk);
+
+    /* Chunks aren't read ahead without a chunk cache to put them in, or with
+     * MPI drivers, where the processes' caches must agree.  Partial edge
+     * chunks that aren't filtered are left to H5D__chunk_lock() too.
+     */
+    if (0 == rdcc->prefetch.nchunks || 0 == rdcc->nslots ||
+        H5F_HAS_FEATURE(dset->oloc.file, H5FD_FEAT_HAS_MPI))
+        HGOTO_DONE(SUCCEED)
+    if (pline->nused && (layout->u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS) &&
+        H5D__chunk_is_partial_edge_chunk(dset->shared->ndims, layout->u.chunk.dim, udata->common.scaled,
+                                         dset->shared->curr_dims))
+        HGOTO_DONE(SUCCEED)
+
+    /* Check if the chunk follows the last one read from the file */
+    chunk_idx = H5VM_array_offset_pre(ndims, layout->u.chunk.down_chunks, udata->common.scaled);
+    if (!rdcc->prefetch.always && chunk_idx != rdcc->prefetch.next) {
+        rdcc->prefetch.next = chunk_idx + 1;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Read ahead no further than the end of the dataset, and no more than
+     * would fill half the cache
+     */
+    H5_CHECKED_ASSIGN(chunk_size, size_t, layout->u.chunk.size, uint32_t);
+    nahead = MIN(rdcc->prefetch.nchunks, (H5D_RDCC_NBYTES_MAX(rdcc) / 2) / chunk_size);
+    if ((hsize_t)nahead > layout->u.chunk.nchunks - (chunk_idx + 1))
+        nahead = (size_t)(layout->u.chunk.nchunks - (chunk_idx + 1));
+    rdcc->prefetch.next = chunk_idx + nahead + 1;
+    if (0 == nahead)
+        HGOTO_DONE(SUCCEED)
+
+    if (NULL == (prefetch->ents = (H5D_chunk_prefetch_ent_t *)H5MM_malloc((nahead + 1) *
+                                                                         sizeof(H5D_chunk_prefetch_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunks to read ahead")
+
+    /* The chunk being read, unless the caller has it already */
+    if (NULL == *chunk) {
+        H5MM_memcpy(prefetch->ents[0].scaled, udata->common.scaled, sizeof(hsize_t) * layout->u.chunk.ndims);
+        H5MM_memcpy(&(prefetch->ents[0].udata), udata, sizeof(H5D_chunk_ud_t));
+        prefetch->ents[0].current = TRUE;
+        prefetch->nused           = 1;
+    } /* end if */
+    nfirst = prefetch->nused;
+
+    /* Gather the chunks that follow it */
+    for (u = 1; u <= nahead; u++) {
+        H5D_chunk_prefetch_ent_t *ent = &(prefetch->ents[prefetch->nused]); /* Chunk to read ahead */
+        unsigned                  idx;                                      /* Chunk's slot in the cache */
+        hbool_t                   found;                                    /* Whether chunk is cached */
+
+        if (H5VM_array_calc_pre(chunk_idx + u, ndims, layout->u.chunk.down_chunks, ent->scaled) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't compute chunk coordinates")
+        ent->scaled[ndims] = 0;
+        ent->current       = FALSE;
+
+        /* Get the info for the chunk in the file */
+        if (H5D__chunk_lookup(dset, ent->scaled, &(ent->udata)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        /* Skip chunks that aren't in the file or are cached already, and
+         * partial edge chunks that aren't filtered
+         */
+        if (!H5F_addr_defined(ent->udata.chunk_block.offset) || UINT_MAX != ent->udata.idx_hint)
+            continue;
+        if (pline->nused && (layout->u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS) &&
+            H5D__chunk_is_partial_edge_chunk(dset->shared->ndims, layout->u.chunk.dim, ent->scaled,
+                                             dset->shared->curr_dims))
+            continue;
+
+        /* Don't evict cached chunks for chunks that may not be used */
+        idx = H5D__chunk_cache_find_slot(dset->shared, ent->scaled, &found);
+        if (rdcc->slot[idx])
+            continue;
+
+        prefetch->nused++;
+    } /* end for */
+
+    /* Nothing to read ahead */
+    if (nfirst == prefetch->nused) {
+        prefetch->nused = 0;
+        prefetch->ents  = (H5D_chunk_prefetch_ent_t *)H5MM_xfree(prefetch->ents);
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Sort the chunks by file address */
+    HDqsort(prefetch->ents, prefetch->nused, sizeof(H5D_chunk_prefetch_ent_t), H5D__chunk_prefetch_cmp_addr);
+
+    /* Allocate the I/O vector and the filter jobs */
+    if (NULL == (types = (H5FD_mem_t *)H5MM_malloc(prefetch->nused * sizeof(H5FD_mem_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O vector")
+    if (NULL == (addrs = (haddr_t *)H5MM_malloc(prefetch->nused * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O vector")
+    if (NULL == (sizes = (size_t *)H5MM_malloc(prefetch->nused * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O vector")
+    if (NULL == (bufs = (void **)H5MM_malloc(prefetch->nused * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for I/O vector")
+    if (NULL == (prefetch->jobs = (H5D_chunk_filter_job_t *)H5MM_calloc(prefetch->nused *
+                                                                       sizeof(H5D_chunk_filter_job_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for filter jobs")
+
+    /* Set up a buffer for each chunk */
+    for (u = 0; u < prefetch->nused; u++) {
+        H5D_chunk_prefetch_ent_t *ent = &(prefetch->ents[u]); /* Chunk to read */
+        H5D_chunk_filter_job_t *  job = &(prefetch->jobs[u]); /* Buffer & filter job for chunk */
+
+        /* Point the index info back at the chunk's coordinates, after sorting */
+        ent->udata.common.scaled = ent->scaled;
+
+        H5_CHECKED_ASSIGN(job->nbytes, size_t, ent->udata.chunk_block.length, hsize_t);
+        job->buf_alloc   = job->nbytes;
+        job->filter_mask = ent->udata.filter_mask;
+        job->status      = pline->nused ? FAIL : SUCCEED;
+        if (NULL == (job->buf = H5D__chunk_mem_alloc(job->nbytes, pline)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+
+        types[u] = H5FD_MEM_DRAW;
+        addrs[u] = ent->udata.chunk_block.offset;
+        sizes[u] = job->nbytes;
+        bufs[u]  = job->buf;
+    } /* end for */
+
+    /* Read the chunks */
+    H5_CHECK_OVERFLOW(prefetch->nused, size_t, uint32_t);
+    if (H5F_shared_vector_read(H5F_SHARED(dset->oloc.file), (uint32_t)prefetch->nused, types, addrs, sizes,
+                               bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+
+    /* Run the filter pipeline on them */
+    if (pline->nused && H5D__chunk_filter_jobs(dset, H5Z_FLAG_REVERSE, prefetch->jobs, prefetch->nused) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "data pipeline read failed")
+
+    /* Hand back the chunk being read (it's read again if the pipeline failed
+     * for it, so that the failure is reported)
+     */
+    for (u = 0; u < prefetch->nused; u++)
+        if (prefetch->ents[u].current) {
+            H5D_chunk_filter_job_t *job = &(prefetch->jobs[u]); /* Buffer & filter job for chunk */
+
+            if (job->status >= 0)
+                *chunk = job->buf;
+            else
+                (void)H5D__chunk_mem_xfree(job->buf, pline);
+            job->buf = NULL;
+            break;
+        } /* end if */
+
+done:
+    H5MM_xfree(types);
+    H5MM_xfree(addrs);
+    H5MM_xfree(sizes);
+    H5MM_xfree(bufs);
+
+    if (ret_value < 0 && H5D__chunk_prefetch_free(dset, prefetch) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release chunks read ahead")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_prefetch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_prefetch_cmp_addr
+ *
+ * Purpose:    Compares the file addresses of two chunks read ahead, for
+ *        qsort().
+ *
+ * Return:    -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_prefetch_cmp_addr(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_prefetch_ent_t *ent1 = (const H5D_chunk_prefetch_ent_t *)_ent1;
+    const H5D_chunk_prefetch_ent_t *ent2 = (const H5D_chunk_prefetch_ent_t *)_ent2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(ent1->udata.chunk_block.offset, ent2->udata.chunk_block.offset))
+} /* end H5D__chunk_prefetch_cmp_addr() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_prefetch_insert
+ *
+ * Purpose:    Adds the chunks read ahead by H5D__chunk_prefetch() to the
+ *        chunk cache, and releases them from PREFETCH.
+ *
+ *        A chunk isn't added if the pipeline failed for it, or if its
+ *        slot in the cache was taken since it was read; it's read
+ *        again when it's needed.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_prefetch_insert(const H5D_io_info_t *io_info, H5D_chunk_prefetch_t *prefetch)
+{
+    const H5D_t *      dset   = io_info->dset;                     /* Dataset */
+    const H5O_pline_t *pline  = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info */
+    const H5D_rdcc_t * rdcc   = &(dset->shared->cache.chunk);      /* Raw data chunk cache */
+    hsize_t *          scaled = io_info->store->chunk.scaled;      /* Scaled coordinates of chunk read */
+    size_t             u;                                          /* Local index variable */
+    herr_t             ret_value = SUCCEED;                        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(prefetch);
+
+    for (u = 0; u < prefetch->nused; u++) {
+        H5D_chunk_prefetch_ent_t *ent = &(prefetch->ents[u]); /* Chunk read ahead */
+        H5D_chunk_filter_job_t *  job = &(prefetch->jobs[u]); /* Buffer & filter job for chunk */
+        void *                    chunk;                      /* Chunk in cache */
+        unsigned                  idx;                        /* Chunk's slot in the cache */
+        hbool_t                   found;                      /* Whether chunk is cached */
+
+        if (NULL == job->buf)
+            continue;
+
+        /* Check that the pipeline succeeded and the chunk's slot is free */
+        idx = H5D__chunk_cache_find_slot(dset->shared, ent->scaled, &found);
+        if (job->status < 0 || rdcc->slot[idx]) {
+            job->buf = H5D__chunk_mem_xfree(job->buf, pline);
+            continue;
+        } /* end if */
+
+        /* Lock the chunk into the cache & release it */
+        io_info->store->chunk.scaled = ent->scaled;
+        chunk                        = H5D__chunk_lock(io_info, &(ent->udata), FALSE, FALSE, job->buf);
+        job->buf                     = NULL;
+        if (NULL == chunk)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to cache raw data chunk read ahead")
+        if (H5D__chunk_unlock(io_info, &(ent->udata), FALSE, chunk, (uint32_t)0) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk read ahead")
+    } /* end for */
+
+done:
+    io_info->store->chunk.scaled = scaled;
+
+    if (H5D__chunk_prefetch_free(dset, prefetch) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release chunks read ahead")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_prefetch_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_prefetch_free
+ *
+ * Purpose:    Releases the chunks read ahead by H5D__chunk_prefetch()
+ *        that weren't added to the cache.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_prefetch_free(const H5D_t *dset, H5D_chunk_prefetch_t *prefetch)
+{
+    size_t u; /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(dset);
+    HDassert(prefetch);
+
+    if (prefetch->jobs)
+        for (u = 0; u < prefetch->nused; u++)
+            if (prefetch->jobs[u].buf)
+                prefetch->jobs[u].buf =
+                    H5D__chunk_mem_xfree(prefetch->jobs[u].buf, &(dset->shared->dcpl_cache.pline));
+
+    prefetch->ents  = (H5D_chunk_prefetch_ent_t *)H5MM_xfree(prefetch->ents);
+    prefetch->jobs  = (H5D_chunk_filter_job_t *)H5MM_xfree(prefetch->jobs);
+    prefetch->nused = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__chunk_prefetch_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_read_coalesced
+ *
+ * Purpose:    Reads the chunks selected for a read that bypass the chunk
+ *        cache and are stored close together in the file, with as
+ *        few I/O requests as possible.
+ *
+ *        The chunks are sorted by address, and runs of chunks that
+ *        are no more than the dataset's largest gap apart (see
+ *        H5Pset_chunk_coalesce) are read into a buffer with one
+ *        request each, no larger than the largest read, along with
+ *        the data between them.  The selected elements are then
+ *        copied out of the buffer, as they are from a cached chunk.
+ *
+ *        Chunks that are read are flagged in *DONE, indexed by their
+ *        position in the selection, for H5D__chunk_read() to skip.
+ *        *DONE is left NULL if no chunks were read.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_read_coalesced(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                          const H5D_chunk_map_t *fm, H5D_io_info_t *cpt_io_info, hbool_t **done)
+{
+    const H5D_t *             dset     = io_info->dset;                /* Dataset */
+    const H5D_rdcc_t *        rdcc     = &(dset->shared->cache.chunk); /* Raw data chunk cache */
+    H5D_chunk_coalesce_ent_t *ents     = NULL;                         /* Uncached chunks in the file */
+    uint8_t *                 buf      = NULL;                         /* Buffer for a run of chunks */
+    size_t                    buf_size = 0;                            /* Size of buffer */
+    size_t                    nsel;                                    /* # of chunks selected */
+    size_t                    nents = 0;                               /* # of uncached chunks in the file */
+    size_t                    chunk_size;                              /* Size of a chunk */
+    H5SL_node_t *             chunk_node;                              /* Current node in chunk skip list */
+    htri_t                    cacheable;                               /* Whether the chunks are cacheable */
+    size_t                    u, v;                                    /* Local index variables */
+    herr_t                    ret_value = SUCCEED;                     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(fm);
+    HDassert(cpt_io_info);
+    HDassert(done && NULL == *done);
+
+    /* Only chunks without filters bypass the cache, and only whole chunks
+     * that fit in the largest read, twice over, are worth reading together.
+     * (Chunks aren't combined with MPI drivers, where raw data I/O goes
+     * through MPI.)
+     */
+    H5_CHECKED_ASSIGN(chunk_size, size_t, dset->shared->layout.u.chunk.size, uint32_t);
+    if (fm->use_single || dset->shared->dcpl_cache.pline.nused > 0 ||
+        rdcc->coalesce.max_size / 2 < chunk_size || H5F_HAS_FEATURE(dset->oloc.file, H5FD_FEAT_HAS_MPI))
+        HGOTO_DONE(SUCCEED)
+    if ((nsel = H5SL_count(fm->sel_chunks)) < 2)
+        HGOTO_DONE(SUCCEED)
+    if ((cacheable = H5D__chunk_cacheable(io_info, HADDR_UNDEF, FALSE)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
+    if (cacheable)
+        HGOTO_DONE(SUCCEED)
+
+    /* Get the addresses of the selected chunks that are in the file */
+    if (NULL == (ents = (H5D_chunk_coalesce_ent_t *)H5MM_malloc(nsel * sizeof(H5D_chunk_coalesce_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunks to read")
+    u          = 0;
+    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
+    while (chunk_node) {
+        H5D_chunk_info_t *chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node); /* Chunk information */
+        H5D_chunk_ud_t    udata;                                                /* Chunk index info */
+
+        if (H5D__chunk_lookup(dset, chunk_info->scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        if (H5F_addr_defined(udata.chunk_block.offset)) {
+            ents[nents].chunk_info = chunk_info;
+            ents[nents].addr       = udata.chunk_block.offset;
+            H5_CHECKED_ASSIGN(ents[nents].size, size_t, udata.chunk_block.length, hsize_t);
+            ents[nents].pos = u;
+            nents++;
+        } /* end if */
+
+        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+        u++;
+    } /* end while */
+    if (nents < 2)
+        HGOTO_DONE(SUCCEED)
+
+    /* Sort the chunks by address */
+    HDqsort(ents, nents, sizeof(H5D_chunk_coalesce_ent_t), H5D__chunk_coalesce_cmp_addr);
+
+    /* Read each run of chunks that are close enough together */
+    for (u = 0; u < nents; u = v) {
+        haddr_t start = ents[u].addr;                /* Start of the run */
+        haddr_t end   = ents[u].addr + ents[u].size; /* End of the run */
+        size_t  run_size;                            /* Size of the run */
+
+        for (v = u + 1; v < nents; v++)
+            if (H5F_addr_lt(ents[v].addr, end) || (ents[v].addr - end) > rdcc->coalesce.max_gap ||
+                (ents[v].addr + ents[v].size) - start > rdcc->coalesce.max_size)
+                break;
+            else
+                end = ents[v].addr + ents[v].size;
+
+        /* Leave chunks on their own to H5D__chunk_read() */
+        if (v - u < 2)
+            continue;
+
+        if (NULL == *done)
+            if (NULL == (*done = (hbool_t *)H5MM_calloc(nsel * sizeof(hbool_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunks read")
+
+        /* Read the run */
+        H5_CHECKED_ASSIGN(run_size, size_t, end - start, hsize_t);
+        if (run_size > buf_size) {
+            uint8_t *new_buf; /* Larger buffer */
+
+            if (NULL == (new_buf = (uint8_t *)H5MM_realloc(buf, run_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunks to read")
+            buf      = new_buf;
+            buf_size = run_size;
+        } /* end if */
+        if (H5F_shared_block_read(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, start, run_size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+
+        /* Copy the selected elements out of each chunk */
+        for (; u < v; u++) {
+            H5D_chunk_info_t *chunk_info = ents[u].chunk_info; /* Chunk information */
+
+            cpt_io_info->store->compact.buf = buf + (ents[u].addr - start);
+            if ((io_info->io_ops.single_read)(cpt_io_info, type_info, (hsize_t)chunk_info->chunk_points,
+                                              chunk_info->fspace, chunk_info->mspace) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked read failed")
+            (*done)[ents[u].pos] = TRUE;
+        } /* end for */
+    }     /* end for */
+
+done:
+    cpt_io_info->store->compact.buf = NULL;
+    H5MM_xfree(buf);
+    H5MM_xfree(ents);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_read_coalesced() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_coalesce_cmp_addr
+ *
+ * Purpose:    Compares the file addresses of two chunks read together,
+ *        for qsort().
+ *
+ * Return:    -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_coalesce_cmp_addr(const void *_ent1, const void *_ent2)
+{
+    const H5D_chunk_coalesce_ent_t *ent1 = (const H5D_chunk_coalesce_ent_t *)_ent1;
+    const H5D_chunk_coalesce_ent_t *ent2 = (const H5D_chunk_coalesce_ent_t *)_ent2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(ent1->addr, ent2->addr))
+} /* end H5D__chunk_coalesce_cmp_addr() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_read
+ *
+ * Purpose:    Read from a chunked dataset.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ * Programmer:    Raymond Lu
+ *        Thursday, April 10, 2003
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t H5_ATTR_UNUSED nelmts,
+                const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
+                H5D_chunk_map_t *fm)
+{
+    H5SL_node_t * chunk_node;                    /* Current node in chunk skip list */
+    H5D_io_info_t nonexistent_io_info;           /* "nonexistent" I/O info object */
+    H5D_io_info_t ctg_io_info;                   /* Contiguous I/O info object */
+    H5D_storage_t ctg_store;                     /* Chunk storage information as contiguous dataset */
+    H5D_io_info_t cpt_io_info;                   /* Compact I/O info object */
+    H5D_storage_t cpt_store;                     /* Chunk storage information as compact dataset */
+    hbool_t       cpt_dirty;                     /* Temporary placeholder for compact storage "dirty" flag */
+    uint32_t      src_accessed_bytes  = 0;       /* Total accessed size in a chunk */
+    hbool_t       skip_missing_chunks = FALSE;   /* Whether to skip missing chunks */
+    H5D_chunk_read_batch_t batch;                /* Chunks read & filtered ahead of use */
+    void *                 filtered_chunk = NULL; /* Chunk from batch, already filtered */
+    H5D_chunk_prefetch_t   prefetch;              /* Chunks read ahead of a scan in order */
+    hbool_t *              coalesced = NULL;      /* Whether each chunk was read with others */
+    size_t                 chunk_pos = 0;         /* Position of chunk in the selection */
+    herr_t        ret_value           = SUCCEED; /*return value        */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(io_info->u.rbuf);
+    HDassert(type_info);
+    HDassert(fm);
+
+    /* Set up to read & filter chunks in batches, if there is more than one */
+    HDmemset(&batch, 0, sizeof(batch));
+    HDmemset(&prefetch, 0, sizeof(prefetch));
+    if (!fm->use_single && (batch.nalloc = H5D__chunk_filter_batch_size(io_info->dset)) > 0) {
+        if (NULL == (batch.chunk_info =
+                         (H5D_chunk_info_t **)H5MM_malloc(batch.nalloc * sizeof(H5D_chunk_info_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+        if (NULL == (batch.udata = (H5D_chunk_ud_t *)H5MM_malloc(batch.nalloc * sizeof(H5D_chunk_ud_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+        if (NULL == (batch.jobs = (H5D_chunk_filter_job_t *)H5MM_calloc(batch.nalloc *
+                                                                        sizeof(H5D_chunk_filter_job_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+        batch.scan_end = H5D_CHUNK_GET_FIRST_NODE(fm);
+    } /* end if */
+
+    /* Set up "nonexistent" I/O info object */
+    H5MM_memcpy(&nonexistent_io_info, io_info, sizeof(nonexistent_io_info));
+    nonexistent_io_info.layout_ops = *H5D_LOPS_NONEXISTENT;
+
+    /* Set up contiguous I/O info object */
+    H5MM_memcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
+    ctg_io_info.store      = &ctg_store;
+    ctg_io_info.layout_ops = *H5D_LOPS_CONTIG;
+
+    /* Initialize temporary contiguous storage info */
+    H5_CHECKED_ASSIGN(ctg_store.contig.dset_size, hsize_t, io_info->dset->shared->layout.u.chunk.size,
+                      uint32_t);
+
+    /* Set up compact I/O info object */
+    H5MM_memcpy(&cpt_io_info, io_info, sizeof(cpt_io_info));
+    cpt_io_info.store      = &cpt_store;
+    cpt_io_info.layout_ops = *H5D_LOPS_COMPACT;
+
+    /* Initialize temporary compact storage info */
+    cpt_store.compact.dirty = &cpt_dirty;
+
+    {
+        const H5O_fill_t *fill = &(io_info->dset->shared->dcpl_cache.fill); /* Fill value info */
+        H5D_fill_value_t  fill_status;                                      /* Fill value status */
+
+        /* Check the fill value status */
+        if (H5P_is_fill_value_defined(fill, &fill_status) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+
+        /* If we are never to return fill values, or if we would return them
+         * but they aren't set, set the flag to skip missing chunks.
+         */
+        if (fill->fill_time == H5D_FILL_TIME_NEVER ||
+            (fill->fill_time == H5D_FILL_TIME_IFSET && fill_status != H5D_FILL_VALUE_USER_DEFINED &&
+             fill_status != H5D_FILL_VALUE_DEFAULT))
+            skip_missing_chunks = TRUE;
+    }
+
+    /* Read the uncached chunks that are close together in the file first */
+    if (H5D__chunk_read_coalesced(io_info, type_info, fm, &cpt_io_info, &coalesced) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+
+    /* Iterate through nodes in chunk skip list */
+    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
+    while (chunk_node) {
+        H5D_chunk_info_t *chunk_info; /* Chunk information */
+        H5D_chunk_ud_t    udata;      /* Chunk index pass-through    */
+
+        /* Skip chunks that were read with others */
+        if (coalesced && coalesced[chunk_pos]) {
+            chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+            chunk_pos++;
+            continue;
+        } /* end if */
+
+        /* Read & filter the next batch of chunks, once past the chunks
+         * examined for the previous one */
+        if (batch.nalloc > 0 && chunk_node == batch.scan_end)
+            if (H5D__chunk_read_batch_fill(io_info, fm, chunk_node, &batch) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+
+        /* Get the actual chunk information from the skip list node */
+        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+
+        /* Check if the chunk was read with the batch */
+        if (batch.next < batch.nused && batch.chunk_info[batch.next] == chunk_info) {
+            H5D_chunk_filter_job_t *job = &(batch.jobs[batch.next]); /* Filter job for chunk */
+
+            H5MM_memcpy(&udata, &(batch.udata[batch.next]), sizeof(udata));
+
+            /* Use the filtered chunk, or read it again if the pipeline failed */
+            if (job->status >= 0)
+                filtered_chunk = job->buf;
+            else
+                (void)H5D__chunk_mem_xfree(job->buf, &(io_info->dset->shared->dcpl_cache.pline));
+            job->buf = NULL;
+            batch.next++;
+        } /* end if */
+        /* Get the info for the chunk in the file */
+        else if (H5D__chunk_lookup(io_info->dset, chunk_info->scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        /* Sanity check */
+        HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
+                 (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
+
+        /* Check for non-existant chunk & skip it if appropriate */
+        if (H5F_addr_defined(udata.chunk_block.offset) || UINT_MAX != udata.idx_hint ||
+            !skip_missing_chunks) {
+            H5D_io_info_t *chk_io_info;  /* Pointer to I/O info object for this chunk */
+            void *         chunk = NULL; /* Pointer to locked chunk buffer */
+            htri_t         cacheable;    /* Whether the chunk is cacheable */
+
+            /* Set chunk's [scaled] coordinates */
+            io_info->store->chunk.scaled = chunk_info->scaled;
+
+            /* Determine if we should use the chunk cache */
+            if ((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, FALSE)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
+            if (cacheable) {
+                /* Load the chunk into cache and lock it. */
+
+                /* Compute # of bytes accessed in chunk */
+                H5_CHECK_OVERFLOW(type_info->src_type_size, /*From:*/ size_t, /*To:*/ uint32_t);
+                src_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->src_type_size;
+
+                /* Read the chunks that follow this one along with it, if the
+                 * dataset is being read in order.  (When chunks are read in
+                 * batches, only past the last chunk selected.)
+                 */
+                if (UINT_MAX == udata.idx_hint && H5F_addr_defined(udata.chunk_block.offset) &&
+                    (0 == batch.nalloc || NULL == H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node)))
+                    if (H5D__chunk_prefetch(io_info, &udata, &prefetch, &filtered_chunk) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read ahead raw data chunks")
+
+                /* Lock the chunk into the cache */
+                chunk          = H5D__chunk_lock(io_info, &udata, FALSE, FALSE, filtered_chunk);
+                filtered_chunk = NULL;
+                if (NULL == chunk)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
                 /* Set up the storage buffer information for this chunk */
                 cpt_store.compact.buf = chunk;
@@ -2568,6 +3811,8 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_
                 chk_io_info = &nonexistent_io_info;
             } /* end else */
 
+            HDassert(!filtered_chunk);
+
             /* Perform the actual read operation */
             if ((io_info->io_ops.single_read)(chk_io_info, type_info, (hsize_t)chunk_info->chunk_points,
                                               chunk_info->fspace, chunk_info->mspace) < 0)
@@ -2576,13 +3821,27 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_
             /* Release the cache lock on the chunk. */
             if (chunk && H5D__chunk_unlock(io_info, &udata, FALSE, chunk, src_accessed_bytes) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
+
+            /* Add the chunks read ahead to the cache */
+            if (prefetch.nused > 0 && H5D__chunk_prefetch_insert(io_info, &prefetch) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to cache raw data chunks read ahead")
         } /* end if */
 
         /* Advance to next chunk in list */
         chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+        chunk_pos++;
     } /* end while */
 
 done:
+    H5MM_xfree(coalesced);
+
+    /* Release the batch of chunks, including any chunks not used */
+    if (filtered_chunk)
+        filtered_chunk = H5D__chunk_mem_xfree(filtered_chunk, &(io_info->dset->shared->dcpl_cache.pline));
+    if (batch.nalloc > 0)
+        H5D__chunk_read_batch_free(io_info->dset, &batch);
+    H5D__chunk_prefetch_free(io_info->dset, &prefetch);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_read() */
 
@@ -2610,6 +3869,10 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize
     H5D_storage_t cpt_store;                    /* Chunk storage information as compact dataset */
     hbool_t       cpt_dirty;                    /* Temporary placeholder for compact storage "dirty" flag */
     uint32_t      dst_accessed_bytes = 0;       /* Total accessed size in a chunk */
+    H5D_rdcc_ent_t * pending      = NULL; /* "Fake" entries for uncached chunks waiting to be written */
+    H5D_rdcc_ent_t **pending_ptrs = NULL; /* Pointers to pending entries */
+    size_t           npending     = 0;    /* # of pending entries */
+    size_t           max_pending  = 0;    /* Max. # of pending entries */
     herr_t        ret_value          = SUCCEED; /* Return value        */
 
     FUNC_ENTER_STATIC
@@ -2620,6 +3883,19 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize
     HDassert(type_info);
     HDassert(fm);
 
+    /* Set up to filter & write chunks that aren't cached in batches, if
+     * there is more than one chunk */
+    if (!fm->use_single && (max_pending = H5D__chunk_filter_batch_size(io_info->dset)) > 0) {
+        size_t u; /* Local index variable */
+
+        if (NULL == (pending = (H5D_rdcc_ent_t *)H5MM_malloc(max_pending * sizeof(H5D_rdcc_ent_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+        if (NULL == (pending_ptrs = (H5D_rdcc_ent_t **)H5MM_malloc(max_pending * sizeof(H5D_rdcc_ent_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+        for (u = 0; u < max_pending; u++)
+            pending_ptrs[u] = &pending[u];
+    } /* end if */
+
     /* Set up contiguous I/O info object */
     H5MM_memcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
     ctg_io_info.store      = &ctg_store;
@@ -2681,7 +3957,7 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize
                 entire_chunk = FALSE;
 
             /* Lock the chunk into the cache */
-            if (NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk, FALSE)))
+            if (NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk, FALSE, NULL)))
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
             /* Set up the storage buffer information for this chunk */
@@ -2733,20 +4009,40 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize
 
         /* Release the cache lock on the chunk, or insert chunk into index. */
         if (chunk) {
-            if (H5D__chunk_unlock(io_info, &udata, TRUE, chunk, dst_accessed_bytes) < 0)
+            /* Hold on to chunks that aren't cached, to filter & write them in batches */
+            if (max_pending > 0 && UINT_MAX == udata.idx_hint) {
+                H5D__chunk_fake_ent_init(io_info, &udata, chunk, &pending[npending++]);
+
+                if (npending == max_pending) {
+                    size_t nents = npending; /* # of entries to write */
+
+                    npending = 0;
+                    if (H5D__chunk_flush_entries(io_info->dset, pending_ptrs, nents, TRUE) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
+                } /* end if */
+            }     /* end if */
+            else if (H5D__chunk_unlock(io_info, &udata, TRUE, chunk, dst_accessed_bytes) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
         } /* end if */
         else {
-            if (need_insert && io_info->dset->shared->layout.storage.u.chunk.ops->insert)
+            if (need_insert && io_info->dset->shared->layout.storage.u.chunk.ops->insert) {
                 if ((io_info->dset->shared->layout.storage.u.chunk.ops->insert)(&idx_info, &udata, NULL) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
-        } /* end else */
+                H5D__chunk_idx_cache_update(idx_info.f, &udata);
+            } /* end if */
+        }     /* end else */
 
         /* Advance to next chunk in list */
         chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
     } /* end while */
 
 done:
+    /* Write out any chunks still waiting (even on failure, so their data isn't lost) */
+    if (npending > 0 && H5D__chunk_flush_entries(io_info->dset, pending_ptrs, npending, TRUE) < 0)
+        HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
+    H5MM_xfree(pending);
+    H5MM_xfree(pending_ptrs);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_write() */
 
@@ -2766,26 +4062,52 @@ done:
 static herr_t
 H5D__chunk_flush(H5D_t *dset)
 {
-    H5D_rdcc_t *    rdcc = &(dset->shared->cache.chunk);
-    H5D_rdcc_ent_t *ent, *next;
-    unsigned        nerrors   = 0;       /* Count of any errors encountered when flushing chunks */
-    herr_t          ret_value = SUCCEED; /* Return value */
+    H5D_rdcc_t *     rdcc = &(dset->shared->cache.chunk);
+    H5D_rdcc_ent_t * ent, *next;
+    H5D_rdcc_ent_t **batch      = NULL;    /* Dirty entries to flush together */
+    size_t           batch_size = 0;       /* Max. # of entries in batch */
+    unsigned         nerrors    = 0;       /* Count of any errors encountered when flushing chunks */
+    herr_t           ret_value  = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
     /* Sanity check */
     HDassert(dset);
 
-    /* Loop over all entries in the chunk cache */
-    for (ent = rdcc->head; ent; ent = next) {
-        next = ent->next;
-        if (H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
+    /* Check whether to filter the dirty chunks in batches */
+    if ((batch_size = H5D__chunk_filter_batch_size(dset)) > 0 &&
+        NULL == (batch = (H5D_rdcc_ent_t **)H5MM_malloc(batch_size * sizeof(H5D_rdcc_ent_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+
+    if (batch) {
+        size_t nents = 0; /* # of entries in batch */
+
+        /* Loop over all entries in the chunk cache, flushing dirty ones in batches */
+        for (ent = rdcc->head; ent; ent = ent->next)
+            if (ent->dirty) {
+                batch[nents++] = ent;
+                if (nents == batch_size) {
+                    if (H5D__chunk_flush_entries(dset, batch, nents, FALSE) < 0)
+                        nerrors++;
+                    nents = 0;
+                } /* end if */
+            }     /* end if */
+        if (nents > 0 && H5D__chunk_flush_entries(dset, batch, nents, FALSE) < 0)
             nerrors++;
-    } /* end for */
+    } /* end if */
+    else
+        /* Loop over all entries in the chunk cache */
+        for (ent = rdcc->head; ent; ent = next) {
+            next = ent->next;
+            if (H5D__chunk_flush_entry(dset, ent, FALSE, NULL) < 0)
+                nerrors++;
+        } /* end for */
     if (nerrors)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
 
 done:
+    H5MM_xfree(batch);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_flush() */
 
@@ -3040,6 +4362,414 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_cinfo_cache_found() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_enabled
+ *
+ * Purpose:     Check whether the chunk records of an index can be kept in
+ *              the file's chunk index cache.
+ *
+ *              Only indexes that are searched (B-trees and arrays) are
+ *              cached.  Files opened for SWMR reading, whose indexes are
+ *              changed by another process, and files opened with an MPI
+ *              driver, whose indexes are changed by other ranks, aren't.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__chunk_idx_cache_enabled(const H5F_t *f, const H5O_storage_chunk_t *sc)
+{
+    hbool_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(sc);
+
+    if (H5F_CHUNK_IDX_CACHE_NENTS(f) > 0 && H5F_addr_defined(sc->idx_addr) &&
+        (sc->idx_type == H5D_CHUNK_IDX_BTREE || sc->idx_type == H5D_CHUNK_IDX_BT2 ||
+         sc->idx_type == H5D_CHUNK_IDX_EARRAY || sc->idx_type == H5D_CHUNK_IDX_FARRAY) &&
+        !(H5F_INTENT(f) & H5F_ACC_SWMR_READ) && !H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        ret_value = TRUE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_idx_cache_enabled() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_hash
+ *
+ * Purpose:     Hash the key of a chunk index cache entry: the address of
+ *              the chunk index and the chunk's scaled offset.
+ *
+ * Return:      The hash value (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5D__chunk_idx_cache_hash(const H5D_chunk_common_ud_t *common)
+{
+    uint64_t hash = 0; /* Hash value */
+    unsigned u;        /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(common);
+    HDassert(common->layout);
+    HDassert(common->storage);
+    HDassert(common->scaled);
+
+    hash = (uint64_t)common->storage->idx_addr * H5D_CHUNK_IDX_CACHE_HASH_MULT;
+    for (u = 0; u < common->layout->ndims; u++)
+        hash = (hash ^ (uint64_t)common->scaled[u]) * H5D_CHUNK_IDX_CACHE_HASH_MULT;
+
+    FUNC_LEAVE_NOAPI(hash)
+} /* H5D__chunk_idx_cache_hash() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_lookup
+ *
+ * Purpose:     Find the entry for a chunk in a chunk index cache.
+ *
+ * Return:      The entry, or NULL if the chunk isn't cached
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_chunk_idx_cache_ent_t *
+H5D__chunk_idx_cache_lookup(H5D_chunk_idx_cache_t *cache, const H5D_chunk_common_ud_t *common, uint64_t hash)
+{
+    H5D_chunk_idx_cache_ent_t *ent = NULL; /* Current entry */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(cache);
+    HDassert(common);
+
+    for (ent = cache->buckets[H5D_CHUNK_IDX_CACHE_BUCKET(hash, cache->hash_bits)]; ent; ent = ent->hnext)
+        if (ent->hash == hash && H5F_addr_eq(ent->idx_addr, common->storage->idx_addr) &&
+            ent->ndims == common->layout->ndims &&
+            !HDmemcmp(ent->scaled, common->scaled, ent->ndims * sizeof(hsize_t)))
+            break;
+
+    FUNC_LEAVE_NOAPI(ent)
+} /* H5D__chunk_idx_cache_lookup() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_remove
+ *
+ * Purpose:     Remove an entry from a chunk index cache and free it.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_idx_cache_remove(H5D_chunk_idx_cache_t *cache, H5D_chunk_idx_cache_ent_t *ent)
+{
+    H5D_chunk_idx_cache_ent_t **pent; /* Pointer to link to entry in its bucket */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(cache);
+    HDassert(ent);
+    HDassert(cache->nents > 0);
+
+    /* Unlink the entry from its bucket */
+    for (pent = &cache->buckets[H5D_CHUNK_IDX_CACHE_BUCKET(ent->hash, cache->hash_bits)]; *pent != ent;
+         pent = &(*pent)->hnext)
+        HDassert(*pent);
+    *pent = ent->hnext;
+
+    /* Unlink the entry from the LRU list */
+    if (ent->prev)
+        ent->prev->next = ent->next;
+    else
+        cache->head = ent->next;
+    if (ent->next)
+        ent->next->prev = ent->prev;
+    else
+        cache->tail = ent->prev;
+    cache->nents--;
+
+    /* Free the entry */
+    ent->scaled = H5FL_SEQ_FREE(hsize_t, ent->scaled);
+    ent         = H5FL_FREE(H5D_chunk_idx_cache_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5D__chunk_idx_cache_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_found
+ *
+ * Purpose:     Look for a chunk's record in the file's chunk index cache,
+ *              and retrieve it if found.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__chunk_idx_cache_found(const H5F_t *f, H5D_chunk_ud_t *udata)
+{
+    H5D_chunk_idx_cache_t *    cache;             /* File's chunk index cache */
+    H5D_chunk_idx_cache_ent_t *ent;               /* Entry for chunk */
+    hbool_t                    ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(udata);
+
+    if (NULL == (cache = H5F_CHUNK_IDX_CACHE(f)))
+        HGOTO_DONE(FALSE)
+    if (NULL == (ent = H5D__chunk_idx_cache_lookup(cache, &udata->common,
+                                                   H5D__chunk_idx_cache_hash(&udata->common))))
+        HGOTO_DONE(FALSE)
+
+    /* Move the entry to the head of the LRU list */
+    if (ent->prev) {
+        ent->prev->next = ent->next;
+        if (ent->next)
+            ent->next->prev = ent->prev;
+        else
+            cache->tail = ent->prev;
+        ent->prev         = NULL;
+        ent->next         = cache->head;
+        cache->head->prev = ent;
+        cache->head       = ent;
+    } /* end if */
+
+    /* Retrieve the information from the cache */
+    udata->chunk_block.offset = ent->addr;
+    udata->chunk_block.length = ent->nbytes;
+    udata->chunk_idx          = ent->chunk_idx;
+    udata->filter_mask        = ent->filter_mask;
+
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_idx_cache_found() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_add
+ *
+ * Purpose:     Add a chunk's record, just looked up in the chunk index,
+ *              to the file's chunk index cache, creating the cache if
+ *              it doesn't exist yet.  When the cache is full, the least
+ *              recently used record is evicted.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_idx_cache_add(H5F_t *f, const H5D_chunk_ud_t *udata)
+{
+    H5D_chunk_idx_cache_t *    cache;               /* File's chunk index cache */
+    H5D_chunk_idx_cache_ent_t *ent       = NULL;    /* Entry for chunk */
+    uint64_t                   hash;                /* Hash of entry's key */
+    size_t                     bucket;              /* Entry's hash bucket */
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(udata);
+    HDassert(H5F_addr_defined(udata->common.storage->idx_addr));
+
+    /* Create the cache, if it doesn't exist yet */
+    if (NULL == (cache = H5F_CHUNK_IDX_CACHE(f))) {
+        if (NULL == (cache = H5FL_CALLOC(H5D_chunk_idx_cache_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk index cache")
+        cache->max_nents = H5F_CHUNK_IDX_CACHE_NENTS(f);
+        cache->hash_bits = H5D_CHUNK_IDX_CACHE_INIT_BITS;
+        cache->nbuckets  = (size_t)1 << cache->hash_bits;
+        if (NULL == (cache->buckets = H5FL_SEQ_CALLOC(H5D_chunk_idx_cache_ent_ptr_t, cache->nbuckets))) {
+            cache = H5FL_FREE(H5D_chunk_idx_cache_t, cache);
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk index cache buckets")
+        } /* end if */
+        if (H5F_SET_CHUNK_IDX_CACHE(f, cache) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set chunk index cache")
+    } /* end if */
+
+    /* Check for the chunk already being cached */
+    hash = H5D__chunk_idx_cache_hash(&udata->common);
+    if (NULL != (ent = H5D__chunk_idx_cache_lookup(cache, &udata->common, hash)))
+        H5D__chunk_idx_cache_remove(cache, ent);
+
+    /* Make room for the new entry */
+    if (cache->nents >= cache->max_nents)
+        H5D__chunk_idx_cache_remove(cache, cache->tail);
+
+    /* Grow the hash table, when it has more entries than buckets */
+    if (cache->nents >= cache->nbuckets && cache->nbuckets < cache->max_nents) {
+        H5D_chunk_idx_cache_ent_t **new_buckets; /* New hash buckets */
+        unsigned                    new_bits = cache->hash_bits + 1;
+
+        if (NULL != (new_buckets = H5FL_SEQ_CALLOC(H5D_chunk_idx_cache_ent_ptr_t, (size_t)1 << new_bits))) {
+            for (ent = cache->head; ent; ent = ent->next) {
+                bucket              = H5D_CHUNK_IDX_CACHE_BUCKET(ent->hash, new_bits);
+                ent->hnext          = new_buckets[bucket];
+                new_buckets[bucket] = ent;
+            } /* end for */
+            cache->buckets   = H5FL_SEQ_FREE(H5D_chunk_idx_cache_ent_ptr_t, cache->buckets);
+            cache->buckets   = new_buckets;
+            cache->hash_bits = new_bits;
+            cache->nbuckets  = (size_t)1 << new_bits;
+        } /* end if */
+    }     /* end if */
+
+    /* Create the entry */
+    if (NULL == (ent = H5FL_MALLOC(H5D_chunk_idx_cache_ent_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk index cache entry")
+    if (NULL == (ent->scaled = H5FL_SEQ_MALLOC(hsize_t, udata->common.layout->ndims))) {
+        ent = H5FL_FREE(H5D_chunk_idx_cache_ent_t, ent);
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk index cache entry")
+    } /* end if */
+    ent->idx_addr = udata->common.storage->idx_addr;
+    ent->ndims    = udata->common.layout->ndims;
+    H5MM_memcpy(ent->scaled, udata->common.scaled, sizeof(hsize_t) * ent->ndims);
+    ent->hash = hash;
+    ent->addr = udata->chunk_block.offset;
+    H5_CHECKED_ASSIGN(ent->nbytes, uint32_t, udata->chunk_block.length, hsize_t);
+    ent->chunk_idx   = udata->chunk_idx;
+    ent->filter_mask = udata->filter_mask;
+
+    /* Link the entry into its bucket and at the head of the LRU list */
+    bucket                 = H5D_CHUNK_IDX_CACHE_BUCKET(hash, cache->hash_bits);
+    ent->hnext             = cache->buckets[bucket];
+    cache->buckets[bucket] = ent;
+    ent->prev              = NULL;
+    ent->next              = cache->head;
+    if (cache->head)
+        cache->head->prev = ent;
+    else
+        cache->tail = ent;
+    cache->head = ent;
+    cache->nents++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_idx_cache_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_update
+ *
+ * Purpose:     Update the file's chunk index cache after a chunk's record
+ *              was inserted into the chunk index, if the chunk is cached.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_idx_cache_update(const H5F_t *f, const H5D_chunk_ud_t *udata)
+{
+    H5D_chunk_idx_cache_t *    cache; /* File's chunk index cache */
+    H5D_chunk_idx_cache_ent_t *ent;   /* Entry for chunk */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(udata);
+
+    if (NULL != (cache = H5F_CHUNK_IDX_CACHE(f)))
+        if (NULL != (ent = H5D__chunk_idx_cache_lookup(cache, &udata->common,
+                                                       H5D__chunk_idx_cache_hash(&udata->common)))) {
+            ent->addr = udata->chunk_block.offset;
+            H5_CHECKED_ASSIGN(ent->nbytes, uint32_t, udata->chunk_block.length, hsize_t);
+            ent->chunk_idx   = udata->chunk_idx;
+            ent->filter_mask = udata->filter_mask;
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5D__chunk_idx_cache_update() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_idx_cache_evict
+ *
+ * Purpose:     Evict a chunk's record (when COMMON is given) or all the
+ *              records of a chunk index (when it's NULL) from the file's
+ *              chunk index cache.  Called when a chunk is removed from an
+ *              index, and when an index is created or deleted, so that
+ *              records left behind by a deleted index can't be mistaken
+ *              for records of a new index at the same address.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_idx_cache_evict(const H5F_t *f, haddr_t idx_addr, const H5D_chunk_common_ud_t *common)
+{
+    H5D_chunk_idx_cache_t *    cache; /* File's chunk index cache */
+    H5D_chunk_idx_cache_ent_t *ent;   /* Entry for chunk */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+
+    if (NULL != (cache = H5F_CHUNK_IDX_CACHE(f)) && H5F_addr_defined(idx_addr)) {
+        if (common) {
+            HDassert(H5F_addr_eq(idx_addr, common->storage->idx_addr));
+            if (NULL != (ent = H5D__chunk_idx_cache_lookup(cache, common, H5D__chunk_idx_cache_hash(common))))
+                H5D__chunk_idx_cache_remove(cache, ent);
+        } /* end if */
+        else {
+            H5D_chunk_idx_cache_ent_t *next; /* Next entry */
+
+            for (ent = cache->head; ent; ent = next) {
+                next = ent->next;
+                if (H5F_addr_eq(ent->idx_addr, idx_addr))
+                    H5D__chunk_idx_cache_remove(cache, ent);
+            } /* end for */
+        }     /* end else */
+    }         /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5D__chunk_idx_cache_evict() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D_chunk_idx_cache_dest
+ *
+ * Purpose:     Destroy a file's chunk index cache, when the file is
+ *              closed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_chunk_idx_cache_dest(H5D_chunk_idx_cache_t *cache)
+{
+    H5D_chunk_idx_cache_ent_t *ent;  /* Current entry */
+    H5D_chunk_idx_cache_ent_t *next; /* Next entry */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(cache);
+
+    for (ent = cache->head; ent; ent = next) {
+        next        = ent->next;
+        ent->scaled = H5FL_SEQ_FREE(hsize_t, ent->scaled);
+        ent         = H5FL_FREE(H5D_chunk_idx_cache_ent_t, ent);
+    } /* end for */
+    cache->buckets = H5FL_SEQ_FREE(H5D_chunk_idx_cache_ent_ptr_t, cache->buckets);
+    cache          = H5FL_FREE(H5D_chunk_idx_cache_t, cache);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5D_chunk_idx_cache_dest() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_create
  *
@@ -3090,6 +4820,9 @@ H5D__chunk_create(const H5D_t *dset /*in,out*/)
     if ((sc->ops->create)(&idx_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk index")
 
+    /* Forget any records of an earlier index at the same address */
+    H5D__chunk_idx_cache_evict(idx_info.f, sc->idx_addr, NULL);
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_create() */
@@ -3098,7 +4831,9 @@ done:
  * Function:    H5D__chunk_hash_val
  *
  * Purpose:     To calculate an index based on the dataset's scaled
- *              coordinates and sizes of the faster dimensions.
+ *              coordinates and sizes of the faster dimensions.  When a
+ *              chunk can be cached in several slots, this is the first
+ *              slot of its set.
  *
  * Return:    Hash value index
  *
@@ -3129,12 +4864,75 @@ H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
         val ^= scaled[u];
     } /* end for */
 
-    /* Modulo value against the number of array slots */
-    ret = (unsigned)(val % shared->cache.chunk.nslots);
+    /* Modulo value against the number of sets of array slots */
+    ret = (unsigned)(val % (shared->cache.chunk.nslots / shared->cache.chunk.nways)) *
+          shared->cache.chunk.nways;
 
     FUNC_LEAVE_NOAPI(ret)
 } /* H5D__chunk_hash_val() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_find_slot
+ *
+ * Purpose:     Looks for a chunk in the slots of the dataset's chunk cache
+ *              it may be cached in.  If it isn't there, picks the slot it
+ *              should be added to: an empty one if there is one, else the
+ *              one whose (unlocked) chunk was used least recently.
+ *
+ * Return:      Index of the slot (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+H5D__chunk_cache_find_slot(const H5D_shared_t *shared, const hsize_t *scaled, hbool_t *found)
+{
+    const H5D_rdcc_t *rdcc      = &(shared->cache.chunk); /* Dataset's chunk cache */
+    uint64_t          oldest    = UINT64_MAX;             /* Time stamp of least recently used chunk */
+    hbool_t           empty     = FALSE;                  /* Whether an empty slot was found */
+    unsigned          first;                              /* First slot of the chunk's set */
+    unsigned          ret_value = 0;                      /* Return value */
+    unsigned          u, v;                               /* Local index variables */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(rdcc->nslots > 0);
+    HDassert(scaled);
+    HDassert(found);
+
+    *found    = FALSE;
+    first     = H5D__chunk_hash_val(shared, scaled);
+    ret_value = first;
+    for (u = first; u < first + rdcc->nways; u++) {
+        const H5D_rdcc_ent_t *ent = rdcc->slot[u]; /* Chunk in the slot */
+
+        if (NULL == ent) {
+            if (!empty) {
+                empty     = TRUE;
+                ret_value = u;
+            } /* end if */
+            continue;
+        } /* end if */
+
+        /* Check if the cache entry is the chunk */
+        for (v = 0; v < shared->ndims; v++)
+            if (scaled[v] != ent->scaled[v])
+                break;
+        if (v == shared->ndims) {
+            *found    = TRUE;
+            ret_value = u;
+            break;
+        } /* end if */
+
+        if (!empty && !ent->locked && ent->stamp < oldest) {
+            oldest    = ent->stamp;
+            ret_value = u;
+        } /* end if */
+    }     /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_cache_find_slot() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_lookup
  *
@@ -3180,24 +4978,12 @@ H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled, H5D_chunk_ud_t *udat
     /* Check for chunk in cache */
     if (dset->shared->cache.chunk.nslots > 0) {
         /* Determine the chunk's location in the hash table */
-        idx = H5D__chunk_hash_val(dset->shared, scaled);
+        idx = H5D__chunk_cache_find_slot(dset->shared, scaled, &found);
 
         /* Get the chunk cache entry for that location */
-        ent = dset->shared->cache.chunk.slot[idx];
-        if (ent) {
-            unsigned u; /* Counter */
-
-            /* Speculatively set the 'found' flag */
-            found = TRUE;
-
-            /* Verify that the cache entry is the correct chunk */
-            for (u = 0; u < dset->shared->ndims; u++)
-                if (scaled[u] != ent->scaled[u]) {
-                    found = FALSE;
-                    break;
-                } /* end if */
-        }         /* end if */
-    }             /* end if */
+        if (found)
+            ent = dset->shared->cache.chunk.slot[idx];
+    } /* end if */
 
     /* Retrieve chunk addr */
     if (found) {
@@ -3213,7 +4999,15 @@ H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled, H5D_chunk_ud_t *udat
 
         /* Check for cached information */
         if (!H5D__chunk_cinfo_cache_found(&dset->shared->cache.chunk.last, udata)) {
-            H5D_chk_idx_info_t idx_info; /* Chunked index info */
+            H5D_chk_idx_info_t idx_info;   /* Chunked index info */
+            hbool_t            idx_cached; /* Whether the file's chunk index cache is used */
+
+            /* Check the file's chunk index cache, which outlives the dataset */
+            idx_cached = H5D__chunk_idx_cache_enabled(dset->oloc.file, sc);
+            if (idx_cached && H5D__chunk_idx_cache_found(dset->oloc.file, udata)) {
+                H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, udata);
+                HGOTO_DONE(SUCCEED)
+            } /* end if */
 
             /* Compose chunked index info struct */
             idx_info.f       = dset->oloc.file;
@@ -3266,6 +5060,10 @@ H5D__chunk_lookup(const H5D_t *dset, const hsize_t *scaled, H5D_chunk_ud_t *udat
                   (H5F_INTENT(dset->oloc.file) & H5F_ACC_RDWR) && dset->shared->dcpl_cache.pline.nused))
 #endif
                 H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, udata);
+
+            /* Remember the chunk's record for later opens of the dataset too */
+            if (idx_cached && H5D__chunk_idx_cache_add(dset->oloc.file, udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't add chunk record to chunk index cache")
         } /* end if */
     }     /* end else */
 
@@ -3281,6 +5079,10 @@ done:
  *        the RESET flag is turned on because it results in one fewer
  *        memory copy.
  *
+ *        If JOB is non-NULL, it holds a copy of the chunk that has
+ *        already been run through the filter pipeline successfully.
+ *        Its buffer is released by this routine.
+ *
  * Return:    Non-negative on success/Negative on failure
  *
  * Programmer:    Robb Matzke
@@ -3289,7 +5091,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
+H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset, H5D_chunk_filter_job_t *job)
 {
     void *               buf                = NULL; /* Temporary buffer        */
     hbool_t              point_of_no_return = FALSE;
@@ -3303,6 +5105,7 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
     H5D_CHUNK_STORAGE_INDEX_CHK(sc);
     HDassert(ent);
     HDassert(!ent->locked);
+    HDassert(!job || (job->buf && job->status >= 0));
 
     buf = ent->chunk;
     if (ent->dirty) {
@@ -3321,43 +5124,53 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
         udata.chunk_idx          = ent->chunk_idx;
 
         /* Should the chunk be filtered before writing it to disk? */
-        if (dset->shared->dcpl_cache.pline.nused && !(ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)) {
-            H5Z_EDC_t err_detect;                       /* Error detection info */
-            H5Z_cb_t  filter_cb;                        /* I/O filter callback function */
-            size_t    alloc = udata.chunk_block.length; /* Bytes allocated for BUF    */
-            size_t    nbytes;                           /* Chunk size (in bytes) */
-
-            /* Retrieve filter settings from API context */
-            if (H5CX_get_err_detect(&err_detect) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
-            if (H5CX_get_filter_cb(&filter_cb) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
-
-            if (!reset) {
-                /*
-                 * Copy the chunk to a new buffer before running it through
-                 * the pipeline because we'll want to save the original buffer
-                 * for later.
-                 */
-                if (NULL == (buf = H5MM_malloc(alloc)))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
-                H5MM_memcpy(buf, ent->chunk, alloc);
+        if (dset->shared->dcpl_cache.pline.nused && !(ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)) {
+            size_t nbytes; /* Chunk size (in bytes) */
+
+            if (job) {
+                /* The chunk has already been filtered */
+                buf               = job->buf;
+                nbytes            = job->nbytes;
+                udata.filter_mask = job->filter_mask;
+                job->buf          = NULL;
             } /* end if */
             else {
-                /*
-                 * If we are resetting and something goes wrong after this
-                 * point then it's too late to recover because we may have
-                 * destroyed the original data by calling H5Z_pipeline().
-                 * The only safe option is to continue with the reset
-                 * even if we can't write the data to disk.
-                 */
-                point_of_no_return = TRUE;
-                ent->chunk         = NULL;
+                H5Z_EDC_t err_detect;                       /* Error detection info */
+                H5Z_cb_t  filter_cb;                        /* I/O filter callback function */
+                size_t    alloc = udata.chunk_block.length; /* Bytes allocated for BUF    */
+
+                /* Retrieve filter settings from API context */
+                if (H5CX_get_err_detect(&err_detect) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+                if (H5CX_get_filter_cb(&filter_cb) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+
+                if (!reset) {
+                    /*
+                     * Copy the chunk to a new buffer before running it through
+                     * the pipeline because we'll want to save the original buffer
+                     * for later.
+                     */
+                    if (NULL == (buf = H5MM_malloc(alloc)))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+                    H5MM_memcpy(buf, ent->chunk, alloc);
+                } /* end if */
+                else {
+                    /*
+                     * If we are resetting and something goes wrong after this
+                     * point then it's too late to recover because we may have
+                     * destroyed the original data by calling H5Z_pipeline().
+                     * The only safe option is to continue with the reset
+                     * even if we can't write the data to disk.
+                     */
+                    point_of_no_return = TRUE;
+                    ent->chunk         = NULL;
+                } /* end else */
+                H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
+                if (H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask), err_detect,
+                                 filter_cb, &nbytes, &alloc, &buf) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
             } /* end else */
-            H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
-            if (H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask), err_detect,
-                             filter_cb, &nbytes, &alloc, &buf) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
 #if H5_SIZEOF_SIZE_T > 4
             /* Check for the chunk expanding too much to encode in a 32-bit value */
             if (nbytes > ((size_t)0xffffffff))
@@ -3419,9 +5232,11 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
             HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
 
         /* Insert the chunk record into the index */
-        if (need_insert && sc->ops->insert)
+        if (need_insert && sc->ops->insert) {
             if ((sc->ops->insert)(&idx_info, &udata, dset) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+            H5D__chunk_idx_cache_update(idx_info.f, &udata);
+        } /* end if */
 
         /* Cache the chunk's info, in case it's accessed again shortly */
         H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, &udata);
@@ -3466,6 +5281,236 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_flush_entry() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_filter_batch_size
+ *
+ * Purpose:    Determine how many chunks of a dataset should be gathered
+ *        into one batch for the filter pipeline.
+ *
+ * Return:    Max. # of chunks in a batch, or 0 when chunks should be
+ *        filtered one at a time
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5D__chunk_filter_batch_size(const H5D_t *dset)
+{
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk); /* Raw data chunk cache */
+    size_t            chunk_size;                          /* Size of a chunk */
+    size_t            ret_value = 0;                       /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(dset);
+
+    /* Only batch chunks when there are several filter threads and filters to
+     * run.  (Filtered chunks with MPI-based drivers are handled collectively
+     * in H5Dmpio.c)
+     */
+    if (rdcc->filter_nthreads > 1 && dset->shared->dcpl_cache.pline.nused > 0 &&
+        !H5F_HAS_FEATURE(dset->oloc.file, H5FD_FEAT_HAS_MPI)) {
+        H5_CHECKED_ASSIGN(chunk_size, size_t, dset->shared->layout.u.chunk.size, uint32_t);
+
+        ret_value = MIN((size_t)rdcc->filter_nthreads * H5D_CHUNK_FILTER_BATCH_PER_THREAD,
+                        H5D_CHUNK_FILTER_BATCH_NBYTES / MAX(chunk_size, 1));
+        if (ret_value < 2)
+            ret_value = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filter_batch_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_filter_job_cb
+ *
+ * Purpose:    Runs one filter job through the filter pipeline.  This may
+ *        be called from a thread other than the one that made the
+ *        library call, so it only uses the information in the job and
+ *        the callback info.
+ *
+ *        No filter callback is used: a chunk that fails is simply
+ *        marked as such, and the caller then processes it with the
+ *        usual serial code, which invokes the application's callback.
+ *
+ * Return:    void (success or failure is recorded in the job)
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_filter_job_cb(size_t job_idx, void *_udata)
+{
+    H5D_chunk_filter_ud_t * udata     = (H5D_chunk_filter_ud_t *)_udata; /* Callback info */
+    H5D_chunk_filter_job_t *job       = &(udata->jobs[job_idx]);         /* Job to run */
+    H5Z_cb_t                filter_cb = {NULL, NULL};                    /* I/O filter callback function */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (job->buf) {
+        job->status = H5Z_pipeline(udata->pline, udata->flags, &(job->filter_mask), udata->err_detect,
+                                   filter_cb, &(job->nbytes), &(job->buf_alloc), &(job->buf));
+
+        /* Don't leave errors for the chunk behind on this thread's stack */
+        if (job->status < 0)
+            H5E_clear_stack(NULL);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_filter_job_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_filter_jobs
+ *
+ * Purpose:    Runs the dataset's filter pipeline (in the direction given
+ *        by FLAGS) on each of the NJOBS jobs that has a buffer, using
+ *        the number of threads set for the dataset when the library is
+ *        thread-safe.
+ *
+ *        A job that fails isn't an error here; its status is set to
+ *        a negative value instead.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_filter_jobs(const H5D_t *dset, unsigned flags, H5D_chunk_filter_job_t *jobs, size_t njobs)
+{
+    H5D_chunk_filter_ud_t udata;               /* Callback info for jobs */
+    size_t                u;                   /* Local index variable */
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(dset);
+    HDassert(jobs || njobs == 0);
+
+    /* Set up callback info */
+    udata.pline = &(dset->shared->dcpl_cache.pline);
+    udata.flags = flags;
+    udata.jobs  = jobs;
+    if (H5CX_get_err_detect(&udata.err_detect) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+
+#ifdef H5D_CHUNK_FILTER_THREADS
+    {
+        unsigned nthreads = dset->shared->cache.chunk.filter_nthreads; /* # of threads to use */
+
+        /* Make certain that every filter is loaded now, so that the filter
+         * table isn't changed while other threads are using it
+         */
+        for (u = 0; u < udata.pline->nused; u++) {
+            htri_t avail; /* Whether the filter is available */
+
+            if ((avail = H5Z_filter_avail(udata.pline->filter[u].id)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check filter availability")
+            if (!avail)
+                nthreads = 1;
+        } /* end for */
+
+        if (nthreads > 1 && njobs > 1) {
+            if (H5TS_run_tasks(nthreads, njobs, H5D__chunk_filter_job_cb, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "can't run filter pipeline in threads")
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    }
+#endif /* H5D_CHUNK_FILTER_THREADS */
+
+    /* Run the jobs in this thread */
+    for (u = 0; u < njobs; u++)
+        H5D__chunk_filter_job_cb(u, &udata);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filter_jobs() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_flush_entries
+ *
+ * Purpose:    Writes several chunks to disk, as H5D__chunk_flush_entry()
+ *        does for one chunk, but runs the filter pipeline for all of
+ *        them at once first (see H5D__chunk_filter_jobs()).  The
+ *        chunks are still written out one at a time, in order.
+ *
+ *        If RESET is non-zero, each entry's chunk buffer is released,
+ *        even if writing the chunk fails.
+ *
+ * Return:    Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_flush_entries(const H5D_t *dset, H5D_rdcc_ent_t **ents, size_t nents, hbool_t reset)
+{
+    const H5O_pline_t *     pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info */
+    H5D_chunk_filter_job_t *jobs  = NULL;                              /* Filter jobs for chunks */
+    size_t                  chunk_size;                                /* Size of a chunk */
+    size_t                  njobs   = 0;                               /* # of chunks to filter */
+    unsigned                nerrors = 0; /* Count of any errors encountered when flushing chunks */
+    size_t                  u;           /* Local index variable */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(dset);
+    HDassert(ents || nents == 0);
+
+    H5_CHECKED_ASSIGN(chunk_size, size_t, dset->shared->layout.u.chunk.size, uint32_t);
+
+    /* Copy the dirty chunks that need filtering into job buffers */
+    if (nents > 0 && NULL == (jobs = (H5D_chunk_filter_job_t *)H5MM_calloc(nents * sizeof(*jobs))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for filter jobs")
+    for (u = 0; u < nents; u++) {
+        jobs[u].status = FAIL;
+        if (ents[u]->dirty && pline->nused && !(ents[u]->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)) {
+            if (NULL == (jobs[u].buf = H5MM_malloc(chunk_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+            H5MM_memcpy(jobs[u].buf, ents[u]->chunk, chunk_size);
+            jobs[u].nbytes    = chunk_size;
+            jobs[u].buf_alloc = chunk_size;
+            njobs++;
+        } /* end if */
+    }     /* end for */
+
+    /* Run the filter pipeline on them */
+    if (njobs > 0 && H5D__chunk_filter_jobs(dset, 0, jobs, nents) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "output pipeline failed")
+
+    /* Write out the chunks */
+    for (u = 0; u < nents; u++) {
+        H5D_chunk_filter_job_t *job = NULL; /* Filtered chunk to write */
+
+        /* Chunks that failed in the pipeline are filtered again when flushed */
+        if (jobs[u].buf) {
+            if (jobs[u].status >= 0)
+                job = &jobs[u];
+            else
+                jobs[u].buf = H5MM_xfree(jobs[u].buf);
+        } /* end if */
+
+        if (H5D__chunk_flush_entry(dset, ents[u], reset, job) < 0)
+            nerrors++;
+
+        /* Release the chunk, if a failed flush didn't */
+        if (reset && ents[u]->chunk)
+            ents[u]->chunk = (uint8_t *)H5D__chunk_mem_xfree(
+                ents[u]->chunk, ((ents[u]->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS) ? NULL : pline));
+    } /* end for */
+    if (nerrors)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
+
+done:
+    if (jobs) {
+        for (u = 0; u < nents; u++)
+            H5MM_xfree(jobs[u].buf);
+        H5MM_xfree(jobs);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_flush_entries() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_cache_evict
  *
@@ -3495,7 +5540,7 @@ H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
 
     if (flush) {
         /* Flush */
-        if (H5D__chunk_flush_entry(dset, ent, TRUE) < 0)
+        if (H5D__chunk_flush_entry(dset, ent, TRUE, NULL) < 0)
             HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
     } /* end if */
     else {
@@ -3533,6 +5578,10 @@ H5D__chunk_cache_evict(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t flush)
          */
         rdcc->slot[ent->idx] = NULL;
 
+    /* Unlink from the file's shared cache */
+    if (rdcc->shared_cache)
+        H5D__chunk_shared_cache_remove(rdcc, ent);
+
     /* Remove from cache */
     HDassert(rdcc->slot[ent->idx] != ent);
     ent->idx = UINT_MAX;
@@ -3573,6 +5622,14 @@ H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
 
     FUNC_ENTER_STATIC
 
+    /* Chunks in the file's shared cache are preempted in LRU order,
+     * whichever dataset they belong to */
+    if (rdcc->shared_cache) {
+        if (H5D__chunk_shared_cache_prune(dset, size) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /*
      * Preemption is accomplished by having multiple pointers (currently two)
      * slide down the list beginning at the head. Pointer p(N+1) will start
@@ -3634,6 +5691,7 @@ H5D__chunk_cache_prune(const H5D_t *dset, size_t size)
                     if (n[j] == cur)
                         n[j] = cur->next;
                 } /* end for */
+                dset->shared->cache.chunk.stats.nevictions++;
                 if (H5D__chunk_cache_evict(dset, cur, TRUE) < 0)
                     nerrors++;
             } /* end if */
@@ -3653,6 +5711,176 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_cache_prune() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_shared_cache_prune
+ *
+ * Purpose:     Prune the file's shared chunk cache by preempting its least
+ *              recently used (unlocked) chunks, of any dataset, until it
+ *              has room for something which is SIZE bytes.
+ *
+ *              The chunks of other datasets are flushed through a stand-in
+ *              for one of their dataset objects, which has the same object
+ *              header and file (the dataset may be open through another
+ *              file ID), with their metadata tagged accordingly.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_shared_cache_prune(const H5D_t *dset, size_t size)
+{
+    H5D_shared_chunk_cache_t *cache = dset->shared->cache.chunk.shared_cache; /* File's shared cache */
+    H5D_rdcc_ent_t *          ent, *prev;       /* Current & previous (more recently used) entries */
+    int                       nerrors   = 0;    /* Accumulated error count during preemptions */
+    herr_t                    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(cache);
+
+    for (ent = cache->tail; ent && (cache->nbytes_used + size) > cache->nbytes_max; ent = prev) {
+        prev = ent->shared_prev;
+        if (ent->locked)
+            continue;
+
+        ent->owner->cache.chunk.stats.nevictions++;
+        if (ent->owner == dset->shared) {
+            if (H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
+                nerrors++;
+        } /* end if */
+        else {
+            H5D_t owner_dset; /* Stand-in for the owner of the chunk */
+
+            HDmemset(&owner_dset, 0, sizeof(owner_dset));
+            owner_dset.oloc.file = dset->oloc.file;
+            owner_dset.oloc.addr = ent->owner->cache.chunk.oh_addr;
+            owner_dset.shared    = ent->owner;
+
+            H5_BEGIN_TAG(owner_dset.oloc.addr)
+            if (H5D__chunk_cache_evict(&owner_dset, ent, TRUE) < 0)
+                nerrors++;
+            H5_END_TAG
+        } /* end else */
+    }     /* end for */
+
+    if (nerrors)
+        HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_shared_cache_prune() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_shared_cache_touch
+ *
+ * Purpose:     Makes a chunk the most recently used in the file's shared
+ *              chunk cache, adding it if it isn't there yet.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_shared_cache_touch(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent)
+{
+    H5D_shared_chunk_cache_t *cache = rdcc->shared_cache; /* File's shared cache */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(cache);
+    HDassert(ent);
+
+    ent->stamp = ++cache->clock;
+    if (cache->head != ent) {
+        /* Unlink from the list, if the chunk is already on it */
+        if (ent->shared_prev) {
+            ent->shared_prev->shared_next = ent->shared_next;
+            if (ent->shared_next)
+                ent->shared_next->shared_prev = ent->shared_prev;
+            else
+                cache->tail = ent->shared_prev;
+        } /* end if */
+
+        /* Link at the head */
+        ent->shared_prev = NULL;
+        ent->shared_next = cache->head;
+        if (cache->head)
+            cache->head->shared_prev = ent;
+        else
+            cache->tail = ent;
+        cache->head = ent;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5D__chunk_shared_cache_touch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_shared_cache_remove
+ *
+ * Purpose:     Removes a chunk that's being evicted from the file's shared
+ *              chunk cache.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_shared_cache_remove(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent)
+{
+    H5D_shared_chunk_cache_t *cache = rdcc->shared_cache; /* File's shared cache */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(cache);
+    HDassert(ent);
+    HDassert(ent->owner);
+
+    if (ent->shared_prev)
+        ent->shared_prev->shared_next = ent->shared_next;
+    else
+        cache->head = ent->shared_next;
+    if (ent->shared_next)
+        ent->shared_next->shared_prev = ent->shared_prev;
+    else
+        cache->tail = ent->shared_prev;
+    ent->shared_prev = ent->shared_next = NULL;
+
+    HDassert(cache->nbytes_used >= ent->owner->layout.u.chunk.size);
+    cache->nbytes_used -= ent->owner->layout.u.chunk.size;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5D__chunk_shared_cache_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D_shared_chunk_cache_dest
+ *
+ * Purpose:     Destroy a file's shared raw data chunk cache, when the file
+ *              is closed.  The chunks have already been evicted when the
+ *              datasets were closed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_shared_chunk_cache_dest(H5D_shared_chunk_cache_t *cache)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity checks */
+    HDassert(cache);
+    HDassert(NULL == cache->head);
+    HDassert(0 == cache->nbytes_used);
+
+    cache = H5FL_FREE(H5D_shared_chunk_cache_t, cache);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5D_shared_chunk_cache_dest() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_lock
  *
@@ -3671,6 +5899,13 @@ done:
  *        for output functions that are about to overwrite the entire
  *        chunk.
  *
+ *        If FILTERED_CHUNK is non-NULL, the chunk isn't in the cache
+ *        and it has already been read from the file (and run through
+ *        the filter pipeline, if the dataset has filters) into that
+ *        buffer (allocated with H5D__chunk_mem_alloc()), which is used
+ *        instead of reading the chunk again.  The buffer is owned by this routine afterwards,
+ *        even on failure.
+ *
  * Return:    Success:    Ptr to a file chunk.
  *
  *        Failure:    NULL
@@ -3681,7 +5916,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static void *
-H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t relax, hbool_t prev_unfilt_chunk)
+H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t relax, hbool_t prev_unfilt_chunk,
+                void *filtered_chunk)
 {
     const H5D_t *      dset = io_info->dset; /* Local pointer to the dataset info */
     const H5O_pline_t *pline =
@@ -3708,6 +5944,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
     HDassert(dset);
     HDassert(!(udata->new_unfilt_chunk && prev_unfilt_chunk));
     HDassert(!rdcc->tmp_head);
+    HDassert(!filtered_chunk || (UINT_MAX == udata->idx_hint && !relax && !prev_unfilt_chunk));
 
     /* Get the chunk's size */
     HDassert(layout->u.chunk.size > 0);
@@ -3815,7 +6052,11 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
             ent->next       = ent->next->next;
             ent->prev->next = ent;
         } /* end if */
-    }     /* end if */
+
+        /* Make the chunk the most recently used in the file's shared cache */
+        if (rdcc->shared_cache)
+            H5D__chunk_shared_cache_touch(rdcc, ent);
+    } /* end if */
     else {
         haddr_t chunk_addr;  /* Address of chunk on disk */
         hsize_t chunk_alloc; /* Length of chunk on disk */
@@ -3876,8 +6117,19 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
              *      or an init if it isn't.
              */
 
+            /* Check if the chunk was already read (& filtered) */
+            if (filtered_chunk) {
+                HDassert(H5F_addr_defined(chunk_addr));
+                HDassert(old_pline == pline);
+
+                chunk          = filtered_chunk;
+                filtered_chunk = NULL;
+
+                /* Increment # of cache misses */
+                rdcc->stats.nmisses++;
+            } /* end if */
             /* Check if the chunk exists on disk */
-            if (H5F_addr_defined(chunk_addr)) {
+            else if (H5F_addr_defined(chunk_addr)) {
                 size_t my_chunk_alloc = chunk_alloc; /* Allocated buffer size */
                 size_t buf_alloc      = chunk_alloc; /* [Re-]allocated buffer size */
 
@@ -3968,15 +6220,19 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
         }     /* end else */
 
         /* See if the chunk can be cached */
-        if (rdcc->nslots > 0 && chunk_size <= rdcc->nbytes_max) {
+        if (rdcc->nslots > 0 && chunk_size <= H5D_RDCC_NBYTES_MAX(rdcc)) {
+            hbool_t found; /* Whether the chunk is in the cache already */
+
             /* Calculate the index */
-            udata->idx_hint = H5D__chunk_hash_val(io_info->dset->shared, udata->common.scaled);
+            udata->idx_hint = H5D__chunk_cache_find_slot(io_info->dset->shared, udata->common.scaled, &found);
 
             /* Add the chunk to the cache only if the slot is not already locked */
             ent = rdcc->slot[udata->idx_hint];
             if (!ent || !ent->locked) {
                 /* Preempt enough things from the cache to make room */
                 if (ent) {
+                    if (!found)
+                        rdcc->stats.nevictions++;
                     if (H5D__chunk_cache_evict(io_info->dset, ent, TRUE) < 0)
                         HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk from cache")
                 } /* end if */
@@ -4007,6 +6263,13 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata, hbool_t rel
                 rdcc->nbytes_used += chunk_size;
                 rdcc->nused++;
 
+                /* Add it to the file's shared cache */
+                if (rdcc->shared_cache) {
+                    ent->owner = dset->shared;
+                    H5D__chunk_shared_cache_touch(rdcc, ent);
+                    rdcc->shared_cache->nbytes_used += chunk_size;
+                } /* end if */
+
                 /* Add it to the linked list */
                 if (rdcc->tail) {
                     rdcc->tail->next = ent;
@@ -4054,9 +6317,67 @@ done:
         if (chunk)
             chunk = H5D__chunk_mem_xfree(chunk, pline);
 
+    /* Release the filtered chunk passed in, if it wasn't used */
+    if (filtered_chunk)
+        filtered_chunk = H5D__chunk_mem_xfree(filtered_chunk, &(dset->shared->dcpl_cache.pline));
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_lock() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_fake_ent_init
+ *
+ * Purpose:    Sets up a "fake" chunk cache entry for a dirty chunk that
+ *        was locked but isn't in the cache, so it can be written out
+ *        with H5D__chunk_flush_entry().  UDATA and CHUNK are the index
+ *        information and buffer for the chunk from H5D__chunk_lock().
+ *
+ * Return:    void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_fake_ent_init(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, void *chunk,
+                         H5D_rdcc_ent_t *fake_ent)
+{
+    const H5O_layout_t *layout                   = &(io_info->dset->shared->layout); /* Dataset layout */
+    hbool_t             is_unfiltered_edge_chunk = FALSE; /* Whether the chunk is an unfiltered edge chunk */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(UINT_MAX == udata->idx_hint);
+    HDassert(fake_ent);
+
+    /* Check if we should disable filters on this chunk */
+    if (udata->new_unfilt_chunk) {
+        HDassert(layout->u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS);
+
+        is_unfiltered_edge_chunk = TRUE;
+    } /* end if */
+    else if (layout->u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS) {
+        /* Check if the chunk is an edge chunk, and disable filters if so */
+        is_unfiltered_edge_chunk =
+            H5D__chunk_is_partial_edge_chunk(io_info->dset->shared->ndims, layout->u.chunk.dim,
+                                             io_info->store->chunk.scaled, io_info->dset->shared->curr_dims);
+    } /* end if */
+
+    HDmemset(fake_ent, 0, sizeof(*fake_ent));
+    fake_ent->dirty = TRUE;
+    if (is_unfiltered_edge_chunk)
+        fake_ent->edge_chunk_state = H5D_RDCC_DISABLE_FILTERS;
+    if (udata->new_unfilt_chunk)
+        fake_ent->edge_chunk_state |= H5D_RDCC_NEWLY_DISABLED_FILTERS;
+    H5MM_memcpy(fake_ent->scaled, udata->common.scaled, sizeof(hsize_t) * layout->u.chunk.ndims);
+    HDassert(layout->u.chunk.size > 0);
+    fake_ent->chunk_idx          = udata->chunk_idx;
+    fake_ent->chunk_block.offset = udata->chunk_block.offset;
+    fake_ent->chunk_block.length = udata->chunk_block.length;
+    fake_ent->chunk              = (uint8_t *)chunk;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_fake_ent_init() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_unlock
  *
@@ -4083,9 +6404,8 @@ static herr_t
 H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, hbool_t dirty, void *chunk,
                   uint32_t naccessed)
 {
-    const H5O_layout_t *layout    = &(io_info->dset->shared->layout); /* Dataset layout */
-    const H5D_rdcc_t *  rdcc      = &(io_info->dset->shared->cache.chunk);
-    herr_t              ret_value = SUCCEED; /* Return value */
+    const H5D_rdcc_t *rdcc      = &(io_info->dset->shared->cache.chunk);
+    herr_t            ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -4098,44 +6418,19 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata, hbo
          * It's not in the cache, probably because it's too big.  If it's
          * dirty then flush it to disk.  In any case, free the chunk.
          */
-        hbool_t is_unfiltered_edge_chunk = FALSE; /* Whether the chunk is an unfiltered edge chunk */
-
-        /* Check if we should disable filters on this chunk */
-        if (udata->new_unfilt_chunk) {
-            HDassert(layout->u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS);
+        H5D_rdcc_ent_t fake_ent; /* "fake" chunk cache entry */
 
-            is_unfiltered_edge_chunk = TRUE;
-        } /* end if */
-        else if (layout->u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS) {
-            /* Check if the chunk is an edge chunk, and disable filters if so */
-            is_unfiltered_edge_chunk = H5D__chunk_is_partial_edge_chunk(
-                io_info->dset->shared->ndims, layout->u.chunk.dim, io_info->store->chunk.scaled,
-                io_info->dset->shared->curr_dims);
-        } /* end if */
+        H5D__chunk_fake_ent_init(io_info, udata, chunk, &fake_ent);
 
         if (dirty) {
-            H5D_rdcc_ent_t fake_ent; /* "fake" chunk cache entry */
-
-            HDmemset(&fake_ent, 0, sizeof(fake_ent));
-            fake_ent.dirty = TRUE;
-            if (is_unfiltered_edge_chunk)
-                fake_ent.edge_chunk_state = H5D_RDCC_DISABLE_FILTERS;
-            if (udata->new_unfilt_chunk)
-                fake_ent.edge_chunk_state |= H5D_RDCC_NEWLY_DISABLED_FILTERS;
-            H5MM_memcpy(fake_ent.scaled, udata->common.scaled, sizeof(hsize_t) * layout->u.chunk.ndims);
-            HDassert(layout->u.chunk.size > 0);
-            fake_ent.chunk_idx          = udata->chunk_idx;
-            fake_ent.chunk_block.offset = udata->chunk_block.offset;
-            fake_ent.chunk_block.length = udata->chunk_block.length;
-            fake_ent.chunk              = (uint8_t *)chunk;
-
-            if (H5D__chunk_flush_entry(io_info->dset, &fake_ent, TRUE) < 0)
+            if (H5D__chunk_flush_entry(io_info->dset, &fake_ent, TRUE, NULL) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
         } /* end if */
         else {
             if (chunk)
-                chunk = H5D__chunk_mem_xfree(
-                    chunk, (is_unfiltered_edge_chunk ? NULL : &(io_info->dset->shared->dcpl_cache.pline)));
+                chunk = H5D__chunk_mem_xfree(chunk, ((fake_ent.edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)
+                                                         ? NULL
+                                                         : &(io_info->dset->shared->dcpl_cache.pline)));
         } /* end else */
     }     /* end if */
     else {
@@ -4222,7 +6517,7 @@ H5D__chunk_allocated(const H5D_t *dset, hsize_t *nbytes)
     /* Search for cached chunks that haven't been written out */
     for (ent = rdcc->head; ent; ent = ent->next)
         /* Flush the chunk out to disk, to make certain the size is correct later */
-        if (H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
+        if (H5D__chunk_flush_entry(dset, ent, FALSE, NULL) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
 
     /* Compose chunked index info struct */
@@ -4632,9 +6927,11 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
             }     /* end if */
 
             /* Insert the chunk record into the index */
-            if (need_insert && ops->insert)
+            if (need_insert && ops->insert) {
                 if ((ops->insert)(&idx_info, &udata, dset) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+                H5D__chunk_idx_cache_update(idx_info.f, &udata);
+            } /* end if */
 
             /* Increment indices and adjust the edge chunk state */
             carry = TRUE;
@@ -4844,7 +7141,7 @@ H5D__chunk_update_old_edge_chunks(H5D_t *dset, hsize_t old_dim[])
             if (H5F_addr_defined(chk_udata.chunk_block.offset) || (UINT_MAX != chk_udata.idx_hint)) {
                 /* Lock the chunk into cache.  H5D__chunk_lock will take care of
                  * updating the chunk to no longer be an edge chunk. */
-                if (NULL == (chunk = (void *)H5D__chunk_lock(&chk_io_info, &chk_udata, FALSE, TRUE)))
+                if (NULL == (chunk = (void *)H5D__chunk_lock(&chk_io_info, &chk_udata, FALSE, TRUE, NULL)))
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to lock raw data chunk")
 
                 /* Unlock the chunk */
@@ -5151,7 +7448,7 @@ H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to select hyperslab")
 
     /* Lock the chunk into the cache, to get a pointer to the chunk buffer */
-    if (NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE, FALSE)))
+    if (NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE, FALSE, NULL)))
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to lock raw data chunk")
 
     /* Fill the selection in the memory buffer */
@@ -5567,6 +7864,7 @@ H5D__chunk_prune_by_extent(H5D_t *dset, const hsize_t *old_dim)
                     if ((sc->ops->remove)(&idx_info, &idx_udata) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTDELETE, FAIL,
                                     "unable to remove chunk entry from index")
+                    H5D__chunk_idx_cache_evict(idx_info.f, sc->idx_addr, &idx_udata);
                 } /* end if */
             }     /* end else */
 
@@ -5772,6 +8070,9 @@ H5D__chunk_delete(H5F_t *f, H5O_t *oh, H5O_storage_t *storage)
     idx_info.layout  = &layout.u.chunk;
     idx_info.storage = &storage->u.chunk;
 
+    /* Forget the index's records */
+    H5D__chunk_idx_cache_evict(f, storage->u.chunk.idx_addr, NULL);
+
     /* Delete the chunked storage information in the file */
     if ((storage->u.chunk.ops->idx_delete)(&idx_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTDELETE, FAIL, "unable to delete chunk index")
@@ -5837,6 +8138,22 @@ H5D__chunk_update_cache(H5D_t *dset)
         old_idx  = ent->idx; /* Save for later */
         ent->idx = H5D__chunk_hash_val(dset->shared, ent->scaled);
 
+        /* When the chunk may go in a set of slots, leave it where it is if
+         * that's in the set, otherwise prefer an empty slot */
+        if (rdcc->nways > 1) {
+            unsigned first = ent->idx; /* First slot of the chunk's set */
+            unsigned u;                /* Local index variable */
+
+            if (!ent->tmp_prev && old_idx >= first && old_idx < first + rdcc->nways)
+                ent->idx = old_idx;
+            else
+                for (u = first; u < first + rdcc->nways; u++)
+                    if (NULL == rdcc->slot[u]) {
+                        ent->idx = u;
+                        break;
+                    } /* end if */
+        }             /* end if */
+
         if (old_idx != ent->idx) {
             H5D_rdcc_ent_t *old_ent; /* Old cache entry  */
 
@@ -5890,6 +8207,7 @@ H5D__chunk_update_cache(H5D_t *dset)
         ent = tmp_head.tmp_next;
 
         /* Remove the old entry from the cache */
+        rdcc->stats.nevictions++;
         if (H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
             HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
     } /* end while */
@@ -5997,28 +8315,17 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
     else {
         H5D_rdcc_ent_t *ent = NULL; /* Cache entry */
         unsigned        idx;        /* Index of chunk in cache, if present */
-        unsigned        u;          /* Counter */
         H5D_shared_t *  shared_fo = (H5D_shared_t *)udata->cpy_info->shared_fo;
 
         /* See if the written chunk is in the chunk cache */
         if (shared_fo && shared_fo->cache.chunk.nslots > 0) {
             /* Determine the chunk's location in the hash table */
-            idx = H5D__chunk_hash_val(shared_fo, chunk_rec->scaled);
+            idx = H5D__chunk_cache_find_slot(shared_fo, chunk_rec->scaled, &udata->chunk_in_cache);
 
             /* Get the chunk cache entry for that location */
-            ent = shared_fo->cache.chunk.slot[idx];
-            if (ent) {
-                /* Speculatively set the 'found' flag */
-                udata->chunk_in_cache = TRUE;
-
-                /* Verify that the cache entry is the correct chunk */
-                for (u = 0; u < shared_fo->ndims; u++)
-                    if (chunk_rec->scaled[u] != ent->scaled[u]) {
-                        udata->chunk_in_cache = FALSE;
-                        break;
-                    } /* end if */
-            }         /* end if */
-        }             /* end if */
+            if (udata->chunk_in_cache)
+                ent = shared_fo->cache.chunk.slot[idx];
+        } /* end if */
 
         if (udata->chunk_in_cache) {
             HDassert(H5F_addr_defined(chunk_rec->chunk_addr));
@@ -6243,6 +8550,9 @@ H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src, H5O_layout_chunk
                     "unable to set up index-specific chunk copying information")
     copy_setup_done = TRUE;
 
+    /* Forget any records of an earlier index at the new index's address */
+    H5D__chunk_idx_cache_evict(f_dst, storage_dst->idx_addr, NULL);
+
     /* Create datatype ID for src datatype */
     if ((tid_src = H5I_register(H5I_DATATYPE, dt_src, FALSE)) < 0)
         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTREGISTER, FAIL, "unable to register source file datatype")
@@ -6847,6 +9157,14 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
 
     *need_insert = FALSE;
 
+    /* Chunks of sharded datasets are placed in their shards */
+    if (H5D_CHUNK_IDX_SHARD == idx_info->storage->idx_type) {
+        if (H5D__shard_file_alloc(idx_info, new_chunk, scaled) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk in shard")
+        *need_insert = TRUE;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Check for filters on chunks */
     if (idx_info->pline->nused > 0) {
         /* Sanity/error checking block */
@@ -6933,6 +9251,7 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
                 *need_insert = TRUE;
                 break;
 
+            case H5D_CHUNK_IDX_SHARD: /* Handled above */
             case H5D_CHUNK_IDX_NTYPES:
             default:
                 HDassert(0 && "This should never be executed!");
@@ -7074,6 +9393,9 @@ H5D__chunk_format_convert(H5D_t *dset, H5D_chk_idx_info_t *idx_info, H5D_chk_idx
     udata.dset_ndims   = dset->shared->ndims;
     udata.dset_dims    = dset->shared->curr_dims;
 
+    /* Forget any records of an earlier index at the new index's address */
+    H5D__chunk_idx_cache_evict(new_idx_info->f, new_idx_info->storage->idx_addr, NULL);
+
     /* Iterate over the chunks in the current index and insert the chunk addresses into version 1 B-tree index
      */
     if ((idx_info->storage->ops->iterate)(idx_info, H5D__chunk_format_convert_cb, &udata) < 0)
@@ -7152,7 +9474,7 @@ H5D__get_num_chunks(const H5D_t *dset, const H5S_t H5_ATTR_UNUSED *space, hsize_
     /* Search for cached chunks that haven't been written out */
     for (ent = rdcc->head; ent; ent = ent->next)
         /* Flush the chunk out to disk, to make certain the size is correct later */
-        if (H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
+        if (H5D__chunk_flush_entry(dset, ent, FALSE, NULL) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
 
     /* Compose chunked index info struct */
@@ -7266,7 +9588,7 @@ H5D__get_chunk_info(const H5D_t *dset, const H5S_t H5_ATTR_UNUSED *space, hsize_
     /* Search for cached chunks that haven't been written out */
     for (ent = rdcc->head; ent; ent = ent->next)
         /* Flush the chunk out to disk, to make certain the size is correct later */
-        if (H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
+        if (H5D__chunk_flush_entry(dset, ent, FALSE, NULL) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
 
     /* Compose chunked index info struct */
@@ -7405,7 +9727,7 @@ H5D__get_chunk_info_by_coord(const H5D_t *dset, const hsize_t *offset, unsigned
     /* Search for cached chunks that haven't been written out */
     for (ent = rdcc->head; ent; ent = ent->next)
         /* Flush the chunk out to disk, to make certain the size is correct later */
-        if (H5D__chunk_flush_entry(dset, ent, FALSE) < 0)
+        if (H5D__chunk_flush_entry(dset, ent, FALSE, NULL) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
 
     /* Set addr & size for when dset is not written or queried chunk is not found */
@@ -83,6 +83,13 @@ typedef struct H5D_contig_writevv_ud_t {
     const unsigned char *wbuf;      /* Pointer to buffer to write */
 } H5D_contig_writevv_ud_t;
 
+/* Callback info for vector readvv/writevv operation */
+typedef struct H5D_contig_vector_ud_t {
+    haddr_t        dset_addr; /* Address of dataset */
+    unsigned char *buf;       /* Pointer to buffer to fill or write */
+    H5D_io_vec_t * io_vec;    /* I/O vector to append entries to */
+} H5D_contig_vector_ud_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -102,7 +109,15 @@ static ssize_t H5D__contig_writevv(const H5D_io_info_t *io_info, size_t dset_max
 static herr_t  H5D__contig_flush(H5D_t *dset);
 
 /* Helper routines */
-static herr_t H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset, size_t size);
+static herr_t  H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset, size_t size);
+static hbool_t H5D__contig_may_use_vector_io(const H5D_io_info_t *io_info, H5D_io_op_type_t op_type,
+                                             size_t dset_max_nseq, size_t dset_curr_seq,
+                                             const size_t dset_len_arr[], const hsize_t dset_off_arr[],
+                                             size_t mem_max_nseq, size_t mem_curr_seq);
+static ssize_t H5D__contig_vector_io(const H5D_io_info_t *io_info, H5D_io_op_type_t op_type,
+                                     size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[],
+                                     hsize_t dset_off_arr[], size_t mem_max_nseq, size_t *mem_curr_seq,
+                                     size_t mem_len_arr[], hsize_t mem_off_arr[]);
 
 /*********************/
 /* Package Variables */
@@ -668,6 +683,157 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_write_one() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_may_use_vector_io
+ *
+ * Purpose:	Decide whether a set of dataset sequences should be handed
+ *              to the file driver as a single vector I/O request instead
+ *              of going through the sieve buffer or being issued one
+ *              sequence at a time.
+ *
+ *              Vector I/O is used when the file driver implements it
+ *              natively, there is more than one sequence to transfer and
+ *              the dataset's sieve buffer doesn't hold data that the
+ *              vector operation would make stale (writes) or miss (reads
+ *              of dirty data).
+ *
+ * Return:	TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__contig_may_use_vector_io(const H5D_io_info_t *io_info, H5D_io_op_type_t op_type, size_t dset_max_nseq,
+                              size_t dset_curr_seq, const size_t dset_len_arr[], const hsize_t dset_off_arr[],
+                              size_t mem_max_nseq, size_t mem_curr_seq)
+{
+    hbool_t ret_value = TRUE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* A single sequence gains nothing from vector I/O and may benefit from the sieve buffer */
+    if ((dset_max_nseq - dset_curr_seq) < 2)
+        HGOTO_DONE(FALSE)
+
+    /* The vector length must fit in the file driver interface */
+    if (((dset_max_nseq - dset_curr_seq) + (mem_max_nseq - mem_curr_seq)) > UINT32_MAX)
+        HGOTO_DONE(FALSE)
+
+    /* Check if the driver would receive the sequences in a single call */
+    if (!H5F_shared_has_vector_io(io_info->f_sh))
+        HGOTO_DONE(FALSE)
+
+    /* Check for conflicts with the sieve buffer */
+    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+        const H5D_rdcdc_t *dset_contig = &(io_info->dset->shared->cache.contig);
+
+        if (dset_contig->sieve_buf && (op_type == H5D_IO_OP_WRITE || dset_contig->sieve_dirty)) {
+            haddr_t start = io_info->store->contig.dset_addr + dset_off_arr[dset_curr_seq];
+            haddr_t end   = io_info->store->contig.dset_addr + dset_off_arr[dset_max_nseq - 1] +
+                          dset_len_arr[dset_max_nseq - 1];
+
+            /* (Sequence offsets are monotonically increasing) */
+            if (H5F_addr_overlap(start, (hsize_t)(end - start), dset_contig->sieve_loc,
+                                 dset_contig->sieve_size))
+                HGOTO_DONE(FALSE)
+        } /* end if */
+    }     /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_may_use_vector_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vector_cb
+ *
+ * Purpose:	Callback operator for H5D__contig_vector_io(), appending
+ *              one entry to the I/O vector.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_vector_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata)
+{
+    H5D_contig_vector_ud_t *udata = (H5D_contig_vector_ud_t *)_udata; /* User data for H5VM_opvv() operator */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    H5D_io_vec_t *io_vec = udata->io_vec;
+
+    io_vec->types[io_vec->nelmts] = H5FD_MEM_DRAW;
+    io_vec->addrs[io_vec->nelmts] = udata->dset_addr + dst_off;
+    io_vec->sizes[io_vec->nelmts] = len;
+    io_vec->bufs[io_vec->nelmts]  = udata->buf + src_off;
+    io_vec->nelmts++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__contig_vector_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_vector_io
+ *
+ * Purpose:	Reads or writes some data vectors from/to a dataset with a
+ *              single vector I/O request to the file driver.  The address
+ *              is the start of the dataset, relative to the base address
+ *              for the file and the offsets and sequence lengths are in
+ *              bytes.
+ *
+ *              If the I/O info has an I/O vector attached (multi-dataset
+ *              I/O), the requests are appended to it and performed later
+ *              by the caller instead.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static ssize_t
+H5D__contig_vector_io(const H5D_io_info_t *io_info, H5D_io_op_type_t op_type, size_t dset_max_nseq,
+                      size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
+                      size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[])
+{
+    H5D_contig_vector_ud_t udata;          /* User data for H5VM_opvv() operator */
+    H5D_io_vec_t           local_vec;      /* I/O vector, when not deferring the I/O */
+    size_t                 max_nelmts;     /* Max. # of entries added to the I/O vector */
+    ssize_t                ret_value = -1; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Each vector entry consumes at least one dataset or memory sequence */
+    max_nelmts = (dset_max_nseq - *dset_curr_seq) + (mem_max_nseq - *mem_curr_seq);
+
+    /* Set up user data for H5VM_opvv() */
+    HDmemset(&local_vec, 0, sizeof(local_vec));
+    udata.dset_addr = io_info->store->contig.dset_addr;
+    udata.io_vec    = io_info->io_vec ? io_info->io_vec : &local_vec;
+    if (op_type == H5D_IO_OP_READ)
+        udata.buf = (unsigned char *)io_info->u.rbuf;
+    else {
+        /* (The buffer is only read from when writing) */
+        H5_GCC_DIAG_OFF("cast-qual")
+        udata.buf = (unsigned char *)io_info->u.wbuf;
+        H5_GCC_DIAG_ON("cast-qual")
+    } /* end else */
+    if (H5D__io_vec_extend(udata.io_vec, max_nelmts) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't extend I/O vector")
+
+    /* Build the I/O vector */
+    if ((ret_value = H5VM_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr, mem_max_nseq,
+                               mem_curr_seq, mem_len_arr, mem_off_arr, H5D__contig_vector_cb, &udata)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't build I/O vector")
+    HDassert(udata.io_vec->nelmts <= udata.io_vec->nalloc);
+
+    /* Perform the I/O now, unless it's being deferred */
+    if (!io_info->io_vec && H5D__io_vec_perform(io_info->f_sh, op_type, &local_vec) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_IO, FAIL, "vector I/O failed")
+
+done:
+    if (H5D__io_vec_reset(&local_vec) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release I/O vector")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__contig_vector_io() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv_sieve_cb
  *
@@ -718,7 +884,7 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
     if (NULL == dset_contig->sieve_buf) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
         if (len > dset_contig->sieve_buf_size) {
-            if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
+            if (H5F_shared_raw_read(f_sh, addr, len, buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
         } /* end if */
         else {
@@ -783,7 +949,7 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *
                 }     /* end if */
 
                 /* Read directly into the user's buffer */
-                if (H5F_shared_block_read(f_sh, H5FD_MEM_DRAW, addr, len, buf) < 0)
+                if (H5F_shared_raw_read(f_sh, addr, len, buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
             } /* end if */
             /* Element size fits within the buffer size */
@@ -856,8 +1022,7 @@ H5D__contig_readvv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata
     FUNC_ENTER_STATIC
 
     /* Write data */
-    if (H5F_shared_block_read(udata->f_sh, H5FD_MEM_DRAW, (udata->dset_addr + dst_off), len,
-                              (udata->rbuf + src_off)) < 0)
+    if (H5F_shared_raw_read(udata->f_sh, (udata->dset_addr + dst_off), len, (udata->rbuf + src_off)) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
 
 done:
@@ -887,7 +1052,8 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *d
                    size_t dset_len_arr[], hsize_t dset_off_arr[], size_t mem_max_nseq, size_t *mem_curr_seq,
                    size_t mem_len_arr[], hsize_t mem_off_arr[])
 {
-    ssize_t ret_value = -1; /* Return value */
+    const void *map       = NULL; /* Dataset's bytes in the file's memory mapping */
+    ssize_t     ret_value = -1;   /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -900,8 +1066,30 @@ H5D__contig_readvv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *d
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Check if the file is mapped into memory, so the sequences can be
+     * copied straight out of the mapping
+     */
+    if (io_info->store->contig.dset_size == (hsize_t)((size_t)io_info->store->contig.dset_size))
+        map = H5F_shared_get_mapped_ptr(io_info->f_sh, io_info->store->contig.dset_addr,
+                                        (size_t)io_info->store->contig.dset_size);
+    if (map) {
+        if ((ret_value = H5VM_memcpyvv(io_info->u.rbuf, mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
+                                       map, dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "vectorized memcpy failed")
+    } /* end if */
+    /* Check if the sequences can be passed to the file driver all at once
+     * (always the case when the I/O is being deferred)
+     */
+    else if (io_info->io_vec || H5D__contig_may_use_vector_io(io_info, H5D_IO_OP_READ, dset_max_nseq,
+                                                         *dset_curr_seq, dset_len_arr, dset_off_arr,
+                                                         mem_max_nseq, *mem_curr_seq)) {
+        if ((ret_value = H5D__contig_vector_io(io_info, H5D_IO_OP_READ, dset_max_nseq, dset_curr_seq,
+                                               dset_len_arr, dset_off_arr, mem_max_nseq, mem_curr_seq,
+                                               mem_len_arr, mem_off_arr)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vector read")
+    } /* end if */
     /* Check if data sieving is enabled */
-    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    else if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_readvv_sieve_ud_t udata; /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -1218,8 +1406,19 @@ H5D__contig_writevv(const H5D_io_info_t *io_info, size_t dset_max_nseq, size_t *
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Check if the sequences can be passed to the file driver all at once
+     * (always the case when the I/O is being deferred)
+     */
+    if (io_info->io_vec || H5D__contig_may_use_vector_io(io_info, H5D_IO_OP_WRITE, dset_max_nseq,
+                                                         *dset_curr_seq, dset_len_arr, dset_off_arr,
+                                                         mem_max_nseq, *mem_curr_seq)) {
+        if ((ret_value = H5D__contig_vector_io(io_info, H5D_IO_OP_WRITE, dset_max_nseq, dset_curr_seq,
+                                               dset_len_arr, dset_off_arr, mem_max_nseq, mem_curr_seq,
+                                               mem_len_arr, mem_off_arr)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vector write")
+    } /* end if */
     /* Check if data sieving is enabled */
-    if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
+    else if (H5F_SHARED_HAS_FEATURE(io_info->f_sh, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_writevv_sieve_ud_t udata; /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
@@ -2606,6 +2606,59 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__get_offset() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__get_mapped_data
+ *
+ * Purpose:     Private function for H5Dget_mapped_data().  Returns a
+ *              pointer to the raw data of a contiguous dataset in the
+ *              memory mapping of its file, and the size of the data.
+ *              *BUF is set to NULL (and *SIZE to 0) when the dataset's
+ *              data isn't mapped.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__get_mapped_data(const H5D_t *dset, const void **buf, hsize_t *size)
+{
+    const H5O_storage_contig_t *contig    = &dset->shared->layout.storage.u.contig; /* Contiguous storage */
+    herr_t                      ret_value = SUCCEED;                                /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+    HDassert(buf);
+    HDassert(size);
+
+    *buf  = NULL;
+    *size = 0;
+
+    switch (dset->shared->layout.type) {
+        case H5D_VIRTUAL:
+        case H5D_CHUNKED:
+        case H5D_COMPACT:
+            break;
+
+        case H5D_CONTIGUOUS:
+            /* The data must be allocated, in the HDF5 file and addressable in memory */
+            if (dset->shared->dcpl_cache.efl.nused == 0 && H5F_addr_defined(contig->addr) &&
+                contig->size > 0 && contig->size == (hsize_t)((size_t)contig->size))
+                if (NULL != (*buf = H5F_shared_get_mapped_ptr(H5F_SHARED(dset->oloc.file), contig->addr,
+                                                              (size_t)contig->size)))
+                    *size = contig->size;
+            break;
+
+        case H5D_LAYOUT_ERROR:
+        case H5D_NLAYOUTS:
+        default:
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "unknown dataset layout type")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__get_mapped_data() */
+
 /*-------------------------------------------------------------------------
  * Function: H5D__vlen_get_buf_size_alloc
  *
@@ -2673,7 +2726,7 @@ H5D__vlen_get_buf_size_cb(void H5_ATTR_UNUSED *elem, hid_t type_id, unsigned H5_
 
     /* Read in the point (with the custom VL memory allocator) */
     if (H5D__read(vlen_bufsize->dset, type_id, vlen_bufsize->mspace, vlen_bufsize->fspace,
-                  vlen_bufsize->common.fl_tbuf) < 0)
+                  vlen_bufsize->common.fl_tbuf, NULL) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, H5_ITER_ERROR, "can't read point")
 
 done:
@@ -3776,6 +3829,8 @@ H5D_get_access_plist(const H5D_t *dset)
     /* If the dataset is chunked then copy the rdcc & append flush parameters.
      * Otherwise, use the default values. */
     if (dset->shared->layout.type == H5D_CHUNKED) {
+        H5D_chunk_cache_stats_t chunk_stats; /* Chunk cache statistics */
+
         if (H5P_set(new_plist, H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME, &(dset->shared->cache.chunk.nslots)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache number of slots")
         if (H5P_set(new_plist, H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME, &(dset->shared->cache.chunk.nbytes_max)) <
@@ -3785,6 +3840,13 @@ H5D_get_access_plist(const H5D_t *dset)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set preempt read chunks")
         if (H5P_set(new_plist, H5D_ACS_APPEND_FLUSH_NAME, &dset->shared->append_flush) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set append flush property")
+
+        /* Set the chunk cache statistics */
+        chunk_stats.nhits      = dset->shared->cache.chunk.stats.nhits;
+        chunk_stats.nmisses    = dset->shared->cache.chunk.stats.nmisses;
+        chunk_stats.nevictions = dset->shared->cache.chunk.stats.nevictions;
+        if (H5P_set(new_plist, H5D_ACS_CHUNK_CACHE_STATS_NAME, &chunk_stats) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk cache statistics")
     }
     else {
         /* Get the default FAPL */
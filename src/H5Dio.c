@@ -43,6 +43,11 @@
 /* Local Prototypes */
 /********************/
 
+/* Multi-dataset I/O routines */
+static herr_t H5D__multi_use_io_vec(size_t count, H5D_t *dset[], hid_t mem_type_id[], hbool_t do_write,
+                                    hbool_t *use_io_vec);
+static herr_t H5D__multi_prep_dset(H5D_t *dset, hbool_t do_write);
+
 /* Setup/teardown routines */
 static herr_t H5D__ioinfo_init(H5D_t *dset, const H5D_type_info_t *type_info, H5D_storage_t *store,
                                H5D_io_info_t *io_info);
@@ -123,6 +128,14 @@ done:
  * Purpose:	Reads (part of) a DATASET into application memory BUF. See
  *		H5Dread() for complete details.
  *
+ *              If IO_VEC is not NULL, the raw data reads from contiguous
+ *              storage are appended to it instead of being performed,
+ *              and the caller must perform them with
+ *              H5D__io_vec_perform() before using BUF.  The caller is
+ *              responsible for only passing an I/O vector for datasets
+ *              which read directly into BUF (no type conversion or data
+ *              transform).
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -132,7 +145,7 @@ done:
  */
 herr_t
 H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
-          void *buf /*out*/)
+          void *buf /*out*/, H5D_io_vec_t *io_vec)
 {
     H5D_chunk_map_t *fm = NULL;                   /* Chunk file<->memory mapping */
     H5D_io_info_t    io_info;                     /* Dataset I/O info     */
@@ -154,6 +167,7 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t
     H5D_storage_t store;                          /* union of EFL and chunk pointer in file space */
     hsize_t       nelmts;                         /* total number of elmts	*/
     hbool_t       io_op_init = FALSE;             /* Whether the I/O op has been initialized */
+    hbool_t       api_held   = FALSE;             /* Whether the API lock is held an extra time */
     char          fake_char;                      /* Temporary variable for NULL buffer pointers */
     herr_t        ret_value = SUCCEED;            /* Return value	*/
 
@@ -286,6 +300,7 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t
     io_info.u.rbuf  = buf;
     if (H5D__ioinfo_init(dataset, &type_info, &store, &io_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to set up I/O operation")
+    io_info.io_vec = io_vec;
 
     /* Sanity check that space is allocated, if there are elements */
     if (nelmts > 0)
@@ -298,6 +313,17 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t
     if (NULL == (fm = H5FL_CALLOC(H5D_chunk_map_t)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate chunk map")
 
+    /* Only contiguous datasets can let other threads into the library while
+     * their raw data is read (see H5F_shared_raw_read()): the I/O state for
+     * other layouts (the selected chunks, the projected source dataspaces)
+     * is kept in the shared dataset struct.  Holding the API lock an extra
+     * time keeps it from being released.
+     */
+    if (dataset->shared->layout.type != H5D_CONTIGUOUS) {
+        H5_API_LOCK
+        api_held = TRUE;
+    } /* end if */
+
     /* Call storage method's I/O initialization routine */
     if (io_info.layout_ops.io_init &&
         (*io_info.layout_ops.io_init)(&io_info, &type_info, nelmts, file_space, mem_space, fm) < 0)
@@ -305,8 +331,10 @@ H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t
     io_op_init = TRUE;
 
 #ifdef H5_HAVE_PARALLEL
-    /* Adjust I/O info for any parallel I/O */
-    if (H5D__ioinfo_adjust(&io_info, dataset, file_space, mem_space, &type_info) < 0)
+    /* Adjust I/O info for any parallel I/O (deferred I/O is performed
+     * for all of the datasets at once by the caller)
+     */
+    if (!io_info.io_vec && H5D__ioinfo_adjust(&io_info, dataset, file_space, mem_space, &type_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to adjust I/O info for parallel I/O")
 #endif /*H5_HAVE_PARALLEL*/
 
@@ -318,6 +346,9 @@ done:
     /* Shut down the I/O op information */
     if (io_op_init && io_info.layout_ops.io_term && (*io_info.layout_ops.io_term)(fm) < 0)
         HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down I/O op info")
+    if (api_held) {
+        H5_API_UNLOCK
+    } /* end if */
     if (fm)
         fm = H5FL_FREE(H5D_chunk_map_t, fm);
 
@@ -339,6 +370,14 @@ done:
  * Purpose:	Writes (part of) a DATASET to a file from application memory
  *		BUF. See H5Dwrite() for complete details.
  *
+ *              If IO_VEC is not NULL, the raw data writes to contiguous
+ *              storage are appended to it instead of being performed,
+ *              and the caller must perform them with
+ *              H5D__io_vec_perform() before BUF can be modified.  The
+ *              caller is responsible for only passing an I/O vector for
+ *              datasets which write directly from BUF (no type conversion
+ *              or data transform).
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -348,7 +387,7 @@ done:
  */
 herr_t
 H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
-           const void *buf)
+           const void *buf, H5D_io_vec_t *io_vec)
 {
     H5D_chunk_map_t *fm = NULL;                   /* Chunk file<->memory mapping */
     H5D_io_info_t    io_info;                     /* Dataset I/O info     */
@@ -489,6 +528,7 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_
     io_info.u.wbuf  = buf;
     if (H5D__ioinfo_init(dataset, &type_info, &store, &io_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up I/O operation")
+    io_info.io_vec = io_vec;
 
     /* Allocate dataspace and initialize it if it hasn't been. */
     if (nelmts > 0 && dataset->shared->dcpl_cache.efl.nused == 0 &&
@@ -522,8 +562,10 @@ H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_
     io_op_init = TRUE;
 
 #ifdef H5_HAVE_PARALLEL
-    /* Adjust I/O info for any parallel I/O */
-    if (H5D__ioinfo_adjust(&io_info, dataset, file_space, mem_space, &type_info) < 0)
+    /* Adjust I/O info for any parallel I/O (deferred I/O is performed
+     * for all of the datasets at once by the caller)
+     */
+    if (!io_info.io_vec && H5D__ioinfo_adjust(&io_info, dataset, file_space, mem_space, &type_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to adjust I/O info for parallel I/O")
 #endif /*H5_HAVE_PARALLEL*/
 
@@ -568,6 +610,405 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5D__write() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_use_io_vec
+ *
+ * Purpose:	Determine whether the raw data I/O for a multi-dataset
+ *              read or write can be gathered into a single I/O vector.
+ *
+ *              This is possible when all of the datasets are in the same
+ *              file, use contiguous storage in that file and transfer
+ *              directly to/from the application's buffers (no type
+ *              conversion or data transform), and the file driver can
+ *              perform vector I/O.
+ *
+ *              For collective parallel I/O, the decision is made
+ *              collectively so that all processes perform the same
+ *              (collective) operations.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__multi_use_io_vec(size_t count, H5D_t *dset[], hid_t mem_type_id[], hbool_t do_write,
+                      hbool_t *use_io_vec)
+{
+    H5F_shared_t *f_sh;                /* Shared file for the datasets */
+    hbool_t       use_vec   = TRUE;    /* Whether this process can use the I/O vector */
+    size_t        u;                   /* Local index variable */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(count > 0);
+    HDassert(dset);
+    HDassert(mem_type_id);
+    HDassert(use_io_vec);
+
+    /* Check that the file driver can receive the I/O all at once */
+    f_sh = H5F_SHARED(dset[0]->oloc.file);
+    if (!H5F_shared_has_vector_io(f_sh))
+        use_vec = FALSE;
+
+    /* Check each dataset */
+    for (u = 0; u < count && use_vec; u++) {
+        H5D_type_info_t type_info; /* Datatype info for dataset */
+
+        if (H5F_SHARED(dset[u]->oloc.file) != f_sh || dset[u]->shared->layout.type != H5D_CONTIGUOUS ||
+            dset[u]->shared->dcpl_cache.efl.nused > 0)
+            use_vec = FALSE;
+        else {
+            if (H5D__typeinfo_init(dset[u], mem_type_id[u], do_write, &type_info) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up type info")
+            if (!(type_info.is_conv_noop && type_info.is_xform_noop))
+                use_vec = FALSE;
+            if (H5D__typeinfo_term(&type_info) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down type info")
+        } /* end else */
+    }     /* end for */
+
+#ifdef H5_HAVE_PARALLEL
+    /* Collective I/O must use the I/O vector on all processes or none */
+    if (H5F_HAS_FEATURE(dset[0]->oloc.file, H5FD_FEAT_HAS_MPI)) {
+        H5FD_mpio_xfer_t xfer_mode; /* MPI I/O transfer mode */
+
+        if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+        if (xfer_mode == H5FD_MPIO_COLLECTIVE) {
+            MPI_Comm comm;               /* MPI communicator for file */
+            int      local_use_vec;      /* Whether this process can use the I/O vector */
+            int      global_use_vec = 0; /* Whether all processes can use the I/O vector */
+            int      mpi_code;           /* MPI return code */
+
+            if (MPI_COMM_NULL == (comm = H5F_mpi_get_comm(dset[0]->oloc.file)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't retrieve MPI communicator")
+
+            local_use_vec = (int)use_vec;
+            if (MPI_SUCCESS !=
+                (mpi_code = MPI_Allreduce(&local_use_vec, &global_use_vec, 1, MPI_INT, MPI_LAND, comm)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Allreduce failed", mpi_code)
+            use_vec = (hbool_t)(global_use_vec != 0);
+        } /* end if */
+    }     /* end if */
+#endif /* H5_HAVE_PARALLEL */
+
+    *use_io_vec = use_vec;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_use_io_vec() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__multi_prep_dset
+ *
+ * Purpose:	Prepare a contiguous dataset for deferred I/O, which
+ *              bypasses its sieve buffer: write out any dirty data in the
+ *              sieve buffer, and, when writing, discard the buffer's
+ *              contents so they can't become stale.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__multi_prep_dset(H5D_t *dset, hbool_t do_write)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+
+    if (H5D__flush_sieve_buf(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush sieve buffer")
+    if (do_write) {
+        dset->shared->cache.contig.sieve_loc  = HADDR_UNDEF;
+        dset->shared->cache.contig.sieve_size = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__multi_prep_dset() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__read_multi
+ *
+ * Purpose:	Reads (part of) COUNT datasets into application memory.
+ *              See H5Dread_multi() for complete details.
+ *
+ *              When possible, the raw data reads for all of the datasets
+ *              are gathered and passed to the file driver as a single
+ *              vector request.  Otherwise, the datasets are read one
+ *              after another.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__read_multi(size_t count, H5D_t *dset[], hid_t mem_type_id[], const H5S_t *mem_space[],
+                const H5S_t *file_space[], void *buf[] /*out*/)
+{
+    H5D_io_vec_t io_vec;              /* Raw data I/O vector for all datasets */
+    hbool_t      use_io_vec = FALSE;  /* Whether to gather the I/O into io_vec */
+#ifdef H5_HAVE_PARALLEL
+    H5FD_mpio_xfer_t xfer_mode = H5FD_MPIO_INDEPENDENT; /* Original MPI I/O transfer mode */
+#endif                                                  /* H5_HAVE_PARALLEL */
+    size_t u;                                           /* Local index variable */
+    herr_t ret_value = SUCCEED;                         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check args */
+    HDassert(count > 0);
+    HDassert(dset && mem_type_id && mem_space && file_space && buf);
+
+    HDmemset(&io_vec, 0, sizeof(io_vec));
+
+    /* Check if the I/O can be gathered into a single vector */
+    if (H5D__multi_use_io_vec(count, dset, mem_type_id, FALSE, &use_io_vec) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up multi-dataset I/O")
+
+#ifdef H5_HAVE_PARALLEL
+    /* Reading each dataset may switch the transfer mode to independent */
+    if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Read (or gather the reads for) each dataset */
+    for (u = 0; u < count; u++) {
+#ifdef H5_HAVE_PARALLEL
+        if (H5CX_set_io_xfer_mode(xfer_mode) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
+#endif /* H5_HAVE_PARALLEL */
+
+        if (use_io_vec && H5D__multi_prep_dset(dset[u], FALSE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't prepare dataset for multi-dataset I/O")
+        if (H5D__read(dset[u], mem_type_id[u], mem_space[u], file_space[u], buf[u],
+                      use_io_vec ? &io_vec : NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end for */
+
+    /* Perform the gathered reads */
+    if (use_io_vec) {
+#ifdef H5_HAVE_PARALLEL
+        /* Record the actual I/O mode */
+        if (xfer_mode == H5FD_MPIO_COLLECTIVE && !H5CX_is_def_dxpl()) {
+            H5CX_set_mpio_actual_chunk_opt(H5D_MPIO_NO_CHUNK_OPTIMIZATION);
+            H5CX_set_mpio_actual_io_mode(H5D_MPIO_CONTIGUOUS_COLLECTIVE);
+        } /* end if */
+#endif /* H5_HAVE_PARALLEL */
+
+        if (H5D__io_vec_perform(H5F_SHARED(dset[0]->oloc.file), H5D_IO_OP_READ, &io_vec) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+    } /* end if */
+
+done:
+    if (H5D__io_vec_reset(&io_vec) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release I/O vector")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__read_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__write_multi
+ *
+ * Purpose:	Writes (part of) COUNT datasets from application memory.
+ *              See H5Dwrite_multi() for complete details.
+ *
+ *              When possible, the raw data writes for all of the datasets
+ *              are gathered and passed to the file driver as a single
+ *              vector request.  Otherwise, the datasets are written one
+ *              after another.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__write_multi(size_t count, H5D_t *dset[], hid_t mem_type_id[], const H5S_t *mem_space[],
+                 const H5S_t *file_space[], const void *buf[])
+{
+    H5D_io_vec_t io_vec;             /* Raw data I/O vector for all datasets */
+    hbool_t      use_io_vec = FALSE; /* Whether to gather the I/O into io_vec */
+#ifdef H5_HAVE_PARALLEL
+    H5FD_mpio_xfer_t xfer_mode = H5FD_MPIO_INDEPENDENT; /* Original MPI I/O transfer mode */
+#endif                                                  /* H5_HAVE_PARALLEL */
+    size_t u;                                           /* Local index variable */
+    herr_t ret_value = SUCCEED;                         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check args */
+    HDassert(count > 0);
+    HDassert(dset && mem_type_id && mem_space && file_space && buf);
+
+    HDmemset(&io_vec, 0, sizeof(io_vec));
+
+    /* Check if the I/O can be gathered into a single vector */
+    if (H5D__multi_use_io_vec(count, dset, mem_type_id, TRUE, &use_io_vec) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up multi-dataset I/O")
+
+#ifdef H5_HAVE_PARALLEL
+    /* Writing each dataset may switch the transfer mode to independent */
+    if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Write (or gather the writes for) each dataset */
+    for (u = 0; u < count; u++) {
+#ifdef H5_HAVE_PARALLEL
+        if (H5CX_set_io_xfer_mode(xfer_mode) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
+#endif /* H5_HAVE_PARALLEL */
+
+        if (use_io_vec && H5D__multi_prep_dset(dset[u], TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't prepare dataset for multi-dataset I/O")
+        if (H5D__write(dset[u], mem_type_id[u], mem_space[u], file_space[u], buf[u],
+                       use_io_vec ? &io_vec : NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+    } /* end for */
+
+    /* Perform the gathered writes */
+    if (use_io_vec) {
+#ifdef H5_HAVE_PARALLEL
+        /* Record the actual I/O mode */
+        if (xfer_mode == H5FD_MPIO_COLLECTIVE && !H5CX_is_def_dxpl()) {
+            H5CX_set_mpio_actual_chunk_opt(H5D_MPIO_NO_CHUNK_OPTIMIZATION);
+            H5CX_set_mpio_actual_io_mode(H5D_MPIO_CONTIGUOUS_COLLECTIVE);
+        } /* end if */
+#endif /* H5_HAVE_PARALLEL */
+
+        if (H5D__io_vec_perform(H5F_SHARED(dset[0]->oloc.file), H5D_IO_OP_WRITE, &io_vec) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+    } /* end if */
+
+done:
+    if (H5D__io_vec_reset(&io_vec) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release I/O vector")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__write_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_vec_extend
+ *
+ * Purpose:	Make room for NELMTS more entries in an I/O vector.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__io_vec_extend(H5D_io_vec_t *io_vec, size_t nelmts)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(io_vec);
+
+    if (io_vec->nelmts + nelmts > io_vec->nalloc) {
+        size_t      new_nalloc = MAX(io_vec->nelmts + nelmts, 2 * io_vec->nalloc);
+        H5FD_mem_t *types;
+        haddr_t *   addrs;
+        size_t *    sizes;
+        void **     bufs;
+
+        if (NULL == (types = (H5FD_mem_t *)H5MM_realloc(io_vec->types, new_nalloc * sizeof(H5FD_mem_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O type vector")
+        io_vec->types = types;
+        if (NULL == (addrs = (haddr_t *)H5MM_realloc(io_vec->addrs, new_nalloc * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O address vector")
+        io_vec->addrs = addrs;
+        if (NULL == (sizes = (size_t *)H5MM_realloc(io_vec->sizes, new_nalloc * sizeof(size_t))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O size vector")
+        io_vec->sizes = sizes;
+        if (NULL == (bufs = (void **)H5MM_realloc(io_vec->bufs, new_nalloc * sizeof(void *))))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate I/O buffer vector")
+        io_vec->bufs = bufs;
+
+        io_vec->nalloc = new_nalloc;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_vec_extend() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_vec_perform
+ *
+ * Purpose:	Perform the raw data reads or writes in an I/O vector with
+ *              a single vector request to the file driver, then empty the
+ *              vector.
+ *
+ *              For parallel collective I/O, this must be called on all
+ *              processes, even when a process's vector is empty.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__io_vec_perform(H5F_shared_t *f_sh, H5D_io_op_type_t op_type, H5D_io_vec_t *io_vec)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(f_sh);
+    HDassert(io_vec);
+
+    /* The vector length must fit in the file driver interface */
+    if (io_vec->nelmts > UINT32_MAX)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "too many entries in I/O vector")
+
+    if (op_type == H5D_IO_OP_READ) {
+        if (H5F_shared_vector_read(f_sh, (uint32_t)io_vec->nelmts, io_vec->types, io_vec->addrs,
+                                   io_vec->sizes, io_vec->bufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+    } /* end if */
+    else {
+        /* (The buffers are only read from when writing) */
+        H5_GCC_DIAG_OFF("cast-qual")
+        if (H5F_shared_vector_write(f_sh, (uint32_t)io_vec->nelmts, io_vec->types, io_vec->addrs,
+                                    io_vec->sizes, (const void **)io_vec->bufs) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+        H5_GCC_DIAG_ON("cast-qual")
+    } /* end else */
+
+    io_vec->nelmts = 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__io_vec_perform() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__io_vec_reset
+ *
+ * Purpose:	Release the memory for an I/O vector and reset it to empty.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__io_vec_reset(H5D_io_vec_t *io_vec)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(io_vec);
+
+    H5MM_xfree(io_vec->types);
+    H5MM_xfree(io_vec->addrs);
+    H5MM_xfree(io_vec->sizes);
+    H5MM_xfree(io_vec->bufs);
+    HDmemset(io_vec, 0, sizeof(*io_vec));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__io_vec_reset() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5D__ioinfo_init
  *
@@ -594,9 +1035,10 @@ H5D__ioinfo_init(H5D_t *dset, const H5D_type_info_t *type_info, H5D_storage_t *s
     HDassert(io_info);
 
     /* Set up "normal" I/O fields */
-    io_info->dset  = dset;
-    io_info->f_sh  = H5F_SHARED(dset->oloc.file);
-    io_info->store = store;
+    io_info->dset   = dset;
+    io_info->f_sh   = H5F_SHARED(dset->oloc.file);
+    io_info->store  = store;
+    io_info->io_vec = NULL;
 
     /* Set I/O operations to initial values */
     io_info->layout_ops = *dset->shared->layout.ops;
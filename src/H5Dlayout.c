@@ -119,6 +119,10 @@ H5D__layout_set_io_ops(const H5D_t *dataset)
                     dataset->shared->layout.storage.u.chunk.ops = H5D_COPS_BT2;
                     break;
 
+                case H5D_CHUNK_IDX_SHARD:
+                    dataset->shared->layout.storage.u.chunk.ops = H5D_COPS_SHARD;
+                    break;
+
                 case H5D_CHUNK_IDX_NTYPES:
                 default:
                     HDassert(0 && "Unknown chunk index method!");
@@ -250,6 +254,11 @@ H5D__layout_meta_size(const H5F_t *f, const H5O_layout_t *layout, hbool_t includ
                         ret_value += H5D_BT2_CREATE_PARAM_SIZE;
                         break;
 
+                    case H5D_CHUNK_IDX_SHARD:
+                        /* v2 B-tree creation parameters & shard dimensions */
+                        ret_value += H5D_SHARD_CREATE_PARAM_SIZE(layout->u.chunk.ndims - 1);
+                        break;
+
                     case H5D_CHUNK_IDX_NTYPES:
                     default:
                         HGOTO_ERROR(H5E_OHDR, H5E_CANTENCODE, 0, "Invalid chunk index type")
@@ -346,8 +355,23 @@ H5D__layout_set_latest_indexing(H5O_layout_t *layout, const H5S_t *space, const
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "invalid dataspace rank")
         ndims = (unsigned)sndims;
 
+        /* Keep the sharded chunk index requested by the application */
+        if (H5D_CHUNK_IDX_SHARD == layout->u.chunk.idx_type) {
+            if (0 == ndims)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "sharded chunk index requires a simple dataspace")
+            layout->storage.u.chunk.idx_type = H5D_CHUNK_IDX_SHARD;
+            layout->storage.u.chunk.ops      = H5D_COPS_SHARD;
+
+            /* Set the v2 B-tree creation parameters for the index of shards */
+            layout->u.chunk.u.shard.btree2.cparam.node_size     = H5D_BT2_NODE_SIZE;
+            layout->u.chunk.u.shard.btree2.cparam.split_percent = H5D_BT2_SPLIT_PERC;
+            layout->u.chunk.u.shard.btree2.cparam.merge_percent = H5D_BT2_MERGE_PERC;
+
+            /* Datatype "dimension" of shards */
+            layout->u.chunk.u.shard.dim[ndims] = 1;
+        } /* end if */
         /* Avoid scalar/null dataspace */
-        if (ndims > 0) {
+        else if (ndims > 0) {
             hsize_t  max_dims[H5O_LAYOUT_NDIMS]; /* Maximum dimension sizes */
             hsize_t  cur_dims[H5O_LAYOUT_NDIMS]; /* Current dimension sizes */
             unsigned unlim_count = 0;            /* Count of unlimited max. dimensions */
@@ -50,13 +50,15 @@
     (io_info)->f_sh    = H5F_SHARED((ds)->oloc.file);                                                        \
     (io_info)->store   = str;                                                                                \
     (io_info)->op_type = H5D_IO_OP_WRITE;                                                                    \
-    (io_info)->u.wbuf  = buf
+    (io_info)->u.wbuf  = buf;                                                                                \
+    (io_info)->io_vec  = NULL
 #define H5D_BUILD_IO_INFO_RD(io_info, ds, str, buf)                                                          \
     (io_info)->dset    = ds;                                                                                 \
     (io_info)->f_sh    = H5F_SHARED((ds)->oloc.file);                                                        \
     (io_info)->store   = str;                                                                                \
     (io_info)->op_type = H5D_IO_OP_READ;                                                                     \
-    (io_info)->u.rbuf  = buf
+    (io_info)->u.rbuf  = buf;                                                                                \
+    (io_info)->io_vec  = NULL
 
 /* Flags for marking aspects of a dataset dirty */
 #define H5D_MARK_SPACE  0x01
@@ -83,6 +85,9 @@
 #define H5D_BT2_SPLIT_PERC        100
 #define H5D_BT2_MERGE_PERC        40
 
+/* Sharded chunk index creation values (v2 B-tree parameters and # of chunks per shard in each dimension) */
+#define H5D_SHARD_CREATE_PARAM_SIZE(ndims) (H5D_BT2_CREATE_PARAM_SIZE + 4 * (ndims))
+
 /****************************/
 /* Package Private Typedefs */
 /****************************/
@@ -211,6 +216,18 @@ typedef enum H5D_io_op_type_t {
     H5D_IO_OP_WRITE /* Write operation */
 } H5D_io_op_type_t;
 
+/* Vector of raw data I/O requests, gathered from several datasets so they
+ * can be passed to the file driver at once (for H5Dread/write_multi)
+ */
+typedef struct H5D_io_vec_t {
+    size_t      nelmts; /* Number of entries in the vector */
+    size_t      nalloc; /* Number of entries allocated */
+    H5FD_mem_t *types;  /* Memory type of each entry */
+    haddr_t *   addrs;  /* File address of each entry */
+    size_t *    sizes;  /* Size of each entry */
+    void **     bufs;   /* Memory buffer of each entry */
+} H5D_io_vec_t;
+
 typedef struct H5D_io_info_t {
     const H5D_t *dset;  /* Pointer to dataset being operated on */
                         /* QAK: Delete the f_sh field when oloc has a shared file pointer? */
@@ -227,6 +244,7 @@ typedef struct H5D_io_info_t {
         void *      rbuf; /* Pointer to buffer for read */
         const void *wbuf; /* Pointer to buffer to write */
     } u;
+    H5D_io_vec_t *io_vec; /* Vector to defer contiguous raw data I/O into, or NULL */
 } H5D_io_info_t;
 
 /******************/
@@ -382,6 +400,35 @@ typedef struct H5D_chunk_cached_t {
     unsigned filter_mask;              /*excluded filters */
 } H5D_chunk_cached_t;
 
+/* Entry in a file's chunk index cache */
+typedef struct H5D_chunk_idx_cache_ent_t {
+    haddr_t                           idx_addr;    /* Address of the chunk index */
+    unsigned                          ndims;       /* Number of dimensions in scaled offset */
+    hsize_t *                         scaled;      /* Scaled offset of chunk */
+    uint64_t                          hash;        /* Hash of index address & scaled offset */
+    haddr_t                           addr;        /* File address of chunk */
+    uint32_t                          nbytes;      /* Size of stored data */
+    hsize_t                           chunk_idx;   /* Index of chunk in dataset */
+    unsigned                          filter_mask; /* Excluded filters */
+    struct H5D_chunk_idx_cache_ent_t *hnext;       /* Next entry in hash bucket */
+    struct H5D_chunk_idx_cache_ent_t *prev;        /* Previous (more recently used) entry */
+    struct H5D_chunk_idx_cache_ent_t *next;        /* Next (less recently used) entry */
+} H5D_chunk_idx_cache_ent_t;
+
+/* A file's chunk index cache: the chunk records most recently looked up in
+ * the chunk indexes of the file's datasets, kept across dataset opens and
+ * closes.  Entries are found through a hash table and evicted in LRU order.
+ */
+struct H5D_chunk_idx_cache_t {
+    size_t                      max_nents; /* Maximum number of entries */
+    size_t                      nents;     /* Number of entries */
+    size_t                      nbuckets;  /* Number of hash buckets (a power of two) */
+    unsigned                    hash_bits; /* log2(nbuckets) */
+    H5D_chunk_idx_cache_ent_t **buckets;   /* Hash buckets */
+    H5D_chunk_idx_cache_ent_t * head;      /* Most recently used entry */
+    H5D_chunk_idx_cache_ent_t * tail;      /* Least recently used entry */
+};
+
 /****************************/
 /* Virtual dataset typedefs */
 /****************************/
@@ -394,18 +441,46 @@ typedef struct H5D_virtual_held_file_t {
 
 /* The raw data chunk cache */
 struct H5D_rdcc_ent_t; /* Forward declaration of struct used below */
+
+/* A file's shared raw data chunk cache: when the file access property list
+ * gives it a size, the chunks cached by all the file's datasets are also on
+ * this list, in least recently used order, and are evicted from its tail
+ * (whichever dataset they belong to) to keep them within its byte budget.
+ */
+struct H5D_shared_chunk_cache_t {
+    size_t                 nbytes_max;  /* Maximum cached raw data in bytes */
+    size_t                 nbytes_used; /* Current cached raw data in bytes */
+    uint64_t               clock;       /* Time stamp of the most recent access */
+    struct H5D_rdcc_ent_t *head;        /* Most recently used entry */
+    struct H5D_rdcc_ent_t *tail;        /* Least recently used entry */
+};
+
 typedef struct H5D_rdcc_t {
     struct {
-        unsigned ninits;   /* Number of chunk creations        */
-        unsigned nhits;    /* Number of cache hits            */
-        unsigned nmisses;  /* Number of cache misses        */
-        unsigned nflushes; /* Number of cache flushes        */
+        unsigned ninits;     /* Number of chunk creations        */
+        unsigned nhits;      /* Number of cache hits            */
+        unsigned nmisses;    /* Number of cache misses        */
+        unsigned nflushes;   /* Number of cache flushes        */
+        unsigned nevictions; /* Number of chunks preempted for others */
     } stats;
-    size_t                 nbytes_max; /* Maximum cached raw data in bytes    */
-    size_t                 nslots;     /* Number of chunk slots allocated    */
-    double                 w0;         /* Chunk preemption policy          */
-    struct H5D_rdcc_ent_t *head;       /* Head of doubly linked list        */
-    struct H5D_rdcc_ent_t *tail;       /* Tail of doubly linked list        */
+    size_t                    nbytes_max;      /* Maximum cached raw data in bytes    */
+    size_t                    nslots;          /* Number of chunk slots allocated    */
+    unsigned                  nways;           /* Number of slots a chunk may be cached in */
+    double                    w0;              /* Chunk preemption policy          */
+    unsigned                  filter_nthreads; /* # of threads for the filter pipeline */
+    struct {
+        size_t  nchunks; /* # of chunks to read ahead (0 to never read ahead) */
+        hbool_t always;  /* Whether to read ahead of all chunk reads, in order or not */
+        hsize_t next;    /* Index of the chunk that a scan in order reads next */
+    } prefetch;
+    struct {
+        size_t max_size; /* Largest read of several uncached chunks (0 to read them one at a time) */
+        size_t max_gap;  /* Largest gap between chunks read together */
+    } coalesce;
+    H5D_shared_chunk_cache_t *shared_cache;    /* File's shared chunk cache, if it's used */
+    haddr_t                   oh_addr;         /* Address of dataset's object header (for shared cache) */
+    struct H5D_rdcc_ent_t *head;            /* Head of doubly linked list        */
+    struct H5D_rdcc_ent_t *tail;            /* Tail of doubly linked list        */
     struct H5D_rdcc_ent_t
         *tmp_head; /* Head of temporary doubly linked list.  Chunks on this list are not in the hash table
                       (slot).  The head entry is a sentinel (does not refer to an actual chunk). */
@@ -537,6 +612,7 @@ H5_DLLVAR const H5D_chunk_ops_t H5D_COPS_SINGLE[1];
 H5_DLLVAR const H5D_chunk_ops_t H5D_COPS_EARRAY[1];
 H5_DLLVAR const H5D_chunk_ops_t H5D_COPS_FARRAY[1];
 H5_DLLVAR const H5D_chunk_ops_t H5D_COPS_BT2[1];
+H5_DLLVAR const H5D_chunk_ops_t H5D_COPS_SHARD[1];
 
 /* The v2 B-tree class for indexing chunked datasets with >1 unlimited dimensions */
 H5_DLLVAR const H5B2_class_t H5D_BT2[1];
@@ -566,6 +642,7 @@ H5_DLL herr_t  H5D__get_chunk_info(const H5D_t *dset, const H5S_t *space, hsize_
 H5_DLL herr_t  H5D__get_chunk_info_by_coord(const H5D_t *dset, const hsize_t *coord, unsigned *filter_mask,
                                             haddr_t *addr, hsize_t *size);
 H5_DLL haddr_t H5D__get_offset(const H5D_t *dset);
+H5_DLL herr_t  H5D__get_mapped_data(const H5D_t *dset, const void **buf, hsize_t *size);
 H5_DLL herr_t  H5D__vlen_get_buf_size(H5D_t *dset, hid_t type_id, hid_t space_id, hsize_t *size);
 H5_DLL herr_t  H5D__vlen_get_buf_size_gen(H5VL_object_t *vol_obj, hid_t type_id, hid_t space_id,
                                           hsize_t *size);
@@ -581,9 +658,16 @@ H5_DLL herr_t H5D__format_convert(H5D_t *dataset);
 
 /* Internal I/O routines */
 H5_DLL herr_t H5D__read(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
-                        void *buf /*out*/);
+                        void *buf /*out*/, H5D_io_vec_t *io_vec);
 H5_DLL herr_t H5D__write(H5D_t *dataset, hid_t mem_type_id, const H5S_t *mem_space, const H5S_t *file_space,
-                         const void *buf);
+                         const void *buf, H5D_io_vec_t *io_vec);
+H5_DLL herr_t H5D__read_multi(size_t count, H5D_t *dset[], hid_t mem_type_id[], const H5S_t *mem_space[],
+                              const H5S_t *file_space[], void *buf[] /*out*/);
+H5_DLL herr_t H5D__write_multi(size_t count, H5D_t *dset[], hid_t mem_type_id[], const H5S_t *mem_space[],
+                               const H5S_t *file_space[], const void *buf[]);
+H5_DLL herr_t H5D__io_vec_extend(H5D_io_vec_t *io_vec, size_t nelmts);
+H5_DLL herr_t H5D__io_vec_perform(H5F_shared_t *f_sh, H5D_io_op_type_t op_type, H5D_io_vec_t *io_vec);
+H5_DLL herr_t H5D__io_vec_reset(H5D_io_vec_t *io_vec);
 
 /* Functions that perform direct serial I/O operations */
 H5_DLL herr_t H5D__select_read(const H5D_io_info_t *io_info, const H5D_type_info_t *type_info, hsize_t nelmts,
@@ -652,6 +736,9 @@ H5_DLL herr_t H5D__get_offset_copy(const H5D_t *dset, const hsize_t *offset, hsi
 H5_DLL herr_t H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset,
                                       uint32_t data_size, const void *buf);
 H5_DLL herr_t H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset, uint32_t *filters, void *buf);
+H5_DLL herr_t H5D__chunk_direct_read_multi(const H5D_t *dset, size_t count, const hsize_t *offsets,
+                                           uint32_t *filters, hsize_t *sizes, hsize_t *buf_offsets,
+                                           size_t buf_size, void *buf);
 #ifdef H5D_CHUNK_DEBUG
 H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
 #endif /* H5D_CHUNK_DEBUG */
@@ -660,6 +747,10 @@ H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
 H5_DLL herr_t H5D__chunk_format_convert(H5D_t *dset, H5D_chk_idx_info_t *idx_info,
                                         H5D_chk_idx_info_t *new_idx_info);
 
+/* Functions that operate on sharded chunk indexes */
+H5_DLL herr_t H5D__shard_file_alloc(const H5D_chk_idx_info_t *idx_info, H5F_block_t *new_chunk,
+                                    const hsize_t *scaled);
+
 /* Functions that operate on compact dataset storage */
 H5_DLL herr_t H5D__compact_fill(const H5D_t *dset);
 H5_DLL herr_t H5D__compact_copy(H5F_t *f_src, H5O_storage_compact_t *storage_src, H5F_t *f_dst,
@@ -55,6 +55,12 @@
 #define H5D_ACS_VDS_PREFIX_NAME           "vds_prefix"           /* VDS file prefix */
 #define H5D_ACS_APPEND_FLUSH_NAME         "append_flush"         /* Append flush actions */
 #define H5D_ACS_EFILE_PREFIX_NAME         "external file prefix" /* External file prefix */
+#define H5D_ACS_FILTER_NTHREADS_NAME      "filter_nthreads"      /* # of threads for chunk filters */
+#define H5D_ACS_CHUNK_CACHE_STATS_NAME    "chunk_cache_stats"    /* Chunk cache statistics */
+#define H5D_ACS_PREFETCH_NCHUNKS_NAME     "prefetch_nchunks"     /* # of chunks to read ahead */
+#define H5D_ACS_PREFETCH_ALWAYS_NAME      "prefetch_always"      /* Read ahead on every chunk read */
+#define H5D_ACS_COALESCE_SIZE_NAME        "coalesce_size"        /* Largest read of several chunks */
+#define H5D_ACS_COALESCE_GAP_NAME         "coalesce_gap"         /* Largest gap read between chunks */
 
 /* ======== Data transfer properties ======== */
 #define H5D_XFER_MAX_TEMP_BUF_NAME          "max_temp_buf"        /* Maximum temp buffer size */
@@ -127,6 +133,12 @@
 /* Typedef for dataset in memory (defined in H5Dpkg.h) */
 typedef struct H5D_t H5D_t;
 
+/* Typedef for a file's chunk index cache (defined in H5Dpkg.h) */
+typedef struct H5D_chunk_idx_cache_t H5D_chunk_idx_cache_t;
+
+/* Typedef for a file's shared raw data chunk cache (defined in H5Dpkg.h) */
+typedef struct H5D_shared_chunk_cache_t H5D_shared_chunk_cache_t;
+
 /* Typedef for cached dataset creation property list information */
 typedef struct H5D_dcpl_cache_t {
     H5O_fill_t  fill;  /* Fill value info (H5D_CRT_FILL_VALUE_NAME) */
@@ -141,6 +153,13 @@ typedef struct H5D_copy_file_ud_t {
     H5T_t *                   src_dtype;        /* Copy of datatype for dataset */
 } H5D_copy_file_ud_t;
 
+/* Structure for dataset chunk cache statistics property (H5Pget_chunk_cache_stats) */
+typedef struct H5D_chunk_cache_stats_t {
+    unsigned nhits;      /* Number of chunks found in the cache */
+    unsigned nmisses;    /* Number of chunks not found in the cache */
+    unsigned nevictions; /* Number of chunks evicted to make room for others */
+} H5D_chunk_cache_stats_t;
+
 /* Structure for dataset append flush property (H5Pset_append_flush) */
 typedef struct H5D_append_flush_t {
     unsigned        ndims;                  /* The # of dimensions for "boundary" */
@@ -170,6 +189,8 @@ H5_DLL hid_t       H5D_get_access_plist(const H5D_t *dset);
 
 /* Functions that operate on chunked storage */
 H5_DLL herr_t H5D_chunk_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr);
+H5_DLL herr_t H5D_chunk_idx_cache_dest(H5D_chunk_idx_cache_t *cache);
+H5_DLL herr_t H5D_shared_chunk_cache_dest(H5D_shared_chunk_cache_t *cache);
 
 /* Functions that operate on virtual storage */
 H5_DLL herr_t H5D_virtual_check_mapping_pre(const H5S_t *vspace, const H5S_t *src_space,
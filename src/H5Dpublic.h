@@ -59,6 +59,7 @@ typedef enum H5D_chunk_index_t {
     H5D_CHUNK_IDX_FARRAY = 3, /* Fixed array (for 0 unlimited dims)       */
     H5D_CHUNK_IDX_EARRAY = 4, /* Extensible array (for 1 unlimited dim)   */
     H5D_CHUNK_IDX_BT2    = 5, /* v2 B-tree index (for >1 unlimited dims)  */
+    H5D_CHUNK_IDX_SHARD  = 6, /* v2 B-tree index of shards of chunks      */
     H5D_CHUNK_IDX_NTYPES      /* This one must be last!                   */
 } H5D_chunk_index_t;
 
@@ -696,6 +697,43 @@ H5_DLL herr_t H5Dget_chunk_info(hid_t dset_id, hid_t fspace_id, hsize_t chk_idx,
  */
 H5_DLL haddr_t H5Dget_offset(hid_t dset_id);
 
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Returns a read-only pointer to the raw data of a dataset
+ *
+ * \dset_id
+ * \param[out] buf  Pointer to the dataset's raw data
+ * \param[out] size Size of the raw data in bytes
+ *
+ * \return \herr_t
+ *
+ * \details H5Dget_mapped_data() gives the application direct access to
+ *          the raw data of the dataset \p dset_id, without copying it,
+ *          when the dataset's file was opened with the mmap file driver
+ *          (see H5Pset_fapl_mmap()).  On return, \p buf points to the
+ *          data in the file's memory mapping and \p size holds its size
+ *          in bytes.  The data is stored in the dataset's datatype in the
+ *          file, in row-major order, including any elements that were
+ *          never written.
+ *
+ *          Only contiguous datasets whose storage has been allocated in
+ *          the HDF5 file itself can be accessed this way.  For any other
+ *          dataset, or a file opened with another driver, \p buf is set
+ *          to NULL and \p size to zero, and the data must be read with
+ *          H5Dread().
+ *
+ *          The pointer stays valid until the file is closed.  The data
+ *          must not be modified.
+ *
+ * \since 1.13.0
+ *
+ * \see H5Dget_offset(), H5Pset_fapl_mmap()
+ *
+ */
+H5_DLL herr_t H5Dget_mapped_data(hid_t dset_id, const void **buf /*out*/, hsize_t *size /*out*/);
+
 /**
  * --------------------------------------------------------------------------
  * \ingroup H5D
@@ -819,6 +857,45 @@ H5_DLL herr_t H5Dread_async(const char *app_file, const char *app_func, unsigned
                             hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id,
                             void *buf /*out*/, hid_t es_id);
 
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Reads raw data from a set of datasets into the provided buffers
+ *
+ * \param[in] count         Number of datasets to read from
+ * \param[in] dset_id       Identifiers of the datasets to read from
+ * \param[in] mem_type_id   Identifiers of the memory datatypes
+ * \param[in] mem_space_id  Identifiers of the memory dataspaces
+ * \param[in] file_space_id Identifiers of the datasets' dataspaces in the file
+ * \param[in] dxpl_id       Identifier of a transfer property list
+ * \param[out] buf          Buffers to receive data read from file
+ *
+ * \return \herr_t
+ *
+ * \details H5Dread_multi() reads data from \p count datasets, whose
+ *          identifiers are listed in the \p dset_id array, into the
+ *          application memory buffers listed in the \p buf array.  The
+ *          \p mem_type_id, \p mem_space_id and \p file_space_id arrays
+ *          have the same meaning for each dataset as the corresponding
+ *          parameters of H5Dread().  A single transfer property list,
+ *          \p dxpl_id, applies to all of the datasets.
+ *
+ *          When the datasets are in the same file and don't require
+ *          datatype conversion, the library may combine the raw data
+ *          transfers for all of the datasets into a single request to
+ *          the file driver.  With the MPI-IO driver and a collective
+ *          transfer property list this results in one collective MPI-IO
+ *          call for all of the datasets instead of one per dataset.
+ *
+ * \since 1.13.0
+ *
+ * \see H5Dread()
+ *
+ */
+H5_DLL herr_t H5Dread_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+                            hid_t file_space_id[], hid_t dxpl_id, void *buf[] /*out*/);
+
 /**
  * --------------------------------------------------------------------------
  * \ingroup H5D
@@ -956,6 +1033,49 @@ H5_DLL herr_t H5Dwrite_async(const char *app_file, const char *app_func, unsigne
                              hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id,
                              const void *buf, hid_t es_id);
 
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Writes raw data from a set of buffers to a set of datasets
+ *
+ * \param[in] count         Number of datasets to write to
+ * \param[in] dset_id       Identifiers of the datasets to write to
+ * \param[in] mem_type_id   Identifiers of the memory datatypes
+ * \param[in] mem_space_id  Identifiers of the memory dataspaces
+ * \param[in] file_space_id Identifiers of the datasets' dataspaces in the file
+ * \param[in] dxpl_id       Identifier of a transfer property list
+ * \param[in] buf           Buffers with data to be written to the file
+ *
+ * \return \herr_t
+ *
+ * \details H5Dwrite_multi() writes data to \p count datasets, whose
+ *          identifiers are listed in the \p dset_id array, from the
+ *          application memory buffers listed in the \p buf array.  The
+ *          \p mem_type_id, \p mem_space_id and \p file_space_id arrays
+ *          have the same meaning for each dataset as the corresponding
+ *          parameters of H5Dwrite().  A single transfer property list,
+ *          \p dxpl_id, applies to all of the datasets.
+ *
+ *          When the datasets are in the same file and don't require
+ *          datatype conversion, the library may combine the raw data
+ *          transfers for all of the datasets into a single request to
+ *          the file driver.  With the MPI-IO driver and a collective
+ *          transfer property list this results in one collective MPI-IO
+ *          call for all of the datasets instead of one per dataset.
+ *
+ *          The same dataset should not be listed more than once with
+ *          overlapping selections, as the order in which the writes are
+ *          performed is not defined.
+ *
+ * \since 1.13.0
+ *
+ * \see H5Dwrite()
+ *
+ */
+H5_DLL herr_t H5Dwrite_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[], hid_t mem_space_id[],
+                             hid_t file_space_id[], hid_t dxpl_id, const void *buf[]);
+
 /**
  * --------------------------------------------------------------------------
  * \ingroup H5D
@@ -1081,6 +1201,66 @@ H5_DLL herr_t H5Dwrite_chunk(hid_t dset_id, hid_t dxpl_id, uint32_t filters, con
 H5_DLL herr_t H5Dread_chunk(hid_t dset_id, hid_t dxpl_id, const hsize_t *offset, uint32_t *filters,
                             void *buf);
 
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Reads several raw data chunks directly from a dataset in a file
+ *        into one buffer
+ *
+ * \dset_id
+ * \dxpl_id
+ * \param[in]  count       Number of chunks to read
+ * \param[in]  offsets     Logical positions of the chunks’ first elements
+ *                         in the dataspace, \p count × rank values
+ * \param[out] filters     Filter masks of the chunks
+ * \param[out] sizes       Sizes of the chunks in the file, in bytes
+ * \param[out] buf_offsets Positions of the chunks in \p buf, in bytes
+ * \param[in]  buf_size    Size of \p buf, in bytes
+ * \param[out] buf         Buffer to read the chunks into
+ *
+ * \return \herr_t
+ *
+ * \details H5Dread_chunks() reads the \p count raw data chunks of the
+ *          chunked dataset \p dset_id whose logical offsets are given
+ *          in \p offsets, bypassing the library’s internal data transfer
+ *          pipeline, including filters, as H5Dread_chunk() does.
+ *
+ *          \p offsets holds the offset of each chunk, one after the
+ *          other, with as many values per chunk as the rank of the
+ *          dataspace. Each offset must not exceed the dimension limits
+ *          and must specify a point that falls on a dataset chunk
+ *          boundary.
+ *
+ *          For each chunk i, \p filters[i] receives the chunk’s filter
+ *          mask (see H5Dread_chunk()), \p sizes[i] the number of bytes
+ *          stored for the chunk in the file and \p buf_offsets[i] the
+ *          position of the chunk’s bytes in \p buf. Chunks that have
+ *          not been written have a size of zero.
+ *
+ *          The chunks are looked up together and read with one request
+ *          to the file driver, in order of their addresses in the file;
+ *          they are packed into \p buf one after the other in that
+ *          order, so \p buf_offsets isn’t necessarily increasing with
+ *          i. If \p buf is NULL, only \p filters, \p sizes and
+ *          \p buf_offsets are returned, and the size of the buffer
+ *          needed is the sum of \p sizes. If \p buf_size is smaller
+ *          than that, the function fails after returning them.
+ *
+ *          Chunks held in the dataset’s chunk cache that haven’t been
+ *          written to the file yet are written out first; they stay in
+ *          the cache.
+ *
+ * \note H5Dread_chunks() is not supported under parallel and does
+ *          not support variable length types.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Dread_chunks(hid_t dset_id, hid_t dxpl_id, size_t count, const hsize_t *offsets,
+                             uint32_t *filters /*out*/, hsize_t *sizes /*out*/,
+                             hsize_t *buf_offsets /*out*/, size_t buf_size, void *buf /*out*/);
+
 /**
  * --------------------------------------------------------------------------
  * \ingroup H5D
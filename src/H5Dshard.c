@@ -0,0 +1,1562 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *
+ * Purpose: Sharded indexing for chunked datasets.
+ *   The chunks are grouped into "shards" of a fixed number of chunks in each
+ *   dimension (see H5Pset_chunk_shard).  Each shard is a block of raw data
+ *   that starts with a table of the addresses of its chunks, followed by the
+ *   chunks themselves, and the shards are indexed by a v2 B-tree keyed by
+ *   their dimensional offset, so the index holds one record per shard.
+ *
+ *   Shard block layout:
+ *     "SHRD" signature, version, 3 reserved bytes
+ *     Size of the block, bytes used from the start of the block (8 bytes each)
+ *     One entry per chunk: chunk address, size of chunk & filter mask
+ *     Checksum of the above
+ *     Chunk data
+ *
+ *   Unfiltered chunks are stored in fixed slots, in "C" order.  Filtered
+ *   chunks are appended to the block, which is extended in the file when
+ *   it's full, up to the size of the unfiltered shard.  Filtered chunks that
+ *   don't fit are stored outside of the block.
+ *
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Dmodule.h" /* This source code file is part of the H5D module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                    */
+#include "H5Dpkg.h"      /* Datasets				*/
+#include "H5Eprivate.h"  /* Error handling		  	*/
+#include "H5FLprivate.h" /* Free Lists                           */
+#include "H5MFprivate.h" /* File space management                */
+#include "H5MMprivate.h" /* Memory management			*/
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Shard block signature & version */
+#define H5D_SHARD_MAGIC   "SHRD"
+#define H5D_SHARD_VERSION 0
+
+/* Size of an entry in a shard's chunk table */
+#define H5D_SHARD_ENT_SIZE(f) ((size_t)H5F_SIZEOF_ADDR(f) + 4 + 4)
+
+/* Size of the header of a shard (signature, version, reserved, size, used, chunk table & checksum) */
+#define H5D_SHARD_HDR_SIZE(f, nchunks)                                                                       \
+    ((size_t)H5_SIZEOF_MAGIC + 4 + 8 + 8 + (nchunks)*H5D_SHARD_ENT_SIZE(f) + H5_SIZEOF_CHKSUM)
+
+/* Check if a chunk is stored in a shard's block */
+#define H5D_SHARD_IN_BLOCK(shard, caddr)                                                                     \
+    (H5F_addr_le((shard)->addr, (caddr)) && H5F_addr_lt((caddr), (shard)->addr + (shard)->size))
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* Entry in a shard's chunk table */
+typedef struct H5D_shard_ent_t {
+    haddr_t  addr;        /* Address of chunk (HADDR_UNDEF if not stored) */
+    uint32_t nbytes;      /* Size of chunk in the file */
+    uint32_t filter_mask; /* Excluded filters for chunk */
+} H5D_shard_ent_t;
+
+/* A shard's header, in memory */
+typedef struct H5D_shard_t {
+    hsize_t          scaled[H5O_LAYOUT_NDIMS]; /* Scaled offset of shard */
+    haddr_t          addr;                     /* Address of shard's block (HADDR_UNDEF if not loaded) */
+    hsize_t          size;                     /* Size of shard's block */
+    hsize_t          used;                     /* Bytes used from the start of the block */
+    size_t           nchunks;                  /* # of entries in chunk table */
+    size_t           hdr_size;                 /* Size of header in the file */
+    H5D_shard_ent_t *ent;                      /* Chunk table */
+    uint8_t *        image;                    /* Buffer for encoded header */
+} H5D_shard_t;
+
+/* Callback info for iteration over chunks in shards */
+typedef struct H5D_shard_it_ud_t {
+    const H5D_chk_idx_info_t *idx_info; /* Index info for the dataset */
+    H5D_shard_t *             shard;    /* Header of shard being visited */
+    H5D_chunk_cb_func_t       cb;       /* Callback routine for the chunk (NULL to free outside chunks) */
+    void *                    udata;    /* User data for the chunk's callback routine */
+} H5D_shard_it_ud_t;
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/* Helper routines */
+static void         H5D__shard_outer_info(const H5D_chk_idx_info_t *idx_info, H5D_chk_idx_info_t *outer_info,
+                                          H5O_layout_chunk_t *outer_layout, H5O_storage_chunk_t *outer_storage);
+static void         H5D__shard_outer_storage(const H5O_storage_chunk_t *storage,
+                                             H5O_storage_chunk_t *    outer_storage);
+static void         H5D__shard_outer_save(H5O_storage_chunk_t *storage, const H5O_storage_chunk_t *outer_storage);
+static size_t       H5D__shard_nchunks(const H5O_layout_chunk_t *layout);
+static hsize_t      H5D__shard_capacity(const H5F_t *f, const H5O_layout_chunk_t *layout);
+static size_t       H5D__shard_locate(const H5O_layout_chunk_t *layout, const hsize_t *scaled, hsize_t *sscaled);
+static H5D_shard_t *H5D__shard_new(const H5F_t *f, const H5O_layout_chunk_t *layout);
+static H5D_shard_t *H5D__shard_free(H5D_shard_t *shard);
+static herr_t       H5D__shard_read(H5F_t *f, H5D_shard_t *shard, haddr_t addr, const hsize_t *sscaled,
+                                    unsigned ndims);
+static herr_t       H5D__shard_write(H5F_t *f, H5D_shard_t *shard);
+static herr_t       H5D__shard_load(const H5D_chk_idx_info_t *idx_info, const hsize_t *sscaled, hbool_t *found);
+static herr_t       H5D__shard_outer_update(const H5D_chk_idx_info_t *idx_info, const H5D_shard_t *shard);
+static int          H5D__shard_iterate_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
+static int          H5D__shard_count_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
+static int          H5D__shard_visit(const H5D_chk_idx_info_t *idx_info, H5D_shard_it_ud_t *udata);
+
+/* Sharded chunk index callbacks */
+static herr_t  H5D__shard_idx_init(const H5D_chk_idx_info_t *idx_info, const H5S_t *space,
+                                   haddr_t dset_ohdr_addr);
+static herr_t  H5D__shard_idx_create(const H5D_chk_idx_info_t *idx_info);
+static hbool_t H5D__shard_idx_is_space_alloc(const H5O_storage_chunk_t *storage);
+static herr_t  H5D__shard_idx_insert(const H5D_chk_idx_info_t *idx_info, H5D_chunk_ud_t *udata,
+                                     const H5D_t *dset);
+static herr_t  H5D__shard_idx_get_addr(const H5D_chk_idx_info_t *idx_info, H5D_chunk_ud_t *udata);
+static int     H5D__shard_idx_iterate(const H5D_chk_idx_info_t *idx_info, H5D_chunk_cb_func_t chunk_cb,
+                                      void *chunk_udata);
+static herr_t  H5D__shard_idx_remove(const H5D_chk_idx_info_t *idx_info, H5D_chunk_common_ud_t *udata);
+static herr_t  H5D__shard_idx_delete(const H5D_chk_idx_info_t *idx_info);
+static herr_t  H5D__shard_idx_copy_setup(const H5D_chk_idx_info_t *idx_info_src,
+                                         const H5D_chk_idx_info_t *idx_info_dst);
+static herr_t  H5D__shard_idx_copy_shutdown(H5O_storage_chunk_t *storage_src, H5O_storage_chunk_t *storage_dst);
+static herr_t  H5D__shard_idx_size(const H5D_chk_idx_info_t *idx_info, hsize_t *size);
+static herr_t  H5D__shard_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr);
+static herr_t  H5D__shard_idx_dump(const H5O_storage_chunk_t *storage, FILE *stream);
+static herr_t  H5D__shard_idx_dest(const H5D_chk_idx_info_t *idx_info);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/* Chunked dataset I/O ops for sharded indexing */
+const H5D_chunk_ops_t H5D_COPS_SHARD[1] = {{
+    FALSE,                         /* Sharded indices don't support SWMR access */
+    H5D__shard_idx_init,           /* init */
+    H5D__shard_idx_create,         /* create */
+    H5D__shard_idx_is_space_alloc, /* is_space_alloc */
+    H5D__shard_idx_insert,         /* insert */
+    H5D__shard_idx_get_addr,       /* get_addr */
+    NULL,                          /* resize */
+    H5D__shard_idx_iterate,        /* iterate */
+    H5D__shard_idx_remove,         /* remove */
+    H5D__shard_idx_delete,         /* delete */
+    H5D__shard_idx_copy_setup,     /* copy_setup */
+    H5D__shard_idx_copy_shutdown,  /* copy_shutdown */
+    H5D__shard_idx_size,           /* size */
+    H5D__shard_idx_reset,          /* reset */
+    H5D__shard_idx_dump,           /* dump */
+    H5D__shard_idx_dest            /* destroy */
+}};
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_outer_info
+ *
+ * Purpose:     Set up the index info for the v2 B-tree of shards: a
+ *              chunked layout whose "chunks" are the shards, stored in
+ *              blocks of the size of an unfiltered shard.
+ *
+ *              The v2 B-tree's handle & address are saved back into the
+ *              dataset's storage info with H5D__shard_outer_save().
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__shard_outer_info(const H5D_chk_idx_info_t *idx_info, H5D_chk_idx_info_t *outer_info,
+                      H5O_layout_chunk_t *outer_layout, H5O_storage_chunk_t *outer_storage)
+{
+    hsize_t  capacity; /* Size of an unfiltered shard */
+    unsigned u;        /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(idx_info);
+    HDassert(idx_info->layout);
+    HDassert(H5D_CHUNK_IDX_SHARD == idx_info->layout->idx_type);
+    HDassert(idx_info->storage);
+
+    /* Set up the layout of the shards */
+    *outer_layout          = *idx_info->layout;
+    outer_layout->idx_type = H5D_CHUNK_IDX_BT2;
+    for (u = 0; u < idx_info->layout->ndims - 1; u++)
+        outer_layout->dim[u] = idx_info->layout->dim[u] * idx_info->layout->u.shard.dim[u];
+    capacity = H5D__shard_capacity(idx_info->f, idx_info->layout);
+    H5_CHECKED_ASSIGN(outer_layout->size, uint32_t, capacity, hsize_t);
+    outer_layout->u.btree2 = idx_info->layout->u.shard.btree2;
+
+    /* Set up the storage of the shards */
+    H5D__shard_outer_storage(idx_info->storage, outer_storage);
+
+    /* Set up the index info */
+    outer_info->f       = idx_info->f;
+    outer_info->pline   = idx_info->pline;
+    outer_info->layout  = outer_layout;
+    outer_info->storage = outer_storage;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__shard_outer_info() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_outer_storage
+ *
+ * Purpose:     Set up the storage info for the v2 B-tree of shards.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__shard_outer_storage(const H5O_storage_chunk_t *storage, H5O_storage_chunk_t *outer_storage)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(storage);
+    HDassert(H5D_CHUNK_IDX_SHARD == storage->idx_type);
+    HDassert(outer_storage);
+
+    outer_storage->idx_type = H5D_CHUNK_IDX_BT2;
+    outer_storage->idx_addr = storage->idx_addr;
+    outer_storage->ops      = H5D_COPS_BT2;
+    outer_storage->u.btree2 = storage->u.shard.btree2;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__shard_outer_storage() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_outer_save
+ *
+ * Purpose:     Save the v2 B-tree handle & address of the shards into the
+ *              dataset's storage info.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__shard_outer_save(H5O_storage_chunk_t *storage, const H5O_storage_chunk_t *outer_storage)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(storage);
+    HDassert(outer_storage);
+    HDassert(H5D_CHUNK_IDX_BT2 == outer_storage->idx_type);
+
+    storage->idx_addr       = outer_storage->idx_addr;
+    storage->u.shard.btree2 = outer_storage->u.btree2;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__shard_outer_save() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_nchunks
+ *
+ * Purpose:     Compute the number of chunks in a shard.
+ *
+ * Return:      The number of chunks in a shard
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5D__shard_nchunks(const H5O_layout_chunk_t *layout)
+{
+    unsigned u;             /* Local index variable */
+    size_t   ret_value = 1; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(layout);
+    HDassert(layout->ndims > 0);
+
+    for (u = 0; u < layout->ndims - 1; u++)
+        ret_value *= (size_t)layout->u.shard.dim[u];
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_nchunks() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_capacity
+ *
+ * Purpose:     Compute the size of a shard of unfiltered chunks, which is
+ *              also the largest a shard of filtered chunks grows.
+ *
+ * Return:      The size of a shard's block, in bytes
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5D__shard_capacity(const H5F_t *f, const H5O_layout_chunk_t *layout)
+{
+    size_t  nchunks;       /* # of chunks in a shard */
+    hsize_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(layout);
+
+    nchunks   = H5D__shard_nchunks(layout);
+    ret_value = (hsize_t)H5D_SHARD_HDR_SIZE(f, nchunks) + (hsize_t)nchunks * layout->size;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_capacity() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_locate
+ *
+ * Purpose:     Compute the scaled offset of the shard holding a chunk, in
+ *              *SSCALED, and the chunk's position in the shard.
+ *
+ * Return:      The chunk's index in the shard's chunk table
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5D__shard_locate(const H5O_layout_chunk_t *layout, const hsize_t *scaled, hsize_t *sscaled)
+{
+    size_t   idx = 0; /* Index of chunk in shard */
+    unsigned u;       /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(layout);
+    HDassert(scaled);
+    HDassert(sscaled);
+
+    for (u = 0; u < layout->ndims - 1; u++) {
+        sscaled[u] = scaled[u] / layout->u.shard.dim[u];
+        idx        = (idx * layout->u.shard.dim[u]) + (size_t)(scaled[u] % layout->u.shard.dim[u]);
+    } /* end for */
+    sscaled[layout->ndims - 1] = 0;
+
+    FUNC_LEAVE_NOAPI(idx)
+} /* end H5D__shard_locate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_new
+ *
+ * Purpose:     Allocate the in-memory header of a shard.
+ *
+ * Return:      Success:    Pointer to the shard's header
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_shard_t *
+H5D__shard_new(const H5F_t *f, const H5O_layout_chunk_t *layout)
+{
+    H5D_shard_t *shard     = NULL; /* New shard header */
+    H5D_shard_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(layout);
+
+    if (NULL == (shard = (H5D_shard_t *)H5MM_calloc(sizeof(H5D_shard_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for shard")
+    shard->addr     = HADDR_UNDEF;
+    shard->nchunks  = H5D__shard_nchunks(layout);
+    shard->hdr_size = H5D_SHARD_HDR_SIZE(f, shard->nchunks);
+    if (NULL == (shard->ent = (H5D_shard_ent_t *)H5MM_malloc(shard->nchunks * sizeof(H5D_shard_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for shard's chunk table")
+    if (NULL == (shard->image = (uint8_t *)H5MM_malloc(shard->hdr_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for shard's header")
+
+    /* Set return value */
+    ret_value = shard;
+
+done:
+    if (NULL == ret_value)
+        H5D__shard_free(shard);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_new() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_free
+ *
+ * Purpose:     Release the in-memory header of a shard.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_shard_t *
+H5D__shard_free(H5D_shard_t *shard)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    if (shard) {
+        H5MM_xfree(shard->ent);
+        H5MM_xfree(shard->image);
+        H5MM_xfree(shard);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(NULL)
+} /* end H5D__shard_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_read
+ *
+ * Purpose:     Read the header of the shard at ADDR, with scaled offset
+ *              SSCALED, from the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_read(H5F_t *f, H5D_shard_t *shard, haddr_t addr, const hsize_t *sscaled, unsigned ndims)
+{
+    const uint8_t *p;                   /* Pointer into the header's image */
+    const uint8_t *chksum_p;            /* Pointer to stored checksum */
+    uint32_t       stored_chksum;       /* Stored checksum */
+    uint32_t       computed_chksum;     /* Computed checksum */
+    size_t         u;                   /* Local index variable */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(shard);
+    HDassert(H5F_addr_defined(addr));
+    HDassert(sscaled);
+
+    /* Forget the shard loaded before, in case of failure */
+    shard->addr = HADDR_UNDEF;
+
+    if (H5F_block_read(f, H5FD_MEM_DRAW, addr, shard->hdr_size, shard->image) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read shard's header")
+    p = shard->image;
+
+    /* Magic number & version */
+    if (HDmemcmp(p, H5D_SHARD_MAGIC, (size_t)H5_SIZEOF_MAGIC) != 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "wrong shard signature")
+    p += H5_SIZEOF_MAGIC;
+    if (*p++ != H5D_SHARD_VERSION)
+        HGOTO_ERROR(H5E_DATASET, H5E_VERSION, FAIL, "wrong shard version")
+    p += 3; /* Reserved */
+
+    /* Verify checksum */
+    chksum_p = shard->image + shard->hdr_size - H5_SIZEOF_CHKSUM;
+    UINT32DECODE(chksum_p, stored_chksum);
+    computed_chksum = H5_checksum_metadata(shard->image, shard->hdr_size - H5_SIZEOF_CHKSUM, 0);
+    if (stored_chksum != computed_chksum)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "incorrect checksum for shard's header")
+
+    /* Block size & bytes used */
+    UINT64DECODE(p, shard->size);
+    UINT64DECODE(p, shard->used);
+    if (shard->used < shard->hdr_size || shard->used > shard->size)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "invalid size of shard")
+
+    /* Chunk table */
+    for (u = 0; u < shard->nchunks; u++) {
+        H5F_addr_decode(f, &p, &shard->ent[u].addr);
+        UINT32DECODE(p, shard->ent[u].nbytes);
+        UINT32DECODE(p, shard->ent[u].filter_mask);
+    } /* end for */
+
+    /* Set the shard's location */
+    H5MM_memcpy(shard->scaled, sscaled, ndims * sizeof(hsize_t));
+    shard->addr = addr;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_write
+ *
+ * Purpose:     Write the header of a shard to the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_write(H5F_t *f, H5D_shard_t *shard)
+{
+    uint8_t *p;                   /* Pointer into the header's image */
+    uint32_t chksum;              /* Checksum of the header */
+    size_t   u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(shard);
+    HDassert(H5F_addr_defined(shard->addr));
+
+    p = shard->image;
+
+    /* Magic number, version & reserved bytes */
+    H5MM_memcpy(p, H5D_SHARD_MAGIC, (size_t)H5_SIZEOF_MAGIC);
+    p += H5_SIZEOF_MAGIC;
+    *p++ = H5D_SHARD_VERSION;
+    *p++ = 0;
+    *p++ = 0;
+    *p++ = 0;
+
+    /* Block size & bytes used */
+    UINT64ENCODE(p, shard->size);
+    UINT64ENCODE(p, shard->used);
+
+    /* Chunk table */
+    for (u = 0; u < shard->nchunks; u++) {
+        H5F_addr_encode(f, &p, shard->ent[u].addr);
+        UINT32ENCODE(p, shard->ent[u].nbytes);
+        UINT32ENCODE(p, shard->ent[u].filter_mask);
+    } /* end for */
+
+    /* Checksum */
+    chksum = H5_checksum_metadata(shard->image, (size_t)(p - shard->image), 0);
+    UINT32ENCODE(p, chksum);
+    HDassert((size_t)(p - shard->image) == shard->hdr_size);
+
+    if (H5F_block_write(f, H5FD_MEM_DRAW, shard->addr, shard->hdr_size, shard->image) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write shard's header")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_load
+ *
+ * Purpose:     Make the shard with scaled offset SSCALED the dataset's
+ *              current shard, reading its header from the file unless
+ *              it's current already.  *FOUND is set to FALSE if the shard
+ *              hasn't been stored.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_load(const H5D_chk_idx_info_t *idx_info, const hsize_t *sscaled, hbool_t *found)
+{
+    H5O_storage_chunk_t *storage;             /* Dataset's chunk storage info */
+    H5D_chk_idx_info_t   outer_info;          /* Index info for v2 B-tree of shards */
+    H5O_layout_chunk_t   outer_layout;        /* Layout of shards */
+    H5O_storage_chunk_t  outer_storage;       /* Storage of shards */
+    H5D_chunk_ud_t       outer_udata;         /* Shard's record */
+    unsigned             ndims;               /* # of dimensions of shard offsets */
+    herr_t               ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(idx_info);
+    HDassert(idx_info->storage);
+    HDassert(H5F_addr_defined(idx_info->storage->idx_addr));
+    HDassert(sscaled);
+    HDassert(found);
+
+    storage = idx_info->storage;
+    ndims   = idx_info->layout->ndims - 1;
+
+    /* Check for the current shard */
+    if (storage->u.shard.shard && H5F_addr_defined(storage->u.shard.shard->addr) &&
+        0 == HDmemcmp(storage->u.shard.shard->scaled, sscaled, ndims * sizeof(hsize_t)))
+        *found = TRUE;
+    else {
+        /* Look up the shard in the v2 B-tree */
+        H5D__shard_outer_info(idx_info, &outer_info, &outer_layout, &outer_storage);
+        HDmemset(&outer_udata, 0, sizeof(outer_udata));
+        outer_udata.common.layout  = &outer_layout;
+        outer_udata.common.storage = &outer_storage;
+        outer_udata.common.scaled  = sscaled;
+        if ((H5D_COPS_BT2->get_addr)(&outer_info, &outer_udata) < 0) {
+            H5D__shard_outer_save(storage, &outer_storage);
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't look up shard")
+        } /* end if */
+        H5D__shard_outer_save(storage, &outer_storage);
+
+        if (H5F_addr_defined(outer_udata.chunk_block.offset)) {
+            /* Set up the dataset's current shard */
+            if (NULL == storage->u.shard.shard)
+                if (NULL == (storage->u.shard.shard = H5D__shard_new(idx_info->f, idx_info->layout)))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate shard")
+
+            if (H5D__shard_read(idx_info->f, storage->u.shard.shard, outer_udata.chunk_block.offset, sscaled,
+                                ndims) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read shard")
+            *found = TRUE;
+        } /* end if */
+        else
+            *found = FALSE;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_load() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_outer_update
+ *
+ * Purpose:     Insert or update the record of a shard in the v2 B-tree of
+ *              shards.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_outer_update(const H5D_chk_idx_info_t *idx_info, const H5D_shard_t *shard)
+{
+    H5D_chk_idx_info_t  outer_info;          /* Index info for v2 B-tree of shards */
+    H5O_layout_chunk_t  outer_layout;        /* Layout of shards */
+    H5O_storage_chunk_t outer_storage;       /* Storage of shards */
+    H5D_chunk_ud_t      outer_udata;         /* Shard's record */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(idx_info);
+    HDassert(shard);
+    HDassert(H5F_addr_defined(shard->addr));
+
+    H5D__shard_outer_info(idx_info, &outer_info, &outer_layout, &outer_storage);
+    HDmemset(&outer_udata, 0, sizeof(outer_udata));
+    outer_udata.common.layout     = &outer_layout;
+    outer_udata.common.storage    = &outer_storage;
+    outer_udata.common.scaled     = shard->scaled;
+    outer_udata.chunk_block.offset = shard->addr;
+    outer_udata.chunk_block.length = shard->size;
+    outer_udata.filter_mask        = 0;
+    if ((H5D_COPS_BT2->insert)(&outer_info, &outer_udata, NULL) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert shard into v2 B-tree")
+    H5D__shard_outer_save(idx_info->storage, &outer_storage);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_outer_update() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_file_alloc
+ *
+ * Purpose:     Allocate file space for a chunk of a dataset with a
+ *              sharded chunk index, creating the chunk's shard if
+ *              needed.  The chunk's address is returned in NEW_CHUNK,
+ *              and is inserted in the shard's chunk table by the index's
+ *              'insert' callback.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__shard_file_alloc(const H5D_chk_idx_info_t *idx_info, H5F_block_t *new_chunk, const hsize_t *scaled)
+{
+    H5D_shard_t *    shard;                     /* Chunk's shard */
+    H5D_shard_ent_t *ent;                       /* Chunk's entry in the shard */
+    hsize_t          sscaled[H5O_LAYOUT_NDIMS]; /* Scaled offset of shard */
+    hsize_t          capacity;                  /* Size of an unfiltered shard */
+    size_t           idx;                       /* Index of chunk in shard */
+    hbool_t          found;                     /* Whether the shard exists */
+    hbool_t          shard_dirty = FALSE;       /* Whether the shard's size changed */
+    herr_t           ret_value   = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(H5D_CHUNK_IDX_SHARD == idx_info->storage->idx_type);
+    HDassert(new_chunk);
+    HDassert(new_chunk->length > 0);
+    HDassert(scaled);
+
+    /* Chunk sizes are stored in 4 bytes */
+    if (new_chunk->length > (hsize_t)0xffffffff)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk in shard must be < 4GB")
+
+    capacity = H5D__shard_capacity(idx_info->f, idx_info->layout);
+    idx      = H5D__shard_locate(idx_info->layout, scaled, sscaled);
+
+    /* Get the chunk's shard, creating it if it doesn't exist yet */
+    if (H5D__shard_load(idx_info, sscaled, &found) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTLOAD, FAIL, "can't load shard")
+    if (!found) {
+        size_t u; /* Local index variable */
+
+        if (NULL == idx_info->storage->u.shard.shard)
+            if (NULL == (idx_info->storage->u.shard.shard = H5D__shard_new(idx_info->f, idx_info->layout)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate shard")
+        shard = idx_info->storage->u.shard.shard;
+
+        /* Unfiltered shards are allocated whole, filtered ones grow as needed */
+        shard->used = shard->hdr_size;
+        if (idx_info->pline->nused > 0)
+            shard->size = MIN(capacity, shard->hdr_size + new_chunk->length);
+        else
+            shard->size = capacity;
+        for (u = 0; u < shard->nchunks; u++) {
+            shard->ent[u].addr        = HADDR_UNDEF;
+            shard->ent[u].nbytes      = 0;
+            shard->ent[u].filter_mask = 0;
+        } /* end for */
+        H5MM_memcpy(shard->scaled, sscaled, idx_info->layout->ndims * sizeof(hsize_t));
+
+        if (HADDR_UNDEF == (shard->addr = H5MF_alloc(idx_info->f, H5FD_MEM_DRAW, shard->size)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed for shard")
+
+        /* Add the shard to the v2 B-tree */
+        if (H5D__shard_outer_update(idx_info, shard) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert shard")
+        shard_dirty = TRUE;
+    } /* end if */
+    shard = idx_info->storage->u.shard.shard;
+    ent   = &shard->ent[idx];
+
+    if (0 == idx_info->pline->nused) {
+        /* Unfiltered chunks have a fixed place in the shard */
+        HDassert(new_chunk->length == idx_info->layout->size);
+        new_chunk->offset = shard->addr + shard->hdr_size + (hsize_t)idx * idx_info->layout->size;
+    } /* end if */
+    else {
+        hbool_t alloc_chunk = TRUE; /* Whether to allocate space for the chunk */
+
+        /* Check for space used by the chunk before */
+        if (H5F_addr_defined(ent->addr)) {
+            if (H5D_SHARD_IN_BLOCK(shard, ent->addr)) {
+                /* Re-use the chunk's space in the shard if the chunk still fits.
+                 * (Otherwise, the space is lost, until the shard is deleted.)
+                 */
+                if (new_chunk->length <= ent->nbytes)
+                    alloc_chunk = FALSE;
+            } /* end if */
+            else {
+                /* Re-use or release the chunk's space outside the shard */
+                if (new_chunk->length == ent->nbytes)
+                    alloc_chunk = FALSE;
+                else if (H5MF_xfree(idx_info->f, H5FD_MEM_DRAW, ent->addr, (hsize_t)ent->nbytes) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk")
+            } /* end else */
+        }     /* end if */
+
+        if (!alloc_chunk)
+            new_chunk->offset = ent->addr;
+        else {
+            /* Extend the shard if the chunk doesn't fit in it, doubling its
+             * space for chunks if possible.
+             */
+            if (shard->used + new_chunk->length > shard->size &&
+                shard->used + new_chunk->length <= capacity) {
+                hsize_t need  = (shard->used + new_chunk->length) - shard->size; /* Bytes needed */
+                hsize_t extra = MIN(MAX(need, shard->size - shard->hdr_size),
+                                    capacity - shard->size); /* Bytes to extend by */
+                htri_t  extended;                            /* Whether the shard was extended */
+
+                if ((extended = H5MF_try_extend(idx_info->f, H5FD_MEM_DRAW, shard->addr, shard->size,
+                                                extra)) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTEXTEND, FAIL, "can't extend shard")
+                if (!extended && extra > need) {
+                    extra = need;
+                    if ((extended = H5MF_try_extend(idx_info->f, H5FD_MEM_DRAW, shard->addr, shard->size,
+                                                    extra)) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTEXTEND, FAIL, "can't extend shard")
+                } /* end if */
+                if (extended) {
+                    shard->size += extra;
+                    if (H5D__shard_outer_update(idx_info, shard) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTUPDATE, FAIL, "unable to update shard")
+                } /* end if */
+            }     /* end if */
+
+            if (shard->used + new_chunk->length <= shard->size) {
+                /* Append the chunk to the shard */
+                new_chunk->offset = shard->addr + shard->used;
+                shard->used += new_chunk->length;
+                shard_dirty = TRUE;
+            } /* end if */
+            else {
+                /* Store the chunk outside the shard */
+                if (HADDR_UNDEF ==
+                    (new_chunk->offset = H5MF_alloc(idx_info->f, H5FD_MEM_DRAW, new_chunk->length)))
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
+            } /* end else */
+        }     /* end else */
+    }         /* end else */
+
+    /* Save the shard's size, in case another shard is used before the chunk is inserted */
+    if (shard_dirty && H5D__shard_write(idx_info->f, shard) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write shard")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_file_alloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_iterate_cb
+ *
+ * Purpose:     Visit the chunks of a shard, making the callback for each
+ *              chunk, or releasing the chunks stored outside the shard if
+ *              there's no callback.
+ *
+ * Return:      Success:    H5_ITER_CONT or the callback's return value
+ *              Failure:    H5_ITER_ERROR
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__shard_iterate_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
+{
+    H5D_shard_it_ud_t *       udata    = (H5D_shard_it_ud_t *)_udata; /* User data */
+    const H5D_chk_idx_info_t *idx_info = udata->idx_info;             /* Dataset's index info */
+    H5D_shard_t *             shard    = udata->shard;                /* Shard's header */
+    unsigned                  ndims;                                  /* # of dimensions of offsets */
+    size_t                    idx;                                    /* Index of chunk in shard */
+    int                       ret_value = H5_ITER_CONT;               /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    ndims = idx_info->layout->ndims - 1;
+
+    /* Read the shard's header */
+    if (H5D__shard_read(idx_info->f, shard, chunk_rec->chunk_addr, chunk_rec->scaled, ndims) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, H5_ITER_ERROR, "can't read shard")
+
+    for (idx = 0; idx < shard->nchunks && H5_ITER_CONT == ret_value; idx++) {
+        const H5D_shard_ent_t *ent = &shard->ent[idx]; /* Chunk's entry */
+
+        if (!H5F_addr_defined(ent->addr))
+            continue;
+
+        if (udata->cb) {
+            H5D_chunk_rec_t rec; /* Chunk's record */
+            size_t          off; /* Remaining index of chunk in shard */
+            unsigned        u;   /* Local index variable */
+
+            /* Compute the chunk's scaled offset from the shard's offset */
+            off = idx;
+            for (u = ndims; u > 0; u--) {
+                rec.scaled[u - 1] = (shard->scaled[u - 1] * idx_info->layout->u.shard.dim[u - 1]) +
+                                    (hsize_t)(off % idx_info->layout->u.shard.dim[u - 1]);
+                off /= idx_info->layout->u.shard.dim[u - 1];
+            } /* end for */
+            rec.scaled[ndims] = 0;
+            rec.nbytes        = ent->nbytes;
+            rec.filter_mask   = ent->filter_mask;
+            rec.chunk_addr    = ent->addr;
+
+            /* Make "generic chunk" callback */
+            if ((ret_value = (udata->cb)(&rec, udata->udata)) < 0)
+                HERROR(H5E_DATASET, H5E_CALLBACK, "failure in generic chunk iterator callback");
+        } /* end if */
+        else if (!H5D_SHARD_IN_BLOCK(shard, ent->addr))
+            if (H5MF_xfree(idx_info->f, H5FD_MEM_DRAW, ent->addr, (hsize_t)ent->nbytes) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, H5_ITER_ERROR, "unable to free chunk")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_iterate_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_count_cb
+ *
+ * Purpose:     Count the shards of a dataset.
+ *
+ * Return:      H5_ITER_CONT
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__shard_count_cb(const H5D_chunk_rec_t H5_ATTR_UNUSED *chunk_rec, void *_udata)
+{
+    hsize_t *nshards = (hsize_t *)_udata; /* # of shards */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    (*nshards)++;
+
+    FUNC_LEAVE_NOAPI(H5_ITER_CONT)
+} /* end H5D__shard_count_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_visit
+ *
+ * Purpose:     Visit the shards of a dataset with H5D__shard_iterate_cb().
+ *
+ * Return:      Success:    H5_ITER_CONT or the callback's return value
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__shard_visit(const H5D_chk_idx_info_t *idx_info, H5D_shard_it_ud_t *udata)
+{
+    H5D_chk_idx_info_t  outer_info;       /* Index info for v2 B-tree of shards */
+    H5O_layout_chunk_t  outer_layout;     /* Layout of shards */
+    H5O_storage_chunk_t outer_storage;    /* Storage of shards */
+    int                 ret_value = FAIL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(idx_info);
+    HDassert(udata);
+
+    /* Use a header of its own, as the callback may use the current shard */
+    udata->idx_info = idx_info;
+    if (NULL == (udata->shard = H5D__shard_new(idx_info->f, idx_info->layout)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate shard")
+
+    H5D__shard_outer_info(idx_info, &outer_info, &outer_layout, &outer_storage);
+    if ((ret_value = (H5D_COPS_BT2->iterate)(&outer_info, H5D__shard_iterate_cb, udata)) < 0)
+        HERROR(H5E_DATASET, H5E_BADITER, "unable to iterate over shards");
+    H5D__shard_outer_save(idx_info->storage, &outer_storage);
+
+done:
+    udata->shard = H5D__shard_free(udata->shard);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_visit() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_init
+ *
+ * Purpose:     Check that a dataset can use a sharded chunk index, and
+ *              initialize the index's information in memory.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_idx_init(const H5D_chk_idx_info_t *idx_info, const H5S_t *space, haddr_t dset_ohdr_addr)
+{
+    H5D_chk_idx_info_t  outer_info;          /* Index info for v2 B-tree of shards */
+    H5O_layout_chunk_t  outer_layout;        /* Layout of shards */
+    H5O_storage_chunk_t outer_storage;       /* Storage of shards */
+    unsigned            u;                   /* Local index variable */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(H5F_addr_defined(dset_ohdr_addr));
+
+    /* Shards are only updated by one process, which can't be seen by SWMR readers */
+    if (H5F_INTENT(idx_info->f) & H5F_ACC_SWMR_WRITE)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "sharded chunk index doesn't support SWMR writes")
+#ifdef H5_HAVE_PARALLEL
+    if (H5F_HAS_FEATURE(idx_info->f, H5FD_FEAT_HAS_MPI))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "sharded chunk index doesn't support parallel I/O")
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Check the shard's dimensions and size */
+    for (u = 0; u < idx_info->layout->ndims - 1; u++)
+        if (0 == idx_info->layout->u.shard.dim[u])
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "shard dimensions must be positive")
+    if (H5D__shard_capacity(idx_info->f, idx_info->layout) > (hsize_t)0xffffffff)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "shard must be < 4GB")
+
+    /* Initialize the v2 B-tree of shards */
+    H5D__shard_outer_info(idx_info, &outer_info, &outer_layout, &outer_storage);
+    if ((H5D_COPS_BT2->init)(&outer_info, space, dset_ohdr_addr) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize v2 B-tree of shards")
+    H5D__shard_outer_save(idx_info->storage, &outer_storage);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_idx_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_create
+ *
+ * Purpose:     Create the v2 B-tree of shards.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_idx_create(const H5D_chk_idx_info_t *idx_info)
+{
+    H5D_chk_idx_info_t  outer_info;          /* Index info for v2 B-tree of shards */
+    H5O_layout_chunk_t  outer_layout;        /* Layout of shards */
+    H5O_storage_chunk_t outer_storage;       /* Storage of shards */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(!H5F_addr_defined(idx_info->storage->idx_addr));
+
+    H5D__shard_outer_info(idx_info, &outer_info, &outer_layout, &outer_storage);
+    if ((H5D_COPS_BT2->create)(&outer_info) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create v2 B-tree of shards")
+    H5D__shard_outer_save(idx_info->storage, &outer_storage);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_idx_create() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_is_space_alloc
+ *
+ * Purpose:     Query if space is allocated for index method
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__shard_idx_is_space_alloc(const H5O_storage_chunk_t *storage)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Check args */
+    HDassert(storage);
+
+    FUNC_LEAVE_NOAPI((hbool_t)H5F_addr_defined(storage->idx_addr))
+} /* end H5D__shard_idx_is_space_alloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_insert
+ *
+ * Purpose:     Insert the address of a chunk, allocated by
+ *              H5D__shard_file_alloc(), in its shard's chunk table.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_idx_insert(const H5D_chk_idx_info_t *idx_info, H5D_chunk_ud_t *udata,
+                      const H5D_t H5_ATTR_UNUSED *dset)
+{
+    H5D_shard_t *    shard;                     /* Chunk's shard */
+    H5D_shard_ent_t *ent;                       /* Chunk's entry in the shard */
+    hsize_t          sscaled[H5O_LAYOUT_NDIMS]; /* Scaled offset of shard */
+    size_t           idx;                       /* Index of chunk in shard */
+    hbool_t          found;                     /* Whether the shard exists */
+    herr_t           ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(H5F_addr_defined(idx_info->storage->idx_addr));
+    HDassert(udata);
+    HDassert(H5F_addr_defined(udata->chunk_block.offset));
+
+    idx = H5D__shard_locate(idx_info->layout, udata->common.scaled, sscaled);
+    if (H5D__shard_load(idx_info, sscaled, &found) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTLOAD, FAIL, "can't load shard")
+    if (!found)
+        HGOTO_ERROR(H5E_DATASET, H5E_NOTFOUND, FAIL, "chunk's shard hasn't been allocated")
+    shard = idx_info->storage->u.shard.shard;
+    ent   = &shard->ent[idx];
+
+    /* Update the chunk's entry */
+    ent->addr = udata->chunk_block.offset;
+    if (idx_info->pline->nused > 0) {
+        H5_CHECKED_ASSIGN(ent->nbytes, uint32_t, udata->chunk_block.length, hsize_t);
+        ent->filter_mask = udata->filter_mask;
+    } /* end if */
+    else {
+        ent->nbytes      = idx_info->layout->size;
+        ent->filter_mask = 0;
+    } /* end else */
+
+    if (H5D__shard_write(idx_info->f, shard) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write shard")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_idx_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_get_addr
+ *
+ * Purpose:     Get the file address of a chunk if file space has been
+ *              assigned.  Save the retrieved information in the udata
+ *              supplied.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_idx_get_addr(const H5D_chk_idx_info_t *idx_info, H5D_chunk_ud_t *udata)
+{
+    hsize_t sscaled[H5O_LAYOUT_NDIMS]; /* Scaled offset of shard */
+    size_t  idx;                       /* Index of chunk in shard */
+    hbool_t found;                     /* Whether the shard exists */
+    herr_t  ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->layout->ndims > 0);
+    HDassert(idx_info->storage);
+    HDassert(H5F_addr_defined(idx_info->storage->idx_addr));
+    HDassert(udata);
+
+    udata->chunk_block.offset = HADDR_UNDEF;
+    udata->chunk_block.length = 0;
+    udata->filter_mask        = 0;
+
+    idx = H5D__shard_locate(idx_info->layout, udata->common.scaled, sscaled);
+    if (H5D__shard_load(idx_info, sscaled, &found) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTLOAD, FAIL, "can't load shard")
+    if (found) {
+        const H5D_shard_ent_t *ent = &idx_info->storage->u.shard.shard->ent[idx]; /* Chunk's entry */
+
+        if (H5F_addr_defined(ent->addr)) {
+            udata->chunk_block.offset = ent->addr;
+            udata->chunk_block.length = ent->nbytes;
+            udata->filter_mask        = ent->filter_mask;
+        } /* end if */
+    }     /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_idx_get_addr() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_iterate
+ *
+ * Purpose:     Iterate over the chunks in an index, making a callback
+ *              for each one.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__shard_idx_iterate(const H5D_chk_idx_info_t *idx_info, H5D_chunk_cb_func_t chunk_cb, void *chunk_udata)
+{
+    H5D_shard_it_ud_t udata;            /* User data for iterating over shards */
+    int               ret_value = FAIL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(H5F_addr_defined(idx_info->storage->idx_addr));
+    HDassert(chunk_cb);
+    HDassert(chunk_udata);
+
+    udata.cb    = chunk_cb;
+    udata.udata = chunk_udata;
+    if ((ret_value = H5D__shard_visit(idx_info, &udata)) < 0)
+        HERROR(H5E_DATASET, H5E_BADITER, "unable to iterate over chunks in shards");
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_idx_iterate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_remove
+ *
+ * Purpose:     Remove chunk from its shard, and the shard from the index
+ *              when its last chunk is removed.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_idx_remove(const H5D_chk_idx_info_t *idx_info, H5D_chunk_common_ud_t *udata)
+{
+    H5D_shard_t *    shard;                     /* Chunk's shard */
+    H5D_shard_ent_t *ent;                       /* Chunk's entry in the shard */
+    hsize_t          sscaled[H5O_LAYOUT_NDIMS]; /* Scaled offset of shard */
+    size_t           idx;                       /* Index of chunk in shard */
+    size_t           u;                         /* Local index variable */
+    hbool_t          found;                     /* Whether the shard exists */
+    herr_t           ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(H5F_addr_defined(idx_info->storage->idx_addr));
+    HDassert(udata);
+
+    idx = H5D__shard_locate(idx_info->layout, udata->scaled, sscaled);
+    if (H5D__shard_load(idx_info, sscaled, &found) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTLOAD, FAIL, "can't load shard")
+    if (!found)
+        HGOTO_DONE(SUCCEED)
+    shard = idx_info->storage->u.shard.shard;
+    ent   = &shard->ent[idx];
+    if (!H5F_addr_defined(ent->addr))
+        HGOTO_DONE(SUCCEED)
+
+    /* Release the chunk's space, if it's outside the shard */
+    if (!H5D_SHARD_IN_BLOCK(shard, ent->addr))
+        if (H5MF_xfree(idx_info->f, H5FD_MEM_DRAW, ent->addr, (hsize_t)ent->nbytes) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk")
+    ent->addr        = HADDR_UNDEF;
+    ent->nbytes      = 0;
+    ent->filter_mask = 0;
+
+    /* Check for other chunks in the shard */
+    for (u = 0; u < shard->nchunks; u++)
+        if (H5F_addr_defined(shard->ent[u].addr))
+            break;
+
+    if (u < shard->nchunks) {
+        if (H5D__shard_write(idx_info->f, shard) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write shard")
+    } /* end if */
+    else {
+        H5D_chk_idx_info_t    outer_info;    /* Index info for v2 B-tree of shards */
+        H5O_layout_chunk_t    outer_layout;  /* Layout of shards */
+        H5O_storage_chunk_t   outer_storage; /* Storage of shards */
+        H5D_chunk_common_ud_t outer_udata;   /* Shard's key */
+
+        /* Remove the empty shard (which releases its space) */
+        shard->addr = HADDR_UNDEF;
+        H5D__shard_outer_info(idx_info, &outer_info, &outer_layout, &outer_storage);
+        outer_udata.layout  = &outer_layout;
+        outer_udata.storage = &outer_storage;
+        outer_udata.scaled  = sscaled;
+        if ((H5D_COPS_BT2->remove)(&outer_info, &outer_udata) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to remove shard from v2 B-tree")
+        H5D__shard_outer_save(idx_info->storage, &outer_storage);
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_idx_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_delete
+ *
+ * Purpose:     Delete index and raw data storage for entire dataset
+ *              (i.e. all chunks)
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_idx_delete(const H5D_chk_idx_info_t *idx_info)
+{
+    H5D_shard_it_ud_t   udata;               /* User data for iterating over shards */
+    H5D_chk_idx_info_t  outer_info;          /* Index info for v2 B-tree of shards */
+    H5O_layout_chunk_t  outer_layout;        /* Layout of shards */
+    H5O_storage_chunk_t outer_storage;       /* Storage of shards */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+
+    /* Forget the current shard */
+    idx_info->storage->u.shard.shard = H5D__shard_free(idx_info->storage->u.shard.shard);
+
+    /* Check if the index data structure has been allocated */
+    if (H5F_addr_defined(idx_info->storage->idx_addr)) {
+        /* Release the chunks stored outside their shards */
+        if (idx_info->pline->nused > 0) {
+            udata.cb    = NULL;
+            udata.udata = NULL;
+            if (H5D__shard_visit(idx_info, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunks outside shards")
+        } /* end if */
+
+        /* Close the v2 B-tree, then delete it (which releases the shards) */
+        H5D__shard_outer_info(idx_info, &outer_info, &outer_layout, &outer_storage);
+        if ((H5D_COPS_BT2->dest)(&outer_info) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to close v2 B-tree of shards")
+        else if ((H5D_COPS_BT2->idx_delete)(&outer_info) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTDELETE, FAIL, "unable to delete v2 B-tree of shards")
+        H5D__shard_outer_save(idx_info->storage, &outer_storage);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_idx_delete() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_copy_setup
+ *
+ * Purpose:     Set up any necessary information for copying chunks
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_idx_copy_setup(const H5D_chk_idx_info_t *idx_info_src, const H5D_chk_idx_info_t *idx_info_dst)
+{
+    H5D_chk_idx_info_t  outer_info_src;      /* Index info for source v2 B-tree of shards */
+    H5O_layout_chunk_t  outer_layout_src;    /* Layout of source shards */
+    H5O_storage_chunk_t outer_storage_src;   /* Storage of source shards */
+    H5D_chk_idx_info_t  outer_info_dst;      /* Index info for destination v2 B-tree of shards */
+    H5O_layout_chunk_t  outer_layout_dst;    /* Layout of destination shards */
+    H5O_storage_chunk_t outer_storage_dst;   /* Storage of destination shards */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Source file */
+    HDassert(idx_info_src);
+    HDassert(idx_info_src->f);
+    HDassert(idx_info_src->pline);
+    HDassert(idx_info_src->layout);
+    HDassert(idx_info_src->storage);
+
+    /* Destination file */
+    HDassert(idx_info_dst);
+    HDassert(idx_info_dst->f);
+    HDassert(idx_info_dst->pline);
+    HDassert(idx_info_dst->layout);
+    HDassert(idx_info_dst->storage);
+    HDassert(!H5F_addr_defined(idx_info_dst->storage->idx_addr));
+
+    H5D__shard_outer_info(idx_info_src, &outer_info_src, &outer_layout_src, &outer_storage_src);
+    H5D__shard_outer_info(idx_info_dst, &outer_info_dst, &outer_layout_dst, &outer_storage_dst);
+    if ((H5D_COPS_BT2->copy_setup)(&outer_info_src, &outer_info_dst) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up copying v2 B-tree of shards")
+    H5D__shard_outer_save(idx_info_src->storage, &outer_storage_src);
+    H5D__shard_outer_save(idx_info_dst->storage, &outer_storage_dst);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_idx_copy_setup() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_copy_shutdown
+ *
+ * Purpose:     Shutdown any information from copying chunks
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_idx_copy_shutdown(H5O_storage_chunk_t *storage_src, H5O_storage_chunk_t *storage_dst)
+{
+    H5O_storage_chunk_t outer_storage_src;   /* Storage of source shards */
+    H5O_storage_chunk_t outer_storage_dst;   /* Storage of destination shards */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(storage_src);
+    HDassert(storage_dst);
+
+    /* Forget the current shards */
+    storage_src->u.shard.shard = H5D__shard_free(storage_src->u.shard.shard);
+    storage_dst->u.shard.shard = H5D__shard_free(storage_dst->u.shard.shard);
+
+    H5D__shard_outer_storage(storage_src, &outer_storage_src);
+    H5D__shard_outer_storage(storage_dst, &outer_storage_dst);
+    if ((H5D_COPS_BT2->copy_shutdown)(&outer_storage_src, &outer_storage_dst) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to shut down copying v2 B-tree of shards")
+    H5D__shard_outer_save(storage_src, &outer_storage_src);
+    H5D__shard_outer_save(storage_dst, &outer_storage_dst);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_idx_copy_shutdown() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_size
+ *
+ * Purpose:     Retrieve the amount of index storage for chunked dataset:
+ *              the v2 B-tree of shards and the shards' headers.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_idx_size(const H5D_chk_idx_info_t *idx_info, hsize_t *index_size)
+{
+    H5D_chk_idx_info_t  outer_info;          /* Index info for v2 B-tree of shards */
+    H5O_layout_chunk_t  outer_layout;        /* Layout of shards */
+    H5O_storage_chunk_t outer_storage;       /* Storage of shards */
+    hsize_t             nshards   = 0;       /* # of shards */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(H5F_addr_defined(idx_info->storage->idx_addr));
+    HDassert(index_size);
+
+    /* Count the shards */
+    H5D__shard_outer_info(idx_info, &outer_info, &outer_layout, &outer_storage);
+    if ((H5D_COPS_BT2->iterate)(&outer_info, H5D__shard_count_cb, &nshards) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "unable to count shards")
+
+    /* Get the v2 B-tree's size (which opens & closes it) */
+    if ((H5D_COPS_BT2->dest)(&outer_info) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to close v2 B-tree of shards")
+    if ((H5D_COPS_BT2->size)(&outer_info, index_size) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get size of v2 B-tree of shards")
+    *index_size += nshards * (hsize_t)H5D_SHARD_HDR_SIZE(idx_info->f, H5D__shard_nchunks(idx_info->layout));
+
+done:
+    H5D__shard_outer_save(idx_info->storage, &outer_storage);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_idx_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_reset
+ *
+ * Purpose:     Reset indexing information.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(storage);
+
+    /* Reset index info */
+    if (reset_addr)
+        storage->idx_addr = HADDR_UNDEF;
+    storage->u.shard.btree2.bt2 = NULL;
+    storage->u.shard.shard      = NULL;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__shard_idx_reset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_dump
+ *
+ * Purpose:     Dump indexing information to a stream.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_idx_dump(const H5O_storage_chunk_t *storage, FILE *stream)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(storage);
+    HDassert(stream);
+
+    HDfprintf(stream, "    Address: %" PRIuHADDR "\n", storage->idx_addr);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__shard_idx_dump() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__shard_idx_dest
+ *
+ * Purpose:     Release indexing information in memory.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__shard_idx_dest(const H5D_chk_idx_info_t *idx_info)
+{
+    H5O_storage_chunk_t outer_storage;       /* Storage of shards */
+    H5D_chk_idx_info_t  outer_info;          /* Index info for v2 B-tree of shards */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->storage);
+
+    /* Forget the current shard */
+    idx_info->storage->u.shard.shard = H5D__shard_free(idx_info->storage->u.shard.shard);
+
+    /* Close the v2 B-tree (which doesn't use the layout) */
+    H5D__shard_outer_storage(idx_info->storage, &outer_storage);
+    outer_info.f       = idx_info->f;
+    outer_info.pline   = idx_info->pline;
+    outer_info.layout  = NULL;
+    outer_info.storage = &outer_storage;
+    if ((H5D_COPS_BT2->dest)(&outer_info) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "unable to close v2 B-tree of shards")
+    H5D__shard_outer_save(idx_info->storage, &outer_storage);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__shard_idx_dest() */
@@ -81,7 +81,6 @@ static ssize_t    H5E__get_class_name(const H5E_cls_t *cls, char *name, size_t s
 static int        H5E__close_msg_cb(void *obj_ptr, hid_t obj_id, void *udata);
 static herr_t     H5E__close_msg(H5E_msg_t *err, void **request);
 static H5E_msg_t *H5E__create_msg(H5E_cls_t *cls, H5E_type_t msg_type, const char *msg);
-static H5E_t *    H5E__get_current_stack(void);
 static herr_t     H5E__set_current_stack(H5E_t *estack);
 static herr_t     H5E__close_stack(H5E_t *err_stack, void **request);
 static ssize_t    H5E__get_num(const H5E_t *err_stack);
@@ -919,7 +918,7 @@ H5Eget_current_stack(void)
     H5TRACE0("i", "");
 
     /* Get the current stack */
-    if (NULL == (stk = H5E__get_current_stack()))
+    if (NULL == (stk = H5E_get_current_stack()))
         HGOTO_ERROR(H5E_ERROR, H5E_CANTCREATE, H5I_INVALID_HID, "can't create error stack")
 
     /* Register the stack */
@@ -931,9 +930,10 @@ done:
 } /* end H5Eget_current_stack() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5E__get_current_stack
+ * Function:    H5E_get_current_stack
  *
- * Purpose:     Private function to register an error stack.
+ * Purpose:     Private function to copy the current error stack and clear
+ *              it.
  *
  * Return:      Success:    Pointer to an error class struct
  *              Failure:    NULL
@@ -943,15 +943,15 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-static H5E_t *
-H5E__get_current_stack(void)
+H5E_t *
+H5E_get_current_stack(void)
 {
     H5E_t *  current_stack;      /* Pointer to the current error stack */
     H5E_t *  estack_copy = NULL; /* Pointer to new error stack to return */
     unsigned u;                  /* Local index variable */
     H5E_t *  ret_value = NULL;   /* Return value */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_NOAPI(NULL)
 
     /* Get a pointer to the current error stack */
     if (NULL == (current_stack = H5E__get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean'
@@ -1006,7 +1006,7 @@ done:
             estack_copy = H5FL_FREE(H5E_t, estack_copy);
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5E__get_current_stack() */
+} /* end H5E_get_current_stack() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5Eset_current_stack
@@ -209,4 +209,6 @@ H5_DLL herr_t H5E_printf_stack(H5E_t *estack, const char *file, const char *func
 H5_DLL herr_t H5E_clear_stack(H5E_t *estack);
 H5_DLL herr_t H5E_dump_api_stack(hbool_t is_api);
 
+H5_DLL H5E_t *H5E_get_current_stack(void);
+
 #endif /* H5Eprivate_H */
@@ -1435,6 +1435,143 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5FDwrite() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FDread_vector
+ *
+ * Purpose:     Performs COUNT reads from FILE according to the data
+ *              transfer property list DXPL_ID (which may be the constant
+ *              H5P_DEFAULT).  The i-th read transfers SIZES[i] bytes of
+ *              TYPES[i] data beginning at address ADDRS[i] into the buffer
+ *              BUFS[i].
+ *
+ *              Drivers that implement the 'read_vector' callback receive
+ *              the whole vector in a single call, which allows them to
+ *              issue fewer, larger I/O requests.  For other drivers the
+ *              library issues one 'read' callback per vector entry.
+ *
+ * Return:      Success:    Non-negative
+ *                          The read results are written into the BUFS
+ *                          buffers which should be allocated by the caller.
+ *
+ *              Failure:    Negative
+ *                          The contents of BUFS are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDread_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                size_t sizes[], void *bufs[] /*out*/)
+{
+    haddr_t *rel_addrs = NULL;    /* Addresses relative to the base address */
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value             */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*#iIu*Mt*a*zx", file, dxpl_id, count, types, addrs, sizes, bufs);
+
+    /* Check arguments */
+    if (!file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file pointer cannot be NULL")
+    if (!file->cls)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file class pointer cannot be NULL")
+    if (count > 0 && (!types || !addrs || !sizes || !bufs))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "vector parameters can't be NULL when count is positive")
+    for (u = 0; u < count; u++)
+        if (!bufs[u] && sizes[u] > 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "result buffer parameter can't be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Compensate for base address addition in internal routine */
+    if (count > 0 && file->base_addr > 0) {
+        if (NULL == (rel_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate address vector")
+        for (u = 0; u < count; u++)
+            rel_addrs[u] = addrs[u] - file->base_addr;
+    } /* end if */
+
+    /* Call private function */
+    if (H5FD_read_vector(file, count, types, rel_addrs ? rel_addrs : addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "file vector read request failed")
+
+done:
+    H5MM_xfree(rel_addrs);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDread_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FDwrite_vector
+ *
+ * Purpose:     Performs COUNT writes to FILE according to the data
+ *              transfer property list DXPL_ID (which may be the constant
+ *              H5P_DEFAULT).  The i-th write transfers SIZES[i] bytes of
+ *              TYPES[i] data from the buffer BUFS[i] to address ADDRS[i].
+ *
+ *              Drivers that implement the 'write_vector' callback receive
+ *              the whole vector in a single call.  For other drivers the
+ *              library issues one 'write' callback per vector entry.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDwrite_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                 size_t sizes[], const void *bufs[])
+{
+    haddr_t *rel_addrs = NULL;    /* Addresses relative to the base address */
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value             */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*#iIu*Mt*a*z**x", file, dxpl_id, count, types, addrs, sizes, bufs);
+
+    /* Check arguments */
+    if (!file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file pointer cannot be NULL")
+    if (!file->cls)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file class pointer cannot be NULL")
+    if (count > 0 && (!types || !addrs || !sizes || !bufs))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "vector parameters can't be NULL when count is positive")
+    for (u = 0; u < count; u++)
+        if (!bufs[u] && sizes[u] > 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "write buffer parameter can't be NULL")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else if (TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(dxpl_id);
+
+    /* Compensate for base address addition in internal routine */
+    if (count > 0 && file->base_addr > 0) {
+        if (NULL == (rel_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate address vector")
+        for (u = 0; u < count; u++)
+            rel_addrs[u] = addrs[u] - file->base_addr;
+    } /* end if */
+
+    /* Call private function */
+    if (H5FD_write_vector(file, count, types, rel_addrs ? rel_addrs : addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "file vector write request failed")
+
+done:
+    H5MM_xfree(rel_addrs);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDwrite_vector() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FDflush
  *
@@ -131,6 +131,8 @@ static const H5FD_class_t H5FD_family_g = {
     H5FD__family_get_handle,    /* get_handle           */
     H5FD__family_read,          /* read            */
     H5FD__family_write,         /* write        */
+    NULL,                       /* read_vector  */
+    NULL,                       /* write_vector */
     H5FD__family_flush,         /* flush        */
     H5FD__family_truncate,      /* truncate        */
     H5FD__family_lock,          /* lock                 */
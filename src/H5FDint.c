@@ -35,6 +35,7 @@
 #include "H5Fprivate.h"  /* File access                              */
 #include "H5FDpkg.h"     /* File Drivers                             */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
 
 /****************/
 /* Local Macros */
@@ -243,6 +244,202 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_read_vector
+ *
+ * Purpose:     Private version of H5FDread_vector()
+ *
+ *              Performs COUNT reads, the i-th of which reads SIZES[i]
+ *              bytes of TYPES[i] data from address ADDRS[i] into BUFS[i].
+ *              The addresses are relative to the base address of the
+ *              file.  If the driver supplies a 'read_vector' callback,
+ *              the entire vector is passed to it in a single call,
+ *              otherwise the 'read' callback is invoked once per entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_read_vector(H5FD_t *file, uint32_t count, H5FD_mem_t types[], haddr_t addrs[], size_t sizes[],
+                 void *bufs[] /*out*/)
+{
+    haddr_t *  abs_addrs = NULL;            /* Absolute addresses of the entries */
+    H5FD_mem_t eoa_type  = H5FD_MEM_NOLIST; /* Memory type of cached EOA */
+    haddr_t    eoa       = HADDR_UNDEF;     /* EOA for the current memory type */
+    hid_t      dxpl_id   = H5I_INVALID_HID; /* DXPL for operation */
+    uint32_t   u;                           /* Local index variable */
+    herr_t     ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+#ifndef H5_HAVE_PARALLEL
+    /* The no-op case
+     *
+     * Do not return early for Parallel mode since the I/O could be a
+     * collective transfer.
+     */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Convert to absolute addresses, checking each entry against the EOA */
+    if (count > 0 && NULL == (abs_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate address vector")
+    for (u = 0; u < count; u++) {
+        HDassert(bufs[u] || sizes[u] == 0);
+
+        /* If the file is open for SWMR read access, allow access to data past
+         * the end of the allocated space (the 'eoa'), as for H5FD_read().
+         */
+        if (!(file->access_flags & H5F_ACC_SWMR_READ)) {
+            if (types[u] != eoa_type) {
+                if (HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, types[u])))
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+                eoa_type = types[u];
+            } /* end if */
+
+            if ((addrs[u] + file->base_addr + sizes[u]) > eoa)
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL,
+                            "addr overflow, addr = %llu, size = %llu, eoa = %llu",
+                            (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u],
+                            (unsigned long long)eoa)
+        } /* end if */
+
+        abs_addrs[u] = addrs[u] + file->base_addr;
+    } /* end for */
+
+    /* Dispatch to driver */
+    if (file->cls->read_vector) {
+        if ((file->cls->read_vector)(file, dxpl_id, count, types, abs_addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read vector request failed")
+    } /* end if */
+    else
+        /* Fall back to issuing one read per vector entry */
+        for (u = 0; u < count; u++)
+            if ((file->cls->read)(file, types[u], dxpl_id, abs_addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read request failed")
+
+done:
+    H5MM_xfree(abs_addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_write_vector
+ *
+ * Purpose:     Private version of H5FDwrite_vector()
+ *
+ *              Performs COUNT writes, the i-th of which writes SIZES[i]
+ *              bytes of TYPES[i] data from BUFS[i] to address ADDRS[i].
+ *              The addresses are relative to the base address of the
+ *              file.  If the driver supplies a 'write_vector' callback,
+ *              the entire vector is passed to it in a single call,
+ *              otherwise the 'write' callback is invoked once per entry.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_write_vector(H5FD_t *file, uint32_t count, H5FD_mem_t types[], haddr_t addrs[], size_t sizes[],
+                  const void *bufs[])
+{
+    haddr_t *  abs_addrs = NULL;            /* Absolute addresses of the entries */
+    H5FD_mem_t eoa_type  = H5FD_MEM_NOLIST; /* Memory type of cached EOA */
+    haddr_t    eoa       = HADDR_UNDEF;     /* EOA for the current memory type */
+    hid_t      dxpl_id;                     /* DXPL for operation */
+    uint32_t   u;                           /* Local index variable */
+    herr_t     ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(file->cls);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Get proper DXPL for I/O */
+    dxpl_id = H5CX_get_dxpl();
+
+#ifndef H5_HAVE_PARALLEL
+    /* The no-op case
+     *
+     * Do not return early for Parallel mode since the I/O could be a
+     * collective transfer.
+     */
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Convert to absolute addresses, checking each entry against the EOA */
+    if (count > 0 && NULL == (abs_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate address vector")
+    for (u = 0; u < count; u++) {
+        HDassert(bufs[u] || sizes[u] == 0);
+
+        if (types[u] != eoa_type) {
+            if (HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, types[u])))
+                HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+            eoa_type = types[u];
+        } /* end if */
+
+        if ((addrs[u] + file->base_addr + sizes[u]) > eoa)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size=%llu, eoa=%llu",
+                        (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u],
+                        (unsigned long long)eoa)
+
+        abs_addrs[u] = addrs[u] + file->base_addr;
+    } /* end for */
+
+    /* Dispatch to driver */
+    if (file->cls->write_vector) {
+        if ((file->cls->write_vector)(file, dxpl_id, count, types, abs_addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write vector request failed")
+    } /* end if */
+    else
+        /* Fall back to issuing one write per vector entry */
+        for (u = 0; u < count; u++)
+            if ((file->cls->write)(file, types[u], dxpl_id, abs_addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write request failed")
+
+done:
+    H5MM_xfree(abs_addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_write_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_has_vector_io
+ *
+ * Purpose:     Checks whether the file's driver implements vector I/O
+ *              natively, i.e. whether H5FD_read_vector() and
+ *              H5FD_write_vector() will result in a single driver call
+ *              instead of one call per vector entry.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5FD_has_vector_io(const H5FD_t *file)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(file && file->cls);
+
+    FUNC_LEAVE_NOAPI(file->cls->read_vector != NULL && file->cls->write_vector != NULL)
+} /* end H5FD_has_vector_io() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD_set_eoa
  *
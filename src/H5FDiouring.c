@@ -0,0 +1,1369 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The io_uring file driver is based on the sec2 driver, but
+ *          issues the entries of vector reads and writes through a Linux
+ *          io_uring submission queue, so that up to 'queue depth' of them
+ *          are in flight in the kernel at once instead of one blocking
+ *          pread()/pwrite() after another.  Single-block I/O is done with
+ *          pread()/pwrite(), as with the sec2 driver.
+ *
+ *          The ring is driven directly through the io_uring_setup() and
+ *          io_uring_enter() system calls, so no extra library is needed.
+ *          If the kernel refuses to create a ring, the driver falls back
+ *          to synchronous I/O.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"   /* Generic Functions        */
+#include "H5Eprivate.h"  /* Error handling           */
+#include "H5Fprivate.h"  /* File access              */
+#include "H5FDprivate.h" /* File drivers             */
+#include "H5FDiouring.h" /* io_uring file driver     */
+#include "H5FLprivate.h" /* Free Lists               */
+#include "H5Iprivate.h"  /* IDs                      */
+#include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+
+#ifdef H5_HAVE_IOURING
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_IOURING_g = 0;
+
+/* Whether to ignore file locks when disabled (env var value) */
+static htri_t ignore_disabled_file_locks_s = FAIL;
+
+/* Largest transfer issued for one request; the kernel reports the number
+ * of bytes transferred in a 32-bit signed integer.  Any remainder is
+ * transferred synchronously.
+ */
+#define H5FD_IOURING_MAX_IO_BYTES ((size_t)1 << 30)
+
+/* Driver-specific file access properties */
+typedef struct H5FD_iouring_fapl_t {
+    unsigned queue_depth; /* # of requests kept in flight */
+} H5FD_iouring_fapl_t;
+
+/* The submission and completion rings shared with the kernel */
+typedef struct H5FD_iouring_ring_t {
+    int                  fd;           /* io_uring file descriptor, or -1 if there's no ring */
+    unsigned             entries;      /* # of submission queue entries                       */
+    void *               sq_ring;      /* mapped submission ring                              */
+    size_t               sq_ring_size; /* size of sq_ring                                     */
+    void *               cq_ring;      /* mapped completion ring (may equal sq_ring)          */
+    size_t               cq_ring_size; /* size of cq_ring                                     */
+    struct io_uring_sqe *sqes;         /* mapped submission queue entries                     */
+    size_t               sqes_size;    /* size of sqes                                        */
+    unsigned *           sq_tail;      /* submission ring tail (written by us)                */
+    unsigned *           sq_mask;      /* submission ring index mask                          */
+    unsigned *           sq_array;     /* submission ring array of sqe indices                */
+    unsigned *           cq_head;      /* completion ring head (written by us)                */
+    unsigned *           cq_tail;      /* completion ring tail (written by the kernel)        */
+    unsigned *           cq_mask;      /* completion ring index mask                          */
+    struct io_uring_cqe *cqes;         /* completion queue entries                            */
+    struct iovec *       iov;          /* I/O vector for each in-flight request               */
+} H5FD_iouring_ring_t;
+
+/*
+ * The description of a file belonging to this driver. The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file (the current size of the underlying filesystem file). The
+ * 'pos' and 'op' values record the last single-block I/O, as in the sec2
+ * driver.
+ */
+typedef struct H5FD_iouring_t {
+    H5FD_t              pub;  /* public stuff, must be first      */
+    int                 fd;   /* the filesystem file descriptor   */
+    haddr_t             eoa;  /* end of allocated region          */
+    haddr_t             eof;  /* end of file; current file size   */
+    haddr_t             pos;  /* current file I/O position        */
+    H5FD_file_op_t      op;   /* last operation                   */
+    H5FD_iouring_fapl_t fa;   /* file access properties           */
+    H5FD_iouring_ring_t ring; /* submission/completion rings      */
+    hbool_t             ignore_disabled_file_locks;
+    char                filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+    dev_t               device;                          /* file device number   */
+    ino_t               inode;                           /* file i-node number   */
+} H5FD_iouring_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Prototypes */
+static herr_t  H5FD__iouring_term(void);
+static void *  H5FD__iouring_fapl_get(H5FD_t *file);
+static void *  H5FD__iouring_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__iouring_close(H5FD_t *_file);
+static int     H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__iouring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                  void *buf);
+static herr_t  H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                   const void *buf);
+static herr_t  H5FD__iouring_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                         haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t  H5FD__iouring_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                          haddr_t addrs[], size_t sizes[], const void *bufs[]);
+static herr_t  H5FD__iouring_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__iouring_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__iouring_unlock(H5FD_t *_file);
+
+static herr_t H5FD__iouring_ring_init(H5FD_iouring_ring_t *ring, unsigned entries);
+static herr_t H5FD__iouring_ring_term(H5FD_iouring_ring_t *ring);
+static herr_t H5FD__iouring_ring_io(H5FD_iouring_t *file, hbool_t do_write, uint32_t count,
+                                    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[]);
+
+static const H5FD_class_t H5FD_iouring_g = {
+    "iouring",                   /* name                 */
+    MAXADDR,                     /* maxaddr              */
+    H5F_CLOSE_WEAK,              /* fc_degree            */
+    H5FD__iouring_term,          /* terminate            */
+    NULL,                        /* sb_size              */
+    NULL,                        /* sb_encode            */
+    NULL,                        /* sb_decode            */
+    sizeof(H5FD_iouring_fapl_t), /* fapl_size            */
+    H5FD__iouring_fapl_get,      /* fapl_get             */
+    H5FD__iouring_fapl_copy,     /* fapl_copy            */
+    NULL,                        /* fapl_free            */
+    0,                           /* dxpl_size            */
+    NULL,                        /* dxpl_copy            */
+    NULL,                        /* dxpl_free            */
+    H5FD__iouring_open,          /* open                 */
+    H5FD__iouring_close,         /* close                */
+    H5FD__iouring_cmp,           /* cmp                  */
+    H5FD__iouring_query,         /* query                */
+    NULL,                        /* get_type_map         */
+    NULL,                        /* alloc                */
+    NULL,                        /* free                 */
+    H5FD__iouring_get_eoa,       /* get_eoa              */
+    H5FD__iouring_set_eoa,       /* set_eoa              */
+    H5FD__iouring_get_eof,       /* get_eof              */
+    H5FD__iouring_get_handle,    /* get_handle           */
+    H5FD__iouring_read,          /* read                 */
+    H5FD__iouring_write,         /* write                */
+    H5FD__iouring_read_vector,   /* read_vector          */
+    H5FD__iouring_write_vector,  /* write_vector         */
+    NULL,                        /* flush                */
+    H5FD__iouring_truncate,      /* truncate             */
+    H5FD__iouring_lock,          /* lock                 */
+    H5FD__iouring_unlock,        /* unlock               */
+    H5FD_FLMAP_DICHOTOMY         /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_iouring_t struct */
+H5FL_DEFINE_STATIC(H5FD_iouring_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    char * lock_env_var = NULL; /* Environment variable pointer */
+    herr_t ret_value    = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Check the use disabled file locks environment variable */
+    lock_env_var = HDgetenv("HDF5_USE_FILE_LOCKING");
+    if (lock_env_var && !HDstrcmp(lock_env_var, "BEST_EFFORT"))
+        ignore_disabled_file_locks_s = TRUE; /* Override: Ignore disabled locks */
+    else if (lock_env_var && (!HDstrcmp(lock_env_var, "TRUE") || !HDstrcmp(lock_env_var, "1")))
+        ignore_disabled_file_locks_s = FALSE; /* Override: Don't ignore disabled locks */
+    else
+        ignore_disabled_file_locks_s = FAIL; /* Environment variable not set, or not set correctly */
+
+    if (H5FD_iouring_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize io_uring VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_iouring_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if (H5I_VFL != H5I_get_type(H5FD_IOURING_g))
+        H5FD_IOURING_g = H5FD_register(&H5FD_iouring_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_IOURING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__iouring_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_term(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Reset VFL ID */
+    H5FD_IOURING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_iouring
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_IOURING driver defined in this source file.
+ *              QUEUE_DEPTH is the number of requests the driver keeps in
+ *              flight during vector I/O; zero selects the default.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth)
+{
+    H5P_genplist_t *    plist; /* Property list pointer */
+    H5FD_iouring_fapl_t fa;
+    herr_t              ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", fapl_id, queue_depth);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if (queue_depth > 4096)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "queue depth can't be larger than 4096")
+
+    HDmemset(&fa, 0, sizeof(H5FD_iouring_fapl_t));
+    fa.queue_depth = (queue_depth != 0) ? queue_depth : H5FD_IOURING_QUEUE_DEPTH_DEF;
+
+    ret_value = H5P_set_driver(plist, H5FD_IOURING, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_iouring
+ *
+ * Purpose:     Returns information about the io_uring file access
+ *              property list though the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth /*out*/)
+{
+    H5P_genplist_t *           plist; /* Property list pointer */
+    const H5FD_iouring_fapl_t *fa;
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, queue_depth);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_IOURING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if (queue_depth)
+        *queue_depth = fa->queue_depth;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_get(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    void *          ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__iouring_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_copy
+ *
+ * Purpose:     Copies the io_uring-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_copy(const void *_old_fa)
+{
+    const H5FD_iouring_fapl_t *old_fa    = (const H5FD_iouring_fapl_t *)_old_fa;
+    H5FD_iouring_fapl_t *      ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(old_fa);
+
+    if (NULL == (ret_value = (H5FD_iouring_fapl_t *)H5MM_malloc(sizeof(H5FD_iouring_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to allocate io_uring file access properties")
+    H5MM_memcpy(ret_value, old_fa, sizeof(H5FD_iouring_fapl_t));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_init
+ *
+ * Purpose:     Creates an io_uring instance with (at least) ENTRIES
+ *              submission queue entries and maps its rings.  If the
+ *              kernel doesn't support io_uring, or refuses to create a
+ *              ring, RING->fd is left at -1 and the driver does its I/O
+ *              synchronously.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_ring_init(H5FD_iouring_ring_t *ring, unsigned entries)
+{
+    struct io_uring_params params;              /* Ring parameters from the kernel */
+    unsigned char *        sq_ptr;              /* Base of the submission ring */
+    unsigned char *        cq_ptr;              /* Base of the completion ring */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(ring);
+    HDassert(entries > 0);
+
+    HDmemset(ring, 0, sizeof(H5FD_iouring_ring_t));
+    ring->sq_ring = MAP_FAILED;
+    ring->cq_ring = MAP_FAILED;
+    ring->sqes    = MAP_FAILED;
+
+    /* Create the ring, falling back to synchronous I/O if that isn't possible */
+    HDmemset(&params, 0, sizeof(params));
+    if ((ring->fd = (int)syscall(__NR_io_uring_setup, entries, &params)) < 0) {
+        ring->fd = -1;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    ring->entries = params.sq_entries;
+
+    /* Map the submission and completion rings (a single mapping, if the kernel allows it) */
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+        ring->sq_ring_size = ring->cq_ring_size = MAX(ring->sq_ring_size, ring->cq_ring_size);
+    if (MAP_FAILED == (ring->sq_ring = HDmmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                                               MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission ring")
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+        ring->cq_ring = ring->sq_ring;
+    else if (MAP_FAILED == (ring->cq_ring = HDmmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                                                    MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring completion ring")
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    if (MAP_FAILED == (ring->sqes = (struct io_uring_sqe *)HDmmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                                                                  MAP_SHARED | MAP_POPULATE, ring->fd,
+                                                                  IORING_OFF_SQES)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission queue entries")
+
+    /* Locate the ring fields */
+    sq_ptr         = (unsigned char *)ring->sq_ring;
+    cq_ptr         = (unsigned char *)ring->cq_ring;
+    ring->sq_tail  = (unsigned *)(void *)(sq_ptr + params.sq_off.tail);
+    ring->sq_mask  = (unsigned *)(void *)(sq_ptr + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)(void *)(sq_ptr + params.sq_off.array);
+    ring->cq_head  = (unsigned *)(void *)(cq_ptr + params.cq_off.head);
+    ring->cq_tail  = (unsigned *)(void *)(cq_ptr + params.cq_off.tail);
+    ring->cq_mask  = (unsigned *)(void *)(cq_ptr + params.cq_off.ring_mask);
+    ring->cqes     = (struct io_uring_cqe *)(void *)(cq_ptr + params.cq_off.cqes);
+
+    /* Allocate an I/O vector for each request */
+    if (NULL == (ring->iov = (struct iovec *)H5MM_malloc(ring->entries * sizeof(struct iovec))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vectors")
+
+done:
+    if (ret_value < 0)
+        H5FD__iouring_ring_term(ring);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_ring_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_term
+ *
+ * Purpose:     Unmaps the rings of an io_uring instance and closes it.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_ring_term(H5FD_iouring_ring_t *ring)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(ring);
+
+    if (ring->sqes != MAP_FAILED && HDmunmap(ring->sqes, ring->sqes_size) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap io_uring submission queue entries")
+    if (ring->cq_ring != MAP_FAILED && ring->cq_ring != ring->sq_ring &&
+        HDmunmap(ring->cq_ring, ring->cq_ring_size) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap io_uring completion ring")
+    if (ring->sq_ring != MAP_FAILED && HDmunmap(ring->sq_ring, ring->sq_ring_size) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap io_uring submission ring")
+    if (ring->fd >= 0 && HDclose(ring->fd) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "unable to close io_uring instance")
+    ring->iov = (struct iovec *)H5MM_xfree(ring->iov);
+
+    ring->fd      = -1;
+    ring->sq_ring = MAP_FAILED;
+    ring->cq_ring = MAP_FAILED;
+    ring->sqes    = MAP_FAILED;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_ring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_iouring_t *           file = NULL; /* io_uring VFD info        */
+    int                        fd   = -1;   /* File descriptor          */
+    int                        o_flags;     /* Flags for open() call    */
+    h5_stat_t                  sb;
+    H5P_genplist_t *           plist;            /* Property list pointer */
+    const H5FD_iouring_fapl_t *fa;               /* io_uring properties   */
+    H5FD_iouring_fapl_t        default_fa;       /* Default properties    */
+    H5FD_t *                   ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Get the driver specific information */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_VFL, H5E_BADTYPE, NULL, "not a file access property list")
+    if (NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist))) {
+        default_fa.queue_depth = H5FD_IOURING_QUEUE_DEPTH_DEF;
+        fa                     = &default_fa;
+    } /* end if */
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if (H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if (H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if (H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+
+    /* Open the file */
+    if ((fd = HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(
+            H5E_FILE, H5E_CANTOPENFILE, NULL,
+            "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x",
+            name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+
+    if (HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_iouring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->pos    = HADDR_UNDEF;
+    file->op     = OP_UNKNOWN;
+    file->device = sb.st_dev;
+    file->inode  = sb.st_ino;
+    H5MM_memcpy(&file->fa, fa, sizeof(H5FD_iouring_fapl_t));
+    file->ring.fd = -1;
+
+    /* Check the file locking flags in the fapl */
+    if (ignore_disabled_file_locks_s != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = ignore_disabled_file_locks_s;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property")
+    }
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Set up the submission and completion rings */
+    if (H5FD__iouring_ring_init(&file->ring, file->fa.queue_depth) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to set up io_uring instance")
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (NULL == ret_value) {
+        if (fd >= 0)
+            HDclose(fd);
+        if (file)
+            file = H5FL_FREE(H5FD_iouring_t, file);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_close
+ *
+ * Purpose:     Closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_close(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Release the rings */
+    if (H5FD__iouring_ring_term(&file->ring) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to release io_uring instance")
+
+    /* Close the underlying file */
+    if (HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_iouring_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_iouring_t *f1        = (const H5FD_iouring_t *)_f1;
+    const H5FD_iouring_t *f2        = (const H5FD_iouring_t *)_f2;
+    int                   ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1)
+    if (f1->device > f2->device)
+        HGOTO_DONE(1)
+#else  /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) < 0)
+        HGOTO_DONE(-1)
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) > 0)
+        HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1)
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
+        *flags |= H5FD_FEAT_DATA_SIEVE; /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE; /* get_handle callback returns a POSIX file descriptor */
+        *flags |=
+            H5FD_FEAT_SUPPORTS_SWMR_IO; /* VFD supports the single-writer/multiple-readers (SWMR) pattern   */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
+                                                       VFD      */
+        *flags |= H5FD_FEAT_CONCURRENT_READ;        /* Reads don't call back into the library */
+    }                                               /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__iouring_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the greater of
+ *              either the filesystem end-of-file or the HDF5 end-of-address
+ *              markers.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__iouring_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_handle
+ *
+ * Purpose:     Returns the file handle of io_uring file driver.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                   size_t size, void *buf /*out*/)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    HDoff_t         offset    = (HDoff_t)addr;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    /* Read data, being careful of interrupted system calls, partial results,
+     * and the end of the file.
+     */
+    while (size > 0) {
+        h5_posix_io_t     bytes_in   = 0;  /* # of bytes to read       */
+        h5_posix_io_ret_t bytes_read = -1; /* # of bytes actually read */
+
+        /* Trying to read more bytes than the return type can handle is
+         * undefined behavior in POSIX.
+         */
+        if (size > H5_POSIX_MAX_IO_BYTES)
+            bytes_in = H5_POSIX_MAX_IO_BYTES;
+        else
+            bytes_in = (h5_posix_io_t)size;
+
+        do {
+            bytes_read = HDpread(file->fd, buf, bytes_in, offset);
+            if (bytes_read > 0)
+                offset += bytes_read;
+        } while (-1 == bytes_read && EINTR == errno);
+
+        if (-1 == bytes_read) { /* error */
+            int    myerrno = errno;
+            time_t mytime  = HDtime(NULL);
+
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                        "file read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, "
+                        "error message = '%s', buf = %p, total read size = %llu, bytes this sub-read = %llu, "
+                        "offset = %llu",
+                        HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf,
+                        (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)offset);
+        } /* end if */
+
+        if (0 == bytes_read) {
+            /* end of file but not end of format address space */
+            HDmemset(buf, 0, size);
+            break;
+        } /* end if */
+
+        HDassert(bytes_read >= 0);
+        HDassert((size_t)bytes_read <= size);
+
+        size -= (size_t)bytes_read;
+        addr += (haddr_t)bytes_read;
+        buf = (char *)buf + bytes_read;
+    } /* end while */
+
+    /* Update current position */
+    file->pos = addr;
+    file->op  = OP_READ;
+
+done:
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                    size_t size, const void *buf)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    HDoff_t         offset    = (HDoff_t)addr;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                    (unsigned long long)addr, (unsigned long long)size)
+
+    /* Write the data, being careful of interrupted system calls and partial
+     * results
+     */
+    while (size > 0) {
+        h5_posix_io_t     bytes_in    = 0;  /* # of bytes to write  */
+        h5_posix_io_ret_t bytes_wrote = -1; /* # of bytes written   */
+
+        /* Trying to write more bytes than the return type can handle is
+         * undefined behavior in POSIX.
+         */
+        if (size > H5_POSIX_MAX_IO_BYTES)
+            bytes_in = H5_POSIX_MAX_IO_BYTES;
+        else
+            bytes_in = (h5_posix_io_t)size;
+
+        do {
+            bytes_wrote = HDpwrite(file->fd, buf, bytes_in, offset);
+            if (bytes_wrote > 0)
+                offset += bytes_wrote;
+        } while (-1 == bytes_wrote && EINTR == errno);
+
+        if (-1 == bytes_wrote) { /* error */
+            int    myerrno = errno;
+            time_t mytime  = HDtime(NULL);
+
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL,
+                        "file write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, "
+                        "error message = '%s', buf = %p, total write size = %llu, bytes this sub-write = "
+                        "%llu, offset = %llu",
+                        HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf,
+                        (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)offset);
+        } /* end if */
+
+        HDassert(bytes_wrote > 0);
+        HDassert((size_t)bytes_wrote <= size);
+
+        size -= (size_t)bytes_wrote;
+        addr += (haddr_t)bytes_wrote;
+        buf = (const char *)buf + bytes_wrote;
+    } /* end while */
+
+    /* Update current position and eof */
+    file->pos = addr;
+    file->op  = OP_WRITE;
+    if (file->pos > file->eof)
+        file->eof = file->pos;
+
+done:
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_io
+ *
+ * Purpose:     Reads or writes a vector of (address, size, buffer) entries
+ *              through the file's io_uring instance.  The entries are
+ *              queued in batches of up to the ring's size; each batch is
+ *              submitted with one system call and all of its requests are
+ *              reaped before the next batch is queued.
+ *
+ *              Requests that transfer fewer bytes than asked for (at the
+ *              end of the file, or after an interruption) are finished
+ *              with the synchronous read and write callbacks, which also
+ *              zero the part of a read past the end of the file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_ring_io(H5FD_iouring_t *file, hbool_t do_write, uint32_t count, H5FD_mem_t types[],
+                      haddr_t addrs[], size_t sizes[], void *bufs[])
+{
+    H5FD_iouring_ring_t *ring      = &file->ring; /* The file's rings */
+    uint32_t             u         = 0;           /* Local index variable */
+    herr_t               ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(ring->fd >= 0);
+
+    while (u < count) {
+        unsigned sq_tail   = *ring->sq_tail; /* Submission ring tail (only we write it) */
+        unsigned nqueued   = 0;              /* # of requests queued in this batch */
+        unsigned nsubmit   = 0;              /* # of requests submitted to the kernel */
+        unsigned nreaped   = 0;              /* # of requests completed */
+        int      io_errno  = 0;              /* errno of the first failed request */
+        uint32_t io_failed = 0;              /* index of the first failed request */
+
+        /* Queue the next batch of requests */
+        while (u < count && nqueued < ring->entries) {
+            struct io_uring_sqe *sqe;
+            unsigned             idx;
+
+            /* Check for overflow conditions */
+            if (!H5F_addr_defined(addrs[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu",
+                            (unsigned long long)addrs[u])
+            if (REGION_OVERFLOW(addrs[u], sizes[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                            (unsigned long long)addrs[u], (unsigned long long)sizes[u])
+
+            if (sizes[u] > 0) {
+                idx = (sq_tail + nqueued) & *ring->sq_mask;
+                sqe = &ring->sqes[idx];
+                HDmemset(sqe, 0, sizeof(*sqe));
+
+                ring->iov[nqueued].iov_base = bufs[u];
+                ring->iov[nqueued].iov_len  = MIN(sizes[u], H5FD_IOURING_MAX_IO_BYTES);
+
+                sqe->opcode        = (__u8)(do_write ? IORING_OP_WRITEV : IORING_OP_READV);
+                sqe->fd            = file->fd;
+                sqe->off           = (__u64)addrs[u];
+                sqe->addr          = (__u64)(uintptr_t)&ring->iov[nqueued];
+                sqe->len           = 1;
+                sqe->user_data     = (__u64)u;
+                ring->sq_array[idx] = idx;
+                nqueued++;
+            } /* end if */
+            u++;
+        } /* end while */
+
+        /* Publish the new tail to the kernel */
+        __atomic_store_n(ring->sq_tail, sq_tail + nqueued, __ATOMIC_RELEASE);
+
+        /* Submit the batch */
+        while (nsubmit < nqueued) {
+            int ret = (int)syscall(__NR_io_uring_enter, ring->fd, nqueued - nsubmit, 0, 0, NULL, 0);
+
+            if (ret < 0) {
+                if (EINTR == errno || EAGAIN == errno || EBUSY == errno)
+                    continue;
+                HSYS_GOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                                "unable to submit io_uring requests")
+            } /* end if */
+            nsubmit += (unsigned)ret;
+        } /* end while */
+
+        /* Wait for and reap the completions.  Every request is reaped, even
+         * after a failure, so the ring is left empty.
+         */
+        while (nreaped < nqueued) {
+            unsigned cq_head = *ring->cq_head;
+            unsigned cq_tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+
+            if (cq_head == cq_tail) {
+                if (syscall(__NR_io_uring_enter, ring->fd, 0, nqueued - nreaped, IORING_ENTER_GETEVENTS, NULL,
+                            0) < 0 &&
+                    EINTR != errno && EAGAIN != errno && EBUSY != errno)
+                    HSYS_GOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                                    "unable to wait for io_uring requests")
+                continue;
+            } /* end if */
+
+            while (cq_head != cq_tail) {
+                const struct io_uring_cqe *cqe = &ring->cqes[cq_head & *ring->cq_mask];
+                uint32_t                   v   = (uint32_t)cqe->user_data;
+
+                if (cqe->res < 0) {
+                    if (0 == io_errno) {
+                        io_errno  = -cqe->res;
+                        io_failed = v;
+                    } /* end if */
+                }     /* end if */
+                else {
+                    size_t done_size = (size_t)cqe->res;
+
+                    /* Finish a short transfer synchronously */
+                    if (done_size < sizes[v] && 0 == io_errno) {
+                        if (do_write) {
+                            if (H5FD__iouring_write((H5FD_t *)file, types[v], H5P_DEFAULT,
+                                                    addrs[v] + done_size, sizes[v] - done_size,
+                                                    (const unsigned char *)bufs[v] + done_size) < 0) {
+                                io_errno  = EIO;
+                                io_failed = v;
+                            } /* end if */
+                        }     /* end if */
+                        else if (H5FD__iouring_read((H5FD_t *)file, types[v], H5P_DEFAULT,
+                                                    addrs[v] + done_size, sizes[v] - done_size,
+                                                    (unsigned char *)bufs[v] + done_size) < 0) {
+                            io_errno  = EIO;
+                            io_failed = v;
+                        } /* end if */
+                    }     /* end if */
+
+                    if (do_write && H5F_addr_gt(addrs[v] + sizes[v], file->eof))
+                        file->eof = addrs[v] + sizes[v];
+                } /* end else */
+
+                cq_head++;
+                nreaped++;
+            } /* end while */
+
+            /* Release the completion entries to the kernel */
+            __atomic_store_n(ring->cq_head, cq_head, __ATOMIC_RELEASE);
+        } /* end while */
+
+        if (io_errno != 0)
+            HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                        "io_uring %s failed: filename = '%s', errno = %d, error message = '%s', addr = %llu, "
+                        "size = %llu",
+                        do_write ? "write" : "read", file->filename, io_errno, HDstrerror(io_errno),
+                        (unsigned long long)addrs[io_failed], (unsigned long long)sizes[io_failed])
+    } /* end while */
+
+done:
+    /* Reset last file I/O information */
+    file->pos = HADDR_UNDEF;
+    file->op  = OP_UNKNOWN;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_ring_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read_vector
+ *
+ * Purpose:     Reads a vector of (address, size, buffer) entries from FILE,
+ *              keeping up to the file's queue depth of them in flight.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                          size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    uint32_t        u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Use the ring, unless there's only one entry or no ring */
+    if (count > 1 && file->ring.fd >= 0) {
+        if (H5FD__iouring_ring_io(file, FALSE, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if (H5FD__iouring_read(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write_vector
+ *
+ * Purpose:     Writes a vector of (address, size, buffer) entries to FILE,
+ *              keeping up to the file's queue depth of them in flight.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                           size_t sizes[], const void *bufs[])
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    uint32_t        u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Use the ring, unless there's only one entry or no ring (the kernel
+     * doesn't modify the buffers of write requests)
+     */
+    if (count > 1 && file->ring.fd >= 0) {
+        H5_GCC_DIAG_OFF("cast-qual")
+        if (H5FD__iouring_ring_io(file, TRUE, count, types, addrs, sizes, (void **)bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed")
+        H5_GCC_DIAG_ON("cast-qual")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if (H5FD__iouring_write(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same (or larger)
+ *              than the end-of-address.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Extend the file to make sure it's large enough */
+    if (!H5F_addr_eq(file->eoa, file->eof)) {
+        if (-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    int             lock_flags;                     /* file locking flags       */
+    herr_t          ret_value = SUCCEED;            /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if (HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_unlock(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    herr_t          ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (HDflock(file->fd, LOCK_UN) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_unlock() */
+
+#endif /* H5_HAVE_IOURING */
@@ -69,6 +69,12 @@ typedef struct H5FD_mpio_t {
     haddr_t  local_eof; /* Local end-of-file address for each process   */
 } H5FD_mpio_t;
 
+/* Entry in a vector I/O request, used to place the entries in file address order */
+typedef struct H5FD_mpio_vec_ent_t {
+    haddr_t  addr; /* File address of the entry          */
+    uint32_t idx;  /* Index of the entry in the request  */
+} H5FD_mpio_vec_ent_t;
+
 /* Private Prototypes */
 
 /* Callbacks */
@@ -84,52 +90,65 @@ static herr_t   H5FD__mpio_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, h
                                 void *buf);
 static herr_t   H5FD__mpio_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
                                  const void *buf);
+static herr_t   H5FD__mpio_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                       haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t   H5FD__mpio_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                        haddr_t addrs[], size_t sizes[], const void *bufs[]);
 static herr_t   H5FD__mpio_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t   H5FD__mpio_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static int      H5FD__mpio_mpi_rank(const H5FD_t *_file);
 static int      H5FD__mpio_mpi_size(const H5FD_t *_file);
 static MPI_Comm H5FD__mpio_communicator(const H5FD_t *_file);
 
+/* Other functions */
+static int    H5FD__mpio_vec_ent_cmp(const void *_ent1, const void *_ent2);
+static herr_t H5FD__mpio_vector_build_types(uint32_t count, haddr_t addrs[], size_t sizes[],
+                                            const void *bufs[], H5FD_mpio_vec_ent_t **ents /*out*/,
+                                            MPI_Datatype *buf_type /*out*/, MPI_Datatype *file_type /*out*/,
+                                            hbool_t *built /*out*/);
+
 /* The MPIO file driver information */
 static const H5FD_class_mpi_t H5FD_mpio_g = {
     {
         /* Start of superclass information */
-        "mpio",                /*name			*/
-        HADDR_MAX,             /*maxaddr		*/
-        H5F_CLOSE_SEMI,        /*fc_degree		*/
-        H5FD__mpio_term,       /*terminate             */
-        NULL,                  /*sb_size		*/
-        NULL,                  /*sb_encode		*/
-        NULL,                  /*sb_decode		*/
-        0,                     /*fapl_size		*/
-        NULL,                  /*fapl_get		*/
-        NULL,                  /*fapl_copy		*/
-        NULL,                  /*fapl_free		*/
-        0,                     /*dxpl_size		*/
-        NULL,                  /*dxpl_copy		*/
-        NULL,                  /*dxpl_free		*/
-        H5FD__mpio_open,       /*open			*/
-        H5FD__mpio_close,      /*close			*/
-        NULL,                  /*cmp			*/
-        H5FD__mpio_query,      /*query			*/
-        NULL,                  /*get_type_map		*/
-        NULL,                  /*alloc			*/
-        NULL,                  /*free			*/
-        H5FD__mpio_get_eoa,    /*get_eoa		*/
-        H5FD__mpio_set_eoa,    /*set_eoa		*/
-        H5FD__mpio_get_eof,    /*get_eof		*/
-        H5FD__mpio_get_handle, /*get_handle            */
-        H5FD__mpio_read,       /*read			*/
-        H5FD__mpio_write,      /*write			*/
-        H5FD__mpio_flush,      /*flush			*/
-        H5FD__mpio_truncate,   /*truncate		*/
-        NULL,                  /*lock                  */
-        NULL,                  /*unlock                */
-        H5FD_FLMAP_DICHOTOMY   /*fl_map                */
-    },                         /* End of superclass information */
-    H5FD__mpio_mpi_rank,       /*get_rank              */
-    H5FD__mpio_mpi_size,       /*get_size              */
-    H5FD__mpio_communicator    /*get_comm              */
+        "mpio",                  /*name			*/
+        HADDR_MAX,               /*maxaddr		*/
+        H5F_CLOSE_SEMI,          /*fc_degree		*/
+        H5FD__mpio_term,         /*terminate             */
+        NULL,                    /*sb_size		*/
+        NULL,                    /*sb_encode		*/
+        NULL,                    /*sb_decode		*/
+        0,                       /*fapl_size		*/
+        NULL,                    /*fapl_get		*/
+        NULL,                    /*fapl_copy		*/
+        NULL,                    /*fapl_free		*/
+        0,                       /*dxpl_size		*/
+        NULL,                    /*dxpl_copy		*/
+        NULL,                    /*dxpl_free		*/
+        H5FD__mpio_open,         /*open			*/
+        H5FD__mpio_close,        /*close			*/
+        NULL,                    /*cmp			*/
+        H5FD__mpio_query,        /*query			*/
+        NULL,                    /*get_type_map		*/
+        NULL,                    /*alloc			*/
+        NULL,                    /*free			*/
+        H5FD__mpio_get_eoa,      /*get_eoa		*/
+        H5FD__mpio_set_eoa,      /*set_eoa		*/
+        H5FD__mpio_get_eof,      /*get_eof		*/
+        H5FD__mpio_get_handle,   /*get_handle            */
+        H5FD__mpio_read,         /*read			*/
+        H5FD__mpio_write,        /*write			*/
+        H5FD__mpio_read_vector,  /*read_vector           */
+        H5FD__mpio_write_vector, /*write_vector          */
+        H5FD__mpio_flush,        /*flush			*/
+        H5FD__mpio_truncate,     /*truncate		*/
+        NULL,                    /*lock                  */
+        NULL,                    /*unlock                */
+        H5FD_FLMAP_DICHOTOMY     /*fl_map                */
+    },                           /* End of superclass information */
+    H5FD__mpio_mpi_rank,         /*get_rank              */
+    H5FD__mpio_mpi_size,         /*get_size              */
+    H5FD__mpio_communicator      /*get_comm              */
 };
 
 #ifdef H5FDmpio_DEBUG
@@ -1518,6 +1537,478 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__mpio_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_vec_ent_cmp
+ *
+ * Purpose:     Callback for qsort() to sort vector I/O entries in
+ *              increasing file address order.
+ *
+ * Return:      -1, 0, 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__mpio_vec_ent_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5FD_mpio_vec_ent_t *ent1      = (const H5FD_mpio_vec_ent_t *)_ent1;
+    const H5FD_mpio_vec_ent_t *ent2      = (const H5FD_mpio_vec_ent_t *)_ent2;
+    int                        ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (H5F_addr_lt(ent1->addr, ent2->addr))
+        ret_value = -1;
+    else if (H5F_addr_gt(ent1->addr, ent2->addr))
+        ret_value = 1;
+    else
+        /* Keep the sort stable for entries at the same address */
+        ret_value = (ent1->idx > ent2->idx) - (ent1->idx < ent2->idx);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_vec_ent_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_vector_build_types
+ *
+ * Purpose:     Build the pair of MPI derived datatypes that describe a
+ *              vector I/O request: FILE_TYPE selects the file regions of
+ *              the entries (relative to file offset 0) and BUF_TYPE
+ *              selects their buffers (relative to MPI_BOTTOM).
+ *
+ *              MPI requires the displacements of a file view to be
+ *              monotonically nondecreasing and non-overlapping, so the
+ *              entries are placed in the types in increasing file
+ *              address order.  That order is returned in ENTS, which the
+ *              caller must free.
+ *
+ *              If the request can't be described by a single pair of
+ *              types (overlapping entries, or an entry or entry count too
+ *              large for an MPI count), *BUILT is set to FALSE and no
+ *              types are created.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_vector_build_types(uint32_t count, haddr_t addrs[], size_t sizes[], const void *bufs[],
+                              H5FD_mpio_vec_ent_t **ents /*out*/, MPI_Datatype *buf_type /*out*/,
+                              MPI_Datatype *file_type /*out*/, hbool_t *built /*out*/)
+{
+    H5FD_mpio_vec_ent_t *vec_ents    = NULL;    /* Entries in file address order */
+    int *                block_lens  = NULL;    /* Length of each entry */
+    MPI_Aint *           buf_displs  = NULL;    /* Memory displacement of each entry */
+    MPI_Aint *           file_displs = NULL;    /* File displacement of each entry */
+    hbool_t              sorted      = TRUE;    /* Whether the request is already in address order */
+    haddr_t              prev_end    = 0;       /* End of the previous entry in the file */
+    uint32_t             u;                     /* Local index variable */
+    int                  mpi_code;              /* MPI return code */
+    herr_t               ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(ents);
+    HDassert(buf_type);
+    HDassert(file_type);
+    HDassert(built);
+
+    *built = FALSE;
+
+    /* Check for a request too large for an MPI count */
+    if (count > (uint32_t)INT_MAX)
+        HGOTO_DONE(SUCCEED)
+
+    /* Allocate space for the entries and the type descriptions (always at least one entry) */
+    if (NULL ==
+        (vec_ents = (H5FD_mpio_vec_ent_t *)H5MM_malloc(MAX(count, 1) * sizeof(H5FD_mpio_vec_ent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate vector entries")
+    if (NULL == (block_lens = (int *)H5MM_malloc(MAX(count, 1) * sizeof(int))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate block lengths")
+    if (NULL == (buf_displs = (MPI_Aint *)H5MM_malloc(MAX(count, 1) * sizeof(MPI_Aint))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory displacements")
+    if (NULL == (file_displs = (MPI_Aint *)H5MM_malloc(MAX(count, 1) * sizeof(MPI_Aint))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate file displacements")
+
+    /* Put the entries in increasing file address order */
+    for (u = 0; u < count; u++) {
+        vec_ents[u].addr = addrs[u];
+        vec_ents[u].idx  = u;
+        if (u > 0 && H5F_addr_lt(addrs[u], addrs[u - 1]))
+            sorted = FALSE;
+    } /* end for */
+    if (!sorted)
+        HDqsort(vec_ents, (size_t)count, sizeof(H5FD_mpio_vec_ent_t), H5FD__mpio_vec_ent_cmp);
+
+    /* Describe each entry */
+    for (u = 0; u < count; u++) {
+        uint32_t   idx = vec_ents[u].idx;
+        MPI_Offset mpi_off;
+
+        /* Give up on entries that overlap or are too large for an MPI count */
+        if (sizes[idx] > (size_t)INT_MAX || (u > 0 && H5F_addr_lt(addrs[idx], prev_end)))
+            HGOTO_DONE(SUCCEED)
+
+        if (H5FD_mpi_haddr_to_MPIOff(addrs[idx], &mpi_off) < 0)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_BADRANGE, FAIL, "can't convert from haddr to MPI off")
+        file_displs[u] = (MPI_Aint)mpi_off;
+        if ((MPI_Offset)file_displs[u] != mpi_off)
+            HGOTO_DONE(SUCCEED)
+        block_lens[u] = (int)sizes[idx];
+        if (MPI_SUCCESS != (mpi_code = MPI_Get_address(bufs[idx], &buf_displs[u])))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Get_address failed", mpi_code)
+
+        prev_end = addrs[idx] + sizes[idx];
+    } /* end for */
+
+    /* Create the memory and file types */
+    if (MPI_SUCCESS !=
+        (mpi_code = MPI_Type_create_hindexed((int)count, block_lens, buf_displs, MPI_BYTE, buf_type)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_hindexed failed", mpi_code)
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_commit(buf_type))) {
+        MPI_Type_free(buf_type);
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+    } /* end if */
+    if (MPI_SUCCESS !=
+        (mpi_code = MPI_Type_create_hindexed((int)count, block_lens, file_displs, MPI_BYTE, file_type))) {
+        MPI_Type_free(buf_type);
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_hindexed failed", mpi_code)
+    } /* end if */
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_commit(file_type))) {
+        MPI_Type_free(buf_type);
+        MPI_Type_free(file_type);
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+    } /* end if */
+
+    /* Hand the entry order back to the caller */
+    *ents    = vec_ents;
+    vec_ents = NULL;
+    *built   = TRUE;
+
+done:
+    H5MM_xfree(vec_ents);
+    H5MM_xfree(block_lens);
+    H5MM_xfree(buf_displs);
+    H5MM_xfree(file_displs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_vector_build_types() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_read_vector
+ *
+ * Purpose:     Reads COUNT raw data blocks, described by the ADDRS, SIZES
+ *              and BUFS arrays, with a single MPI read.  The blocks are
+ *              described by a pair of derived datatypes, so MPI-IO can
+ *              aggregate them.  With collective transfers enabled the read
+ *              is collective, and all processes must make the call (COUNT
+ *              may be zero).
+ *
+ *              Blocks that lie beyond the end of the file are zero-filled.
+ *
+ * Return:      Success:    SUCCEED. Results are stored in the caller-
+ *                          supplied buffers.
+ *              Failure:    FAIL. Contents of the buffers are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                       size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_mpio_t *        file      = (H5FD_mpio_t *)_file;
+    H5FD_mpio_vec_ent_t *vec_ents  = NULL;              /* Entries in file address order */
+    MPI_Datatype         buf_type  = MPI_DATATYPE_NULL; /* MPI description of the buffers */
+    MPI_Datatype         file_type = MPI_DATATYPE_NULL; /* MPI description of the file regions */
+    MPI_Status           mpi_stat;                      /* Status from I/O operation */
+    H5FD_mpio_xfer_t     xfer_mode;                     /* I/O transfer mode */
+    hbool_t              collective = FALSE;            /* Whether to perform collective I/O */
+    hbool_t              built      = FALSE;            /* Whether the MPI types were built */
+    hbool_t              view_set   = FALSE;            /* Whether the file view was changed */
+#if MPI_VERSION >= 3
+    MPI_Count bytes_read = 0; /* Number of bytes read in */
+#else
+    int bytes_read = 0; /* Number of bytes read in */
+#endif
+    size_t   skip;                /* Bytes of the request satisfied by the read */
+    uint32_t u;                   /* Local index variable */
+    int      mpi_code;            /* MPI return code */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+#ifdef H5FDmpio_DEBUG
+    if (H5FD_mpio_Debug[(int)'t'])
+        HDfprintf(stdout, "%s: Entering, count = %u\n", FUNC, (unsigned)count);
+#endif
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_MPIO == file->pub.driver_id);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Portably initialize MPI status variable */
+    HDmemset(&mpi_stat, 0, sizeof(MPI_Status));
+
+    /* Get the transfer mode from the API context */
+    if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+    if (xfer_mode == H5FD_MPIO_COLLECTIVE) {
+        H5FD_mpio_collective_opt_t coll_opt_mode;
+
+        /* Get the collective_opt property to check whether the application wants to do IO individually. */
+        if (H5CX_get_mpio_coll_opt(&coll_opt_mode) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O collective_op property")
+        collective = (coll_opt_mode == H5FD_MPIO_COLLECTIVE_IO);
+    } /* end if */
+
+    /* Describe the request with MPI derived types */
+    H5_GCC_DIAG_OFF("cast-qual")
+    if (H5FD__mpio_vector_build_types(count, addrs, sizes, (const void **)bufs, &vec_ents, &buf_type,
+                                      &file_type, &built) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't build MPI datatypes for vector read")
+    H5_GCC_DIAG_ON("cast-qual")
+
+    /* Fall back to reading the entries independently if the request can't
+     * be described by a single pair of types.
+     */
+    if (!built) {
+        if (collective)
+            HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL,
+                        "can't perform collective read of overlapping or oversized vector entries")
+
+        for (u = 0; u < count; u++)
+            if (H5FD__mpio_read(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "file read failed")
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Set the file view to the regions being read */
+    if (MPI_SUCCESS != (mpi_code = MPI_File_set_view(file->f, (MPI_Offset)0, MPI_BYTE, file_type,
+                                                     H5FD_mpi_native_g, file->info)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_File_set_view failed", mpi_code)
+    view_set = TRUE;
+
+    /* Read the data */
+    if (collective) {
+#ifdef H5FDmpio_DEBUG
+        if (H5FD_mpio_Debug[(int)'r'])
+            HDfprintf(stdout, "%s: doing MPI collective IO\n", FUNC);
+#endif
+        if (MPI_SUCCESS !=
+            (mpi_code = MPI_File_read_at_all(file->f, (MPI_Offset)0, MPI_BOTTOM, 1, buf_type, &mpi_stat)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_File_read_at_all failed", mpi_code)
+    } /* end if */
+    else if (MPI_SUCCESS !=
+             (mpi_code = MPI_File_read_at(file->f, (MPI_Offset)0, MPI_BOTTOM, 1, buf_type, &mpi_stat)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_File_read_at failed", mpi_code)
+
+    /* Reset the file view */
+    view_set = FALSE;
+    if (MPI_SUCCESS != (mpi_code = MPI_File_set_view(file->f, (MPI_Offset)0, MPI_BYTE, MPI_BYTE,
+                                                     H5FD_mpi_native_g, file->info)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_File_set_view failed", mpi_code)
+
+    /* How many bytes were actually read? */
+#if MPI_VERSION >= 3
+    if (MPI_SUCCESS != (mpi_code = MPI_Get_elements_x(&mpi_stat, MPI_BYTE, &bytes_read)))
+#else
+    if (MPI_SUCCESS != (mpi_code = MPI_Get_elements(&mpi_stat, MPI_BYTE, &bytes_read)))
+#endif
+        HMPI_GOTO_ERROR(FAIL, "MPI_Get_elements failed", mpi_code)
+    if (bytes_read < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+    /* The buffers are filled in file address order; zero any part of the
+     * request that lies beyond the end of the physical MPI file.
+     */
+    skip = (size_t)bytes_read;
+    for (u = 0; u < count; u++) {
+        uint32_t idx = vec_ents[u].idx;
+
+        if (skip >= sizes[idx])
+            skip -= sizes[idx];
+        else {
+            HDmemset((unsigned char *)bufs[idx] + skip, 0, sizes[idx] - skip);
+            skip = 0;
+        } /* end else */
+    }     /* end for */
+
+done:
+    if (view_set)
+        MPI_File_set_view(file->f, (MPI_Offset)0, MPI_BYTE, MPI_BYTE, H5FD_mpi_native_g, file->info);
+    if (buf_type != MPI_DATATYPE_NULL)
+        MPI_Type_free(&buf_type);
+    if (file_type != MPI_DATATYPE_NULL)
+        MPI_Type_free(&file_type);
+    H5MM_xfree(vec_ents);
+
+#ifdef H5FDmpio_DEBUG
+    if (H5FD_mpio_Debug[(int)'t'])
+        HDfprintf(stdout, "%s: Leaving, proc %d: ret_value = %d\n", FUNC, file->mpi_rank, ret_value);
+#endif
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_write_vector
+ *
+ * Purpose:     Writes COUNT raw data blocks, described by the ADDRS, SIZES
+ *              and BUFS arrays, with a single MPI write.  The blocks are
+ *              described by a pair of derived datatypes, so MPI-IO can
+ *              aggregate them.  With collective transfers enabled the
+ *              write is collective, and all processes must make the call
+ *              (COUNT may be zero).
+ *
+ * Return:      Success:    SUCCEED. USE_EOF and USE_EOA are updated if
+ *                          necessary.
+ *              Failure:    FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                        size_t sizes[], const void *bufs[])
+{
+    H5FD_mpio_t *        file      = (H5FD_mpio_t *)_file;
+    H5FD_mpio_vec_ent_t *vec_ents  = NULL;              /* Entries in file address order */
+    MPI_Datatype         buf_type  = MPI_DATATYPE_NULL; /* MPI description of the buffers */
+    MPI_Datatype         file_type = MPI_DATATYPE_NULL; /* MPI description of the file regions */
+    MPI_Status           mpi_stat;                      /* Status from I/O operation */
+    H5FD_mpio_xfer_t     xfer_mode;                     /* I/O transfer mode */
+    hbool_t              collective = FALSE;            /* Whether to perform collective I/O */
+    hbool_t              built      = FALSE;            /* Whether the MPI types were built */
+    hbool_t              view_set   = FALSE;            /* Whether the file view was changed */
+#if MPI_VERSION >= 3
+    MPI_Count bytes_written = 0; /* Number of bytes written */
+#else
+    int bytes_written = 0; /* Number of bytes written */
+#endif
+    size_t   io_size = 0;         /* Number of bytes requested */
+    haddr_t  max_end = 0;         /* End of the last block written */
+    uint32_t u;                   /* Local index variable */
+    int      mpi_code;            /* MPI return code */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+#ifdef H5FDmpio_DEBUG
+    if (H5FD_mpio_Debug[(int)'t'])
+        HDfprintf(stdout, "%s: Entering, count = %u\n", FUNC, (unsigned)count);
+#endif
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_MPIO == file->pub.driver_id);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Portably initialize MPI status variable */
+    HDmemset(&mpi_stat, 0, sizeof(MPI_Status));
+
+    /* Verify that no data is written when between MPI_Barrier()s during file flush */
+    HDassert(!H5CX_get_mpi_file_flushing());
+
+    /* Get the transfer mode from the API context */
+    if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+    if (xfer_mode == H5FD_MPIO_COLLECTIVE) {
+        H5FD_mpio_collective_opt_t coll_opt_mode;
+
+        /* Get the collective_opt property to check whether the application wants to do IO individually. */
+        if (H5CX_get_mpio_coll_opt(&coll_opt_mode) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O collective_op property")
+        collective = (coll_opt_mode == H5FD_MPIO_COLLECTIVE_IO);
+    } /* end if */
+
+    /* Describe the request with MPI derived types */
+    if (H5FD__mpio_vector_build_types(count, addrs, sizes, bufs, &vec_ents, &buf_type, &file_type, &built) <
+        0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "can't build MPI datatypes for vector write")
+
+    /* Fall back to writing the entries independently if the request can't
+     * be described by a single pair of types.
+     */
+    if (!built) {
+        if (collective)
+            HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL,
+                        "can't perform collective write of overlapping or oversized vector entries")
+
+        for (u = 0; u < count; u++)
+            if (H5FD__mpio_write(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "file write failed")
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Set the file view to the regions being written */
+    if (MPI_SUCCESS != (mpi_code = MPI_File_set_view(file->f, (MPI_Offset)0, MPI_BYTE, file_type,
+                                                     H5FD_mpi_native_g, file->info)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_File_set_view failed", mpi_code)
+    view_set = TRUE;
+
+    /* Write the data */
+    if (collective) {
+#ifdef H5FDmpio_DEBUG
+        if (H5FD_mpio_Debug[(int)'w'])
+            HDfprintf(stdout, "%s: doing MPI collective IO\n", FUNC);
+#endif
+        if (MPI_SUCCESS !=
+            (mpi_code = MPI_File_write_at_all(file->f, (MPI_Offset)0, MPI_BOTTOM, 1, buf_type, &mpi_stat)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_File_write_at_all failed", mpi_code)
+    } /* end if */
+    else if (MPI_SUCCESS !=
+             (mpi_code = MPI_File_write_at(file->f, (MPI_Offset)0, MPI_BOTTOM, 1, buf_type, &mpi_stat)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_File_write_at failed", mpi_code)
+
+    /* Reset the file view */
+    view_set = FALSE;
+    if (MPI_SUCCESS != (mpi_code = MPI_File_set_view(file->f, (MPI_Offset)0, MPI_BYTE, MPI_BYTE,
+                                                     H5FD_mpi_native_g, file->info)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_File_set_view failed", mpi_code)
+
+    /* How many bytes were actually written? */
+#if MPI_VERSION >= 3
+    if (MPI_SUCCESS != (mpi_code = MPI_Get_elements_x(&mpi_stat, MPI_BYTE, &bytes_written)))
+#else
+    if (MPI_SUCCESS != (mpi_code = MPI_Get_elements(&mpi_stat, MPI_BYTE, &bytes_written)))
+#endif
+        HMPI_GOTO_ERROR(FAIL, "MPI_Get_elements failed", mpi_code)
+
+    /* Check for write failure */
+    for (u = 0; u < count; u++) {
+        io_size += sizes[u];
+        if (sizes[u] > 0 && H5F_addr_gt(addrs[u] + sizes[u], max_end))
+            max_end = addrs[u] + sizes[u];
+    } /* end for */
+    if (bytes_written < 0 || (size_t)bytes_written != io_size)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+    /* Keep the actual EOF undefined until it is reduced across processes,
+     * as in H5FD__mpio_write().
+     */
+    file->eof = HADDR_UNDEF;
+    if (max_end > file->local_eof)
+        file->local_eof = max_end;
+
+done:
+    if (view_set)
+        MPI_File_set_view(file->f, (MPI_Offset)0, MPI_BYTE, MPI_BYTE, H5FD_mpi_native_g, file->info);
+    if (buf_type != MPI_DATATYPE_NULL)
+        MPI_Type_free(&buf_type);
+    if (file_type != MPI_DATATYPE_NULL)
+        MPI_Type_free(&file_type);
+    H5MM_xfree(vec_ents);
+
+#ifdef H5FDmpio_DEBUG
+    if (H5FD_mpio_Debug[(int)'t'])
+        HDfprintf(stdout, "%s: Leaving, proc %d: ret_value = %d\n", FUNC, file->mpi_rank, ret_value);
+#endif
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_write_vector() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__mpio_flush
  *
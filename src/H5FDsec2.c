@@ -121,6 +121,16 @@ typedef struct H5FD_sec2_t {
 #define REGION_OVERFLOW(A, Z)                                                                                \
     (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
 
+#ifdef H5_HAVE_PREADWRITEV
+/* Maximum number of I/O vector entries passed to one preadv()/pwritev() call */
+#define H5FD_SEC2_MAX_IOV 1024
+
+/* Largest hole between two entries of a vector read that is read through
+ * (into a scratch buffer) instead of splitting the preadv() call.
+ */
+#define H5FD_SEC2_MAX_VECTOR_GAP 4096
+#endif /* H5_HAVE_PREADWRITEV */
+
 /* Prototypes */
 static herr_t  H5FD__sec2_term(void);
 static H5FD_t *H5FD__sec2_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
@@ -135,6 +145,14 @@ static herr_t  H5FD__sec2_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, ha
                                void *buf);
 static herr_t  H5FD__sec2_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
                                 const void *buf);
+#ifdef H5_HAVE_PREADWRITEV
+static herr_t H5FD__sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                     haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t H5FD__sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+                                      haddr_t addrs[], size_t sizes[], const void *bufs[]);
+static herr_t H5FD__sec2_preadv(H5FD_sec2_t *file, struct iovec *iov, size_t niov, haddr_t addr);
+static herr_t H5FD__sec2_pwritev(H5FD_sec2_t *file, struct iovec *iov, size_t niov, haddr_t addr);
+#endif /* H5_HAVE_PREADWRITEV */
 static herr_t  H5FD__sec2_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__sec2_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__sec2_unlock(H5FD_t *_file);
@@ -167,6 +185,13 @@ static const H5FD_class_t H5FD_sec2_g = {
     H5FD__sec2_get_handle, /* get_handle           */
     H5FD__sec2_read,       /* read                 */
     H5FD__sec2_write,      /* write                */
+#ifdef H5_HAVE_PREADWRITEV
+    H5FD__sec2_read_vector,  /* read_vector          */
+    H5FD__sec2_write_vector, /* write_vector         */
+#else
+    NULL,                  /* read_vector          */
+    NULL,                  /* write_vector         */
+#endif /* H5_HAVE_PREADWRITEV */
     NULL,                  /* flush                */
     H5FD__sec2_truncate,   /* truncate             */
     H5FD__sec2_lock,       /* lock                 */
@@ -565,6 +590,7 @@ H5FD__sec2_query(const H5FD_t *_file, unsigned long *flags /* out */)
             H5FD_FEAT_SUPPORTS_SWMR_IO; /* VFD supports the single-writer/multiple-readers (SWMR) pattern   */
         *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
                                                        VFD      */
+        *flags |= H5FD_FEAT_CONCURRENT_READ; /* Reads don't call back into the library */
 
         /* Check for flags that are set by h5repart */
         if (file && file->fam_to_single)
@@ -894,6 +920,342 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__sec2_write() */
 
+#ifdef H5_HAVE_PREADWRITEV
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_read_vector
+ *
+ * Purpose:     Reads a vector of (address, size, buffer) entries from FILE.
+ *
+ *              Runs of entries that are adjacent in the file, or that are
+ *              separated only by small holes, are gathered into a single
+ *              preadv() call.  The bytes in the holes are read into a
+ *              scratch buffer and discarded.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                       size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_sec2_t * file      = (H5FD_sec2_t *)_file;
+    struct iovec *iov       = NULL;                  /* I/O vector for preadv() */
+    size_t        max_iov;                           /* # of entries allocated in iov */
+    unsigned char gap_buf[H5FD_SEC2_MAX_VECTOR_GAP]; /* Scratch buffer for holes */
+    haddr_t       end       = HADDR_UNDEF;           /* End of the current run */
+    uint32_t      u         = 0;                     /* Local index variable */
+    herr_t        ret_value = SUCCEED;               /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Allocate the I/O vector (each entry may need a second slot for a hole) */
+    max_iov = MIN(2 * (size_t)count, H5FD_SEC2_MAX_IOV);
+    if (count > 0 && NULL == (iov = (struct iovec *)H5MM_malloc(max_iov * sizeof(struct iovec))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+
+    while (u < count) {
+        haddr_t  start = addrs[u]; /* Start of the current run */
+        uint32_t first = u;        /* First entry in the current run */
+        size_t   niov  = 0;        /* # of iov entries in the current run */
+
+        /* Check for overflow conditions */
+        if (!H5F_addr_defined(start))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)start)
+        if (REGION_OVERFLOW(start, sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)start)
+
+        /* Start a new run with this entry */
+        iov[niov].iov_base = bufs[u];
+        iov[niov].iov_len  = sizes[u];
+        niov++;
+        end = start + sizes[u];
+        u++;
+
+        /* Gather the following entries that begin at, or shortly after, the
+         * end of the current run
+         */
+        while (u < count && niov + 2 <= max_iov) {
+            if (!H5F_addr_defined(addrs[u]) || REGION_OVERFLOW(addrs[u], sizes[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu",
+                            (unsigned long long)addrs[u])
+            if (H5F_addr_lt(addrs[u], end) || (addrs[u] - end) > H5FD_SEC2_MAX_VECTOR_GAP)
+                break;
+            if (((addrs[u] + sizes[u]) - start) > H5_POSIX_MAX_IO_BYTES)
+                break;
+
+            /* Read through the hole, if there is one */
+            if (H5F_addr_gt(addrs[u], end)) {
+                iov[niov].iov_base = gap_buf;
+                iov[niov].iov_len  = (size_t)(addrs[u] - end);
+                niov++;
+            } /* end if */
+
+            iov[niov].iov_base = bufs[u];
+            iov[niov].iov_len  = sizes[u];
+            niov++;
+            end = addrs[u] + sizes[u];
+            u++;
+        } /* end while */
+
+        /* Issue the I/O for the run */
+        if (1 == niov) {
+            if (H5FD__sec2_read(_file, types[first], dxpl_id, start, sizes[first], bufs[first]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+        } /* end if */
+        else if (H5FD__sec2_preadv(file, iov, niov, start) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed")
+    } /* end while */
+
+    /* Update current position */
+    file->pos = end;
+    file->op  = OP_READ;
+
+done:
+    if (iov)
+        iov = (struct iovec *)H5MM_xfree(iov);
+
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_read_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_write_vector
+ *
+ * Purpose:     Writes a vector of (address, size, buffer) entries to FILE.
+ *
+ *              Runs of entries that are adjacent in the file are gathered
+ *              into a single pwritev() call.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                        size_t sizes[], const void *bufs[])
+{
+    H5FD_sec2_t * file      = (H5FD_sec2_t *)_file;
+    struct iovec *iov       = NULL;        /* I/O vector for pwritev() */
+    size_t        max_iov;                 /* # of entries allocated in iov */
+    haddr_t       end       = HADDR_UNDEF; /* End of the current run */
+    uint32_t      u         = 0;           /* Local index variable */
+    herr_t        ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Allocate the I/O vector */
+    max_iov = MIN((size_t)count, H5FD_SEC2_MAX_IOV);
+    if (count > 0 && NULL == (iov = (struct iovec *)H5MM_malloc(max_iov * sizeof(struct iovec))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O vector")
+
+    while (u < count) {
+        haddr_t  start = addrs[u]; /* Start of the current run */
+        uint32_t first = u;        /* First entry in the current run */
+        size_t   niov  = 0;        /* # of iov entries in the current run */
+
+        /* Check for overflow conditions */
+        if (!H5F_addr_defined(start))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)start)
+        if (REGION_OVERFLOW(start, sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                        (unsigned long long)start, (unsigned long long)sizes[u])
+
+        /* Start a new run with this entry (pwritev() doesn't modify the buffers) */
+        H5_GCC_DIAG_OFF("cast-qual")
+        iov[niov].iov_base = (void *)bufs[u];
+        H5_GCC_DIAG_ON("cast-qual")
+        iov[niov].iov_len = sizes[u];
+        niov++;
+        end = start + sizes[u];
+        u++;
+
+        /* Gather the following entries that begin exactly at the end of the run */
+        while (u < count && niov < max_iov && H5F_addr_eq(addrs[u], end)) {
+            if (REGION_OVERFLOW(addrs[u], sizes[u]))
+                HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                            (unsigned long long)addrs[u], (unsigned long long)sizes[u])
+            if (((addrs[u] + sizes[u]) - start) > H5_POSIX_MAX_IO_BYTES)
+                break;
+
+            H5_GCC_DIAG_OFF("cast-qual")
+            iov[niov].iov_base = (void *)bufs[u];
+            H5_GCC_DIAG_ON("cast-qual")
+            iov[niov].iov_len = sizes[u];
+            niov++;
+            end += sizes[u];
+            u++;
+        } /* end while */
+
+        /* Issue the I/O for the run */
+        if (1 == niov) {
+            if (H5FD__sec2_write(_file, types[first], dxpl_id, start, sizes[first], bufs[first]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        } /* end if */
+        else {
+            if (H5FD__sec2_pwritev(file, iov, niov, start) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed")
+            if (H5F_addr_gt(end, file->eof))
+                file->eof = end;
+        } /* end else */
+    } /* end while */
+
+    /* Update current position */
+    file->pos = end;
+    file->op  = OP_WRITE;
+
+done:
+    if (iov)
+        iov = (struct iovec *)H5MM_xfree(iov);
+
+    if (ret_value < 0) {
+        /* Reset last file I/O information */
+        file->pos = HADDR_UNDEF;
+        file->op  = OP_UNKNOWN;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_write_vector() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_preadv
+ *
+ * Purpose:     Reads the file bytes starting at ADDR into the NIOV buffers
+ *              described by IOV, being careful of interrupted system calls,
+ *              partial results, and the end of the file.  The IOV array is
+ *              modified.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_preadv(H5FD_sec2_t *file, struct iovec *iov, size_t niov, haddr_t addr)
+{
+    HDoff_t offset    = (HDoff_t)addr;
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    while (niov > 0) {
+        ssize_t bytes_read = -1; /* # of bytes actually read */
+
+        do {
+            bytes_read = HDpreadv(file->fd, iov, (int)niov, offset);
+        } while (-1 == bytes_read && EINTR == errno);
+
+        if (-1 == bytes_read) { /* error */
+            int    myerrno = errno;
+            time_t mytime  = HDtime(NULL);
+
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                        "file vector read failed: time = %s, filename = '%s', file descriptor = %d, "
+                        "errno = %d, error message = '%s', # of buffers = %llu, offset = %llu",
+                        HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno),
+                        (unsigned long long)niov, (unsigned long long)offset);
+        } /* end if */
+
+        if (0 == bytes_read) {
+            /* end of file but not end of format address space */
+            while (niov > 0) {
+                HDmemset(iov->iov_base, 0, iov->iov_len);
+                iov++;
+                niov--;
+            } /* end while */
+            break;
+        } /* end if */
+
+        offset += bytes_read;
+
+        /* Skip the buffers that were filled, and advance into a partially filled one */
+        while (niov > 0 && (size_t)bytes_read >= iov->iov_len) {
+            bytes_read -= (ssize_t)iov->iov_len;
+            iov++;
+            niov--;
+        } /* end while */
+        if (bytes_read > 0) {
+            iov->iov_base = (unsigned char *)iov->iov_base + bytes_read;
+            iov->iov_len -= (size_t)bytes_read;
+        } /* end if */
+    }     /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_preadv() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__sec2_pwritev
+ *
+ * Purpose:     Writes the NIOV buffers described by IOV to the file,
+ *              starting at ADDR, being careful of interrupted system calls
+ *              and partial results.  The IOV array is modified.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__sec2_pwritev(H5FD_sec2_t *file, struct iovec *iov, size_t niov, haddr_t addr)
+{
+    HDoff_t offset    = (HDoff_t)addr;
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Skip leading empty buffers */
+    while (niov > 0 && 0 == iov->iov_len) {
+        iov++;
+        niov--;
+    } /* end while */
+
+    while (niov > 0) {
+        ssize_t bytes_wrote = -1; /* # of bytes written */
+
+        do {
+            bytes_wrote = HDpwritev(file->fd, iov, (int)niov, offset);
+        } while (-1 == bytes_wrote && EINTR == errno);
+
+        if (bytes_wrote <= 0) { /* error */
+            int    myerrno = errno;
+            time_t mytime  = HDtime(NULL);
+
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL,
+                        "file vector write failed: time = %s, filename = '%s', file descriptor = %d, "
+                        "errno = %d, error message = '%s', # of buffers = %llu, offset = %llu",
+                        HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno),
+                        (unsigned long long)niov, (unsigned long long)offset);
+        } /* end if */
+
+        offset += bytes_wrote;
+
+        /* Skip the buffers that were written, and advance into a partially written one */
+        while (niov > 0 && (size_t)bytes_wrote >= iov->iov_len) {
+            bytes_wrote -= (ssize_t)iov->iov_len;
+            iov++;
+            niov--;
+        } /* end while */
+        if (bytes_wrote > 0) {
+            iov->iov_base = (unsigned char *)iov->iov_base + bytes_wrote;
+            iov->iov_len -= (size_t)bytes_wrote;
+        } /* end if */
+    }     /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__sec2_pwritev() */
+#endif /* H5_HAVE_PREADWRITEV */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__sec2_truncate
  *
@@ -102,8 +102,7 @@ H5FL_BLK_DEFINE_STATIC(meta_accum);
 herr_t
 H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t size, void *buf /*out*/)
 {
-    H5FD_t *file;                /* File driver pointer */
-    herr_t  ret_value = SUCCEED; /* Return value */
+    herr_t ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -111,9 +110,6 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
     HDassert(f_sh);
     HDassert(buf);
 
-    /* Translate to file driver I/O info object */
-    file = f_sh->lf;
-
     /* Check if this information is in the metadata accumulator */
     if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type != H5FD_MEM_DRAW) {
         H5F_meta_accum_t *accum; /* Alias for file's metadata accumulator */
@@ -168,7 +164,7 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
                         accum->dirty_off += amount_before;
 
                     /* Dispatch to driver */
-                    if (H5FD_read(file, map_type, addr, amount_before, accum->buf) < 0)
+                    if (H5F__fd_read(f_sh, map_type, addr, amount_before, accum->buf) < 0)
                         HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
                 } /* end if */
                 else
@@ -183,8 +179,8 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
                                       hsize_t);
 
                     /* Dispatch to driver */
-                    if (H5FD_read(file, map_type, (accum->loc + accum->size), amount_after,
-                                  (accum->buf + accum->size + amount_before)) < 0)
+                    if (H5F__fd_read(f_sh, map_type, (accum->loc + accum->size), amount_after,
+                                     (accum->buf + accum->size + amount_before)) < 0)
                         HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
                 } /* end if */
 
@@ -198,13 +194,13 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
             /* Current read doesn't overlap with metadata accumulator, read it from file */
             else {
                 /* Dispatch to driver */
-                if (H5FD_read(file, map_type, addr, size, buf) < 0)
+                if (H5F__fd_read(f_sh, map_type, addr, size, buf) < 0)
                     HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
             } /* end else */
         }     /* end if */
         else {
             /* Read the data */
-            if (H5FD_read(file, map_type, addr, size, buf) < 0)
+            if (H5F__fd_read(f_sh, map_type, addr, size, buf) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
 
             /* Check for overlap w/dirty accumulator */
@@ -248,7 +244,7 @@ H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t si
     }         /* end if */
     else {
         /* Read the data */
-        if (H5FD_read(file, map_type, addr, size, buf) < 0)
+        if (H5F__fd_read(f_sh, map_type, addr, size, buf) < 0)
             HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
     } /* end else */
 
@@ -269,14 +265,14 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5F__accum_adjust(H5F_meta_accum_t *accum, H5FD_t *file, H5F_accum_adjust_t adjust, size_t size)
+H5F__accum_adjust(H5F_meta_accum_t *accum, H5F_shared_t *f_sh, H5F_accum_adjust_t adjust, size_t size)
 {
     herr_t ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
     HDassert(accum);
-    HDassert(file);
+    HDassert(f_sh);
     HDassert(H5F_ACCUM_APPEND == adjust || H5F_ACCUM_PREPEND == adjust);
     HDassert(size > 0);
     HDassert(size <= H5F_ACCUM_MAX_SIZE);
@@ -336,8 +332,8 @@ H5F__accum_adjust(H5F_meta_accum_t *accum, H5FD_t *file, H5F_accum_adjust_t adju
                     if ((accum->size - shrink_size) < (accum->dirty_off + accum->dirty_len)) {
                         /* Write out the dirty region from the metadata accumulator, with dispatch to driver
                          */
-                        if (H5FD_write(file, H5FD_MEM_DEFAULT, (accum->loc + accum->dirty_off),
-                                       accum->dirty_len, (accum->buf + accum->dirty_off)) < 0)
+                        if (H5F__fd_write(f_sh, H5FD_MEM_DEFAULT, (accum->loc + accum->dirty_off),
+                                          accum->dirty_len, (accum->buf + accum->dirty_off)) < 0)
                             HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "file write failed")
 
                         /* Reset accumulator dirty flag */
@@ -349,8 +345,8 @@ H5F__accum_adjust(H5F_meta_accum_t *accum, H5FD_t *file, H5F_accum_adjust_t adju
                     if (shrink_size > accum->dirty_off) {
                         /* Write out the dirty region from the metadata accumulator, with dispatch to driver
                          */
-                        if (H5FD_write(file, H5FD_MEM_DEFAULT, (accum->loc + accum->dirty_off),
-                                       accum->dirty_len, (accum->buf + accum->dirty_off)) < 0)
+                        if (H5F__fd_write(f_sh, H5FD_MEM_DEFAULT, (accum->loc + accum->dirty_off),
+                                          accum->dirty_len, (accum->buf + accum->dirty_off)) < 0)
                             HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "file write failed")
 
                         /* Reset accumulator dirty flag */
@@ -412,8 +408,7 @@ done:
 herr_t
 H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t size, const void *buf)
 {
-    H5FD_t *file;                /* File driver pointer */
-    herr_t  ret_value = SUCCEED; /* Return value */
+    herr_t ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
@@ -422,9 +417,6 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
     HDassert(H5F_SHARED_INTENT(f_sh) & H5F_ACC_RDWR);
     HDassert(buf);
 
-    /* Translate to file driver pointer */
-    file = f_sh->lf;
-
     /* Check for accumulating metadata */
     if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type != H5FD_MEM_DRAW) {
         H5F_meta_accum_t *accum; /* Alias for file's metadata accumulator */
@@ -441,7 +433,7 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                 /* Check if the new metadata adjoins the beginning of the current accumulator */
                 if ((addr + size) == accum->loc) {
                     /* Check if we need to adjust accumulator size */
-                    if (H5F__accum_adjust(accum, file, H5F_ACCUM_PREPEND, size) < 0)
+                    if (H5F__accum_adjust(accum, f_sh, H5F_ACCUM_PREPEND, size) < 0)
                         HGOTO_ERROR(H5E_IO, H5E_CANTRESIZE, FAIL, "can't adjust metadata accumulator")
 
                     /* Move the existing metadata to the proper location */
@@ -466,7 +458,7 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                 /* Check if the new metadata adjoins the end of the current accumulator */
                 else if (addr == (accum->loc + accum->size)) {
                     /* Check if we need to adjust accumulator size */
-                    if (H5F__accum_adjust(accum, file, H5F_ACCUM_APPEND, size) < 0)
+                    if (H5F__accum_adjust(accum, f_sh, H5F_ACCUM_APPEND, size) < 0)
                         HGOTO_ERROR(H5E_IO, H5E_CANTRESIZE, FAIL, "can't adjust metadata accumulator")
 
                     /* Copy the new metadata to the end */
@@ -527,7 +519,7 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                         H5_CHECKED_ASSIGN(add_size, size_t, (accum->loc - addr), hsize_t);
 
                         /* Check if we need to adjust accumulator size */
-                        if (H5F__accum_adjust(accum, file, H5F_ACCUM_PREPEND, add_size) < 0)
+                        if (H5F__accum_adjust(accum, f_sh, H5F_ACCUM_PREPEND, add_size) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_CANTRESIZE, FAIL, "can't adjust metadata accumulator")
 
                         /* Calculate the proper offset of the existing metadata */
@@ -569,7 +561,7 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                                           hsize_t);
 
                         /* Check if we need to adjust accumulator size */
-                        if (H5F__accum_adjust(accum, file, H5F_ACCUM_APPEND, add_size) < 0)
+                        if (H5F__accum_adjust(accum, f_sh, H5F_ACCUM_APPEND, add_size) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_CANTRESIZE, FAIL, "can't adjust metadata accumulator")
 
                         /* Compute offset of dirty region (after adjusting accumulator) */
@@ -637,8 +629,8 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                 else {
                     /* Write out the existing metadata accumulator, with dispatch to driver */
                     if (accum->dirty) {
-                        if (H5FD_write(file, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off,
-                                       accum->dirty_len, accum->buf + accum->dirty_off) < 0)
+                        if (H5F__fd_write(f_sh, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off,
+                                          accum->dirty_len, accum->buf + accum->dirty_off) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
 
                         /* Reset accumulator dirty flag */
@@ -738,7 +730,7 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
                     HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't reset accumulator")
 
             /* Write the data */
-            if (H5FD_write(file, map_type, addr, size, buf) < 0)
+            if (H5F__fd_write(f_sh, map_type, addr, size, buf) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
 
             /* Check for overlap w/accumulator */
@@ -827,7 +819,7 @@ H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t map_type, haddr_t addr, size_t s
     }             /* end if */
     else {
         /* Write the data */
-        if (H5FD_write(file, map_type, addr, size, buf) < 0)
+        if (H5F__fd_write(f_sh, map_type, addr, size, buf) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
     } /* end else */
 
@@ -852,7 +844,6 @@ herr_t
 H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr, hsize_t size)
 {
     H5F_meta_accum_t *accum;               /* Alias for file's metadata accumulator */
-    H5FD_t *          file;                /* File driver pointer */
     herr_t            ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -863,9 +854,6 @@ H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr
     /* Set up alias for file's metadata accumulator info */
     accum = &f_sh->accum;
 
-    /* Translate to file driver pointer */
-    file = f_sh->lf;
-
     /* Adjust the metadata accumulator to remove the freed block, if it overlaps */
     if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) &&
         H5F_addr_overlap(addr, size, accum->loc, accum->size)) {
@@ -938,8 +926,8 @@ H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr
                     /* Check if block to free is entirely before dirty region */
                     if (H5F_addr_le(tail_addr, dirty_start)) {
                         /* Write out the entire dirty region of the accumulator */
-                        if (H5FD_write(file, H5FD_MEM_DEFAULT, dirty_start, accum->dirty_len,
-                                       accum->buf + accum->dirty_off) < 0)
+                        if (H5F__fd_write(f_sh, H5FD_MEM_DEFAULT, dirty_start, accum->dirty_len,
+                                          accum->buf + accum->dirty_off) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
                     } /* end if */
                     /* Block to free overlaps with some/all of dirty region */
@@ -954,8 +942,8 @@ H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr
                         HDassert(write_size > 0);
 
                         /* Write out the unfreed dirty region of the accumulator */
-                        if (H5FD_write(file, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size,
-                                       accum->buf + accum->dirty_off + dirty_delta) < 0)
+                        if (H5F__fd_write(f_sh, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size,
+                                          accum->buf + accum->dirty_off + dirty_delta) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
                     } /* end if */
 
@@ -975,8 +963,8 @@ H5F__accum_free(H5F_shared_t *f_sh, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr
                         HDassert(write_size > 0);
 
                         /* Write out the unfreed end of the dirty region of the accumulator */
-                        if (H5FD_write(file, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size,
-                                       accum->buf + accum->dirty_off + dirty_delta) < 0)
+                        if (H5F__fd_write(f_sh, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size,
+                                          accum->buf + accum->dirty_off + dirty_delta) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
                     } /* end if */
 
@@ -1026,14 +1014,9 @@ H5F__accum_flush(H5F_shared_t *f_sh)
 
     /* Check if we need to flush out the metadata accumulator */
     if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && f_sh->accum.dirty) {
-        H5FD_t *file; /* File driver pointer */
-
-        /* Translate to file driver pointer */
-        file = f_sh->lf;
-
         /* Flush the metadata contents */
-        if (H5FD_write(file, H5FD_MEM_DEFAULT, f_sh->accum.loc + f_sh->accum.dirty_off, f_sh->accum.dirty_len,
-                       f_sh->accum.buf + f_sh->accum.dirty_off) < 0)
+        if (H5F__fd_write(f_sh, H5FD_MEM_DEFAULT, f_sh->accum.loc + f_sh->accum.dirty_off,
+                          f_sh->accum.dirty_len, f_sh->accum.buf + f_sh->accum.dirty_off) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
 
         /* Reset the dirty flag */
@@ -1087,3 +1070,29 @@ H5F__accum_reset(H5F_shared_t *f_sh, hbool_t flush)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F__accum_reset() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_overlaps
+ *
+ * Purpose:	Check if a region of the file overlaps the information held
+ *              in the metadata accumulator.  I/O that bypasses the
+ *              accumulator must not touch such a region.
+ *
+ * Return:	TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F__accum_overlaps(const H5F_shared_t *f_sh, haddr_t addr, size_t size)
+{
+    hbool_t ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(f_sh);
+
+    if ((f_sh->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && f_sh->accum.size > 0)
+        ret_value = H5F_addr_overlap(addr, size, f_sh->accum.loc, f_sh->accum.size);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_overlaps() */
@@ -387,6 +387,11 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set data cache byte size")
     if (H5P_set(new_plist, H5F_ACS_PREEMPT_READ_CHUNKS_NAME, &(f->shared->rdcc_w0)) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set preempt read chunks")
+    if (H5P_set(new_plist, H5F_ACS_CHUNK_IDX_CACHE_NENTS_NAME, &(f->shared->chunk_idx_cache_nents)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set chunk index cache size")
+    if (H5P_set(new_plist, H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_NAME, &(f->shared->shared_chunk_cache_nbytes)) <
+        0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set shared chunk cache size")
     if (H5P_set(new_plist, H5F_ACS_ALIGN_THRHD_NAME, &(f->shared->threshold)) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set alignment threshold")
     if (H5P_set(new_plist, H5F_ACS_ALIGN_NAME, &(f->shared->alignment)) < 0)
@@ -1129,6 +1134,9 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
         f->shared->sohm_vers = HDF5_SHAREDHEADER_VERSION;
         f->shared->accum.loc = HADDR_UNDEF;
         f->shared->lf        = lf;
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_init(&f->shared->io_lock);
+#endif /* H5_HAVE_THREADSAFE */
 
         /* Initialization for handling file space */
         for (u = 0; u < NELMTS(f->shared->fs_addr); u++) {
@@ -1191,6 +1199,11 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get data cache byte size")
         if (H5P_get(plist, H5F_ACS_PREEMPT_READ_CHUNKS_NAME, &(f->shared->rdcc_w0)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get preempt read chunk")
+        if (H5P_get(plist, H5F_ACS_CHUNK_IDX_CACHE_NENTS_NAME, &(f->shared->chunk_idx_cache_nents)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get chunk index cache size")
+        if (H5P_get(plist, H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_NAME, &(f->shared->shared_chunk_cache_nbytes)) <
+            0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get shared chunk cache size")
         if (H5P_get(plist, H5F_ACS_ALIGN_THRHD_NAME, &(f->shared->threshold)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get alignment threshold")
         if (H5P_get(plist, H5F_ACS_ALIGN_NAME, &(f->shared->alignment)) < 0)
@@ -1348,6 +1361,9 @@ done:
                 if (H5I_dec_ref(f->shared->fcpl_id) < 0)
                     HDONE_ERROR(H5E_FILE, H5E_CANTDEC, NULL, "can't close property list")
 
+#ifdef H5_HAVE_THREADSAFE
+            H5TS_mutex_destroy(&f->shared->io_lock);
+#endif /* H5_HAVE_THREADSAFE */
             f->shared = H5FL_FREE(H5F_shared_t, f->shared);
         }
 
@@ -1488,7 +1504,7 @@ H5F__dest(H5F_t *f, hbool_t flush)
                         HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "can't release file space")
 
                     /* Truncate the file to the current allocated size */
-                    if (H5FD_truncate(f->shared->lf, TRUE) < 0)
+                    if (H5F__fd_truncate(f->shared, TRUE) < 0)
                         /* Push error, but keep going*/
                         HDONE_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "low level truncate failed")
 
@@ -1566,6 +1582,18 @@ H5F__dest(H5F_t *f, hbool_t flush)
         if (H5G_node_close(f) < 0)
             /* Push error, but keep going*/
             HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+        if (f->shared->chunk_idx_cache) {
+            if (H5D_chunk_idx_cache_dest(f->shared->chunk_idx_cache) < 0)
+                /* Push error, but keep going*/
+                HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+            f->shared->chunk_idx_cache = NULL;
+        } /* end if */
+        if (f->shared->shared_chunk_cache) {
+            if (H5D_shared_chunk_cache_dest(f->shared->shared_chunk_cache) < 0)
+                /* Push error, but keep going*/
+                HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+            f->shared->shared_chunk_cache = NULL;
+        } /* end if */
 
         /* Destroy file creation properties */
         if (H5I_GENPROP_LST != H5I_get_type(f->shared->fcpl_id))
@@ -1604,6 +1632,9 @@ H5F__dest(H5F_t *f, hbool_t flush)
                 f->shared->retries[actype] = (uint32_t *)H5MM_xfree(f->shared->retries[actype]);
 
         /* Destroy shared file struct */
+#ifdef H5_HAVE_THREADSAFE
+        H5TS_mutex_destroy(&f->shared->io_lock);
+#endif /* H5_HAVE_THREADSAFE */
         f->shared = (H5F_shared_t *)H5FL_FREE(H5F_shared_t, f->shared);
     }
     else if (f->shared->nrefs > 0) {
@@ -2207,7 +2238,7 @@ H5F__flush_phase2(H5F_t *f, hbool_t closing)
 #endif /* H5_HAVE_PARALLEL */
 
     /* Truncate the file to the current allocated size */
-    if (H5FD_truncate(f->shared->lf, closing) < 0)
+    if (H5F__fd_truncate(f->shared, closing) < 0)
         /* Push error, but keep going*/
         HDONE_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "low level truncate failed")
 
@@ -2923,6 +2954,52 @@ H5F_set_grp_btree_shared(H5F_t *f, H5UC_t *rc)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5F_set_grp_btree_shared() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F_set_chunk_idx_cache
+ *
+ * Purpose:     Set the file's chunk index cache.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_set_chunk_idx_cache(H5F_t *f, struct H5D_chunk_idx_cache_t *cache)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+
+    f->shared->chunk_idx_cache = cache;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5F_set_chunk_idx_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_set_shared_chunk_cache
+ *
+ * Purpose:     Set the raw data chunk cache shared by the file's datasets.
+ *
+ * Return:      SUCCEED/FAIL
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_set_shared_chunk_cache(H5F_t *f, struct H5D_shared_chunk_cache_t *cache)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+
+    f->shared->shared_chunk_cache = cache;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5F_set_shared_chunk_cache() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5F_set_sohm_addr
  *
@@ -3162,7 +3239,7 @@ H5F__get_file_image(H5F_t *file, void *buf_ptr, size_t buf_len)
 
         /* read in the file image */
         /* (Note compensation for base address addition in internal routine) */
-        if (H5FD_read(fd_ptr, H5FD_MEM_DEFAULT, 0, space_needed, buf_ptr) < 0)
+        if (H5F__fd_read(file->shared, H5FD_MEM_DEFAULT, 0, space_needed, buf_ptr) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_READERROR, (-1), "file image read request failed")
 
         /* Offset to "status_flags" in the superblock */
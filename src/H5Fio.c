@@ -54,6 +54,11 @@
 /* Local Prototypes */
 /********************/
 
+static hbool_t H5F__vector_io_bypass_ok(const H5F_shared_t *f_sh, uint32_t count, const H5FD_mem_t types[],
+                                        const haddr_t addrs[], const size_t sizes[]);
+static herr_t  H5F__fd_read_unlocked(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[],
+                                     haddr_t addrs[], size_t sizes[], void *bufs[]);
+
 /*********************/
 /* Package Variables */
 /*********************/
@@ -66,6 +71,137 @@
 /* Local Variables */
 /*******************/
 
+/*-------------------------------------------------------------------------
+ * Function:	H5F__fd_read
+ *
+ * Purpose:	Reads a block from the file driver, holding the file's I/O
+ *              lock.  All reads through the file driver for the H5F
+ *              layer go through this routine or H5F__fd_read_unlocked().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__fd_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *buf /*out*/)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(f_sh);
+
+    H5F_SHARED_IO_LOCK(f_sh)
+    if (H5FD_read(f_sh->lf, type, addr, size, buf) < 0)
+        HDONE_ERROR(H5E_IO, H5E_READERROR, FAIL, "file driver read failed")
+    H5F_SHARED_IO_UNLOCK(f_sh)
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__fd_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__fd_write
+ *
+ * Purpose:	Writes a block through the file driver, holding the file's
+ *              I/O lock.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__fd_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(f_sh);
+
+    H5F_SHARED_IO_LOCK(f_sh)
+    if (H5FD_write(f_sh->lf, type, addr, size, buf) < 0)
+        HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file driver write failed")
+    H5F_SHARED_IO_UNLOCK(f_sh)
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__fd_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__fd_truncate
+ *
+ * Purpose:	Truncates the file to its allocated size, holding the
+ *              file's I/O lock.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F__fd_truncate(H5F_shared_t *f_sh, hbool_t closing)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(f_sh);
+
+    H5F_SHARED_IO_LOCK(f_sh)
+    if (H5FD_truncate(f_sh->lf, closing) < 0)
+        HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file driver truncate failed")
+    H5F_SHARED_IO_UNLOCK(f_sh)
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__fd_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__fd_read_unlocked
+ *
+ * Purpose:	Reads COUNT blocks of raw data from the file driver into
+ *              the caller's buffers, letting other threads into the
+ *              library while the driver is busy.
+ *
+ *              The API lock is only released when the file driver
+ *              advertises H5FD_FEAT_CONCURRENT_READ (its read callbacks
+ *              don't call back into the library) and this thread holds
+ *              the lock exactly once (i.e. it isn't inside a callback
+ *              from the library).  The file's I/O lock is held across
+ *              the driver call either way, so I/O on the same file stays
+ *              serialized; the buffers must not be shared with any other
+ *              part of the library.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__fd_read_unlocked(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                      size_t sizes[], void *bufs[] /*out*/)
+{
+    hbool_t yielded   = FALSE;   /* Whether the API lock was released */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(f_sh);
+
+    H5F_SHARED_IO_LOCK(f_sh)
+    if (f_sh->feature_flags & H5FD_FEAT_CONCURRENT_READ)
+        H5_API_YIELD(yielded)
+
+    if (1 == count) {
+        if (H5FD_read(f_sh->lf, types[0], addrs[0], sizes[0], bufs[0]) < 0)
+            HDONE_ERROR(H5E_IO, H5E_READERROR, FAIL, "file driver read failed")
+    } /* end if */
+    else if (H5FD_read_vector(f_sh->lf, count, types, addrs, sizes, bufs) < 0)
+        HDONE_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read through file driver failed")
+
+    /* Drop the file's I/O lock before waiting for the API lock */
+    H5F_SHARED_IO_UNLOCK(f_sh)
+    H5_API_RESUME(yielded)
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__fd_read_unlocked() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5F_shared_block_read
  *
@@ -238,6 +374,251 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_write() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5F__vector_io_bypass_ok
+ *
+ * Purpose:	Check if a vector of raw data I/O requests can be passed
+ *              directly to the file driver.  Vector I/O bypasses the page
+ *              buffer and the metadata accumulator, so it is only allowed
+ *              when neither of them could hold any of the data.
+ *
+ * Return:	TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5F__vector_io_bypass_ok(const H5F_shared_t *f_sh, uint32_t count, const H5FD_mem_t types[],
+                         const haddr_t addrs[], const size_t sizes[])
+{
+    haddr_t  lo = HADDR_MAX, hi = 0; /* Range of file addresses covered */
+    uint32_t u;                      /* Local index variable */
+    hbool_t  ret_value = TRUE;       /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Page buffering caches raw data as well as metadata */
+    if (f_sh->page_buf)
+        HGOTO_DONE(FALSE)
+
+    for (u = 0; u < count; u++) {
+        /* Global heap data is mapped to raw data by the block I/O routines */
+        if (types[u] != H5FD_MEM_DRAW)
+            HGOTO_DONE(FALSE)
+
+        lo = MIN(lo, addrs[u]);
+        hi = MAX(hi, addrs[u] + sizes[u]);
+    } /* end for */
+
+    if (count > 0 && H5F__accum_overlaps(f_sh, lo, (size_t)(hi - lo)))
+        ret_value = FALSE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__vector_io_bypass_ok() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_vector_read
+ *
+ * Purpose:	Reads COUNT blocks of raw data from a file into the buffers
+ *              in BUFS.  The addresses are relative to the base address
+ *              for the file.  The whole vector is handed to the file
+ *              driver at once when possible, otherwise each block is read
+ *              with H5F_shared_block_read().
+ *
+ *              Other threads may enter the library while the file driver
+ *              reads the vector, so the buffers must be owned by the
+ *              caller (see H5F__fd_read_unlocked()).
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_vector_read(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                       size_t sizes[], void *bufs[] /*out*/)
+{
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Check for attempting I/O on 'temporary' file address */
+    for (u = 0; u < count; u++) {
+        HDassert(H5F_addr_defined(addrs[u]));
+        if (H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+    } /* end for */
+
+    if (H5F__vector_io_bypass_ok(f_sh, count, types, addrs, sizes)) {
+        /* Pass the whole vector down to the file driver layer */
+        if (H5F__fd_read_unlocked(f_sh, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read through file driver failed")
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if (H5F_shared_block_read(f_sh, types[u], addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "block read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_vector_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_raw_read
+ *
+ * Purpose:	Reads a block of raw data from a file into a buffer owned
+ *              by the caller.  Unlike H5F_shared_block_read(), other
+ *              threads may enter the library while the file driver
+ *              performs the read, when the block doesn't need to pass
+ *              through the page buffer or the metadata accumulator.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_raw_read(H5F_shared_t *f_sh, haddr_t addr, size_t size, void *buf /*out*/)
+{
+    H5FD_mem_t type      = H5FD_MEM_DRAW; /* Type of the data */
+    herr_t     ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(buf);
+    HDassert(H5F_addr_defined(addr));
+
+    /* Check for attempting I/O on 'temporary' file address */
+    if (H5F_addr_le(f_sh->tmp_addr, (addr + size)))
+        HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+    if (H5F__vector_io_bypass_ok(f_sh, 1, &type, &addr, &size)) {
+        if (H5F__fd_read_unlocked(f_sh, 1, &type, &addr, &size, &buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through file driver failed")
+    } /* end if */
+    else if (H5F_shared_block_read(f_sh, type, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "block read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_raw_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_vector_write
+ *
+ * Purpose:	Writes COUNT blocks of raw data from the buffers in BUFS to
+ *              a file.  The addresses are relative to the base address
+ *              for the file.  The whole vector is handed to the file
+ *              driver at once when possible, otherwise each block is
+ *              written with H5F_shared_block_write().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_shared_vector_write(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                        size_t sizes[], const void *bufs[])
+{
+    uint32_t u;                   /* Local index variable */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f_sh);
+    HDassert(H5F_SHARED_INTENT(f_sh) & H5F_ACC_RDWR);
+    HDassert(count == 0 || (types && addrs && sizes && bufs));
+
+    /* Check for attempting I/O on 'temporary' file address */
+    for (u = 0; u < count; u++) {
+        HDassert(H5F_addr_defined(addrs[u]));
+        if (H5F_addr_le(f_sh->tmp_addr, (addrs[u] + sizes[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+    } /* end for */
+
+    if (H5F__vector_io_bypass_ok(f_sh, count, types, addrs, sizes)) {
+        /* Pass the whole vector down to the file driver layer */
+        H5F_SHARED_IO_LOCK(f_sh)
+        if (H5FD_write_vector(f_sh->lf, count, types, addrs, sizes, bufs) < 0)
+            HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write through file driver failed")
+        H5F_SHARED_IO_UNLOCK(f_sh)
+    } /* end if */
+    else
+        for (u = 0; u < count; u++)
+            if (H5F_shared_block_write(f_sh, types[u], addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "block write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_vector_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_has_vector_io
+ *
+ * Purpose:	Check if vector I/O on a file results in a single call to
+ *              the file driver, i.e. if the driver implements vector I/O
+ *              natively and page buffering is not in use.
+ *
+ * Return:	TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_shared_has_vector_io(const H5F_shared_t *f_sh)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f_sh);
+    HDassert(f_sh->lf);
+
+    FUNC_LEAVE_NOAPI(NULL == f_sh->page_buf && H5FD_has_vector_io(f_sh->lf))
+} /* end H5F_shared_has_vector_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_shared_get_mapped_ptr
+ *
+ * Purpose:	Returns a pointer to a block of raw data in the memory
+ *              mapping of a file, when the file driver keeps the file
+ *              mapped (see H5FD_FEAT_MEMORY_MAPPED).  The address is
+ *              relative to the base address for the file.  Like vector
+ *              I/O, the pointer bypasses the page buffer and the metadata
+ *              accumulator, so none is returned when either could hold
+ *              part of the block.
+ *
+ * Return:	Success:	Pointer into the mapping, valid until the
+ *                              file is closed
+ *		Failure:	NULL, when the block isn't in a mapping
+ *
+ *-------------------------------------------------------------------------
+ */
+const void *
+H5F_shared_get_mapped_ptr(const H5F_shared_t *f_sh, haddr_t addr, size_t size)
+{
+    H5FD_mem_t  type      = H5FD_MEM_DRAW; /* Type of the data */
+    const void *ret_value = NULL;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f_sh);
+    HDassert(f_sh->lf);
+
+    if (H5F_SHARED_HAS_FEATURE(f_sh, H5FD_FEAT_MEMORY_MAPPED) && H5F_addr_defined(addr) &&
+        H5F_addr_lt((addr + size), f_sh->tmp_addr) && H5F__vector_io_bypass_ok(f_sh, 1, &type, &addr, &size))
+#ifdef H5_HAVE_MMAP
+        ret_value = H5FD_mmap_get_ptr(f_sh->lf, addr, size);
+#else  /* H5_HAVE_MMAP */
+        ret_value = NULL;
+#endif /* H5_HAVE_MMAP */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_shared_get_mapped_ptr() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5F_flush_tagged_metadata
  *
@@ -67,6 +67,18 @@
     ((F)->shared->fs_strategy == H5F_FSPACE_STRATEGY_FSM_AGGR ||                                             \
      (F)->shared->fs_strategy == H5F_FSPACE_STRATEGY_PAGE)
 
+/* Macros to serialize calls into the file driver.  Raw data reads can be
+ * performed without holding the API lock (see H5F_shared_raw_read()), so
+ * every transfer to/from the file driver is protected by a per-file lock.
+ */
+#ifdef H5_HAVE_THREADSAFE
+#define H5F_SHARED_IO_LOCK(F_SH)   H5TS_mutex_lock_simple(&(F_SH)->io_lock);
+#define H5F_SHARED_IO_UNLOCK(F_SH) H5TS_mutex_unlock_simple(&(F_SH)->io_lock);
+#else /* H5_HAVE_THREADSAFE */
+#define H5F_SHARED_IO_LOCK(F_SH)
+#define H5F_SHARED_IO_UNLOCK(F_SH)
+#endif /* H5_HAVE_THREADSAFE */
+
 /* Macros for encoding/decoding superblock */
 #define H5F_MAX_DRVINFOBLOCK_SIZE 1024 /* Maximum size of superblock driver info buffer */
 #define H5F_DRVINFOBLOCK_HDR_SIZE 16   /* Size of superblock driver info header */
@@ -307,6 +319,14 @@ struct H5F_shared_t {
     hbool_t              use_file_locking;  /* Whether or not to use file locking */
     hbool_t              closing;           /* File is in the process of being closed */
 
+    /* Cache of the chunk index records of the file's datasets */
+    size_t                        chunk_idx_cache_nents; /* Maximum number of entries */
+    struct H5D_chunk_idx_cache_t *chunk_idx_cache;       /* The cache (created when first used) */
+
+    /* Raw data chunk cache shared by the file's datasets */
+    size_t                           shared_chunk_cache_nbytes; /* Size in bytes (0 if not shared) */
+    struct H5D_shared_chunk_cache_t *shared_chunk_cache;        /* The cache (created when first used) */
+
     /* Cached VOL connector ID & info */
     hid_t               vol_id;   /* ID of VOL connector for the container */
     const H5VL_class_t *vol_cls;  /* Pointer to VOL connector class for the container */
@@ -363,6 +383,10 @@ struct H5F_shared_t {
     H5P_coll_md_read_flag_t coll_md_read;  /* Do all metadata reads collectively */
     hbool_t                 coll_md_write; /* Do all metadata writes collectively */
 #endif                                     /* H5_HAVE_PARALLEL */
+
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_mutex_simple_t io_lock; /* Serializes transfers through the file driver */
+#endif                           /* H5_HAVE_THREADSAFE */
 };
 
 /*
@@ -436,6 +460,12 @@ H5_DLL herr_t H5F__super_ext_write_msg(H5F_t *f, unsigned id, void *mesg, hbool_
 H5_DLL herr_t H5F__super_ext_remove_msg(H5F_t *f, unsigned id);
 H5_DLL herr_t H5F__super_ext_close(H5F_t *f, H5O_loc_t *ext_ptr, hbool_t was_created);
 
+/* File driver I/O routines */
+H5_DLL herr_t H5F__fd_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *buf);
+H5_DLL herr_t H5F__fd_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
+                            const void *buf);
+H5_DLL herr_t H5F__fd_truncate(H5F_shared_t *f_sh, hbool_t closing);
+
 /* Metadata accumulator routines */
 H5_DLL herr_t H5F__accum_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *buf);
 H5_DLL herr_t H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
@@ -443,6 +473,7 @@ H5_DLL herr_t H5F__accum_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr
 H5_DLL herr_t H5F__accum_free(H5F_shared_t *f, H5FD_mem_t type, haddr_t addr, hsize_t size);
 H5_DLL herr_t H5F__accum_flush(H5F_shared_t *f_sh);
 H5_DLL herr_t H5F__accum_reset(H5F_shared_t *f_sh, hbool_t flush);
+H5_DLL hbool_t H5F__accum_overlaps(const H5F_shared_t *f_sh, haddr_t addr, size_t size);
 
 /* Shared file list related routines */
 H5_DLL herr_t H5F__sfile_add(H5F_shared_t *shared);
@@ -382,6 +382,12 @@ typedef struct H5F_t H5F_t;
 #define H5F_VOL_CLS(F)                 ((F)->shared->vol_cls)
 #define H5F_VOL_OBJ(F)                 ((F)->vol_obj)
 #define H5F_USE_FILE_LOCKING(F)        ((F)->shared->use_file_locking)
+#define H5F_CHUNK_IDX_CACHE_NENTS(F)   ((F)->shared->chunk_idx_cache_nents)
+#define H5F_CHUNK_IDX_CACHE(F)         ((F)->shared->chunk_idx_cache)
+#define H5F_SET_CHUNK_IDX_CACHE(F, C)  ((F)->shared->chunk_idx_cache = (C), SUCCEED)
+#define H5F_SHARED_CHUNK_CACHE_NBYTES(F) ((F)->shared->shared_chunk_cache_nbytes)
+#define H5F_SHARED_CHUNK_CACHE(F)        ((F)->shared->shared_chunk_cache)
+#define H5F_SET_SHARED_CHUNK_CACHE(F, C) ((F)->shared->shared_chunk_cache = (C), SUCCEED)
 #else /* H5F_MODULE */
 #define H5F_LOW_BOUND(F)                 (H5F_get_low_bound(F))
 #define H5F_HIGH_BOUND(F)                (H5F_get_high_bound(F))
@@ -445,6 +451,12 @@ typedef struct H5F_t H5F_t;
 #define H5F_VOL_CLS(F)                 (H5F_get_vol_cls(F))
 #define H5F_VOL_OBJ(F)                 (H5F_get_vol_obj(F))
 #define H5F_USE_FILE_LOCKING(F)        (H5F_get_use_file_locking(F))
+#define H5F_CHUNK_IDX_CACHE_NENTS(F)   (H5F_chunk_idx_cache_nents(F))
+#define H5F_CHUNK_IDX_CACHE(F)         (H5F_chunk_idx_cache(F))
+#define H5F_SET_CHUNK_IDX_CACHE(F, C)  (H5F_set_chunk_idx_cache((F), (C)))
+#define H5F_SHARED_CHUNK_CACHE_NBYTES(F) (H5F_get_shared_chunk_cache_nbytes(F))
+#define H5F_SHARED_CHUNK_CACHE(F)        (H5F_get_shared_chunk_cache(F))
+#define H5F_SET_SHARED_CHUNK_CACHE(F, C) (H5F_set_shared_chunk_cache((F), (C)))
 #endif /* H5F_MODULE */
 
 /* Macros to encode/decode offset/length's for storing in the file */
@@ -557,6 +569,10 @@ typedef struct H5F_t H5F_t;
 #define H5F_ACS_DATA_CACHE_NUM_SLOTS_NAME "rdcc_nslots" /* Size of raw data chunk cache(slots) */
 #define H5F_ACS_DATA_CACHE_BYTE_SIZE_NAME "rdcc_nbytes" /* Size of raw data chunk cache(bytes) */
 #define H5F_ACS_PREEMPT_READ_CHUNKS_NAME  "rdcc_w0"     /* Preemption read chunks first */
+#define H5F_ACS_CHUNK_IDX_CACHE_NENTS_NAME                                                                   \
+    "chunk_idx_cache_nents" /* Size of chunk index cache (entries) */
+#define H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_NAME                                                               \
+    "shared_chunk_cache_nbytes" /* Size of shared raw data chunk cache (bytes) */
 #define H5F_ACS_ALIGN_THRHD_NAME          "threshold"   /* Threshold for alignment */
 #define H5F_ACS_ALIGN_NAME                "align"       /* Alignment */
 #define H5F_ACS_META_BLOCK_SIZE_NAME                                                                         \
@@ -759,6 +775,8 @@ struct H5O_loc_t;
 struct H5HG_heap_t;
 struct H5VL_class_t;
 struct H5P_genplist_t;
+struct H5D_chunk_idx_cache_t;
+struct H5D_shared_chunk_cache_t;
 
 /* Forward declarations for anonymous H5F objects */
 
@@ -898,6 +916,16 @@ H5_DLL hbool_t H5F_use_mdc_logging(const H5F_t *f);
 H5_DLL hbool_t H5F_start_mdc_log_on_access(const H5F_t *f);
 H5_DLL char *  H5F_mdc_log_location(const H5F_t *f);
 
+/* Functions that access the chunk index cache */
+H5_DLL size_t                        H5F_chunk_idx_cache_nents(const H5F_t *f);
+H5_DLL struct H5D_chunk_idx_cache_t *H5F_chunk_idx_cache(const H5F_t *f);
+H5_DLL herr_t                        H5F_set_chunk_idx_cache(H5F_t *f, struct H5D_chunk_idx_cache_t *cache);
+
+/* Functions that access the shared raw data chunk cache */
+H5_DLL size_t                           H5F_get_shared_chunk_cache_nbytes(const H5F_t *f);
+H5_DLL struct H5D_shared_chunk_cache_t *H5F_get_shared_chunk_cache(const H5F_t *f);
+H5_DLL herr_t H5F_set_shared_chunk_cache(H5F_t *f, struct H5D_shared_chunk_cache_t *cache);
+
 /* Functions that retrieve values from VFD layer */
 H5_DLL hid_t   H5F_get_driver_id(const H5F_t *f);
 H5_DLL herr_t  H5F_get_fileno(const H5F_t *f, unsigned long *filenum);
@@ -920,6 +948,13 @@ H5_DLL herr_t H5F_block_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t siz
 H5_DLL herr_t H5F_shared_block_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size,
                                      const void *buf);
 H5_DLL herr_t H5F_block_write(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t H5F_shared_raw_read(H5F_shared_t *f_sh, haddr_t addr, size_t size, void *buf /*out*/);
+H5_DLL herr_t H5F_shared_vector_read(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                                     size_t sizes[], void *bufs[] /*out*/);
+H5_DLL herr_t H5F_shared_vector_write(H5F_shared_t *f_sh, uint32_t count, H5FD_mem_t types[],
+                                      haddr_t addrs[], size_t sizes[], const void *bufs[]);
+H5_DLL hbool_t H5F_shared_has_vector_io(const H5F_shared_t *f_sh);
+H5_DLL const void *H5F_shared_get_mapped_ptr(const H5F_shared_t *f_sh, haddr_t addr, size_t size);
 
 /* Functions that flush or evict */
 H5_DLL herr_t H5F_flush_tagged_metadata(H5F_t *f, haddr_t tag);
@@ -641,6 +641,90 @@ H5F_rdcc_w0(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->rdcc_w0)
 } /* end H5F_rdcc_w0() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5F_chunk_idx_cache_nents
+ *
+ * Purpose:  Retrieve the maximum number of entries in the file's chunk
+ *           index cache.
+ *
+ * Return:   The maximum number of entries (can't fail)
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5F_chunk_idx_cache_nents(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->chunk_idx_cache_nents)
+} /* end H5F_chunk_idx_cache_nents() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_chunk_idx_cache
+ *
+ * Purpose:  Retrieve the file's chunk index cache.
+ *
+ * Return:   The chunk index cache, or NULL if it hasn't been created
+ *-------------------------------------------------------------------------
+ */
+struct H5D_chunk_idx_cache_t *
+H5F_chunk_idx_cache(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->chunk_idx_cache)
+} /* end H5F_chunk_idx_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_get_shared_chunk_cache_nbytes
+ *
+ * Purpose:  Retrieve the size in bytes of the raw data chunk cache shared
+ *           by the file's datasets.
+ *
+ * Return:   The size, or 0 if the datasets have their own caches (can't
+ *           fail)
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5F_get_shared_chunk_cache_nbytes(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->shared_chunk_cache_nbytes)
+} /* end H5F_get_shared_chunk_cache_nbytes() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_get_shared_chunk_cache
+ *
+ * Purpose:  Retrieve the raw data chunk cache shared by the file's
+ *           datasets.
+ *
+ * Return:   The shared chunk cache, or NULL if it hasn't been created
+ *-------------------------------------------------------------------------
+ */
+struct H5D_shared_chunk_cache_t *
+H5F_get_shared_chunk_cache(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->shared_chunk_cache)
+} /* end H5F_get_shared_chunk_cache() */
+
 /*-------------------------------------------------------------------------
  * Function: H5F_get_base_addr
  *
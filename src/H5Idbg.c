@@ -30,7 +30,6 @@
 #include "H5Gprivate.h"  /* Groups                                   */
 #include "H5Ipkg.h"      /* IDs                                      */
 #include "H5RSprivate.h" /* Reference-counted strings                */
-#include "H5SLprivate.h" /* Skip Lists                               */
 #include "H5Tprivate.h"  /* Datatypes                                */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
@@ -50,7 +49,7 @@
 /* Local Prototypes */
 /********************/
 
-static int H5I__id_dump_cb(void *_item, void *_key, void *_udata);
+static int H5I__id_dump_cb(H5I_id_info_t *info, void *_udata);
 
 /*********************/
 /* Package Variables */
@@ -74,12 +73,11 @@ static int H5I__id_dump_cb(void *_item, void *_key, void *_udata);
  *-------------------------------------------------------------------------
  */
 static int
-H5I__id_dump_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__id_dump_cb(H5I_id_info_t *info, void *_udata)
 {
-    H5I_id_info_t *   info   = (H5I_id_info_t *)_item; /* Pointer to the ID node */
-    H5I_type_t        type   = *(H5I_type_t *)_udata;  /* User data */
-    const H5G_name_t *path   = NULL;                   /* Path to file object */
-    const void *      object = NULL;                   /* Pointer to VOL connector object */
+    H5I_type_t        type   = *(H5I_type_t *)_udata; /* User data */
+    const H5G_name_t *path   = NULL;                  /* Path to file object */
+    const void *      object = NULL;                  /* Pointer to VOL connector object */
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -182,7 +180,7 @@ H5I_dump_ids_for_type(H5I_type_t type)
         /* List */
         if (type_info->id_count > 0) {
             HDfprintf(stderr, "     List:\n");
-            H5SL_iterate(type_info->ids, H5I__id_dump_cb, &type);
+            H5I__table_iterate(type_info->ids, H5I__id_dump_cb, &type);
         }
     }
     else
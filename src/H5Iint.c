@@ -29,7 +29,6 @@
 #include "H5FLprivate.h" /* Free Lists                               */
 #include "H5Ipkg.h"      /* IDs                                      */
 #include "H5MMprivate.h" /* Memory management                        */
-#include "H5SLprivate.h" /* Skip Lists                               */
 #include "H5Tprivate.h"  /* Datatypes                                */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
@@ -40,6 +39,32 @@
 /* Combine a Type number and an ID index into an ID */
 #define H5I_MAKE(g, i) ((((hid_t)(g)&TYPE_MASK) << ID_BITS) | ((hid_t)(i)&ID_MASK))
 
+/* Lock the ID tables against threads that look up and reference count IDs
+ * without holding the API lock (i.e. threads pushing errors while they are
+ * in a blocking read or running a task for H5TS_run_tasks()).  Object
+ * callbacks (free, realize & discard) are never invoked with this lock held.
+ */
+#ifdef H5_HAVE_THREADSAFE
+#define H5I_LOCK   H5TS_mutex_lock_simple(&H5TS_ids_lock_g);
+#define H5I_UNLOCK H5TS_mutex_unlock_simple(&H5TS_ids_lock_g);
+#else /* H5_HAVE_THREADSAFE */
+#define H5I_LOCK
+#define H5I_UNLOCK
+#endif /* H5_HAVE_THREADSAFE */
+
+/* Size of the smallest hash index for an ID table (log2 of the # of slots) */
+#define H5I_TABLE_MIN_SLOT_BITS 4
+
+/* Initial # of entries allocated for an ID table */
+#define H5I_TABLE_MIN_ENTRIES 8
+
+/* Map an ID to its home slot in a hash index with 2^bits slots.  This is
+ * Fibonacci hashing, which spreads the consecutive IDs handed out for a
+ * type evenly over the index.
+ */
+#define H5I_TABLE_HASH(id, bits)                                                                             \
+    ((size_t)(((uint64_t)(id) * (uint64_t)0x9E3779B97F4A7C15ULL) >> (64 - (bits))))
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -74,13 +99,19 @@ typedef struct {
 /* Local Prototypes */
 /********************/
 
-static void * H5I__unwrap(void *object, H5I_type_t type);
-static htri_t H5I__clear_type_cb(void *_id, void *key, void *udata);
-static void * H5I__remove_common(H5I_type_info_t *type_info, hid_t id);
-static int    H5I__dec_ref(hid_t id, void **request);
-static int    H5I__dec_app_ref(hid_t id, void **request);
-static int    H5I__dec_app_ref_always_close(hid_t id, void **request);
-static int    H5I__find_id_cb(void *_item, void *_key, void *_udata);
+static void *          H5I__unwrap(void *object, H5I_type_t type);
+static int             H5I__clear_type_cb(H5I_id_info_t *info, void *udata);
+static void *          H5I__remove_common(H5I_type_info_t *type_info, hid_t id);
+static int             H5I__dec_ref(hid_t id, void **request);
+static int             H5I__dec_app_ref(hid_t id, void **request);
+static int             H5I__dec_app_ref_always_close(hid_t id, void **request);
+static int             H5I__find_id_cb(H5I_id_info_t *info, void *udata);
+static H5I_id_table_t *H5I__table_create(void);
+static void            H5I__table_close(H5I_id_table_t *table);
+static void            H5I__table_rebuild(H5I_id_table_t *table, H5I_id_slot_t *slots, unsigned slot_bits);
+static herr_t          H5I__table_insert(H5I_id_table_t *table, H5I_id_info_t *info);
+static H5I_id_info_t * H5I__table_remove(H5I_id_table_t *table, hid_t id);
+static H5I_id_info_t * H5I__table_search(const H5I_id_table_t *table, hid_t id);
 
 /*********************/
 /* Package Variables */
@@ -96,6 +127,9 @@ int              H5I_next_type_g = (int)H5I_NTYPES;
 /* Declare a free list to manage the H5I_id_info_t struct */
 H5FL_DEFINE_STATIC(H5I_id_info_t);
 
+/* Declare a free list to manage the H5I_id_table_t struct */
+H5FL_DEFINE_STATIC(H5I_id_table_t);
+
 /*****************************/
 /* Library Private Variables */
 /*****************************/
@@ -196,8 +230,8 @@ H5I_register_type(const H5I_class_t *cls)
         type_info->id_count     = 0;
         type_info->nextid       = cls->reserved;
         type_info->last_id_info = NULL;
-        if (NULL == (type_info->ids = H5SL_create(H5SL_TYPE_HID, NULL)))
-            HGOTO_ERROR(H5E_ID, H5E_CANTCREATE, FAIL, "skip list creation failed")
+        if (NULL == (type_info->ids = H5I__table_create()))
+            HGOTO_ERROR(H5E_ID, H5E_CANTCREATE, FAIL, "ID table creation failed")
     }
 
     /* Increment the count of the times this type has been initialized */
@@ -208,7 +242,7 @@ done:
     if (ret_value < 0) {
         if (type_info) {
             if (type_info->ids)
-                H5SL_close(type_info->ids);
+                H5I__table_close(type_info->ids);
             H5MM_free(type_info);
         }
     }
@@ -329,7 +363,7 @@ H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref)
     udata.app_ref = app_ref;
 
     /* Attempt to free all ids in the type */
-    if (H5SL_try_free_safe(udata.type_info->ids, H5I__clear_type_cb, &udata) < 0)
+    if (H5I__table_iterate(udata.type_info->ids, H5I__clear_type_cb, &udata) < 0)
         HGOTO_ERROR(H5E_ID, H5E_CANTDELETE, FAIL, "can't free ids in type")
 
 done:
@@ -342,19 +376,18 @@ done:
  * Purpose:     Attempts to free the specified ID, calling the free
  *              function for the object.
  *
- * Return:      TRUE/FALSE/FAIL
+ * Return:      H5_ITER_CONT (always)
  *
  * Programmer:  Neil Fortner
  *              Friday, July 10, 2015
  *
  *-------------------------------------------------------------------------
  */
-static htri_t
-H5I__clear_type_cb(void *_info, void H5_ATTR_UNUSED *key, void *_udata)
+static int
+H5I__clear_type_cb(H5I_id_info_t *info, void *_udata)
 {
-    H5I_id_info_t *      info      = (H5I_id_info_t *)_info;        /* Current ID info being worked with */
-    H5I_clear_type_ud_t *udata     = (H5I_clear_type_ud_t *)_udata; /* udata struct */
-    htri_t               ret_value = FALSE;                         /* Return value */
+    H5I_clear_type_ud_t *udata  = (H5I_clear_type_ud_t *)_udata; /* udata struct */
+    hbool_t              remove = FALSE;                         /* Whether to remove the ID */
 
     FUNC_ENTER_STATIC_NOERR
 
@@ -382,13 +415,13 @@ H5I__clear_type_cb(void *_info, void H5_ATTR_UNUSED *key, void *_udata)
                     }
 #endif /* H5I_DEBUG */
 
-                    /* Indicate node should be removed from list */
-                    ret_value = TRUE;
+                    /* Indicate the ID should be removed */
+                    remove = TRUE;
                 }
             }
             else {
-                /* Indicate node should be removed from list */
-                ret_value = TRUE;
+                /* Indicate the ID should be removed */
+                remove = TRUE;
             }
         }
         else {
@@ -405,28 +438,34 @@ H5I__clear_type_cb(void *_info, void H5_ATTR_UNUSED *key, void *_udata)
                     }
 #endif /* H5I_DEBUG */
 
-                    /* Indicate node should be removed from list */
-                    ret_value = TRUE;
+                    /* Indicate the ID should be removed */
+                    remove = TRUE;
                 }
             }
             else {
-                /* Indicate node should be removed from list */
-                ret_value = TRUE;
+                /* Indicate the ID should be removed */
+                remove = TRUE;
             }
         }
         H5_GCC_DIAG_ON("cast-qual")
 
         /* Remove ID if requested */
-        if (ret_value) {
-            /* Free ID info */
-            info = H5FL_FREE(H5I_id_info_t, info);
+        if (remove) {
+            H5I_LOCK
+            H5I__table_remove(udata->type_info->ids, info->id);
+            if (udata->type_info->last_id_info == info)
+                udata->type_info->last_id_info = NULL;
 
             /* Decrement the number of IDs in the type */
             udata->type_info->id_count--;
+            H5I_UNLOCK
+
+            /* Free ID info */
+            info = H5FL_FREE(H5I_id_info_t, info);
         }
     }
 
-    FUNC_LEAVE_NOAPI(ret_value)
+    FUNC_LEAVE_NOAPI(H5_ITER_CONT)
 } /* end H5I__clear_type_cb() */
 
 /*-------------------------------------------------------------------------
@@ -468,8 +507,7 @@ H5I__destroy_type(H5I_type_t type)
         if (type_info->cls->flags & H5I_CLASS_IS_APPLICATION)
             type_info->cls = H5MM_xfree_const(type_info->cls);
 
-    if (H5SL_close(type_info->ids) < 0)
-        HGOTO_ERROR(H5E_ID, H5E_CANTCLOSEOBJ, FAIL, "can't close skip list")
+    H5I__table_close(type_info->ids);
     type_info->ids = NULL;
 
     type_info = H5MM_xfree(type_info);
@@ -530,8 +568,11 @@ H5I__register(H5I_type_t type, const void *object, hbool_t app_ref, H5I_future_r
     info->discard_cb = discard_cb;
 
     /* Insert into the type */
-    if (H5SL_insert(type_info->ids, info, &info->id) < 0)
-        HGOTO_ERROR(H5E_ID, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into skip list")
+    H5I_LOCK
+    if (H5I__table_insert(type_info->ids, info) < 0) {
+        H5I_UNLOCK
+        HGOTO_ERROR(H5E_ID, H5E_CANTINSERT, H5I_INVALID_HID, "can't insert ID node into table")
+    } /* end if */
     type_info->id_count++;
     type_info->nextid++;
 
@@ -540,6 +581,7 @@ H5I__register(H5I_type_t type, const void *object, hbool_t app_ref, H5I_future_r
 
     /* Set the most recent ID to this object */
     type_info->last_id_info = info;
+    H5I_UNLOCK
 
     /* Set return value */
     ret_value = new_id;
@@ -642,12 +684,16 @@ H5I_register_using_existing_id(H5I_type_t type, void *object, hbool_t app_ref, h
     info->discard_cb = NULL;
 
     /* Insert into the type */
-    if (H5SL_insert(type_info->ids, info, &info->id) < 0)
-        HGOTO_ERROR(H5E_ID, H5E_CANTINSERT, FAIL, "can't insert ID node into skip list")
+    H5I_LOCK
+    if (H5I__table_insert(type_info->ids, info) < 0) {
+        H5I_UNLOCK
+        HGOTO_ERROR(H5E_ID, H5E_CANTINSERT, FAIL, "can't insert ID node into table")
+    } /* end if */
     type_info->id_count++;
 
     /* Set the most recent ID to this object */
     type_info->last_id_info = info;
+    H5I_UNLOCK
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -680,12 +726,14 @@ H5I_subst(hid_t id, const void *new_object)
         HGOTO_ERROR(H5E_ID, H5E_NOTFOUND, NULL, "can't get ID ref count")
 
     /* Get the old object pointer to return */
+    H5I_LOCK
     H5_GCC_DIAG_OFF("cast-qual")
     ret_value = (void *)info->object; /* (Casting away const OK -QAK) */
     H5_GCC_DIAG_ON("cast-qual")
 
     /* Set the new object pointer for the ID */
     info->object = new_object;
+    H5I_UNLOCK
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -898,22 +946,26 @@ H5I__remove_common(H5I_type_info_t *type_info, hid_t id)
     HDassert(type_info);
 
     /* Get the ID node for the ID */
-    if (NULL == (info = (H5I_id_info_t *)H5SL_remove(type_info->ids, &id)))
-        HGOTO_ERROR(H5E_ID, H5E_CANTDELETE, NULL, "can't remove ID node from skip list")
+    H5I_LOCK
+    if (NULL == (info = H5I__table_remove(type_info->ids, id))) {
+        H5I_UNLOCK
+        HGOTO_ERROR(H5E_ID, H5E_CANTDELETE, NULL, "can't remove ID node from table")
+    } /* end if */
 
     /* Check if this ID was the last one accessed */
     if (type_info->last_id_info == info)
         type_info->last_id_info = NULL;
 
+    /* Decrement the number of IDs in the type */
+    (type_info->id_count)--;
+    H5I_UNLOCK
+
     H5_GCC_DIAG_OFF("cast-qual")
     ret_value = (void *)info->object; /* (Casting away const OK -QAK) */
     H5_GCC_DIAG_ON("cast-qual")
 
     info = H5FL_FREE(H5I_id_info_t, info);
 
-    /* Decrement the number of IDs in the type */
-    (type_info->id_count)--;
-
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I__remove_common() */
@@ -1000,9 +1052,13 @@ H5I__dec_ref(hid_t id, void **request)
      * write when a dataset is closed and the chunk cache is flushed to the
      * file.  We have to close the dataset anyway. (SLU - 2010/9/7)
      */
+    H5I_LOCK
     if (1 == info->count) {
         H5I_type_info_t *type_info; /*ptr to the type    */
 
+        /* Don't hold the ID lock while the object is freed */
+        H5I_UNLOCK
+
         /* Get the ID's type */
         type_info = H5I_type_info_array_g[H5I_TYPE(id)];
 
@@ -1021,6 +1077,7 @@ H5I__dec_ref(hid_t id, void **request)
     else {
         --(info->count);
         ret_value = (int)info->count;
+        H5I_UNLOCK
     } /* end else */
 
 done:
@@ -1092,11 +1149,13 @@ H5I__dec_app_ref(hid_t id, void **request)
             HGOTO_ERROR(H5E_ID, H5E_BADID, (-1), "can't locate ID")
 
         /* Adjust app_ref */
+        H5I_LOCK
         --(info->app_count);
         HDassert(info->count >= info->app_count);
 
         /* Set return value */
         ret_value = (int)info->app_count;
+        H5I_UNLOCK
     } /* end if */
 
 done:
@@ -1301,12 +1360,14 @@ H5I_inc_ref(hid_t id, hbool_t app_ref)
         HGOTO_ERROR(H5E_ID, H5E_BADID, (-1), "can't locate ID")
 
     /* Adjust reference counts */
+    H5I_LOCK
     ++(info->count);
     if (app_ref)
         ++(info->app_count);
 
     /* Set return value */
     ret_value = (int)(app_ref ? info->app_count : info->count);
+    H5I_UNLOCK
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1476,9 +1537,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__iterate_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__iterate_cb(H5I_id_info_t *info, void *_udata)
 {
-    H5I_id_info_t *   info      = (H5I_id_info_t *)_item;     /* Pointer to the ID info */
     H5I_iterate_ud_t *udata     = (H5I_iterate_ud_t *)_udata; /* User data for callback */
     int               ret_value = H5_ITER_CONT;               /* Callback return value */
 
@@ -1562,7 +1622,7 @@ H5I_iterate(H5I_type_t type, H5I_search_func_t func, void *udata, hbool_t app_re
         iter_udata.obj_type   = type;
 
         /* Iterate over IDs */
-        if ((iter_status = H5SL_iterate(type_info->ids, H5I__iterate_cb, &iter_udata)) < 0)
+        if ((iter_status = H5I__table_iterate(type_info->ids, H5I__iterate_cb, &iter_udata)) < 0)
             HGOTO_ERROR(H5E_ID, H5E_BADITER, FAIL, "iteration failed")
     }
 
@@ -1601,15 +1661,17 @@ H5I__find_id(hid_t id)
         HGOTO_DONE(NULL)
 
     /* Check for same ID as we have looked up last time */
+    H5I_LOCK
     if (type_info->last_id_info && type_info->last_id_info->id == id)
         id_info = type_info->last_id_info;
     else {
         /* Locate the ID node for the ID */
-        id_info = (H5I_id_info_t *)H5SL_search(type_info->ids, &id);
+        id_info = H5I__table_search(type_info->ids, id);
 
         /* Remember this ID */
         type_info->last_id_info = id_info;
     }
+    H5I_UNLOCK
 
     /* Check if this is a future ID */
     H5_GCC_DIAG_OFF("cast-qual")
@@ -1664,9 +1726,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5I__find_id_cb(void *_item, void H5_ATTR_UNUSED *_key, void *_udata)
+H5I__find_id_cb(H5I_id_info_t *info, void *_udata)
 {
-    H5I_id_info_t *  info      = (H5I_id_info_t *)_item;    /* Pointer to the ID info */
     H5I_get_id_ud_t *udata     = (H5I_get_id_ud_t *)_udata; /* Pointer to user data */
     H5I_type_t       type      = udata->obj_type;
     const void *     object    = NULL;
@@ -1730,7 +1791,7 @@ H5I_find_id(const void *object, H5I_type_t type, hid_t *id)
         udata.ret_id   = H5I_INVALID_HID;
 
         /* Iterate over IDs for the ID type */
-        if ((iter_status = H5SL_iterate(type_info->ids, H5I__find_id_cb, &udata)) < 0)
+        if ((iter_status = H5I__table_iterate(type_info->ids, H5I__find_id_cb, &udata)) < 0)
             HGOTO_ERROR(H5E_ID, H5E_BADITER, FAIL, "iteration failed")
 
         *id = udata.ret_id;
@@ -1739,3 +1800,361 @@ H5I_find_id(const void *object, H5I_type_t type, hid_t *id)
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_find_id() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__table_create
+ *
+ * Purpose:     Create an empty table of IDs.
+ *
+ * Return:      Success:    Pointer to the new table
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_table_t *
+H5I__table_create(void)
+{
+    H5I_id_table_t *table     = NULL; /* New table */
+    H5I_id_table_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (NULL == (table = H5FL_CALLOC(H5I_id_table_t)))
+        HGOTO_ERROR(H5E_ID, H5E_CANTALLOC, NULL, "memory allocation failed for ID table")
+    table->slot_bits = H5I_TABLE_MIN_SLOT_BITS;
+    if (NULL == (table->slots = (H5I_id_slot_t *)H5MM_calloc(((size_t)1 << table->slot_bits) *
+                                                             sizeof(H5I_id_slot_t))))
+        HGOTO_ERROR(H5E_ID, H5E_CANTALLOC, NULL, "memory allocation failed for ID table index")
+
+    /* Set return value */
+    ret_value = table;
+
+done:
+    if (NULL == ret_value && table)
+        table = H5FL_FREE(H5I_id_table_t, table);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__table_create() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__table_close
+ *
+ * Purpose:     Release a table of IDs.  The info for any IDs still in the
+ *              table is not released.
+ *
+ * Return:      Void (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__table_close(H5I_id_table_t *table)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(table);
+    HDassert(0 == table->iter_count);
+
+    H5MM_xfree(table->entries);
+    H5MM_xfree(table->slots);
+    table = H5FL_FREE(H5I_id_table_t, table);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__table_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__table_rebuild
+ *
+ * Purpose:     Rebuild the hash index of an ID table in SLOTS, which has
+ *              2^SLOT_BITS slots and replaces the current index (or is
+ *              NULL to rebuild the current index in place).
+ *
+ *              Unless the table is being iterated over, the entries of
+ *              removed IDs are squeezed out first, and the entries are
+ *              shrunk if they are mostly unused.
+ *
+ * Return:      Void (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I__table_rebuild(H5I_id_table_t *table, H5I_id_slot_t *slots, unsigned slot_bits)
+{
+    size_t mask; /* Mask for wrapping around the index */
+    size_t u, v; /* Local index variables */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(table);
+    HDassert(slots || slot_bits == table->slot_bits);
+    HDassert(table->nids < ((size_t)1 << slot_bits));
+
+    /* Squeeze out the removed IDs */
+    if (0 == table->iter_count && table->nids < table->nentries) {
+        for (u = v = 0; u < table->nentries; u++)
+            if (table->entries[u])
+                table->entries[v++] = table->entries[u];
+        HDassert(v == table->nids);
+        table->nentries = v;
+
+        /* Give back memory that isn't needed (keeping the old entries if
+         * that doesn't work out is fine)
+         */
+        if (table->max_entries > H5I_TABLE_MIN_ENTRIES && table->nentries < table->max_entries / 4) {
+            H5I_id_info_t **entries; /* Shrunk entries */
+            size_t          max_entries = MAX(table->max_entries / 2, H5I_TABLE_MIN_ENTRIES);
+
+            if (NULL != (entries = (H5I_id_info_t **)H5MM_realloc(table->entries,
+                                                                   max_entries * sizeof(H5I_id_info_t *)))) {
+                table->entries     = entries;
+                table->max_entries = max_entries;
+            } /* end if */
+        }     /* end if */
+    }         /* end if */
+
+    /* Switch to the new index, or clear the current one */
+    if (slots) {
+        H5MM_xfree(table->slots);
+        table->slots     = slots;
+        table->slot_bits = slot_bits;
+    } /* end if */
+    else
+        HDmemset(table->slots, 0, ((size_t)1 << table->slot_bits) * sizeof(H5I_id_slot_t));
+
+    /* Put each ID in its slot */
+    mask = ((size_t)1 << table->slot_bits) - 1;
+    for (u = 0; u < table->nentries; u++)
+        if (table->entries[u]) {
+            size_t slot = H5I_TABLE_HASH(table->entries[u]->id, table->slot_bits);
+
+            while (table->slots[slot].id != 0)
+                slot = (slot + 1) & mask;
+            table->slots[slot].id  = table->entries[u]->id;
+            table->slots[slot].pos = u;
+        } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I__table_rebuild() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__table_insert
+ *
+ * Purpose:     Add the ID described by INFO to an ID table.  The ID must
+ *              not be in the table already.
+ *
+ *              The hash index is kept at most half full, doubling it as
+ *              needed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I__table_insert(H5I_id_table_t *table, H5I_id_info_t *info)
+{
+    size_t mask;                /* Mask for wrapping around the index */
+    size_t slot;                /* Slot for the ID */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(table);
+    HDassert(info);
+    HDassert(info->id > 0);
+
+    /* Grow the index, if it would be more than half full */
+    if (table->nids + 1 > ((size_t)1 << (table->slot_bits - 1))) {
+        H5I_id_slot_t *slots; /* New index */
+
+        if (NULL == (slots = (H5I_id_slot_t *)H5MM_calloc(((size_t)1 << (table->slot_bits + 1)) *
+                                                          sizeof(H5I_id_slot_t))))
+            HGOTO_ERROR(H5E_ID, H5E_CANTALLOC, FAIL, "memory allocation failed for ID table index")
+        H5I__table_rebuild(table, slots, table->slot_bits + 1);
+    } /* end if */
+
+    /* Make room for another entry, squeezing out the entries of removed IDs
+     * if that frees up at least half of them, or allocating more otherwise
+     */
+    if (table->nentries == table->max_entries) {
+        if (0 == table->iter_count && table->nids <= table->nentries / 2 && table->nentries > 0)
+            H5I__table_rebuild(table, NULL, table->slot_bits);
+        else {
+            H5I_id_info_t **entries; /* Grown entries */
+            size_t          max_entries = MAX(table->max_entries * 2, H5I_TABLE_MIN_ENTRIES);
+
+            if (NULL == (entries = (H5I_id_info_t **)H5MM_realloc(table->entries,
+                                                                   max_entries * sizeof(H5I_id_info_t *))))
+                HGOTO_ERROR(H5E_ID, H5E_CANTALLOC, FAIL, "memory allocation failed for ID table entries")
+            table->entries     = entries;
+            table->max_entries = max_entries;
+        } /* end else */
+    }     /* end if */
+
+    /* Find an empty slot for the ID */
+    mask = ((size_t)1 << table->slot_bits) - 1;
+    slot = H5I_TABLE_HASH(info->id, table->slot_bits);
+    while (table->slots[slot].id != 0) {
+        if (table->slots[slot].id == info->id)
+            HGOTO_ERROR(H5E_ID, H5E_EXISTS, FAIL, "ID already in table")
+        slot = (slot + 1) & mask;
+    } /* end while */
+
+    /* Add the ID */
+    table->slots[slot].id             = info->id;
+    table->slots[slot].pos            = table->nentries;
+    table->entries[table->nentries++] = info;
+    table->nids++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__table_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__table_remove
+ *
+ * Purpose:     Remove an ID from an ID table.
+ *
+ *              The slot of the ID is filled by shifting back IDs later in
+ *              its probe sequence, so lookups never have to step over
+ *              removed IDs.  The index is halved when it becomes less than
+ *              an eighth full.
+ *
+ * Return:      Success:    Pointer to the info for the ID
+ *              Failure:    NULL (the ID isn't in the table)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I__table_remove(H5I_id_table_t *table, hid_t id)
+{
+    size_t         mask;             /* Mask for wrapping around the index */
+    size_t         hole, slot;       /* Slots being moved between */
+    H5I_id_info_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(table);
+
+    /* Find the ID's slot */
+    mask = ((size_t)1 << table->slot_bits) - 1;
+    hole = H5I_TABLE_HASH(id, table->slot_bits);
+    while (table->slots[hole].id != id) {
+        if (0 == table->slots[hole].id)
+            HGOTO_DONE(NULL)
+        hole = (hole + 1) & mask;
+    } /* end while */
+
+    /* Remove the ID's entry, dropping unused entries at the end */
+    ret_value                              = table->entries[table->slots[hole].pos];
+    table->entries[table->slots[hole].pos] = NULL;
+    while (table->nentries > 0 && NULL == table->entries[table->nentries - 1])
+        table->nentries--;
+    table->nids--;
+
+    /* Move IDs after the hole whose home slot isn't between the hole and
+     * where they are now back into the hole
+     */
+    slot = hole;
+    while (1) {
+        size_t home; /* Home slot of an ID */
+
+        slot = (slot + 1) & mask;
+        if (0 == table->slots[slot].id)
+            break;
+        home = H5I_TABLE_HASH(table->slots[slot].id, table->slot_bits);
+        if (hole <= slot ? (hole < home && home <= slot) : (hole < home || home <= slot))
+            continue;
+        table->slots[hole] = table->slots[slot];
+        hole               = slot;
+    } /* end while */
+    table->slots[hole].id = 0;
+
+    /* Shrink the index, if it's mostly empty (it's just bigger than it needs
+     * to be if that doesn't work out)
+     */
+    if (table->slot_bits > H5I_TABLE_MIN_SLOT_BITS && table->nids < ((size_t)1 << (table->slot_bits - 3))) {
+        H5I_id_slot_t *slots; /* New index */
+
+        if (NULL != (slots = (H5I_id_slot_t *)H5MM_calloc(((size_t)1 << (table->slot_bits - 1)) *
+                                                          sizeof(H5I_id_slot_t))))
+            H5I__table_rebuild(table, slots, table->slot_bits - 1);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__table_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__table_search
+ *
+ * Purpose:     Look up an ID in an ID table.
+ *
+ * Return:      Success:    Pointer to the info for the ID
+ *              Failure:    NULL (the ID isn't in the table)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I__table_search(const H5I_id_table_t *table, hid_t id)
+{
+    size_t         mask;             /* Mask for wrapping around the index */
+    size_t         slot;             /* Slot being looked at */
+    H5I_id_info_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(table);
+
+    mask = ((size_t)1 << table->slot_bits) - 1;
+    slot = H5I_TABLE_HASH(id, table->slot_bits);
+    while (table->slots[slot].id != 0) {
+        if (table->slots[slot].id == id)
+            HGOTO_DONE(table->entries[table->slots[slot].pos])
+        slot = (slot + 1) & mask;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__table_search() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5I__table_iterate
+ *
+ * Purpose:     Call OP for each ID in an ID table, in the order the IDs
+ *              were added, until OP returns non-zero.
+ *
+ *              OP may add and remove IDs.  IDs it adds may or may not be
+ *              visited, and IDs it removes are not visited afterwards.
+ *
+ * Return:      Last value returned by OP (H5_ITER_CONT if OP was never
+ *              called)
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5I__table_iterate(H5I_id_table_t *table, H5I_table_op_t op, void *op_data)
+{
+    size_t u;                        /* Local index variable */
+    int    ret_value = H5_ITER_CONT; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(table);
+    HDassert(op);
+
+    /* Keep the entries where they are while OP runs (re-reading them each
+     * time around, since OP may move them by adding IDs)
+     */
+    table->iter_count++;
+    for (u = 0; u < table->nentries && H5_ITER_CONT == ret_value; u++)
+        if (table->entries[u])
+            ret_value = (*op)(table->entries[u], op_data);
+    table->iter_count--;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I__table_iterate() */
@@ -29,9 +29,6 @@
 /* Get package's private header */
 #include "H5Iprivate.h"
 
-/* Other private headers needed by this file */
-#include "H5SLprivate.h" /* Skip Lists                               */
-
 /**************************/
 /* Package Private Macros */
 /**************************/
@@ -74,6 +71,34 @@ typedef struct H5I_id_info_t {
     H5I_future_discard_func_t discard_cb; /* 'discard' callback for future object */
 } H5I_id_info_t;
 
+/* Slot in the hash index of an ID table */
+typedef struct H5I_id_slot_t {
+    hid_t  id;  /* ID in this slot (0 for an empty slot) */
+    size_t pos; /* Position of the ID's info in the table's 'entries' */
+} H5I_id_slot_t;
+
+/* Table of the IDs in a type.
+ *
+ * The info for each ID is kept in 'entries', in the order the IDs were
+ * inserted, and 'slots' is an open-addressing (linear probing) hash index
+ * from each ID to its position in 'entries'.  Removing an ID leaves a NULL
+ * entry behind, which is squeezed out the next time the index is rebuilt,
+ * unless the table is being iterated over.  Callbacks can therefore add
+ * and remove IDs while the table is iterated over.
+ */
+typedef struct H5I_id_table_t {
+    H5I_id_info_t **entries;     /* ID info, in insertion order (NULL for removed IDs) */
+    size_t          nentries;    /* # of entries in use, including removed IDs */
+    size_t          max_entries; /* # of entries allocated */
+    H5I_id_slot_t * slots;       /* Hash index of the IDs */
+    unsigned        slot_bits;   /* log2 of the # of slots in the hash index */
+    size_t          nids;        /* # of IDs in the table */
+    unsigned        iter_count;  /* # of iterations over the table in progress */
+} H5I_id_table_t;
+
+/* Callback for iterating over the IDs in a table */
+typedef int (*H5I_table_op_t)(H5I_id_info_t *info, void *op_data);
+
 /* Type information structure used */
 typedef struct H5I_type_info_t {
     const H5I_class_t *cls;          /* Pointer to ID class */
@@ -81,7 +106,7 @@ typedef struct H5I_type_info_t {
     uint64_t           id_count;     /* Current number of IDs held */
     uint64_t           nextid;       /* ID to use for the next object */
     H5I_id_info_t *    last_id_info; /* Info for most recent ID looked up */
-    H5SL_t *           ids;          /* Pointer to skip list that stores IDs */
+    H5I_id_table_t *   ids;          /* Pointer to table that stores IDs */
 } H5I_type_info_t;
 
 /*****************************/
@@ -110,6 +135,7 @@ H5_DLL void *H5I__remove_verify(hid_t id, H5I_type_t type);
 H5_DLL int   H5I__inc_type_ref(H5I_type_t type);
 H5_DLL int   H5I__get_type_ref(H5I_type_t type);
 H5_DLL H5I_id_info_t *H5I__find_id(hid_t id);
+H5_DLL int            H5I__table_iterate(H5I_id_table_t *table, H5I_table_op_t op, void *op_data);
 
 /* Testing functions */
 #ifdef H5I_TESTING
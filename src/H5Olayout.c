@@ -358,6 +358,23 @@ H5O__layout_decode(H5F_t *f, H5O_t H5_ATTR_UNUSED *open_oh, unsigned H5_ATTR_UNU
                             mesg->storage.u.chunk.ops = H5D_COPS_BT2;
                             break;
 
+                        case H5D_CHUNK_IDX_SHARD: /* v2 B-tree index of shards */
+                            UINT32DECODE(p, mesg->u.chunk.u.shard.btree2.cparam.node_size);
+                            mesg->u.chunk.u.shard.btree2.cparam.split_percent = *p++;
+                            mesg->u.chunk.u.shard.btree2.cparam.merge_percent = *p++;
+
+                            /* # of chunks per shard in each dimension */
+                            for (u = 0; u < (unsigned)(mesg->u.chunk.ndims - 1); u++) {
+                                UINT32DECODE(p, mesg->u.chunk.u.shard.dim[u]);
+                                if (0 == mesg->u.chunk.u.shard.dim[u])
+                                    HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, NULL, "invalid shard dimension")
+                            } /* end for */
+                            mesg->u.chunk.u.shard.dim[mesg->u.chunk.ndims - 1] = 1;
+
+                            /* Set the chunk operations */
+                            mesg->storage.u.chunk.ops = H5D_COPS_SHARD;
+                            break;
+
                         case H5D_CHUNK_IDX_NTYPES:
                         default:
                             HGOTO_ERROR(H5E_OHDR, H5E_BADVALUE, NULL, "Invalid chunk index type")
@@ -696,6 +713,16 @@ H5O__layout_encode(H5F_t *f, hbool_t H5_ATTR_UNUSED disable_shared, uint8_t *p,
                         *p++ = mesg->u.chunk.u.btree2.cparam.merge_percent;
                         break;
 
+                    case H5D_CHUNK_IDX_SHARD: /* v2 B-tree index of shards */
+                        UINT32ENCODE(p, mesg->u.chunk.u.shard.btree2.cparam.node_size);
+                        *p++ = mesg->u.chunk.u.shard.btree2.cparam.split_percent;
+                        *p++ = mesg->u.chunk.u.shard.btree2.cparam.merge_percent;
+
+                        /* # of chunks per shard in each dimension */
+                        for (u = 0; u < (unsigned)(mesg->u.chunk.ndims - 1); u++)
+                            UINT32ENCODE(p, mesg->u.chunk.u.shard.dim[u]);
+                        break;
+
                     case H5D_CHUNK_IDX_NTYPES:
                     default:
                         HGOTO_ERROR(H5E_OHDR, H5E_CANTENCODE, FAIL, "Invalid chunk index type")
@@ -1188,6 +1215,11 @@ H5O__layout_debug(H5F_t H5_ATTR_UNUSED *f, const void *_mesg, FILE *stream, int
                     /* (Should print the v2-Btree creation parameters) */
                     break;
 
+                case H5D_CHUNK_IDX_SHARD:
+                    HDfprintf(stream, "%*s%-*s %s\n", indent, "", fwidth, "Index Type:", "Sharded v2 B-tree");
+                    /* (Should print the v2-Btree creation parameters) */
+                    break;
+
                 case H5D_CHUNK_IDX_NTYPES:
                 default:
                     HDfprintf(stream, "%*s%-*s %s (%u)\n", indent, "", fwidth, "Index Type:", "Unknown",
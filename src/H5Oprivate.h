@@ -481,6 +481,14 @@ typedef struct H5O_storage_chunk_bt2_t {
     struct H5B2_t *bt2;            /* Pointer to b-tree 2 struct */
 } H5O_storage_chunk_bt2_t;
 
+/* Forward declaration of structs used below */
+struct H5D_shard_t; /* Defined in H5Dshard.c          */
+
+typedef struct H5O_storage_chunk_shard_t {
+    H5O_storage_chunk_bt2_t btree2; /* Information for v2 B-tree index of shards */
+    struct H5D_shard_t *    shard;  /* Table of chunks in the shard accessed last */
+} H5O_storage_chunk_shard_t;
+
 typedef struct H5O_storage_chunk_t {
     H5D_chunk_index_t             idx_type; /* Type of chunk index               */
     haddr_t                       idx_addr; /* File address of chunk index       */
@@ -491,6 +499,7 @@ typedef struct H5O_storage_chunk_t {
         H5O_storage_chunk_earray_t      earray; /* Information for extensible array index   */
         H5O_storage_chunk_farray_t      farray; /* Information for fixed array index   */
         H5O_storage_chunk_single_filt_t single; /* Information for single chunk w/ filters index */
+        H5O_storage_chunk_shard_t       shard;  /* Information for sharded chunk index */
     } u;
 } H5O_storage_chunk_t;
 
@@ -633,6 +642,11 @@ typedef struct H5O_layout_chunk_bt2_t {
     } cparam;
 } H5O_layout_chunk_bt2_t;
 
+typedef struct H5O_layout_chunk_shard_t {
+    H5O_layout_chunk_bt2_t btree2;                /* Creation parameters for v2 B-tree of shards */
+    uint32_t               dim[H5O_LAYOUT_NDIMS]; /* # of chunks per shard in each dimension */
+} H5O_layout_chunk_shard_t;
+
 typedef struct H5O_layout_chunk_t {
     H5D_chunk_index_t idx_type;                      /* Type of chunk index               */
     uint8_t           flags;                         /* Chunk layout flags                */
@@ -650,6 +664,7 @@ typedef struct H5O_layout_chunk_t {
         H5O_layout_chunk_farray_t farray; /* Information for fixed array index */
         H5O_layout_chunk_earray_t earray; /* Information for extensible array index */
         H5O_layout_chunk_bt2_t    btree2; /* Information for v2 B-tree index */
+        H5O_layout_chunk_shard_t  shard;  /* Information for sharded chunk index */
     } u;
 } H5O_layout_chunk_t;
 
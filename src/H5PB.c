@@ -677,7 +677,6 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
 {
     H5PB_t *      page_buf;                        /* Page buffering info for this file */
     H5PB_entry_t *page_entry;                      /* Pointer to the corresponding page entry */
-    H5FD_t *      file;                            /* File driver pointer */
     haddr_t       first_page_addr, last_page_addr; /* Addresses of the first and last pages covered by I/O */
     haddr_t       offset;
     haddr_t       search_addr;       /* Address of current page */
@@ -767,9 +766,6 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
         last_page_addr    = HADDR_UNDEF;
     } /* end else */
 
-    /* Translate to file driver I/O info object */
-    file = f_sh->lf;
-
     /* Copy raw data from dirty pages into the read buffer if the read
        request spans pages in the page buffer*/
     if (H5FD_MEM_DRAW == type && size >= page_buf->page_size) {
@@ -897,7 +893,7 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                         HDassert(0 == i);
 
                         /* read entire block from VFD and return */
-                        if (H5FD_read(file, type, addr, size, buf) < 0)
+                        if (H5F__fd_read(f_sh, type, addr, size, buf) < 0)
                             HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
 
                         /* Break out of loop */
@@ -926,7 +922,7 @@ H5PB_read(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, void *
                     page_size = (size_t)(eoa - search_addr);
 
                 /* Read page from VFD */
-                if (H5FD_read(file, type, search_addr, page_size, new_page_buf) < 0)
+                if (H5F__fd_read(f_sh, type, search_addr, page_size, new_page_buf) < 0)
                     HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
 
                 /* Copy the requested data from the page into the input buffer */
@@ -978,7 +974,6 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
 {
     H5PB_t *      page_buf;                        /* Page buffering info for this file */
     H5PB_entry_t *page_entry;                      /* Pointer to the corresponding page entry */
-    H5FD_t *      file;                            /* File driver pointer */
     haddr_t       first_page_addr, last_page_addr; /* Addresses of the first and last pages covered by I/O */
     haddr_t       offset;
     haddr_t       search_addr;       /* Address of current page */
@@ -1075,9 +1070,6 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
         last_page_addr    = HADDR_UNDEF;
     } /* end else */
 
-    /* Translate to file driver I/O info object */
-    file = f_sh->lf;
-
     /* Check if existing pages for raw data need to be updated since raw data access is not atomic */
     if (H5FD_MEM_DRAW == type && size >= page_buf->page_size) {
         /* For each touched page, check if it exists in the page buffer, and
@@ -1201,7 +1193,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                         HDassert(0 == i);
 
                         /* Write to VFD and return */
-                        if (H5FD_write(file, type, addr, size, buf) < 0)
+                        if (H5F__fd_write(f_sh, type, addr, size, buf) < 0)
                             HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "driver write request failed")
 
                         /* Break out of loop */
@@ -1277,7 +1269,7 @@ H5PB_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t size, const
                         page_size = (size_t)(eoa - search_addr);
 
                     if (search_addr < eof) {
-                        if (H5FD_read(file, type, search_addr, page_size, new_page_buf) < 0)
+                        if (H5F__fd_read(f_sh, type, search_addr, page_size, new_page_buf) < 0)
                             HGOTO_ERROR(H5E_PAGEBUF, H5E_READERROR, FAIL, "driver read request failed")
 
                         /* Update statistics */
@@ -1489,18 +1481,14 @@ H5PB__write_entry(H5F_shared_t *f_sh, H5PB_entry_t *page_entry)
      * the EOA, then the entire page is discarded without writing.
      */
     if (page_entry->addr <= eoa) {
-        H5FD_t *file; /* File driver I/O info */
-        size_t  page_size = f_sh->page_buf->page_size;
+        size_t page_size = f_sh->page_buf->page_size;
 
         /* Adjust the page length if it exceeds the EOA */
         if ((page_entry->addr + page_size) > eoa)
             page_size = (size_t)(eoa - page_entry->addr);
 
-        /* Translate to file driver I/O info object */
-        file = f_sh->lf;
-
-        if (H5FD_write(file, (H5FD_mem_t)page_entry->type, page_entry->addr, page_size,
-                       page_entry->page_buf_ptr) < 0)
+        if (H5F__fd_write(f_sh, (H5FD_mem_t)page_entry->type, page_entry->addr, page_size,
+                          page_entry->page_buf_ptr) < 0)
             HGOTO_ERROR(H5E_PAGEBUF, H5E_WRITEERROR, FAIL, "file write failed")
     } /* end if */
 
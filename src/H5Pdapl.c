@@ -98,6 +98,37 @@
 #define H5D_ACS_EFILE_PREFIX_COPY  H5P__dapl_efile_pref_copy
 #define H5D_ACS_EFILE_PREFIX_CMP   H5P__dapl_efile_pref_cmp
 #define H5D_ACS_EFILE_PREFIX_CLOSE H5P__dapl_efile_pref_close
+/* Definitions for number of threads used to run the chunk filter pipeline */
+#define H5D_ACS_FILTER_NTHREADS_SIZE sizeof(unsigned)
+#define H5D_ACS_FILTER_NTHREADS_DEF  1
+#define H5D_ACS_FILTER_NTHREADS_ENC  H5P__encode_unsigned
+#define H5D_ACS_FILTER_NTHREADS_DEC  H5P__decode_unsigned
+/* Definitions for the # of chunks read ahead of sequential chunk reads */
+#define H5D_ACS_PREFETCH_NCHUNKS_SIZE sizeof(size_t)
+#define H5D_ACS_PREFETCH_NCHUNKS_DEF  8
+#define H5D_ACS_PREFETCH_NCHUNKS_ENC  H5P__encode_size_t
+#define H5D_ACS_PREFETCH_NCHUNKS_DEC  H5P__decode_size_t
+/* Definitions for reading ahead of all chunk reads */
+#define H5D_ACS_PREFETCH_ALWAYS_SIZE sizeof(hbool_t)
+#define H5D_ACS_PREFETCH_ALWAYS_DEF  FALSE
+#define H5D_ACS_PREFETCH_ALWAYS_ENC  H5P__encode_hbool_t
+#define H5D_ACS_PREFETCH_ALWAYS_DEC  H5P__decode_hbool_t
+/* Definitions for the largest read of several uncached chunks */
+#define H5D_ACS_COALESCE_SIZE_SIZE sizeof(size_t)
+#define H5D_ACS_COALESCE_SIZE_DEF  (1024 * 1024)
+#define H5D_ACS_COALESCE_SIZE_ENC  H5P__encode_size_t
+#define H5D_ACS_COALESCE_SIZE_DEC  H5P__decode_size_t
+/* Definitions for the largest gap between chunks read together */
+#define H5D_ACS_COALESCE_GAP_SIZE sizeof(size_t)
+#define H5D_ACS_COALESCE_GAP_DEF  4096
+#define H5D_ACS_COALESCE_GAP_ENC  H5P__encode_size_t
+#define H5D_ACS_COALESCE_GAP_DEC  H5P__decode_size_t
+/* Definitions for the chunk cache statistics */
+#define H5D_ACS_CHUNK_CACHE_STATS_SIZE sizeof(H5D_chunk_cache_stats_t)
+#define H5D_ACS_CHUNK_CACHE_STATS_DEF                                                                        \
+    {                                                                                                        \
+        0, 0, 0                                                                                              \
+    }
 
 /******************/
 /* Local Typedefs */
@@ -174,6 +205,8 @@ const H5P_libclass_t H5P_CLS_DACC[1] = {{
 /* Property value defaults */
 static const H5D_append_flush_t H5D_def_append_flush_g =
     H5D_ACS_APPEND_FLUSH_DEF; /* Default setting for append flush */
+static const H5D_chunk_cache_stats_t H5D_def_chunk_cache_stats_g =
+    H5D_ACS_CHUNK_CACHE_STATS_DEF; /* Default (empty) chunk cache statistics */
 static const char *H5D_def_efile_prefix_g =
     H5D_ACS_EFILE_PREFIX_DEF;                                     /* Default external file prefix string */
 static const char *H5D_def_vds_prefix_g = H5D_ACS_VDS_PREFIX_DEF; /* Default vds prefix string */
@@ -193,9 +226,14 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
     size_t rdcc_nslots = H5D_ACS_DATA_CACHE_NUM_SLOTS_DEF;    /* Default raw data chunk cache # of slots */
     size_t rdcc_nbytes = H5D_ACS_DATA_CACHE_BYTE_SIZE_DEF;    /* Default raw data chunk cache # of bytes */
     double rdcc_w0     = H5D_ACS_PREEMPT_READ_CHUNKS_DEF;     /* Default raw data chunk cache dirty ratio */
-    H5D_vds_view_t virtual_view = H5D_ACS_VDS_VIEW_DEF;       /* Default VDS view option */
-    hsize_t        printf_gap   = H5D_ACS_VDS_PRINTF_GAP_DEF; /* Default VDS printf gap */
-    herr_t         ret_value    = SUCCEED;                    /* Return value */
+    H5D_vds_view_t virtual_view     = H5D_ACS_VDS_VIEW_DEF;         /* Default VDS view option */
+    hsize_t        printf_gap       = H5D_ACS_VDS_PRINTF_GAP_DEF;   /* Default VDS printf gap */
+    unsigned       filter_nthreads  = H5D_ACS_FILTER_NTHREADS_DEF;  /* Default # of chunk filter threads */
+    size_t         prefetch_nchunks = H5D_ACS_PREFETCH_NCHUNKS_DEF; /* Default # of chunks to read ahead */
+    hbool_t        prefetch_always  = H5D_ACS_PREFETCH_ALWAYS_DEF;  /* Default read ahead setting */
+    size_t         coalesce_size    = H5D_ACS_COALESCE_SIZE_DEF;    /* Default max. size of chunk reads */
+    size_t         coalesce_gap     = H5D_ACS_COALESCE_GAP_DEF;     /* Default max. gap in chunk reads */
+    herr_t         ret_value        = SUCCEED;                      /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -249,6 +287,44 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
                            H5D_ACS_EFILE_PREFIX_CLOSE) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the number of threads for the chunk filter pipeline */
+    if (H5P__register_real(pclass, H5D_ACS_FILTER_NTHREADS_NAME, H5D_ACS_FILTER_NTHREADS_SIZE,
+                           &filter_nthreads, NULL, NULL, NULL, H5D_ACS_FILTER_NTHREADS_ENC,
+                           H5D_ACS_FILTER_NTHREADS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the # of chunks to read ahead */
+    if (H5P__register_real(pclass, H5D_ACS_PREFETCH_NCHUNKS_NAME, H5D_ACS_PREFETCH_NCHUNKS_SIZE,
+                           &prefetch_nchunks, NULL, NULL, NULL, H5D_ACS_PREFETCH_NCHUNKS_ENC,
+                           H5D_ACS_PREFETCH_NCHUNKS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register whether to read ahead of all chunk reads */
+    if (H5P__register_real(pclass, H5D_ACS_PREFETCH_ALWAYS_NAME, H5D_ACS_PREFETCH_ALWAYS_SIZE,
+                           &prefetch_always, NULL, NULL, NULL, H5D_ACS_PREFETCH_ALWAYS_ENC,
+                           H5D_ACS_PREFETCH_ALWAYS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the largest read of several uncached chunks */
+    if (H5P__register_real(pclass, H5D_ACS_COALESCE_SIZE_NAME, H5D_ACS_COALESCE_SIZE_SIZE, &coalesce_size,
+                           NULL, NULL, NULL, H5D_ACS_COALESCE_SIZE_ENC, H5D_ACS_COALESCE_SIZE_DEC, NULL, NULL,
+                           NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the largest gap between chunks read together */
+    if (H5P__register_real(pclass, H5D_ACS_COALESCE_GAP_NAME, H5D_ACS_COALESCE_GAP_SIZE, &coalesce_gap, NULL,
+                           NULL, NULL, H5D_ACS_COALESCE_GAP_ENC, H5D_ACS_COALESCE_GAP_DEC, NULL, NULL, NULL,
+                           NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the chunk cache statistics */
+    /* (Note: this property should not have an encode/decode callback, it's
+     *  only set by H5Dget_access_plist) */
+    if (H5P__register_real(pclass, H5D_ACS_CHUNK_CACHE_STATS_NAME, H5D_ACS_CHUNK_CACHE_STATS_SIZE,
+                           &H5D_def_chunk_cache_stats_g, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+                           NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dacc_reg_prop() */
@@ -850,6 +926,269 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_chunk_cache() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_filter_threads
+ *
+ * Purpose:     Sets the number of threads used to run the filter pipeline
+ *              on the chunks of a dataset.  When more than one thread is
+ *              requested, chunks that are read from or written to the
+ *              file in the same I/O operation (or flushed from the chunk
+ *              cache together) are filtered concurrently.
+ *
+ *              Only has an effect when the library is built thread-safe;
+ *              otherwise the chunks are always filtered one at a time.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_filter_threads(hid_t dapl_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", dapl_id, nthreads);
+
+    /* Check arguments */
+    if (nthreads == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be at least 1");
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Set the value */
+    if (H5P_set(plist, H5D_ACS_FILTER_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set number of chunk filter threads");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_filter_threads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_filter_threads
+ *
+ * Purpose:     Retrieves the number of threads used to run the filter
+ *              pipeline on the chunks of a dataset.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_filter_threads(hid_t dapl_id, unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", dapl_id, nthreads);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get the value */
+    if (nthreads)
+        if (H5P_get(plist, H5D_ACS_FILTER_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get number of chunk filter threads");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_filter_threads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_prefetch
+ *
+ * Purpose:     Sets how many chunks of a dataset are read ahead when its
+ *              chunks are read in order.  When a chunk that isn't in the
+ *              chunk cache is read right after the chunk before it, the
+ *              next NCHUNKS chunks are read from the file along with it,
+ *              in as few I/O requests as possible, and put in the chunk
+ *              cache.  If ALWAYS is TRUE, chunks are read ahead of every
+ *              chunk read from the file, in order or not.
+ *
+ *              Setting NCHUNKS to 0 turns reading ahead off.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_prefetch(hid_t dapl_id, size_t nchunks, hbool_t always)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "izb", dapl_id, nchunks, always);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Set the values */
+    if (H5P_set(plist, H5D_ACS_PREFETCH_NCHUNKS_NAME, &nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set number of chunks to read ahead");
+    if (H5P_set(plist, H5D_ACS_PREFETCH_ALWAYS_NAME, &always) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set whether to always read ahead");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_prefetch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_prefetch
+ *
+ * Purpose:     Retrieves how many chunks of a dataset are read ahead, and
+ *              whether that's done for every chunk read or only when the
+ *              chunks are read in order.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_prefetch(hid_t dapl_id, size_t *nchunks /*out*/, hbool_t *always /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", dapl_id, nchunks, always);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get the values */
+    if (nchunks)
+        if (H5P_get(plist, H5D_ACS_PREFETCH_NCHUNKS_NAME, nchunks) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get number of chunks to read ahead");
+    if (always)
+        if (H5P_get(plist, H5D_ACS_PREFETCH_ALWAYS_NAME, always) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get whether to always read ahead");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_prefetch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_coalesce
+ *
+ * Purpose:     Sets how chunks of a dataset that are read without going
+ *              through the chunk cache are combined into larger reads.
+ *              The chunks selected by a read are sorted by address in the
+ *              file, and chunks that are no more than MAX_GAP bytes apart
+ *              are read together, with the data between them, in reads
+ *              of no more than MAX_SIZE bytes.
+ *
+ *              Setting MAX_SIZE to 0 reads the chunks one at a time.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_coalesce(hid_t dapl_id, size_t max_size, size_t max_gap)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "izz", dapl_id, max_size, max_gap);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Set the values */
+    if (H5P_set(plist, H5D_ACS_COALESCE_SIZE_NAME, &max_size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set largest read of several chunks");
+    if (H5P_set(plist, H5D_ACS_COALESCE_GAP_NAME, &max_gap) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set largest gap between chunks read together");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_coalesce() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_coalesce
+ *
+ * Purpose:     Retrieves the largest read of several chunks that bypass
+ *              the chunk cache, and the largest gap between the chunks
+ *              that are read together.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_coalesce(hid_t dapl_id, size_t *max_size /*out*/, size_t *max_gap /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", dapl_id, max_size, max_gap);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get the values */
+    if (max_size)
+        if (H5P_get(plist, H5D_ACS_COALESCE_SIZE_NAME, max_size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get largest read of several chunks");
+    if (max_gap)
+        if (H5P_get(plist, H5D_ACS_COALESCE_GAP_NAME, max_gap) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get largest gap between chunks read together");
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_coalesce() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_cache_stats
+ *
+ * Purpose:     Retrieves the statistics of a dataset's raw data chunk
+ *              cache: the number of chunks that were found in the cache
+ *              (hits), that had to be read or created (misses), and that
+ *              were evicted from the cache to make room for other chunks,
+ *              since the dataset was opened.
+ *
+ *              The statistics are only set in the property lists
+ *              returned by H5Dget_access_plist(); they are all zero in
+ *              other dataset access property lists.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_cache_stats(hid_t dapl_id, unsigned *nhits /*out*/, unsigned *nmisses /*out*/,
+                         unsigned *nevictions /*out*/)
+{
+    H5P_genplist_t *        plist;               /* Property list pointer */
+    H5D_chunk_cache_stats_t stats;               /* Chunk cache statistics */
+    herr_t                  ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", dapl_id, nhits, nmisses, nevictions);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID");
+
+    /* Get the values */
+    if (H5P_get(plist, H5D_ACS_CHUNK_CACHE_STATS_NAME, &stats) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk cache statistics");
+    if (nhits)
+        *nhits = stats.nhits;
+    if (nmisses)
+        *nmisses = stats.nmisses;
+    if (nevictions)
+        *nevictions = stats.nevictions;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_cache_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:       H5P__encode_chunk_cache_nslots
  *
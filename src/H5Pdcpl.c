@@ -2813,6 +2813,128 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_chunk_opts() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_shard
+ *
+ * Purpose:     Stores the chunks of a dataset in shards of DIM chunks in
+ *              each dimension, indexed by a v2 B-tree of shards.  The
+ *              storage must already be set to chunked, with NDIMS
+ *              dimensions.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_shard(hid_t plist_id, int ndims, const hsize_t dim[/*ndims*/])
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    H5O_layout_t    layout;              /* Layout information for setting shard info */
+    unsigned        u;                   /* Local index variable */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iIs*[a1]h", plist_id, ndims, dim);
+
+    /* Check arguments */
+    if (ndims <= 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "shard dimensionality must be positive")
+    if (!dim)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no shard dimensions specified")
+
+#ifndef H5_HAVE_C99_DESIGNATED_INITIALIZER
+    /* If the compiler doesn't support C99 designated initializers, check if
+     *  the default layout structs have been initialized yet or not.  *ick* -QAK
+     */
+    if (!H5P_dcrt_def_layout_init_g)
+        if (H5P__init_def_layout() < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTINIT, FAIL, "can't initialize default layout info")
+#endif /* H5_HAVE_C99_DESIGNATED_INITIALIZER */
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Retrieve the layout property */
+    if (H5P_peek(plist, H5D_CRT_LAYOUT_NAME, &layout) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't get layout")
+    if (H5D_CHUNKED != layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a chunked storage layout")
+    if ((unsigned)ndims != layout.u.chunk.ndims)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "shard dimensionality doesn't match chunk dimensionality")
+
+    /* Set the shard dimensions */
+    for (u = 0; u < (unsigned)ndims; u++) {
+        if (dim[u] == 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "all shard dimensions must be positive")
+        if (dim[u] != (dim[u] & 0xffffffff))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "all shard dimensions must be less than 2^32")
+        layout.u.chunk.u.shard.dim[u] = (uint32_t)dim[u];
+    } /* end for */
+
+    /* Update the layout message, including the version (if necessary) */
+    layout.u.chunk.idx_type = H5D_CHUNK_IDX_SHARD;
+    if (layout.version < H5O_LAYOUT_VERSION_4)
+        layout.version = H5O_LAYOUT_VERSION_4;
+
+    /* Set layout value */
+    if (H5P_poke(plist, H5D_CRT_LAYOUT_NAME, &layout) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINIT, FAIL, "can't set layout")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_shard() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_shard
+ *
+ * Purpose:     Retrieves the number of chunks per shard in each dimension
+ *              of a sharded chunked layout.  At most MAX_NDIMS elements
+ *              of DIM will be initialized.
+ *
+ * Return:      Success:    Shard dimensionality, or zero if the chunks
+ *                          aren't sharded
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5Pget_chunk_shard(hid_t plist_id, int max_ndims, hsize_t dim[] /*out*/)
+{
+    H5P_genplist_t *plist;         /* Property list pointer */
+    H5O_layout_t    layout;        /* Layout information */
+    int             ret_value = 0; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("Is", "iIsx", plist_id, max_ndims, dim);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Peek at the layout property */
+    if (H5P_peek(plist, H5D_CRT_LAYOUT_NAME, &layout) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't get layout")
+    if (H5D_CHUNKED != layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a chunked storage layout")
+
+    if (H5D_CHUNK_IDX_SHARD == layout.u.chunk.idx_type) {
+        if (dim) {
+            unsigned u; /* Local index variable */
+
+            /* Get the dimension sizes */
+            for (u = 0; u < layout.u.chunk.ndims && u < (unsigned)max_ndims; u++)
+                dim[u] = layout.u.chunk.u.shard.dim[u];
+        } /* end if */
+
+        /* Set the return value */
+        ret_value = (int)layout.u.chunk.ndims;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_shard() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_external
  *
@@ -3107,6 +3229,52 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pset_shuffle() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_bitshuffle
+ *
+ * Purpose:	Sets the shuffle filter, H5Z_FILTER_SHUFFLE, to shuffle the
+ *		bits of the datatype of the array, as well as its bytes
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_bitshuffle(hid_t plist_id)
+{
+    H5O_pline_t     pline;
+    H5P_genplist_t *plist;                                   /* Property list pointer */
+    unsigned        cd_values[H5Z_SHUFFLE_TOTAL_NPARMS + 1]; /* Filter parameters */
+    herr_t          ret_value = SUCCEED;                     /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", plist_id);
+
+    /* Check arguments */
+    if (TRUE != H5P_isa_class(plist_id, H5P_DATASET_CREATE))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset creation property list")
+
+    /* Get the plist structure */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set the mode (the element size is set for each dataset) */
+    cd_values[0] = 0;
+    cd_values[1] = H5Z_SHUFFLE_BIT;
+
+    /* Add the filter */
+    if (H5P_peek(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get pipeline")
+    if (H5Z_append(&pline, H5Z_FILTER_SHUFFLE, H5Z_FLAG_OPTIONAL, (size_t)(H5Z_SHUFFLE_TOTAL_NPARMS + 1),
+                   cd_values) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to shuffle the data")
+    if (H5P_poke(plist, H5O_CRT_PIPELINE_NAME, &pline) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "unable to set pipeline")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_bitshuffle() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_nbit
  *
@@ -76,6 +76,16 @@
 #define H5F_ACS_PREEMPT_READ_CHUNKS_DEF  0.75f
 #define H5F_ACS_PREEMPT_READ_CHUNKS_ENC  H5P__encode_double
 #define H5F_ACS_PREEMPT_READ_CHUNKS_DEC  H5P__decode_double
+/* Definition for size of chunk index cache (entries) */
+#define H5F_ACS_CHUNK_IDX_CACHE_NENTS_SIZE sizeof(size_t)
+#define H5F_ACS_CHUNK_IDX_CACHE_NENTS_DEF  8192
+#define H5F_ACS_CHUNK_IDX_CACHE_NENTS_ENC  H5P__encode_size_t
+#define H5F_ACS_CHUNK_IDX_CACHE_NENTS_DEC  H5P__decode_size_t
+/* Definition for size of shared raw data chunk cache (bytes) */
+#define H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_SIZE sizeof(size_t)
+#define H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_DEF  0
+#define H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_ENC  H5P__encode_size_t
+#define H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_DEC  H5P__decode_size_t
 /* Definition for threshold for alignment */
 #define H5F_ACS_ALIGN_THRHD_SIZE sizeof(hsize_t)
 #define H5F_ACS_ALIGN_THRHD_DEF  H5F_ALIGN_THRHD_DEF
@@ -438,6 +448,10 @@ static const size_t H5F_def_rdcc_nbytes_g =
     H5F_ACS_DATA_CACHE_BYTE_SIZE_DEF; /* Default raw data chunk cache # of bytes */
 static const double H5F_def_rdcc_w0_g =
     H5F_ACS_PREEMPT_READ_CHUNKS_DEF; /* Default raw data chunk cache dirty ratio */
+static const size_t H5F_def_chunk_idx_cache_nents_g =
+    H5F_ACS_CHUNK_IDX_CACHE_NENTS_DEF; /* Default chunk index cache # of entries */
+static const size_t H5F_def_shared_chunk_cache_nbytes_g =
+    H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_DEF; /* Default shared raw data chunk cache # of bytes */
 static const hsize_t H5F_def_threshold_g =
     H5F_ACS_ALIGN_THRHD_DEF;                                  /* Default allocation alignment threshold */
 static const hsize_t H5F_def_alignment_g = H5F_ACS_ALIGN_DEF; /* Default allocation alignment value */
@@ -553,6 +567,20 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            H5F_ACS_PREEMPT_READ_CHUNKS_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the size of the chunk index cache (entries) */
+    if (H5P__register_real(pclass, H5F_ACS_CHUNK_IDX_CACHE_NENTS_NAME, H5F_ACS_CHUNK_IDX_CACHE_NENTS_SIZE,
+                           &H5F_def_chunk_idx_cache_nents_g, NULL, NULL, NULL,
+                           H5F_ACS_CHUNK_IDX_CACHE_NENTS_ENC, H5F_ACS_CHUNK_IDX_CACHE_NENTS_DEC, NULL, NULL,
+                           NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the size of the shared raw data chunk cache (bytes) */
+    if (H5P__register_real(pclass, H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_NAME,
+                           H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_SIZE, &H5F_def_shared_chunk_cache_nbytes_g, NULL,
+                           NULL, NULL, H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_ENC,
+                           H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the threshold for alignment */
     if (H5P__register_real(pclass, H5F_ACS_ALIGN_THRHD_NAME, H5F_ACS_ALIGN_THRHD_SIZE, &H5F_def_threshold_g,
                            NULL, NULL, NULL, H5F_ACS_ALIGN_THRHD_ENC, H5F_ACS_ALIGN_THRHD_DEC, NULL, NULL,
@@ -1756,6 +1784,137 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_cache() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_index_cache
+ *
+ * Purpose:     Sets the maximum number of entries in the file's chunk
+ *              index cache, which remembers the file address, size and
+ *              filter mask of the chunks looked up in the chunk indexes
+ *              of the file's datasets, across dataset opens and closes.
+ *              A value of zero disables the cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_index_cache(hid_t fapl_id, size_t nentries)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", fapl_id, nentries);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set the value */
+    if (H5P_set(plist, H5F_ACS_CHUNK_IDX_CACHE_NENTS_NAME, &nentries) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk index cache size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_index_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_index_cache
+ *
+ * Purpose:     Retrieves the maximum number of entries in the file's
+ *              chunk index cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_index_cache(hid_t fapl_id, size_t *nentries /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, nentries);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get the value */
+    if (nentries)
+        if (H5P_get(plist, H5F_ACS_CHUNK_IDX_CACHE_NENTS_NAME, nentries) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk index cache size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_index_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_shared_chunk_cache
+ *
+ * Purpose:     Sets the size, in bytes, of a raw data chunk cache shared
+ *              by all the chunked datasets of the file.  When it's set,
+ *              the datasets' chunks are kept in one fully associative
+ *              least-recently-used cache with this byte budget instead
+ *              of in a separate cache per dataset (see H5Pset_cache()
+ *              and H5Pset_chunk_cache(), whose byte sizes are then only
+ *              used to turn the cache off for a dataset, with zero).
+ *              A value of zero (the default) disables the shared cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_shared_chunk_cache(hid_t fapl_id, size_t nbytes)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", fapl_id, nbytes);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set the value */
+    if (H5P_set(plist, H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_NAME, &nbytes) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set shared chunk cache size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_shared_chunk_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_shared_chunk_cache
+ *
+ * Purpose:     Retrieves the size, in bytes, of the raw data chunk cache
+ *              shared by all the chunked datasets of the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_shared_chunk_cache(hid_t fapl_id, size_t *nbytes /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, nbytes);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get the value */
+    if (nbytes)
+        if (H5P_get(plist, H5F_ACS_SHARED_CHUNK_CACHE_NBYTES_NAME, nbytes) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get shared chunk cache size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_shared_chunk_cache() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_mdc_image_config
  *
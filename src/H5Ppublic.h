@@ -3170,6 +3170,25 @@ H5_DLL herr_t H5Pget_alignment(hid_t fapl_id, hsize_t *threshold /*out*/, hsize_
  */
 H5_DLL herr_t H5Pget_cache(hid_t plist_id, int *mdc_nelmts, /* out */
                            size_t *rdcc_nslots /*out*/, size_t *rdcc_nbytes /*out*/, double *rdcc_w0);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves the size of the chunk index cache
+ *
+ * \fapl_id
+ * \param[out] nentries Maximum number of entries in the chunk index cache
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_chunk_index_cache() retrieves the maximum number of
+ *          chunk records kept in the chunk index cache of files opened
+ *          with the file access property list \p fapl_id, as set with
+ *          H5Pset_chunk_index_cache().
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_chunk_index_cache(hid_t fapl_id, size_t *nentries /*out*/);
 /**
  * \ingroup FAPL
  *
@@ -3513,6 +3532,27 @@ H5_DLL herr_t H5Pget_multi_type(hid_t fapl_id, H5FD_mem_t *type);
 H5_DLL herr_t H5Pget_object_flush_cb(hid_t plist_id, H5F_flush_cb_t *func, void **udata);
 H5_DLL herr_t H5Pget_page_buffer_size(hid_t plist_id, size_t *buf_size, unsigned *min_meta_per,
                                       unsigned *min_raw_per);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves the size of the raw data chunk cache shared by the
+ *        datasets of a file
+ *
+ * \fapl_id
+ * \param[out] nbytes Size of the shared chunk cache, in bytes
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_shared_chunk_cache() retrieves the size of the raw data
+ *          chunk cache shared by the chunked datasets of files opened
+ *          with the file access property list \p fapl_id, as set with
+ *          H5Pset_shared_chunk_cache().  A size of 0 means that each
+ *          dataset has its own chunk cache.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_shared_chunk_cache(hid_t fapl_id, size_t *nbytes /*out*/);
 H5_DLL herr_t H5Pget_sieve_buf_size(hid_t fapl_id, size_t *size /*out*/);
 H5_DLL herr_t H5Pget_small_data_block_size(hid_t fapl_id, hsize_t *size /*out*/);
 /**
@@ -3684,6 +3724,38 @@ H5_DLL herr_t H5Pset_alignment(hid_t fapl_id, hsize_t threshold, hsize_t alignme
  */
 H5_DLL herr_t H5Pset_cache(hid_t plist_id, int mdc_nelmts, size_t rdcc_nslots, size_t rdcc_nbytes,
                            double rdcc_w0);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets the size of the chunk index cache
+ *
+ * \fapl_id
+ * \param[in] nentries Maximum number of entries in the chunk index cache
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_chunk_index_cache() sets the maximum number of chunk
+ *          records kept in the chunk index cache of files opened with the
+ *          file access property list \p fapl_id. The default is 8192;
+ *          0 disables the cache.
+ *
+ *          Each record holds the file address, size and filter mask of a
+ *          chunk that was looked up in the chunk index (B-tree, fixed
+ *          array or extensible array) of a dataset. The cache belongs to
+ *          the file rather than to the dataset, so when a dataset is
+ *          closed and opened again, its chunks are found without searching
+ *          the chunk index again. When the cache is full, the least
+ *          recently used record is evicted. A record takes about 100 bytes.
+ *
+ *          The cache is not used with files opened for SWMR reading, or
+ *          with an MPI file driver.
+ *
+ * \see H5Pset_cache(), H5Pset_chunk_cache()
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_chunk_index_cache(hid_t fapl_id, size_t nentries);
 H5_DLL herr_t H5Pset_core_write_tracking(hid_t fapl_id, hbool_t is_enabled, size_t page_size);
 /**
  * \ingroup FAPL
@@ -3780,6 +3852,51 @@ H5_DLL herr_t H5Pset_file_image(hid_t fapl_id, void *buf_ptr, size_t buf_len);
 H5_DLL herr_t H5Pset_file_image_callbacks(hid_t fapl_id, H5FD_file_image_callbacks_t *callbacks_ptr);
 H5_DLL herr_t H5Pset_file_locking(hid_t fapl_id, hbool_t use_file_locking, hbool_t ignore_when_disabled);
 H5_DLL herr_t H5Pset_gc_references(hid_t fapl_id, unsigned gc_ref);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets the size of a raw data chunk cache shared by the datasets
+ *        of a file
+ *
+ * \fapl_id
+ * \param[in] nbytes Size of the shared chunk cache, in bytes
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_shared_chunk_cache() sets the size, in bytes, of a raw
+ *          data chunk cache shared by all the chunked datasets of files
+ *          opened with the file access property list \p fapl_id.  The
+ *          default is 0, where each dataset has its own chunk cache.
+ *
+ *          By default, each open dataset has a chunk cache whose size is
+ *          set with H5Pset_cache() or H5Pset_chunk_cache(), so the memory
+ *          used for chunks grows with the number of open datasets.  With
+ *          a shared cache, the chunks of all the datasets are kept within
+ *          the one budget of \p nbytes bytes: when room is needed, the
+ *          least recently used chunk of any dataset is evicted (and
+ *          written to the file first, if it was modified).
+ *
+ *          Each chunk of a dataset may then be cached in any of a set of
+ *          8 slots of the dataset's hash table, so that chunks whose hash
+ *          values collide don't keep evicting each other.  The number of
+ *          hash table slots is still set with H5Pset_cache() or
+ *          H5Pset_chunk_cache(); the byte sizes set with them are no
+ *          longer used, except that a size (or number of slots) of 0
+ *          still turns off chunk caching for a dataset.  The
+ *          preemption policy \c w0 isn't used either.
+ *
+ *          The numbers of chunk cache hits, misses and evictions of a
+ *          dataset can be retrieved with H5Pget_chunk_cache_stats() from
+ *          the property list returned by H5Dget_access_plist().
+ *
+ *          The shared cache isn't used with the MPI file drivers.
+ *
+ * \see H5Pset_cache(), H5Pset_chunk_cache(), H5Pget_chunk_cache_stats()
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_shared_chunk_cache(hid_t fapl_id, size_t nbytes);
 /**
  * \ingroup FAPL
  *
@@ -4084,6 +4201,28 @@ H5_DLL int H5Pget_chunk(hid_t plist_id, int max_ndims, hsize_t dim[] /*out*/);
  *
  */
 H5_DLL herr_t H5Pget_chunk_opts(hid_t plist_id, unsigned *opts);
+/**
+ * \ingroup DCPL
+ *
+ * \brief Retrieves the number of chunks per shard of a dataset with a
+ *        sharded chunk index
+ *
+ * \dcpl_id{plist_id}
+ * \param[in] max_ndims Size of the \p dim array
+ * \param[out] dim Array to store the number of chunks per shard in each
+ *                 dimension
+ *
+ * \return Returns the shard dimensionality if successful, zero if the
+ *         chunks aren't stored in shards, and a negative value otherwise.
+ *
+ * \details H5Pget_chunk_shard() retrieves the number of chunks per shard
+ *          set with H5Pset_chunk_shard(). At most, \p max_ndims elements
+ *          of \p dim will be initialized.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL int H5Pget_chunk_shard(hid_t plist_id, int max_ndims, hsize_t dim[] /*out*/);
 /**
  * \ingroup DCPL
  *
@@ -4571,6 +4710,44 @@ H5_DLL herr_t H5Pset_chunk(hid_t plist_id, int ndims, const hsize_t dim[/*ndims*
  *
  */
 H5_DLL herr_t H5Pset_chunk_opts(hid_t plist_id, unsigned opts);
+/**
+ * \ingroup DCPL
+ *
+ * \brief Stores the chunks of a dataset in shards of several chunks
+ *
+ * \dcpl_id{plist_id}
+ * \param[in] ndims The number of dimensions of each shard
+ * \param[in] dim An array defining the number of chunks per shard in
+ *                each dimension
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_chunk_shard() groups the chunks of a dataset into
+ *          shards of \p dim chunks in each dimension. Each shard is
+ *          stored in one block of the file, starting with a table of its
+ *          chunks, and the dataset's chunk index holds one record per
+ *          shard rather than one per chunk. This keeps the index small,
+ *          and chunks that are close together in the dataset close
+ *          together in the file, for datasets with very many small
+ *          chunks.
+ *
+ *          The storage must already be set to chunked with H5Pset_chunk(),
+ *          with \p ndims dimensions. Calling H5Pset_chunk() again resets
+ *          this setting.
+ *
+ *          Unfiltered chunks have a fixed place in their shard, which is
+ *          allocated whole. Filtered chunks are appended to their shard,
+ *          which grows up to the size of the unfiltered shard; a shard
+ *          must be smaller than 4GB.
+ *
+ *          Datasets with sharded chunks can't be read by earlier versions
+ *          of the library, and can't be written with SWMR or parallel
+ *          I/O.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_chunk_shard(hid_t plist_id, int ndims, const hsize_t dim[/*ndims*/]);
 /**
  * \ingroup DCPL
  *
@@ -4770,6 +4947,40 @@ H5_DLL herr_t H5Pset_fill_value(hid_t plist_id, hid_t type_id, const void *value
  *
  */
 H5_DLL herr_t H5Pset_shuffle(hid_t plist_id);
+/**
+ * \ingroup DCPL
+ *
+ * \brief Sets up use of the shuffle filter in bit shuffle mode
+ *
+ * \dcpl_id{plist_id}
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_bitshuffle() sets the shuffle filter, #H5Z_FILTER_SHUFFLE,
+ *          in the dataset creation property list \p plist_id, like
+ *          H5Pset_shuffle(), but with the #H5Z_SHUFFLE_BIT mode. After the
+ *          bytes of the data elements are shuffled, the bits in each block
+ *          of bytes from one byte position are shuffled in the same way:
+ *          bit 0 of every byte in the block is placed first, then bit 1 of
+ *          every byte, etc. For data whose values only use a few of the
+ *          bits in each byte position, this gives a compression filter
+ *          long runs of identical bytes to work with. The bits of the last
+ *          (n % 8) bytes in each block of n bytes are not shuffled.
+ *
+ *          Unlike the byte shuffle mode, the bit shuffle mode also applies
+ *          to 1-byte datatypes.
+ *
+ *          The same mode may be set with H5Pset_filter(), with the two
+ *          filter parameters {0, #H5Z_SHUFFLE_BIT} (the first parameter is
+ *          replaced by the datatype size).
+ *
+ *          Datasets written with the bit shuffle mode cannot be read by
+ *          versions of the library before 1.13.0.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_bitshuffle(hid_t plist_id);
 /**
  * \ingroup DCPL
  *
@@ -5230,6 +5441,96 @@ H5_DLL herr_t H5Pget_append_flush(hid_t dapl_id, unsigned dims, hsize_t boundary
  */
 H5_DLL herr_t H5Pget_chunk_cache(hid_t dapl_id, size_t *rdcc_nslots /*out*/, size_t *rdcc_nbytes /*out*/,
                                  double *rdcc_w0 /*out*/);
+/**
+ * \ingroup DAPL
+ *
+ * \brief Retrieves the statistics of a dataset's raw data chunk cache
+ *
+ * \dapl_id
+ * \param[out] nhits      Number of chunks found in the cache
+ * \param[out] nmisses    Number of chunks read from the file into the cache
+ * \param[out] nevictions Number of chunks evicted to make room for others
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_chunk_cache_stats() retrieves the numbers of hits,
+ *          misses and evictions of a dataset's raw data chunk cache since
+ *          the dataset was opened, from the dataset access property list
+ *          \p dapl_id returned by H5Dget_access_plist().  Writing a whole
+ *          chunk that isn't in the cache is counted as a hit, since it
+ *          doesn't need to be read.  When the file has a shared chunk
+ *          cache (see H5Pset_shared_chunk_cache()), the evictions of a
+ *          dataset's chunks include those made to make room for the
+ *          chunks of other datasets.
+ *
+ *          The statistics are all zero in other dataset access property
+ *          lists.  Any of the pointer arguments may be null pointers, in
+ *          which case the corresponding value is not returned.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_chunk_cache_stats(hid_t dapl_id, unsigned *nhits /*out*/, unsigned *nmisses /*out*/,
+                                       unsigned *nevictions /*out*/);
+/**
+ * \ingroup DAPL
+ *
+ * \brief Retrieves the number of threads used to filter dataset chunks
+ *
+ * \dapl_id
+ * \param[out] nthreads Number of threads
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_chunk_filter_threads() retrieves the number of threads
+ *          set with H5Pset_chunk_filter_threads() on the dataset access
+ *          property list \p dapl_id.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_chunk_filter_threads(hid_t dapl_id, unsigned *nthreads /*out*/);
+/**
+ * \ingroup DAPL
+ *
+ * \brief Retrieves the read-ahead settings for dataset chunks
+ *
+ * \dapl_id
+ * \param[out] nchunks Number of chunks read ahead
+ * \param[out] always  Whether chunks are read ahead of every chunk read,
+ *                     rather than only when chunks are read in order
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_chunk_prefetch() retrieves the settings made with
+ *          H5Pset_chunk_prefetch() on the dataset access property list
+ *          \p dapl_id. Either pointer may be null, in which case the
+ *          corresponding value is not returned.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_chunk_prefetch(hid_t dapl_id, size_t *nchunks /*out*/, hbool_t *always /*out*/);
+/**
+ * \ingroup DAPL
+ *
+ * \brief Retrieves how uncached dataset chunks are combined into larger
+ *        reads
+ *
+ * \dapl_id
+ * \param[out] max_size Largest read of several chunks, in bytes
+ * \param[out] max_gap  Largest gap between chunks read together, in bytes
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_chunk_coalesce() retrieves the settings made with
+ *          H5Pset_chunk_coalesce() on the dataset access property list
+ *          \p dapl_id.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_chunk_coalesce(hid_t dapl_id, size_t *max_size /*out*/, size_t *max_gap /*out*/);
 /**
  * \ingroup DAPL
  *
@@ -5555,6 +5856,113 @@ H5_DLL herr_t H5Pset_append_flush(hid_t dapl_id, unsigned ndims, const hsize_t b
  *
  */
 H5_DLL herr_t H5Pset_chunk_cache(hid_t dapl_id, size_t rdcc_nslots, size_t rdcc_nbytes, double rdcc_w0);
+/**
+ * \ingroup DAPL
+ *
+ * \brief Sets the number of threads used to filter dataset chunks
+ *
+ * \dapl_id
+ * \param[in] nthreads Number of threads; must be at least 1
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_chunk_filter_threads() sets the number of threads used
+ *          to run the filter pipeline (e.g. compression) on the chunks of
+ *          a dataset. The default is 1, which filters chunks one at a time
+ *          in the calling thread.
+ *
+ *          With a larger value, the chunks that are read from the file by
+ *          a single H5Dread() call, and the chunks that are written out by
+ *          a single H5Dwrite() call or by flushing the chunk cache, are
+ *          filtered concurrently. The file I/O itself is still performed
+ *          by the calling thread.
+ *
+ *          All filters in the dataset's pipeline must be safe to call
+ *          from several threads at once.
+ *
+ * \note This setting only has an effect when the library is built with
+ *       thread-safety enabled; otherwise it is accepted and ignored.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_chunk_filter_threads(hid_t dapl_id, unsigned nthreads);
+/**
+ * \ingroup DAPL
+ *
+ * \brief Sets how many dataset chunks are read ahead
+ *
+ * \dapl_id
+ * \param[in] nchunks Number of chunks to read ahead; 0 turns reading
+ *                    ahead off
+ * \param[in] always  Whether to read ahead of every chunk read, rather
+ *                    than only when chunks are read in order
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_chunk_prefetch() sets how many chunks of a dataset are
+ *          read ahead of the chunk being read. The default is 8 chunks,
+ *          read ahead only when chunks are read in order.
+ *
+ *          When a chunk that isn't in the chunk cache is read right after
+ *          the chunk before it, in the order the chunks are stored in the
+ *          dataset's dataspace (the last dimension changing fastest), or
+ *          is the first chunk, the next \p nchunks chunks that are in the file but not in the
+ *          chunk cache are read along with it. The chunks are read in
+ *          order of their addresses in the file, so that file drivers
+ *          can combine adjacent chunks into single large reads, and they
+ *          are all run through the filter pipeline at once, using the
+ *          threads set with H5Pset_chunk_filter_threads(). They are then
+ *          put in the chunk cache, where the following reads find them.
+ *
+ *          If \p always is \c TRUE, chunks are read ahead of every chunk
+ *          read from the file, which helps when an application knows it
+ *          will read a dataset in order from a chunk other than the first.
+ *
+ * \note No more chunks are read ahead than fill half of the chunk cache
+ *       (see H5Pset_chunk_cache()), and chunks are not read ahead into
+ *       cache slots that are in use. Chunks are not read ahead with file
+ *       drivers based on MPI.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_chunk_prefetch(hid_t dapl_id, size_t nchunks, hbool_t always);
+/**
+ * \ingroup DAPL
+ *
+ * \brief Sets how uncached dataset chunks are combined into larger reads
+ *
+ * \dapl_id
+ * \param[in] max_size Largest read of several chunks, in bytes; 0 reads
+ *                     the chunks one at a time
+ * \param[in] max_gap  Largest gap between chunks read together, in bytes
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_chunk_coalesce() sets how the chunks of a dataset that
+ *          are read without going through the chunk cache are combined
+ *          into larger reads. The defaults are 1 MiB and 4 KiB.
+ *
+ *          Chunks that have no filters and don't fit in the chunk cache
+ *          (see H5Pset_chunk_cache()) are read straight from the file.
+ *          When H5Dread() selects several of them, they are sorted by
+ *          their addresses in the file, and chunks that are no more than
+ *          \p max_gap bytes apart are read with a single request, along
+ *          with the data between them, as long as the request is no
+ *          larger than \p max_size bytes. This turns many small reads
+ *          into a few large ones when a dataset's chunks are stored next
+ *          to each other, which matters most on storage with slow seeks.
+ *
+ *          Chunks are always read whole when they are combined, even if
+ *          only part of each chunk is selected.
+ *
+ * \note Chunks are not combined with file drivers based on MPI.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_chunk_coalesce(hid_t dapl_id, size_t max_size, size_t max_gap);
 /**
  * \ingroup DAPL
  *
@@ -52,12 +52,22 @@ typedef struct H5TS_cancel_struct {
 /* Function pointer typedef for thread callback function */
 typedef void *(*H5TS_thread_cb_t)(void *);
 
+/* Set of tasks shared by the threads in H5TS_run_tasks() */
+typedef struct H5TS_tasks_t {
+    H5TS_mutex_simple_t lock;      /* Protects 'next' */
+    size_t              next;      /* Index of the next task to run */
+    size_t              ntasks;    /* Number of tasks */
+    H5TS_task_cb_t      op;        /* Callback for each task */
+    void *              op_data;   /* User data for callback */
+} H5TS_tasks_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
 static void   H5TS__key_destructor(void *key_val);
 static herr_t H5TS__mutex_acquire(H5TS_mutex_t *mutex, unsigned int lock_count, hbool_t *acquired);
 static herr_t H5TS__mutex_unlock(H5TS_mutex_t *mutex, unsigned int *lock_count);
+static void * H5TS__task_worker(void *_tasks);
 
 /*********************/
 /* Package Variables */
@@ -81,6 +91,9 @@ H5TS_key_t H5TS_funcstk_key_g; /* Function stack */
 #endif                         /* H5_HAVE_CODESTACK */
 H5TS_key_t H5TS_apictx_key_g;  /* API context */
 
+/* Locks, used by other interfaces */
+H5TS_mutex_simple_t H5TS_ids_lock_g; /* ID tables */
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -289,6 +302,8 @@ H5TS_thread_id(void)
 void
 H5TS_pthread_first_thread_init(void)
 {
+    pthread_mutexattr_t ids_attr; /* Attributes for ID table lock */
+
     H5_g.H5_libinit_g = FALSE; /* Library hasn't been initialized */
     H5_g.H5_libterm_g = FALSE; /* Library isn't being shutdown */
 
@@ -308,6 +323,12 @@ H5TS_pthread_first_thread_init(void)
     HDpthread_mutex_init(&H5_g.init_lock.atomic_lock2, NULL);
     H5_g.init_lock.attempt_lock_count = 0;
 
+    /* initialize the (recursive) lock for the ID tables */
+    HDpthread_mutexattr_init(&ids_attr);
+    HDpthread_mutexattr_settype(&ids_attr, PTHREAD_MUTEX_RECURSIVE);
+    HDpthread_mutex_init(&H5TS_ids_lock_g, &ids_attr);
+    HDpthread_mutexattr_destroy(&ids_attr);
+
     /* Initialize integer thread identifiers. */
     H5TS_tid_init();
 
@@ -586,6 +607,60 @@ done:
     FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
 } /* H5TS_mutex_unlock */
 
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_mutex_yield
+ *
+ * USAGE
+ *    H5TS_mutex_yield(&mutex_var, &yielded)
+ *
+ * RETURNS
+ *    Non-negative on success / Negative on failure
+ *
+ * DESCRIPTION
+ *    Release a recursive lock held exactly once by this thread, so that
+ *    other threads can take it while this thread blocks on something
+ *    else.  When 'yielded' is returned TRUE, the caller must take the
+ *    lock again with H5TS_mutex_lock().  A lock that isn't held by this
+ *    thread, or that is held more than once (i.e. the thread is inside
+ *    a callback from the library), is left alone.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_mutex_yield(H5TS_mutex_t *mutex, hbool_t *yielded)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NAMECHECK_ONLY
+
+    *yielded = FALSE;
+
+#ifndef H5_HAVE_WIN_THREADS
+    /* Check if this thread holds the lock exactly once */
+    ret_value = HDpthread_mutex_lock(&mutex->atomic_lock);
+    if (ret_value)
+        HGOTO_DONE(ret_value);
+    if (1 == mutex->lock_count && HDpthread_equal(HDpthread_self(), mutex->owner_thread)) {
+        mutex->lock_count = 0;
+        *yielded          = TRUE;
+    } /* end if */
+    ret_value = HDpthread_mutex_unlock(&mutex->atomic_lock);
+
+    /* Wake another thread waiting for the lock */
+    if (*yielded) {
+        int err;
+
+        err = HDpthread_cond_signal(&mutex->cond_var);
+        if (err != 0)
+            ret_value = err;
+    } /* end if */
+
+done:
+#endif /* H5_HAVE_WIN_THREADS */
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
+} /* H5TS_mutex_yield */
+
 /*--------------------------------------------------------------------------
  * Function:    H5TSmutex_get_attempt_count
  *
@@ -795,8 +870,9 @@ H5TS_win32_process_enter(PINIT_ONCE InitOnce, PVOID Parameter, PVOID *lpContex)
 
     FUNC_ENTER_NOAPI_NAMECHECK_ONLY
 
-    /* Initialize the critical section (can't fail) */
+    /* Initialize the critical sections (can't fail) */
     InitializeCriticalSection(&H5_g.init_lock.CriticalSection);
+    InitializeCriticalSection(&H5TS_ids_lock_g);
 
     /* Set up thread local storage */
     if (TLS_OUT_OF_INDEXES == (H5TS_errstk_key_g = TlsAlloc()))
@@ -869,6 +945,7 @@ H5TS_win32_process_exit(void)
 
     /* Clean up critical section resources (can't fail) */
     DeleteCriticalSection(&H5_g.init_lock.CriticalSection);
+    DeleteCriticalSection(&H5TS_ids_lock_g);
 
     /* Clean up per-process thread local storage */
     TlsFree(H5TS_errstk_key_g);
@@ -927,6 +1004,122 @@ H5TS_win32_thread_exit(void)
 } /* H5TS_win32_thread_exit() */
 #endif /* H5_HAVE_WIN_THREADS */
 
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS__task_worker
+ *
+ * RETURNS
+ *    NULL
+ *
+ * DESCRIPTION
+ *    Run tasks from a set of tasks shared with other threads, until there
+ *    are none left.
+ *
+ *--------------------------------------------------------------------------
+ */
+static void *
+H5TS__task_worker(void *_tasks)
+{
+    H5TS_tasks_t *tasks = (H5TS_tasks_t *)_tasks;
+
+    FUNC_ENTER_STATIC_NAMECHECK_ONLY
+
+    for (;;) {
+        size_t task_idx; /* Index of task to run */
+
+        /* Claim the next task */
+        H5TS_mutex_lock_simple(&tasks->lock);
+        task_idx = tasks->next;
+        if (task_idx < tasks->ntasks)
+            tasks->next++;
+        H5TS_mutex_unlock_simple(&tasks->lock);
+
+        if (task_idx >= tasks->ntasks)
+            break;
+
+        (tasks->op)(task_idx, tasks->op_data);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(NULL)
+} /* H5TS__task_worker */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_run_tasks
+ *
+ * RETURNS
+ *    Non-negative on success / Negative on failure
+ *
+ * DESCRIPTION
+ *    Call OP for each of NTASKS tasks, using up to NTHREADS threads
+ *    (including the calling thread), and wait for all of them to finish.
+ *
+ *    OP runs without the global library lock held by the thread running
+ *    it, so it must not call API routines or change library state.  If
+ *    worker threads can't be created, the remaining tasks are run by
+ *    the threads that were created and the calling thread.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_run_tasks(unsigned nthreads, size_t ntasks, H5TS_task_cb_t op, void *op_data)
+{
+    H5TS_tasks_t   tasks;              /* Tasks shared among threads */
+    H5TS_thread_t *threads  = NULL;    /* Worker threads */
+    unsigned       nworkers = 0;       /* Number of worker threads created */
+    unsigned       u;                  /* Local index variable */
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NAMECHECK_ONLY
+
+    HDassert(op);
+
+    /* Set up the shared tasks */
+    H5TS_mutex_init(&tasks.lock);
+    tasks.next    = 0;
+    tasks.ntasks  = ntasks;
+    tasks.op      = op;
+    tasks.op_data = op_data;
+
+    /* Start worker threads, leaving one task for the calling thread */
+    if (nthreads > 1 && ntasks > 1) {
+        if ((size_t)nthreads > ntasks)
+            nthreads = (unsigned)ntasks;
+
+        /* Use HDmalloc here instead of H5MM_malloc(), to avoid calling the H5CS routines */
+        if (NULL != (threads = (H5TS_thread_t *)HDmalloc((nthreads - 1) * sizeof(H5TS_thread_t)))) {
+            for (u = 0; u < nthreads - 1; u++) {
+#ifdef H5_HAVE_WIN_THREADS
+                if (NULL == (threads[u] = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)H5TS__task_worker,
+                                                       &tasks, 0, NULL)))
+                    break;
+#else  /* H5_HAVE_WIN_THREADS */
+                if (0 != pthread_create(&threads[u], NULL, H5TS__task_worker, &tasks))
+                    break;
+#endif /* H5_HAVE_WIN_THREADS */
+                nworkers++;
+            } /* end for */
+        }     /* end if */
+    }         /* end if */
+
+    /* Run tasks in this thread as well */
+    H5TS__task_worker(&tasks);
+
+    /* Wait for the worker threads */
+    for (u = 0; u < nworkers; u++) {
+        H5TS_wait_for_thread(threads[u]);
+#ifdef H5_HAVE_WIN_THREADS
+        CloseHandle(threads[u]);
+#endif /* H5_HAVE_WIN_THREADS */
+    } /* end for */
+
+    if (threads)
+        HDfree(threads);
+    H5TS_mutex_destroy(&tasks.lock);
+
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(ret_value)
+} /* H5TS_run_tasks */
+
 /*--------------------------------------------------------------------------
  * NAME
  *    H5TS_create_thread
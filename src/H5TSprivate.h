@@ -60,6 +60,7 @@ typedef INIT_ONCE        H5TS_once_t;
 #define H5TS_mutex_init(mutex)                  InitializeCriticalSection(mutex)
 #define H5TS_mutex_lock_simple(mutex)           EnterCriticalSection(mutex)
 #define H5TS_mutex_unlock_simple(mutex)         LeaveCriticalSection(mutex)
+#define H5TS_mutex_destroy(mutex)               DeleteCriticalSection(mutex)
 
 /* Functions called from DllMain */
 H5_DLL BOOL CALLBACK H5TS_win32_process_enter(PINIT_ONCE InitOnce, PVOID Parameter, PVOID *lpContex);
@@ -106,6 +107,7 @@ typedef pthread_once_t  H5TS_once_t;
 #define H5TS_mutex_init(mutex)                  pthread_mutex_init(mutex, NULL)
 #define H5TS_mutex_lock_simple(mutex)           pthread_mutex_lock(mutex)
 #define H5TS_mutex_unlock_simple(mutex)         pthread_mutex_unlock(mutex)
+#define H5TS_mutex_destroy(mutex)               pthread_mutex_destroy(mutex)
 
 /* Pthread-only routines */
 H5_DLL uint64_t H5TS_thread_id(void);
@@ -121,10 +123,19 @@ extern H5TS_key_t H5TS_funcstk_key_g; /* Function stacks */
 #endif                                /* H5_HAVE_CODESTACK */
 extern H5TS_key_t H5TS_apictx_key_g;  /* API contexts */
 
+/* Library-scope locks, used by other interfaces */
+extern H5TS_mutex_simple_t H5TS_ids_lock_g; /* ID tables (recursive) */
+
+/* Callback for each task run by H5TS_run_tasks() */
+typedef void (*H5TS_task_cb_t)(size_t task_idx, void *op_data);
+
 /* Library-scope routines */
+H5_DLL herr_t H5TS_run_tasks(unsigned nthreads, size_t ntasks, H5TS_task_cb_t op, void *op_data);
+
 /* (Only used within H5private.h macros) */
 H5_DLL herr_t H5TS_mutex_lock(H5TS_mutex_t *mutex);
 H5_DLL herr_t H5TS_mutex_unlock(H5TS_mutex_t *mutex);
+H5_DLL herr_t H5TS_mutex_yield(H5TS_mutex_t *mutex, hbool_t *yielded);
 H5_DLL herr_t H5TS_cancel_count_inc(void);
 H5_DLL herr_t H5TS_cancel_count_dec(void);
 
@@ -34,6 +34,10 @@
 #include "H5Pprivate.h"  /* Property lists            */
 #include "H5Tpkg.h"      /* Datatypes                */
 
+#ifdef H5_HAVE_SIMD_DISPATCH
+#include <immintrin.h>
+#endif /* H5_HAVE_SIMD_DISPATCH */
+
 /****************/
 /* Local Macros */
 /****************/
@@ -678,7 +682,7 @@
     }
 #define H5T_CONV_Fx_NOEX_CORE(STYPE, DTYPE, S, D, ST, DT, D_MIN, D_MAX)                                      \
     {                                                                                                        \
-        if (*(S) > (ST)(D_MAX))                                                                              \
+        if (*(S) > (ST)(D_MAX) || (sprec < dprec && *(S) == (ST)(D_MAX)))                                    \
             *(D) = (DT)(D_MAX);                                                                              \
         else if (*(S) < (ST)(D_MIN))                                                                         \
             *(D) = (DT)(D_MIN);                                                                              \
@@ -710,19 +714,20 @@
         FUNC_ENTER_PACKAGE                                                                                   \
                                                                                                              \
         {                                                                                                    \
-            size_t elmtno;                    /*element number        */                                     \
-            H5T_CONV_DECL_PREC(PREC)          /*declare precision variables, or not */                       \
-            void *        src_buf;            /*'raw' source buffer        */                                \
-            void *        dst_buf;            /*'raw' destination buffer    */                               \
-            ST *          src, *s;            /*source buffer            */                                  \
-            DT *          dst, *d;            /*destination buffer        */                                 \
-            H5T_t *       st, *dt;            /*datatype descriptors        */                               \
-            ST            src_aligned;        /*source aligned type        */                                \
-            DT            dst_aligned;        /*destination aligned type    */                               \
-            hbool_t       s_mv, d_mv;         /*move data to align it?    */                                 \
-            ssize_t       s_stride, d_stride; /*src and dst strides        */                                \
-            size_t        safe;               /*how many elements are safe to process in each pass */        \
-            H5T_conv_cb_t cb_struct;          /*conversion callback structure */                             \
+            size_t elmtno;                          /*element number        */                               \
+            H5T_CONV_DECL_PREC(PREC)                /*declare precision variables, or not */                 \
+            void *              src_buf;            /*'raw' source buffer        */                          \
+            void *              dst_buf;            /*'raw' destination buffer    */                         \
+            ST *                src, *s;            /*source buffer            */                            \
+            DT *                dst, *d;            /*destination buffer        */                           \
+            H5T_t *             st, *dt;            /*datatype descriptors        */                         \
+            ST                  src_aligned;        /*source aligned type        */                          \
+            DT                  dst_aligned;        /*destination aligned type    */                         \
+            hbool_t             s_mv, d_mv;         /*move data to align it?    */                           \
+            ssize_t             s_stride, d_stride; /*src and dst strides        */                          \
+            size_t              safe;               /*how many elements are safe to process in each pass */  \
+            H5T_conv_cb_t       cb_struct;          /*conversion callback structure */                       \
+            H5T_conv_vec_func_t vec_func;           /*vectorized conversion, if any */                       \
                                                                                                              \
             switch (cdata->command) {                                                                        \
                 case H5T_CONV_INIT:                                                                          \
@@ -780,6 +785,10 @@
                                                                                                              \
                     H5T_CONV_SET_PREC(PREC) /*init precision variables, or not */                            \
                                                                                                              \
+                    /* Look for a vectorized conversion, which can only be used */                           \
+                    /* when there's no exception callback or alignment to handle */                          \
+                    vec_func = (cb_struct.func || s_mv || d_mv) ? NULL : H5T_CONV_VEC_FIND(st, dt);          \
+                                                                                                             \
                     /* The outer loop of the type conversion macro, controlling which */                     \
                     /* direction the buffer is walked */                                                     \
                     while (nelmts > 0) {                                                                     \
@@ -835,6 +844,10 @@
                             H5T_CONV_LOOP_OUTER(PRE_SNOALIGN, PRE_DALIGN, POST_SNOALIGN, POST_DALIGN, GUTS,  \
                                                 STYPE, DTYPE, src, d, ST, DT, D_MIN, D_MAX)                  \
                         }                                                                                    \
+                        else if (vec_func && s_stride == (ssize_t)sizeof(ST) &&                              \
+                                 d_stride == (ssize_t)sizeof(DT))                                            \
+                            /* Packed elements, converted with vector instructions */                        \
+                            (*vec_func)(src, dst, safe);                                                     \
                         else {                                                                               \
                             /* Alignment is not required for both source and destination */                  \
                             H5T_CONV_LOOP_OUTER(PRE_SNOALIGN, PRE_DNOALIGN, POST_SNOALIGN, POST_DNOALIGN,    \
@@ -1032,6 +1045,25 @@ done:
 /* Minimum size of variable-length conversion buffer */
 #define H5T_VLEN_MIN_CONF_BUF_SIZE 4096
 
+/* Find the vectorized conversion for the source & destination datatypes of
+ * a hardware conversion, if there is one
+ */
+#ifdef H5_HAVE_SIMD_DISPATCH
+#define H5T_CONV_VEC_FIND(ST, DT) H5T__conv_vec_find(ST, DT)
+#else /* H5_HAVE_SIMD_DISPATCH */
+#define H5T_CONV_VEC_FIND(ST, DT) NULL
+#endif /* H5_HAVE_SIMD_DISPATCH */
+
+#ifdef H5_HAVE_SIMD_DISPATCH
+/* Convert as many elements as possible with the AVX2 or SSE2 kernel for a
+ * vectorized conversion, returning the number of elements converted
+ */
+#define H5T_CONV_VEC_KERNEL(NAME, SRC, DST, NELMTS)                                                         \
+    (H5_CPU_HAS_AVX2()                                                                                       \
+         ? H5_GLUE3(H5T__conv_vec_, NAME, _avx2)(SRC, DST, NELMTS)                                           \
+         : (H5_CPU_HAS_SSE2() ? H5_GLUE3(H5T__conv_vec_, NAME, _sse2)(SRC, DST, NELMTS) : (size_t)0))
+#endif /* H5_HAVE_SIMD_DISPATCH */
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -1059,6 +1091,25 @@ typedef struct H5T_conv_hw_t {
     size_t d_aligned; /*number destination elements aligned*/
 } H5T_conv_hw_t;
 
+/* Vectorized conversion of packed elements, for the hardware conversion
+ * functions to use when there's no exception callback.  The source &
+ * destination may be the same buffer.
+ */
+typedef void (*H5T_conv_vec_func_t)(const void *src, void *dst, size_t nelmts);
+
+#ifdef H5_HAVE_SIMD_DISPATCH
+/* Kinds of native datatypes with vectorized conversions */
+typedef enum H5T_conv_vec_kind_t {
+    H5T_CONV_VEC_NONE = 0, /* No vectorized conversions */
+    H5T_CONV_VEC_INT8,     /* 8-bit signed integer */
+    H5T_CONV_VEC_INT16,    /* 16-bit signed integer */
+    H5T_CONV_VEC_INT32,    /* 32-bit signed integer */
+    H5T_CONV_VEC_FLOAT32,  /* IEEE single precision */
+    H5T_CONV_VEC_FLOAT64,  /* IEEE double precision */
+    H5T_CONV_VEC_NKINDS    /* Number of kinds (must be last) */
+} H5T_conv_vec_kind_t;
+#endif /* H5_HAVE_SIMD_DISPATCH */
+
 /********************/
 /* Package Typedefs */
 /********************/
@@ -1068,6 +1119,18 @@ typedef struct H5T_conv_hw_t {
 /********************/
 
 static herr_t H5T__reverse_order(uint8_t *rev, uint8_t *s, size_t size, H5T_order_t order);
+#ifdef H5_HAVE_SIMD_DISPATCH
+static H5T_conv_vec_kind_t H5T__conv_vec_kind(const H5T_t *dt);
+static H5T_conv_vec_func_t H5T__conv_vec_find(const H5T_t *st, const H5T_t *dt);
+static void                H5T__conv_vec_float_double(const void *_src, void *_dst, size_t nelmts);
+static void                H5T__conv_vec_double_float(const void *_src, void *_dst, size_t nelmts);
+static void                H5T__conv_vec_int_float(const void *_src, void *_dst, size_t nelmts);
+static void                H5T__conv_vec_int_double(const void *_src, void *_dst, size_t nelmts);
+static void                H5T__conv_vec_float_int(const void *_src, void *_dst, size_t nelmts);
+static void                H5T__conv_vec_double_int(const void *_src, void *_dst, size_t nelmts);
+static void                H5T__conv_vec_int_short(const void *_src, void *_dst, size_t nelmts);
+static void                H5T__conv_vec_short_schar(const void *_src, void *_dst, size_t nelmts);
+#endif /* H5_HAVE_SIMD_DISPATCH */
 
 /*********************/
 /* Public Variables */
@@ -1094,6 +1157,23 @@ H5FL_BLK_DEFINE_STATIC(array_seq);
 /* Declare a free list to manage pieces of reference data */
 H5FL_BLK_DEFINE_STATIC(ref_seq);
 
+#ifdef H5_HAVE_SIMD_DISPATCH
+/* Vectorized conversions, by the kinds of the source & destination types */
+static const H5T_conv_vec_func_t H5T_conv_vec_g[H5T_CONV_VEC_NKINDS][H5T_CONV_VEC_NKINDS] = {
+    /* H5T_CONV_VEC_NONE */
+    {NULL, NULL, NULL, NULL, NULL, NULL},
+    /* H5T_CONV_VEC_INT8 */
+    {NULL, NULL, NULL, NULL, NULL, NULL},
+    /* H5T_CONV_VEC_INT16 */
+    {NULL, H5T__conv_vec_short_schar, NULL, NULL, NULL, NULL},
+    /* H5T_CONV_VEC_INT32 */
+    {NULL, NULL, H5T__conv_vec_int_short, NULL, H5T__conv_vec_int_float, H5T__conv_vec_int_double},
+    /* H5T_CONV_VEC_FLOAT32 */
+    {NULL, NULL, NULL, H5T__conv_vec_float_int, NULL, H5T__conv_vec_float_double},
+    /* H5T_CONV_VEC_FLOAT64 */
+    {NULL, NULL, NULL, H5T__conv_vec_double_int, H5T__conv_vec_double_float, NULL}};
+#endif /* H5_HAVE_SIMD_DISPATCH */
+
 /*-------------------------------------------------------------------------
  * Function:    H5T__conv_noop
  *
@@ -9548,3 +9628,768 @@ H5T_reclaim_cb(void *elem, const H5T_t *dt, unsigned H5_ATTR_UNUSED ndim, const
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T_reclaim_cb() */
+
+#ifdef H5_HAVE_SIMD_DISPATCH
+/*
+ * Vectorized conversions between the common native integer & floating-point
+ * types, for the hardware conversion functions to use on packed elements
+ * when there's no exception callback.  They give the same results as the
+ * "no exception" conversions: values out of the destination's range are
+ * clamped to the destination's minimum or maximum (or, for a destination
+ * 'float', set to infinity).  Integers are clamped by the saturating "pack"
+ * instructions and doubles by the min/max instructions.
+ *
+ * Each conversion converts as many elements as possible with its AVX2 or
+ * SSE2 kernel (which load all of the elements in a block before storing
+ * them, so that the buffers can overlap the way the hardware conversion
+ * functions use them) and converts the rest of the elements one at a time.
+ */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_kind
+ *
+ * Purpose:     Determine the kind of a datatype, for the vectorized
+ *              conversions.
+ *
+ * Return:      The kind of datatype, or H5T_CONV_VEC_NONE if there are no
+ *              vectorized conversions for it
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5T_conv_vec_kind_t
+H5T__conv_vec_kind(const H5T_t *dt)
+{
+    const H5T_atomic_t *atomic    = &dt->shared->u.atomic;
+    H5T_conv_vec_kind_t ret_value = H5T_CONV_VEC_NONE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Only little-endian types without padding bits (which the native types
+     * are on processors with SSE2) are converted
+     */
+    if (H5T_ORDER_LE == atomic->order && 0 == atomic->offset && (8 * dt->shared->size) == atomic->prec) {
+        if (H5T_INTEGER == dt->shared->type && H5T_SGN_2 == atomic->u.i.sign) {
+            if (1 == dt->shared->size)
+                ret_value = H5T_CONV_VEC_INT8;
+            else if (2 == dt->shared->size)
+                ret_value = H5T_CONV_VEC_INT16;
+            else if (4 == dt->shared->size)
+                ret_value = H5T_CONV_VEC_INT32;
+        } /* end if */
+        else if (H5T_FLOAT == dt->shared->type) {
+            if (4 == dt->shared->size && 23 == atomic->u.f.msize && 8 == atomic->u.f.esize)
+                ret_value = H5T_CONV_VEC_FLOAT32;
+            else if (8 == dt->shared->size && 52 == atomic->u.f.msize && 11 == atomic->u.f.esize)
+                ret_value = H5T_CONV_VEC_FLOAT64;
+        } /* end if */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vec_kind() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_find
+ *
+ * Purpose:     Find the vectorized conversion between two datatypes.
+ *
+ * Return:      The vectorized conversion, or NULL if there isn't one
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5T_conv_vec_func_t
+H5T__conv_vec_find(const H5T_t *st, const H5T_t *dt)
+{
+    H5T_conv_vec_func_t ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    ret_value = H5T_conv_vec_g[H5T__conv_vec_kind(st)][H5T__conv_vec_kind(dt)];
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_vec_find() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_float_double_sse2
+ *
+ * Purpose:     Convert 'float' to 'double' with SSE2 instructions, 4
+ *              elements at a time.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static size_t
+H5T__conv_vec_float_double_sse2(const float *src, double *dst, size_t nelmts)
+{
+    size_t nvec = nelmts - (nelmts % 4); /* Number of elements to convert */
+    size_t u;                            /* Local index variable */
+
+    for (u = 0; u < nvec; u += 4) {
+        __m128 x = _mm_loadu_ps(src + u);
+
+        _mm_storeu_pd(dst + u, _mm_cvtps_pd(x));
+        _mm_storeu_pd(dst + u + 2, _mm_cvtps_pd(_mm_movehl_ps(x, x)));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_float_double_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_float_double_avx2
+ *
+ * Purpose:     Convert 'float' to 'double' with AVX2 instructions, 8
+ *              elements at a time.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static size_t
+H5T__conv_vec_float_double_avx2(const float *src, double *dst, size_t nelmts)
+{
+    size_t nvec = nelmts - (nelmts % 8); /* Number of elements to convert */
+    size_t u;                            /* Local index variable */
+
+    for (u = 0; u < nvec; u += 8) {
+        __m128 x0 = _mm_loadu_ps(src + u);
+        __m128 x1 = _mm_loadu_ps(src + u + 4);
+
+        _mm256_storeu_pd(dst + u, _mm256_cvtps_pd(x0));
+        _mm256_storeu_pd(dst + u + 4, _mm256_cvtps_pd(x1));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_float_double_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_float_double
+ *
+ * Purpose:     Convert 'float' to 'double'.
+ *
+ * Return:      Void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_vec_float_double(const void *_src, void *_dst, size_t nelmts)
+{
+    const float *src = (const float *)_src;
+    double *     dst = (double *)_dst;
+    size_t       u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = H5T_CONV_VEC_KERNEL(float_double, src, dst, nelmts); u < nelmts; u++)
+        dst[u] = (double)src[u];
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_vec_float_double() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_double_float_sse2
+ *
+ * Purpose:     Convert 'double' to 'float' with SSE2 instructions, 4
+ *              elements at a time.  Values beyond FLT_MAX are set to
+ *              infinity.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static size_t
+H5T__conv_vec_double_float_sse2(const double *src, float *dst, size_t nelmts)
+{
+    const __m128d sign = _mm_set1_pd(-0.0);
+    const __m128d max  = _mm_set1_pd((double)FLT_MAX);
+    const __m128d inf  = _mm_set1_pd(H5T_NATIVE_DOUBLE_POS_INF_g);
+    size_t        nvec = nelmts - (nelmts % 4); /* Number of elements to convert */
+    size_t        u;                            /* Local index variable */
+
+    for (u = 0; u < nvec; u += 4) {
+        __m128d x[2];
+        size_t  v;
+
+        x[0] = _mm_loadu_pd(src + u);
+        x[1] = _mm_loadu_pd(src + u + 2);
+        for (v = 0; v < 2; v++) {
+            __m128d over = _mm_cmpgt_pd(_mm_andnot_pd(sign, x[v]), max);
+
+            x[v] = _mm_or_pd(_mm_andnot_pd(over, x[v]),
+                             _mm_and_pd(over, _mm_or_pd(_mm_and_pd(sign, x[v]), inf)));
+        } /* end for */
+        _mm_storeu_ps(dst + u, _mm_movelh_ps(_mm_cvtpd_ps(x[0]), _mm_cvtpd_ps(x[1])));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_double_float_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_double_float_avx2
+ *
+ * Purpose:     Convert 'double' to 'float' with AVX2 instructions, 8
+ *              elements at a time.  Values beyond FLT_MAX are set to
+ *              infinity.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static size_t
+H5T__conv_vec_double_float_avx2(const double *src, float *dst, size_t nelmts)
+{
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    const __m256d max  = _mm256_set1_pd((double)FLT_MAX);
+    const __m256d inf  = _mm256_set1_pd(H5T_NATIVE_DOUBLE_POS_INF_g);
+    size_t        nvec = nelmts - (nelmts % 8); /* Number of elements to convert */
+    size_t        u;                            /* Local index variable */
+
+    for (u = 0; u < nvec; u += 8) {
+        __m256d x[2];
+        size_t  v;
+
+        x[0] = _mm256_loadu_pd(src + u);
+        x[1] = _mm256_loadu_pd(src + u + 4);
+        for (v = 0; v < 2; v++) {
+            __m256d over = _mm256_cmp_pd(_mm256_andnot_pd(sign, x[v]), max, _CMP_GT_OQ);
+
+            x[v] = _mm256_blendv_pd(x[v], _mm256_or_pd(_mm256_and_pd(sign, x[v]), inf), over);
+        } /* end for */
+        _mm_storeu_ps(dst + u, _mm256_cvtpd_ps(x[0]));
+        _mm_storeu_ps(dst + u + 4, _mm256_cvtpd_ps(x[1]));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_double_float_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_double_float
+ *
+ * Purpose:     Convert 'double' to 'float'.  Values beyond FLT_MAX are set
+ *              to infinity.
+ *
+ * Return:      Void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_vec_double_float(const void *_src, void *_dst, size_t nelmts)
+{
+    const double *src = (const double *)_src;
+    float *       dst = (float *)_dst;
+    size_t        u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = H5T_CONV_VEC_KERNEL(double_float, src, dst, nelmts); u < nelmts; u++) {
+        if (src[u] > (double)FLT_MAX)
+            dst[u] = H5T_NATIVE_FLOAT_POS_INF_g;
+        else if (src[u] < -(double)FLT_MAX)
+            dst[u] = H5T_NATIVE_FLOAT_NEG_INF_g;
+        else
+            dst[u] = (float)src[u];
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_vec_double_float() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_int_float_sse2
+ *
+ * Purpose:     Convert 32-bit integers to 'float' with SSE2 instructions,
+ *              4 elements at a time.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static size_t
+H5T__conv_vec_int_float_sse2(const int32_t *src, float *dst, size_t nelmts)
+{
+    size_t nvec = nelmts - (nelmts % 4); /* Number of elements to convert */
+    size_t u;                            /* Local index variable */
+
+    for (u = 0; u < nvec; u += 4)
+        _mm_storeu_ps(dst + u, _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(src + u))));
+
+    return nvec;
+} /* end H5T__conv_vec_int_float_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_int_float_avx2
+ *
+ * Purpose:     Convert 32-bit integers to 'float' with AVX2 instructions,
+ *              8 elements at a time.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static size_t
+H5T__conv_vec_int_float_avx2(const int32_t *src, float *dst, size_t nelmts)
+{
+    size_t nvec = nelmts - (nelmts % 8); /* Number of elements to convert */
+    size_t u;                            /* Local index variable */
+
+    for (u = 0; u < nvec; u += 8)
+        _mm256_storeu_ps(dst + u, _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)(src + u))));
+
+    return nvec;
+} /* end H5T__conv_vec_int_float_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_int_float
+ *
+ * Purpose:     Convert 32-bit integers to 'float'.
+ *
+ * Return:      Void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_vec_int_float(const void *_src, void *_dst, size_t nelmts)
+{
+    const int32_t *src = (const int32_t *)_src;
+    float *        dst = (float *)_dst;
+    size_t         u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = H5T_CONV_VEC_KERNEL(int_float, src, dst, nelmts); u < nelmts; u++)
+        dst[u] = (float)src[u];
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_vec_int_float() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_int_double_sse2
+ *
+ * Purpose:     Convert 32-bit integers to 'double' with SSE2 instructions,
+ *              4 elements at a time.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static size_t
+H5T__conv_vec_int_double_sse2(const int32_t *src, double *dst, size_t nelmts)
+{
+    size_t nvec = nelmts - (nelmts % 4); /* Number of elements to convert */
+    size_t u;                            /* Local index variable */
+
+    for (u = 0; u < nvec; u += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(src + u));
+
+        _mm_storeu_pd(dst + u, _mm_cvtepi32_pd(x));
+        _mm_storeu_pd(dst + u + 2, _mm_cvtepi32_pd(_mm_srli_si128(x, 8)));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_int_double_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_int_double_avx2
+ *
+ * Purpose:     Convert 32-bit integers to 'double' with AVX2 instructions,
+ *              8 elements at a time.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static size_t
+H5T__conv_vec_int_double_avx2(const int32_t *src, double *dst, size_t nelmts)
+{
+    size_t nvec = nelmts - (nelmts % 8); /* Number of elements to convert */
+    size_t u;                            /* Local index variable */
+
+    for (u = 0; u < nvec; u += 8) {
+        __m128i x0 = _mm_loadu_si128((const __m128i *)(src + u));
+        __m128i x1 = _mm_loadu_si128((const __m128i *)(src + u + 4));
+
+        _mm256_storeu_pd(dst + u, _mm256_cvtepi32_pd(x0));
+        _mm256_storeu_pd(dst + u + 4, _mm256_cvtepi32_pd(x1));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_int_double_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_int_double
+ *
+ * Purpose:     Convert 32-bit integers to 'double'.
+ *
+ * Return:      Void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_vec_int_double(const void *_src, void *_dst, size_t nelmts)
+{
+    const int32_t *src = (const int32_t *)_src;
+    double *       dst = (double *)_dst;
+    size_t         u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = H5T_CONV_VEC_KERNEL(int_double, src, dst, nelmts); u < nelmts; u++)
+        dst[u] = (double)src[u];
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_vec_int_double() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_float_int_sse2
+ *
+ * Purpose:     Convert 'float' to 32-bit integers with SSE2 instructions,
+ *              4 elements at a time.  The conversion instruction sets
+ *              values out of range (and NaNs) to INT32_MIN, so the ones
+ *              above the range are flipped to INT32_MAX.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static size_t
+H5T__conv_vec_float_int_sse2(const float *src, int32_t *dst, size_t nelmts)
+{
+    const __m128 max  = _mm_set1_ps(2147483648.0F); /* (INT32_MAX + 1) */
+    size_t       nvec = nelmts - (nelmts % 4);      /* Number of elements to convert */
+    size_t       u;                                 /* Local index variable */
+
+    for (u = 0; u < nvec; u += 4) {
+        __m128 x = _mm_loadu_ps(src + u);
+
+        _mm_storeu_si128((__m128i *)(dst + u),
+                         _mm_xor_si128(_mm_cvttps_epi32(x), _mm_castps_si128(_mm_cmpge_ps(x, max))));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_float_int_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_float_int_avx2
+ *
+ * Purpose:     Convert 'float' to 32-bit integers with AVX2 instructions,
+ *              8 elements at a time, the same way as
+ *              H5T__conv_vec_float_int_sse2().
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static size_t
+H5T__conv_vec_float_int_avx2(const float *src, int32_t *dst, size_t nelmts)
+{
+    const __m256 max  = _mm256_set1_ps(2147483648.0F); /* (INT32_MAX + 1) */
+    size_t       nvec = nelmts - (nelmts % 8);         /* Number of elements to convert */
+    size_t       u;                                    /* Local index variable */
+
+    for (u = 0; u < nvec; u += 8) {
+        __m256 x = _mm256_loadu_ps(src + u);
+
+        _mm256_storeu_si256((__m256i *)(dst + u),
+                            _mm256_xor_si256(_mm256_cvttps_epi32(x),
+                                             _mm256_castps_si256(_mm256_cmp_ps(x, max, _CMP_GE_OQ))));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_float_int_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_float_int
+ *
+ * Purpose:     Convert 'float' to 32-bit integers, clamping values out of
+ *              range.  NaNs are converted to INT32_MIN.
+ *
+ * Return:      Void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_vec_float_int(const void *_src, void *_dst, size_t nelmts)
+{
+    const float *src = (const float *)_src;
+    int32_t *    dst = (int32_t *)_dst;
+    size_t       u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = H5T_CONV_VEC_KERNEL(float_int, src, dst, nelmts); u < nelmts; u++) {
+        if (src[u] >= 2147483648.0F)
+            dst[u] = INT32_MAX;
+        else if (!(src[u] > -2147483648.0F))
+            dst[u] = INT32_MIN;
+        else
+            dst[u] = (int32_t)src[u];
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_vec_float_int() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_double_int_sse2
+ *
+ * Purpose:     Convert 'double' to 32-bit integers with SSE2 instructions,
+ *              4 elements at a time, clamping values out of range.  NaNs
+ *              are converted to INT32_MIN.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static size_t
+H5T__conv_vec_double_int_sse2(const double *src, int32_t *dst, size_t nelmts)
+{
+    const __m128d min  = _mm_set1_pd((double)INT32_MIN);
+    const __m128d max  = _mm_set1_pd((double)INT32_MAX);
+    size_t        nvec = nelmts - (nelmts % 4); /* Number of elements to convert */
+    size_t        u;                            /* Local index variable */
+
+    for (u = 0; u < nvec; u += 4) {
+        /* (The max instruction returns its second operand for NaNs) */
+        __m128d x0 = _mm_min_pd(_mm_max_pd(_mm_loadu_pd(src + u), min), max);
+        __m128d x1 = _mm_min_pd(_mm_max_pd(_mm_loadu_pd(src + u + 2), min), max);
+
+        _mm_storeu_si128((__m128i *)(dst + u),
+                         _mm_unpacklo_epi64(_mm_cvttpd_epi32(x0), _mm_cvttpd_epi32(x1)));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_double_int_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_double_int_avx2
+ *
+ * Purpose:     Convert 'double' to 32-bit integers with AVX2 instructions,
+ *              8 elements at a time, clamping values out of range.  NaNs
+ *              are converted to INT32_MIN.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static size_t
+H5T__conv_vec_double_int_avx2(const double *src, int32_t *dst, size_t nelmts)
+{
+    const __m256d min  = _mm256_set1_pd((double)INT32_MIN);
+    const __m256d max  = _mm256_set1_pd((double)INT32_MAX);
+    size_t        nvec = nelmts - (nelmts % 8); /* Number of elements to convert */
+    size_t        u;                            /* Local index variable */
+
+    for (u = 0; u < nvec; u += 8) {
+        /* (The max instruction returns its second operand for NaNs) */
+        __m256d x0 = _mm256_min_pd(_mm256_max_pd(_mm256_loadu_pd(src + u), min), max);
+        __m256d x1 = _mm256_min_pd(_mm256_max_pd(_mm256_loadu_pd(src + u + 4), min), max);
+
+        _mm_storeu_si128((__m128i *)(dst + u), _mm256_cvttpd_epi32(x0));
+        _mm_storeu_si128((__m128i *)(dst + u + 4), _mm256_cvttpd_epi32(x1));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_double_int_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_double_int
+ *
+ * Purpose:     Convert 'double' to 32-bit integers, clamping values out
+ *              of range.  NaNs are converted to INT32_MIN.
+ *
+ * Return:      Void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_vec_double_int(const void *_src, void *_dst, size_t nelmts)
+{
+    const double *src = (const double *)_src;
+    int32_t *     dst = (int32_t *)_dst;
+    size_t        u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = H5T_CONV_VEC_KERNEL(double_int, src, dst, nelmts); u < nelmts; u++) {
+        if (src[u] > (double)INT32_MAX)
+            dst[u] = INT32_MAX;
+        else if (!(src[u] > (double)INT32_MIN))
+            dst[u] = INT32_MIN;
+        else
+            dst[u] = (int32_t)src[u];
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_vec_double_int() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_int_short_sse2
+ *
+ * Purpose:     Convert 32-bit integers to 16-bit integers with SSE2
+ *              instructions, 8 elements at a time, clamping values out of
+ *              range.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static size_t
+H5T__conv_vec_int_short_sse2(const int32_t *src, int16_t *dst, size_t nelmts)
+{
+    size_t nvec = nelmts - (nelmts % 8); /* Number of elements to convert */
+    size_t u;                            /* Local index variable */
+
+    for (u = 0; u < nvec; u += 8) {
+        __m128i x0 = _mm_loadu_si128((const __m128i *)(src + u));
+        __m128i x1 = _mm_loadu_si128((const __m128i *)(src + u + 4));
+
+        _mm_storeu_si128((__m128i *)(dst + u), _mm_packs_epi32(x0, x1));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_int_short_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_int_short_avx2
+ *
+ * Purpose:     Convert 32-bit integers to 16-bit integers with AVX2
+ *              instructions, 16 elements at a time, clamping values out
+ *              of range.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static size_t
+H5T__conv_vec_int_short_avx2(const int32_t *src, int16_t *dst, size_t nelmts)
+{
+    size_t nvec = nelmts - (nelmts % 16); /* Number of elements to convert */
+    size_t u;                             /* Local index variable */
+
+    for (u = 0; u < nvec; u += 16) {
+        __m256i x0 = _mm256_loadu_si256((const __m256i *)(src + u));
+        __m256i x1 = _mm256_loadu_si256((const __m256i *)(src + u + 8));
+
+        /* (The pack instruction works on each 128-bit half separately) */
+        _mm256_storeu_si256((__m256i *)(dst + u),
+                            _mm256_permute4x64_epi64(_mm256_packs_epi32(x0, x1), _MM_SHUFFLE(3, 1, 2, 0)));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_int_short_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_int_short
+ *
+ * Purpose:     Convert 32-bit integers to 16-bit integers, clamping
+ *              values out of range.
+ *
+ * Return:      Void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_vec_int_short(const void *_src, void *_dst, size_t nelmts)
+{
+    const int32_t *src = (const int32_t *)_src;
+    int16_t *      dst = (int16_t *)_dst;
+    size_t         u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = H5T_CONV_VEC_KERNEL(int_short, src, dst, nelmts); u < nelmts; u++) {
+        if (src[u] > INT16_MAX)
+            dst[u] = INT16_MAX;
+        else if (src[u] < INT16_MIN)
+            dst[u] = INT16_MIN;
+        else
+            dst[u] = (int16_t)src[u];
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_vec_int_short() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_short_schar_sse2
+ *
+ * Purpose:     Convert 16-bit integers to 8-bit integers with SSE2
+ *              instructions, 16 elements at a time, clamping values out
+ *              of range.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static size_t
+H5T__conv_vec_short_schar_sse2(const int16_t *src, int8_t *dst, size_t nelmts)
+{
+    size_t nvec = nelmts - (nelmts % 16); /* Number of elements to convert */
+    size_t u;                             /* Local index variable */
+
+    for (u = 0; u < nvec; u += 16) {
+        __m128i x0 = _mm_loadu_si128((const __m128i *)(src + u));
+        __m128i x1 = _mm_loadu_si128((const __m128i *)(src + u + 8));
+
+        _mm_storeu_si128((__m128i *)(dst + u), _mm_packs_epi16(x0, x1));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_short_schar_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_short_schar_avx2
+ *
+ * Purpose:     Convert 16-bit integers to 8-bit integers with AVX2
+ *              instructions, 32 elements at a time, clamping values out
+ *              of range.
+ *
+ * Return:      The number of elements converted
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static size_t
+H5T__conv_vec_short_schar_avx2(const int16_t *src, int8_t *dst, size_t nelmts)
+{
+    size_t nvec = nelmts - (nelmts % 32); /* Number of elements to convert */
+    size_t u;                             /* Local index variable */
+
+    for (u = 0; u < nvec; u += 32) {
+        __m256i x0 = _mm256_loadu_si256((const __m256i *)(src + u));
+        __m256i x1 = _mm256_loadu_si256((const __m256i *)(src + u + 16));
+
+        /* (The pack instruction works on each 128-bit half separately) */
+        _mm256_storeu_si256((__m256i *)(dst + u),
+                            _mm256_permute4x64_epi64(_mm256_packs_epi16(x0, x1), _MM_SHUFFLE(3, 1, 2, 0)));
+    } /* end for */
+
+    return nvec;
+} /* end H5T__conv_vec_short_schar_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5T__conv_vec_short_schar
+ *
+ * Purpose:     Convert 16-bit integers to 8-bit integers, clamping values
+ *              out of range.
+ *
+ * Return:      Void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T__conv_vec_short_schar(const void *_src, void *_dst, size_t nelmts)
+{
+    const int16_t *src = (const int16_t *)_src;
+    int8_t *       dst = (int8_t *)_dst;
+    size_t         u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = H5T_CONV_VEC_KERNEL(short_schar, src, dst, nelmts); u < nelmts; u++) {
+        if (src[u] > INT8_MAX)
+            dst[u] = INT8_MAX;
+        else if (src[u] < INT8_MIN)
+            dst[u] = INT8_MIN;
+        else
+            dst[u] = (int8_t)src[u];
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__conv_vec_short_schar() */
+#endif /* H5_HAVE_SIMD_DISPATCH */
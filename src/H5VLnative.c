@@ -144,12 +144,21 @@ static const H5VL_class_t H5VL_native_cls_g = {
     },
     {
         /* request_cls */
+#ifdef H5VL_NATIVE_ASYNC
+        H5VL__native_request_wait,     /* wait         */
+        NULL,                          /* notify       */
+        H5VL__native_request_cancel,   /* cancel       */
+        H5VL__native_request_specific, /* specific     */
+        NULL,                          /* optional     */
+        H5VL__native_request_free      /* free         */
+#else  /* H5VL_NATIVE_ASYNC */
         NULL, /* wait         */
         NULL, /* notify       */
         NULL, /* cancel       */
         NULL, /* specific     */
         NULL, /* optional     */
         NULL  /* free         */
+#endif /* H5VL_NATIVE_ASYNC */
     },
     {
         /* blob_cls */
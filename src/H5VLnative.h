@@ -54,6 +54,10 @@
 #define H5VL_NATIVE_DATASET_CHUNK_WRITE             7 /* H5Dchunk_write               */
 #define H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE       8 /* H5Dvlen_get_buf_size         */
 #define H5VL_NATIVE_DATASET_GET_OFFSET              9 /* H5Dget_offset                */
+#define H5VL_NATIVE_DATASET_READ_MULTI              10 /* H5Dread_multi                */
+#define H5VL_NATIVE_DATASET_WRITE_MULTI             11 /* H5Dwrite_multi               */
+#define H5VL_NATIVE_DATASET_GET_MAPPED_DATA         12 /* H5Dget_mapped_data           */
+#define H5VL_NATIVE_DATASET_CHUNK_READ_MULTI        13 /* H5Dread_chunks               */
 
 /* Values for native VOL connector file optional VOL operations */
 /* NOTE: If new values are added here, the H5VL__native_introspect_opt_query
@@ -24,12 +24,74 @@
 #include "H5Fprivate.h"  /* Files                                    */
 #include "H5Gprivate.h"  /* Groups                                   */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
 #include "H5Pprivate.h"  /* Property lists                           */
 #include "H5Sprivate.h"  /* Dataspaces                               */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
 #include "H5VLnative_private.h" /* Native VOL connector                     */
 
+/********************/
+/* Local Prototypes */
+/********************/
+
+static herr_t H5VL__native_dataset_multi_setup(size_t count, hid_t dset_id[], hid_t mem_space_id[],
+                                               hid_t file_space_id[], H5D_t ***dset,
+                                               const H5S_t ***mem_space, const H5S_t ***file_space);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_dataset_multi_setup
+ *
+ * Purpose:     Look up the datasets and dataspaces for a multi-dataset
+ *              read or write.  The arrays returned must be freed by the
+ *              caller (also on failure).
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_dataset_multi_setup(size_t count, hid_t dset_id[], hid_t mem_space_id[], hid_t file_space_id[],
+                                 H5D_t ***dset, const H5S_t ***mem_space, const H5S_t ***file_space)
+{
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Allocate the arrays */
+    if (NULL == (*dset = (H5D_t **)H5MM_malloc(count * sizeof(H5D_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate dataset array")
+    if (NULL == (*mem_space = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory dataspace array")
+    if (NULL == (*file_space = (const H5S_t **)H5MM_malloc(count * sizeof(H5S_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate file dataspace array")
+
+    for (u = 0; u < count; u++) {
+        if (NULL == ((*dset)[u] = (H5D_t *)H5VL_object_verify(dset_id[u], H5I_DATASET)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+        if (NULL == (*dset)[u]->oloc.file)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+
+#ifdef H5VL_NATIVE_ASYNC
+        /* Finish asynchronous operations on the dataset */
+        if (H5VL__native_async_finish((*dset)[u], NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't finish asynchronous operations on dataset")
+#endif /* H5VL_NATIVE_ASYNC */
+
+        /* Get validated dataspace pointers */
+        if (H5S_get_validated_dataspace(mem_space_id[u], &(*mem_space)[u]) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                        "could not get a validated dataspace from mem_space_id")
+        if (H5S_get_validated_dataspace(file_space_id[u], &(*file_space)[u]) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                        "could not get a validated dataspace from file_space_id")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_dataset_multi_setup() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5VL__native_dataset_create
  *
@@ -158,11 +220,25 @@ H5VL__native_dataset_read(void *obj, hid_t mem_type_id, hid_t mem_space_id, hid_
     if (H5S_get_validated_dataspace(file_space_id, &file_space) < 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from file_space_id")
 
+#ifdef H5VL_NATIVE_ASYNC
+    /* Queue an asynchronous read, or finish the asynchronous operations on
+     *      the dataset before reading
+     */
+    if (req) {
+        if (H5VL__native_async_queue(H5VL_NATIVE_ASYNC_READ, dset, mem_type_id, mem_space, file_space, dxpl_id,
+                                     buf, NULL, req) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't queue asynchronous read")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    if (H5VL__native_async_finish(dset, NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't finish asynchronous operations on dataset")
+#endif /* H5VL_NATIVE_ASYNC */
+
     /* Set DXPL for operation */
     H5CX_set_dxpl(dxpl_id);
 
     /* Read raw data */
-    if (H5D__read(dset, mem_type_id, mem_space, file_space, buf /*out*/) < 0)
+    if (H5D__read(dset, mem_type_id, mem_space, file_space, buf /*out*/, NULL) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
 
 done:
@@ -199,11 +275,25 @@ H5VL__native_dataset_write(void *obj, hid_t mem_type_id, hid_t mem_space_id, hid
     if (H5S_get_validated_dataspace(file_space_id, &file_space) < 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "could not get a validated dataspace from file_space_id")
 
+#ifdef H5VL_NATIVE_ASYNC
+    /* Queue an asynchronous write, or finish the asynchronous operations on
+     *      the dataset before writing
+     */
+    if (req) {
+        if (H5VL__native_async_queue(H5VL_NATIVE_ASYNC_WRITE, dset, mem_type_id, mem_space, file_space,
+                                     dxpl_id, NULL, buf, req) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't queue asynchronous write")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    if (H5VL__native_async_finish(dset, NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't finish asynchronous operations on dataset")
+#endif /* H5VL_NATIVE_ASYNC */
+
     /* Set DXPL for operation */
     H5CX_set_dxpl(dxpl_id);
 
     /* Write the data */
-    if (H5D__write(dset, mem_type_id, mem_space, file_space, buf) < 0)
+    if (H5D__write(dset, mem_type_id, mem_space, file_space, buf, NULL) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
 
 done:
@@ -228,6 +318,12 @@ H5VL__native_dataset_get(void *obj, H5VL_dataset_get_t get_type, hid_t H5_ATTR_U
 
     FUNC_ENTER_PACKAGE
 
+#ifdef H5VL_NATIVE_ASYNC
+    /* Finish asynchronous operations on the dataset */
+    if (H5VL__native_async_finish(dset, NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't finish asynchronous operations on dataset")
+#endif /* H5VL_NATIVE_ASYNC */
+
     switch (get_type) {
         /* H5Dget_space */
         case H5VL_DATASET_GET_SPACE: {
@@ -316,6 +412,12 @@ H5VL__native_dataset_specific(void *obj, H5VL_dataset_specific_t specific_type,
 
     FUNC_ENTER_PACKAGE
 
+#ifdef H5VL_NATIVE_ASYNC
+    /* Finish asynchronous operations on the dataset */
+    if (H5VL__native_async_finish(dset, NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't finish asynchronous operations on dataset")
+#endif /* H5VL_NATIVE_ASYNC */
+
     switch (specific_type) {
         /* H5Dspecific_space */
         case H5VL_DATASET_SET_EXTENT: { /* H5Dset_extent (H5Dextend - deprecated) */
@@ -347,8 +449,9 @@ H5VL__native_dataset_specific(void *obj, H5VL_dataset_specific_t specific_type,
         }
 
         case H5VL_DATASET_WAIT: { /* H5Dwait */
-            /* The native VOL connector doesn't support asynchronous
-             *      operations, so this is a no-op.
+            /* Asynchronous operations on the dataset were finished above
+             *      (without background threads there are none), so this is
+             *      a no-op.
              */
             break;
         }
@@ -382,6 +485,12 @@ H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type,
     /* Sanity checks */
     HDassert(dset);
 
+#ifdef H5VL_NATIVE_ASYNC
+    /* Finish asynchronous operations on the dataset */
+    if (H5VL__native_async_finish(dset, NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't finish asynchronous operations on dataset")
+#endif /* H5VL_NATIVE_ASYNC */
+
     /* Set DXPL for operation */
     H5CX_set_dxpl(dxpl_id);
 
@@ -594,6 +703,87 @@ H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type,
             break;
         }
 
+        /* H5Dget_mapped_data */
+        case H5VL_NATIVE_DATASET_GET_MAPPED_DATA: {
+            const void **buf  = HDva_arg(arguments, const void **);
+            hsize_t *    size = HDva_arg(arguments, hsize_t *);
+
+            if (H5D__get_mapped_data(dset, buf, size) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get mapped dataset data")
+            break;
+        }
+
+        case H5VL_NATIVE_DATASET_CHUNK_READ_MULTI: { /* H5Dread_chunks */
+            size_t         count       = HDva_arg(arguments, size_t);
+            const hsize_t *offsets     = HDva_arg(arguments, const hsize_t *);
+            uint32_t *     filters     = HDva_arg(arguments, uint32_t *);
+            hsize_t *      sizes       = HDva_arg(arguments, hsize_t *);
+            hsize_t *      buf_offsets = HDva_arg(arguments, hsize_t *);
+            size_t         buf_size    = HDva_arg(arguments, size_t);
+            void *         buf         = HDva_arg(arguments, void *);
+
+            /* Check arguments */
+            if (NULL == dset->oloc.file)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+            if (H5D_CHUNKED != dset->shared->layout.type)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+            /* Read the raw chunks */
+            if (H5D__chunk_direct_read_multi(dset, count, offsets, filters, sizes, buf_offsets, buf_size,
+                                             buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read unprocessed chunk data")
+
+            break;
+        }
+
+        /* H5Dread_multi */
+        case H5VL_NATIVE_DATASET_READ_MULTI: {
+            size_t        count         = HDva_arg(arguments, size_t);
+            hid_t *       dset_id       = HDva_arg(arguments, hid_t *);
+            hid_t *       mem_type_id   = HDva_arg(arguments, hid_t *);
+            hid_t *       mem_space_id  = HDva_arg(arguments, hid_t *);
+            hid_t *       file_space_id = HDva_arg(arguments, hid_t *);
+            void **       buf           = HDva_arg(arguments, void **);
+            H5D_t **      dsets         = NULL;
+            const H5S_t **mem_spaces    = NULL;
+            const H5S_t **file_spaces   = NULL;
+
+            if (H5VL__native_dataset_multi_setup(count, dset_id, mem_space_id, file_space_id, &dsets,
+                                                 &mem_spaces, &file_spaces) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up multi-dataset read")
+            else if (H5D__read_multi(count, dsets, mem_type_id, mem_spaces, file_spaces, buf) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+
+            H5MM_xfree(dsets);
+            H5MM_xfree(mem_spaces);
+            H5MM_xfree(file_spaces);
+            break;
+        }
+
+        /* H5Dwrite_multi */
+        case H5VL_NATIVE_DATASET_WRITE_MULTI: {
+            size_t        count         = HDva_arg(arguments, size_t);
+            hid_t *       dset_id       = HDva_arg(arguments, hid_t *);
+            hid_t *       mem_type_id   = HDva_arg(arguments, hid_t *);
+            hid_t *       mem_space_id  = HDva_arg(arguments, hid_t *);
+            hid_t *       file_space_id = HDva_arg(arguments, hid_t *);
+            const void ** buf           = HDva_arg(arguments, const void **);
+            H5D_t **      dsets         = NULL;
+            const H5S_t **mem_spaces    = NULL;
+            const H5S_t **file_spaces   = NULL;
+
+            if (H5VL__native_dataset_multi_setup(count, dset_id, mem_space_id, file_space_id, &dsets,
+                                                 &mem_spaces, &file_spaces) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up multi-dataset write")
+            else if (H5D__write_multi(count, dsets, mem_type_id, mem_spaces, file_spaces, buf) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+
+            H5MM_xfree(dsets);
+            H5MM_xfree(mem_spaces);
+            H5MM_xfree(file_spaces);
+            break;
+        }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
@@ -619,6 +809,20 @@ H5VL__native_dataset_close(void *dset, hid_t H5_ATTR_UNUSED dxpl_id, void H5_ATT
 
     FUNC_ENTER_PACKAGE
 
+#ifdef H5VL_NATIVE_ASYNC
+    /* Queue an asynchronous close after the unfinished operations on the
+     *      dataset, or finish them before closing it
+     */
+    if (req && H5VL__native_async_pending((H5D_t *)dset)) {
+        if (H5VL__native_async_queue(H5VL_NATIVE_ASYNC_CLOSE, (H5D_t *)dset, H5I_INVALID_HID, NULL, NULL,
+                                     H5P_DATASET_XFER_DEFAULT, NULL, NULL, req) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't queue asynchronous close")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    if (H5VL__native_async_finish((H5D_t *)dset, NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTWAIT, FAIL, "can't finish asynchronous operations on dataset")
+#endif /* H5VL_NATIVE_ASYNC */
+
     if (H5D_close((H5D_t *)dset) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't close dataset")
 
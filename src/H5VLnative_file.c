@@ -291,6 +291,12 @@ H5VL__native_file_specific(void *obj, H5VL_file_specific_t specific_type, hid_t
 
     FUNC_ENTER_PACKAGE
 
+#ifdef H5VL_NATIVE_ASYNC
+    /* Finish asynchronous operations */
+    if (H5VL__native_async_finish(NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTWAIT, FAIL, "can't finish asynchronous operations")
+#endif /* H5VL_NATIVE_ASYNC */
+
     switch (specific_type) {
         /* H5Fflush */
         case H5VL_FILE_FLUSH: {
@@ -438,6 +444,12 @@ H5VL__native_file_optional(void *obj, H5VL_file_optional_t optional_type, hid_t
 
     FUNC_ENTER_PACKAGE
 
+#ifdef H5VL_NATIVE_ASYNC
+    /* Finish asynchronous operations */
+    if (H5VL__native_async_finish(NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTWAIT, FAIL, "can't finish asynchronous operations")
+#endif /* H5VL_NATIVE_ASYNC */
+
     f = (H5F_t *)obj;
     switch (optional_type) {
         /* H5Fget_filesize */
@@ -823,6 +835,12 @@ H5VL__native_file_close(void *file, hid_t H5_ATTR_UNUSED dxpl_id, void H5_ATTR_U
     /* This routine should only be called when a file ID's ref count drops to zero */
     HDassert(H5F_ID_EXISTS(f));
 
+#ifdef H5VL_NATIVE_ASYNC
+    /* Finish asynchronous operations on the file's datasets */
+    if (H5VL__native_async_finish(NULL, f) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTWAIT, FAIL, "can't finish asynchronous operations on file")
+#endif /* H5VL_NATIVE_ASYNC */
+
     /* Flush file if this is the last reference to this id and we have write
      * intent, unless it will be flushed by the "shared" file being closed.
      * This is only necessary to replicate previous behaviour, and could be
@@ -120,6 +120,12 @@ H5VL__native_object_copy(void *src_obj, const H5VL_loc_params_t *loc_params1, co
     if (H5G_loc_real(dst_obj, loc_params2->obj_type, &dst_loc) < 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
 
+#ifdef H5VL_NATIVE_ASYNC
+    /* Finish asynchronous operations on the source file's datasets */
+    if (H5VL__native_async_finish(NULL, src_loc.oloc->file) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTWAIT, FAIL, "can't finish asynchronous operations on file")
+#endif /* H5VL_NATIVE_ASYNC */
+
     /* Copy the object */
     if ((ret_value = H5O__copy(&src_loc, src_name, &dst_loc, dst_name, ocpypl_id, lcpl_id)) < 0)
         HGOTO_ERROR(H5E_OHDR, H5E_CANTCOPY, FAIL, "unable to copy object")
@@ -309,6 +315,12 @@ H5VL__native_object_specific(void *obj, const H5VL_loc_params_t *loc_params,
     if (H5G_loc_real(obj, loc_params->obj_type, &loc) < 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
 
+#ifdef H5VL_NATIVE_ASYNC
+    /* Finish asynchronous operations on the file's datasets */
+    if (H5VL__native_async_finish(NULL, loc.oloc->file) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTWAIT, FAIL, "can't finish asynchronous operations on file")
+#endif /* H5VL_NATIVE_ASYNC */
+
     switch (specific_type) {
         /* H5Oincr_refcount / H5Odecr_refcount */
         case H5VL_OBJECT_CHANGE_REF_COUNT: {
@@ -445,6 +457,12 @@ H5VL__native_object_optional(void *obj, H5VL_object_optional_t optional_type, hi
     if (H5G_loc_real(obj, loc_params->obj_type, &loc) < 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
 
+#ifdef H5VL_NATIVE_ASYNC
+    /* Finish asynchronous operations on the file's datasets */
+    if (H5VL__native_async_finish(NULL, loc.oloc->file) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTWAIT, FAIL, "can't finish asynchronous operations on file")
+#endif /* H5VL_NATIVE_ASYNC */
+
     switch (optional_type) {
         /* H5Oget_comment / H5Oget_comment_by_name */
         case H5VL_NATIVE_OBJECT_GET_COMMENT: {
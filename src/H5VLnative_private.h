@@ -18,17 +18,31 @@
 #define H5VLnative_private_H
 
 /* Private headers needed by this file */
+#include "H5Dprivate.h" /* Datasets                                 */
 #include "H5Fprivate.h" /* Files                                    */
+#include "H5Sprivate.h" /* Dataspaces                               */
 #include "H5VLnative.h" /* Native VOL connector                     */
 
 /**************************/
 /* Library Private Macros */
 /**************************/
 
+/* Asynchronous operations are run by background threads in thread-safe builds */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+#define H5VL_NATIVE_ASYNC
+#endif
+
 /****************************/
 /* Library Private Typedefs */
 /****************************/
 
+/* Kinds of asynchronous operations */
+typedef enum H5VL_native_async_op_type_t {
+    H5VL_NATIVE_ASYNC_READ,  /* H5Dread_async  */
+    H5VL_NATIVE_ASYNC_WRITE, /* H5Dwrite_async */
+    H5VL_NATIVE_ASYNC_CLOSE  /* H5Dclose_async */
+} H5VL_native_async_op_type_t;
+
 /*****************************/
 /* Library Private Variables */
 /*****************************/
@@ -174,6 +188,23 @@ H5_DLL herr_t H5VL_native_addr_to_token(void *obj, H5I_type_t obj_type, haddr_t
 H5_DLL herr_t H5VL_native_token_to_addr(void *obj, H5I_type_t obj_type, H5O_token_t token, haddr_t *addr);
 H5_DLL herr_t H5VL_native_get_file_struct(void *obj, H5I_type_t type, H5F_t **file);
 
+#ifdef H5VL_NATIVE_ASYNC
+/* Request callbacks */
+H5_DLL herr_t H5VL__native_request_wait(void *req, uint64_t timeout, H5VL_request_status_t *status);
+H5_DLL herr_t H5VL__native_request_cancel(void *req, H5VL_request_status_t *status);
+H5_DLL herr_t H5VL__native_request_specific(void *req, H5VL_request_specific_t specific_type,
+                                            va_list arguments);
+H5_DLL herr_t H5VL__native_request_free(void *req);
+
+/* Asynchronous operations */
+H5_DLL herr_t  H5VL__native_async_queue(H5VL_native_async_op_type_t op_type, H5D_t *dset, hid_t mem_type_id,
+                                        const H5S_t *mem_space, const H5S_t *file_space, hid_t dxpl_id,
+                                        void *rbuf, const void *wbuf, void **req);
+H5_DLL hbool_t H5VL__native_async_pending(const H5D_t *dset);
+H5_DLL herr_t  H5VL__native_async_finish(const H5D_t *dset, const H5F_t *file);
+H5_DLL herr_t  H5VL_native_async_term(void);
+#endif /* H5VL_NATIVE_ASYNC */
+
 #ifdef __cplusplus
 }
 #endif
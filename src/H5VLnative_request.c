@@ -0,0 +1,745 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Asynchronous operations & request callbacks for the native
+ *              VOL connector
+ *
+ *              In thread-safe builds, H5Dread_async(), H5Dwrite_async() and
+ *              H5Dclose_async() put the operation on a queue and return a
+ *              request token for the event set, and a background thread
+ *              runs the queued operations.  Operations on the same dataset
+ *              run in the order they were queued.
+ *
+ *              Operations run while holding the global library lock, and
+ *              don't give it up during I/O, so a thread that holds the lock
+ *              knows that no queued operation is in progress.  Anything that
+ *              has to wait for queued operations (H5ESwait, or a synchronous
+ *              call on the same dataset or file) runs them itself, in order,
+ *              instead of waiting for the background thread.
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#define H5D_FRIEND /* Suppress error about including H5Dpkg    */
+
+/***********/
+/* Headers */
+/***********/
+
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5CXprivate.h" /* API Contexts                             */
+#include "H5Dpkg.h"      /* Datasets                                 */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5Fprivate.h"  /* Files                                    */
+#include "H5FLprivate.h" /* Free Lists                               */
+#include "H5Iprivate.h"  /* IDs                                      */
+#include "H5Pprivate.h"  /* Property lists                           */
+#include "H5Sprivate.h"  /* Dataspaces                               */
+#include "H5VLprivate.h" /* Virtual Object Layer                     */
+
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
+#ifdef H5VL_NATIVE_ASYNC
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Number of background threads.  Operations hold the global library lock
+ * while they run, so more threads wouldn't run more of them at once.
+ */
+#define H5VL_NATIVE_ASYNC_NTHREADS 1
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* States of an asynchronous operation */
+typedef enum H5VL_native_async_state_t {
+    H5VL_NATIVE_ASYNC_QUEUED,  /* Waiting to run */
+    H5VL_NATIVE_ASYNC_RUNNING, /* Being run */
+    H5VL_NATIVE_ASYNC_DONE     /* Finished, or canceled */
+} H5VL_native_async_state_t;
+
+/* An asynchronous operation, which is also its request token */
+typedef struct H5VL_native_async_op_t {
+    H5VL_native_async_op_type_t type;         /* Kind of operation */
+    H5VL_native_async_state_t   state;        /* State of the operation */
+    H5VL_request_status_t       status;       /* Result of the operation, once it's done */
+    hid_t                       err_stack_id; /* Error stack, if the operation failed */
+    hbool_t                     released;     /* Whether the request token has been freed */
+
+    /* Operation's arguments */
+    H5D_t *     dset;        /* Dataset */
+    hid_t       mem_type_id; /* Memory datatype (held open) */
+    H5S_t *     mem_space;   /* Copy of memory dataspace (NULL for H5S_ALL) */
+    H5S_t *     file_space;  /* Copy of file dataspace (NULL for H5S_ALL) */
+    hid_t       dxpl_id;     /* Copy of DXPL */
+    void *      rbuf;        /* Application's buffer to read into */
+    const void *wbuf;        /* Application's buffer to write from */
+
+    /* Keys for ordering operations */
+    const void *dset_key; /* Dataset's shared info */
+    const void *file_key; /* Dataset's file's shared info */
+
+    /* Queue of unfinished operations */
+    struct H5VL_native_async_op_t *prev;
+    struct H5VL_native_async_op_t *next;
+} H5VL_native_async_op_t;
+
+/* Queue of unfinished operations, shared with the background threads */
+typedef struct H5VL_native_async_queue_t {
+    pthread_mutex_t         lock;     /* Lock for the fields below */
+    pthread_cond_t          cond;     /* Signaled when there is work to do, or on shutdown */
+    H5VL_native_async_op_t *head;     /* First (oldest) unfinished operation */
+    H5VL_native_async_op_t *tail;     /* Last (newest) unfinished operation */
+    unsigned                nthreads; /* Number of background threads */
+    hbool_t                 shutdown; /* Whether the background threads should exit */
+} H5VL_native_async_queue_t;
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static H5VL_native_async_op_t *H5VL__native_async_next(const void *dset_key, const void *file_key);
+static herr_t                  H5VL__native_async_release(H5VL_native_async_op_t *op);
+static herr_t                  H5VL__native_async_exec(H5VL_native_async_op_t *op);
+static void                    H5VL__native_async_run(H5VL_native_async_op_t *op);
+static void *                  H5VL__native_async_thread(void *arg);
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5VL_native_async_op_t struct */
+H5FL_DEFINE_STATIC(H5VL_native_async_op_t);
+
+/* The queue (the lock & condition are never destroyed, since background
+ * threads may still be waking up after the library is closed)
+ */
+static H5VL_native_async_queue_t H5VL_native_async_queue_g = {
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, NULL, 0, FALSE};
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_next
+ *
+ * Purpose:     Find the oldest queued operation that can run now, on the
+ *              dataset or file with the given key (any operation when
+ *              both keys are NULL).  An operation can run when no older
+ *              unfinished operation is on the same dataset.
+ *
+ *              The queue's lock must be held.
+ *
+ * Return:      Success:    Pointer to the operation
+ *              Failure:    NULL, if there's no such operation
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5VL_native_async_op_t *
+H5VL__native_async_next(const void *dset_key, const void *file_key)
+{
+    H5VL_native_async_op_t *op;               /* Operation to check */
+    H5VL_native_async_op_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (op = H5VL_native_async_queue_g.head; op && !ret_value; op = op->next) {
+        H5VL_native_async_op_t *prev; /* Older operation */
+
+        if (op->state != H5VL_NATIVE_ASYNC_QUEUED)
+            continue;
+        if ((dset_key && op->dset_key != dset_key) || (file_key && op->file_key != file_key))
+            continue;
+
+        /* Check for an older operation on the same dataset */
+        for (prev = op->prev; prev; prev = prev->prev)
+            if (prev->dset_key == op->dset_key)
+                break;
+        if (NULL == prev)
+            ret_value = op;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_next() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_release
+ *
+ * Purpose:     Release the copies of an operation's arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_async_release(H5VL_native_async_op_t *op)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (op->mem_type_id >= 0 && H5I_dec_ref(op->mem_type_id) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTDEC, FAIL, "can't release memory datatype")
+    op->mem_type_id = H5I_INVALID_HID;
+    if (op->mem_space && H5S_close(op->mem_space) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release memory dataspace")
+    op->mem_space = NULL;
+    if (op->file_space && H5S_close(op->file_space) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release file dataspace")
+    op->file_space = NULL;
+    if (op->dxpl_id >= 0 && op->dxpl_id != H5P_DATASET_XFER_DEFAULT && H5I_dec_ref(op->dxpl_id) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTDEC, FAIL, "can't release DXPL")
+    op->dxpl_id = H5I_INVALID_HID;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_exec
+ *
+ * Purpose:     Perform an asynchronous operation, in its own API context,
+ *              and release its arguments.
+ *
+ *              The global library lock must be held.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5VL__native_async_exec(H5VL_native_async_op_t *op)
+{
+    hbool_t api_ctx_pushed = FALSE;   /* Whether an API context was pushed */
+    herr_t  ret_value      = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (H5CX_push() < 0)
+        HGOTO_ERROR(H5E_VOL, H5E_CANTSET, FAIL, "can't set API context")
+    api_ctx_pushed = TRUE;
+
+    /* Set DXPL for operation */
+    H5CX_set_dxpl(op->dxpl_id);
+
+    switch (op->type) {
+        case H5VL_NATIVE_ASYNC_READ:
+            if (H5D__read(op->dset, op->mem_type_id, op->mem_space, op->file_space, op->rbuf, NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data")
+            break;
+
+        case H5VL_NATIVE_ASYNC_WRITE:
+            if (H5D__write(op->dset, op->mem_type_id, op->mem_space, op->file_space, op->wbuf, NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data")
+            break;
+
+        case H5VL_NATIVE_ASYNC_CLOSE:
+            if (H5D_close(op->dset) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't close dataset")
+            break;
+
+        default:
+            HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid asynchronous operation")
+    } /* end switch */
+
+done:
+    if (H5VL__native_async_release(op) < 0)
+        HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release operation's arguments")
+    if (api_ctx_pushed)
+        H5CX_pop(FALSE);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_exec() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_run
+ *
+ * Purpose:     Run an operation that was marked as running, record its
+ *              result, and take it off the queue.
+ *
+ *              The global library lock must be held, and the queue's lock
+ *              must not be.
+ *
+ * Return:      None
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5VL__native_async_run(H5VL_native_async_op_t *op)
+{
+    H5VL_native_async_queue_t *queue    = &H5VL_native_async_queue_g;
+    H5VL_request_status_t      status   = H5VL_REQUEST_STATUS_SUCCEED; /* Result of operation */
+    hid_t                      err_id   = H5I_INVALID_HID;             /* Operation's error stack */
+    hbool_t                    released = FALSE; /* Whether the token has been freed */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(op->state == H5VL_NATIVE_ASYNC_RUNNING);
+
+    /* Perform the operation, keeping its errors for the event set */
+    if (H5VL__native_async_exec(op) < 0) {
+        H5E_t *estack; /* Copy of the error stack */
+
+        status = H5VL_REQUEST_STATUS_FAIL;
+        if (NULL != (estack = H5E_get_current_stack()))
+            err_id = H5I_register(H5I_ERROR_STACK, estack, TRUE);
+    } /* end if */
+
+    /* Take the operation off the queue */
+    H5TS_mutex_lock_simple(&queue->lock);
+    op->state        = H5VL_NATIVE_ASYNC_DONE;
+    op->status       = status;
+    op->err_stack_id = err_id;
+    if (op->prev)
+        op->prev->next = op->next;
+    else
+        queue->head = op->next;
+    if (op->next)
+        op->next->prev = op->prev;
+    else
+        queue->tail = op->prev;
+    op->prev = op->next = NULL;
+    released            = op->released;
+
+    /* Later operations on the same dataset may be able to run now */
+    if (queue->head)
+        HDpthread_cond_signal(&queue->cond);
+    H5TS_mutex_unlock_simple(&queue->lock);
+
+    /* Free the operation, if nobody is waiting for its result */
+    if (released) {
+        if (op->err_stack_id >= 0)
+            H5I_dec_app_ref(op->err_stack_id);
+        op = H5FL_FREE(H5VL_native_async_op_t, op);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5VL__native_async_run() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_thread
+ *
+ * Purpose:     Run queued operations, until the library shuts down.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5VL__native_async_thread(void H5_ATTR_UNUSED *arg)
+{
+    H5VL_native_async_queue_t *queue = &H5VL_native_async_queue_g;
+
+    FUNC_ENTER_STATIC_NAMECHECK_ONLY
+
+    for (;;) {
+        H5VL_native_async_op_t *op; /* Operation to run */
+
+        /* Wait for an operation that can run */
+        H5TS_mutex_lock_simple(&queue->lock);
+        while (!queue->shutdown && NULL == H5VL__native_async_next(NULL, NULL))
+            HDpthread_cond_wait(&queue->cond, &queue->lock);
+        if (queue->shutdown) {
+            queue->nthreads--;
+            H5TS_mutex_unlock_simple(&queue->lock);
+            break;
+        } /* end if */
+        H5TS_mutex_unlock_simple(&queue->lock);
+
+        /* Take the global lock twice, so that the operation can't give it up
+         * during I/O (see H5TS_mutex_yield), then claim the operation, unless
+         * another thread ran it in the meantime.
+         */
+        H5_API_LOCK
+        H5_API_LOCK
+        H5TS_mutex_lock_simple(&queue->lock);
+        if (NULL != (op = H5VL__native_async_next(NULL, NULL)))
+            op->state = H5VL_NATIVE_ASYNC_RUNNING;
+        H5TS_mutex_unlock_simple(&queue->lock);
+
+        if (op)
+            H5VL__native_async_run(op);
+        H5_API_UNLOCK
+        H5_API_UNLOCK
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_NAMECHECK_ONLY(NULL)
+} /* end H5VL__native_async_thread() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_queue
+ *
+ * Purpose:     Queue an asynchronous read, write or close of a dataset,
+ *              starting the background threads if needed.  RBUF is the
+ *              buffer for a read, and WBUF the buffer for a write.  The
+ *              dataspaces and DXPL are copied and the memory datatype is
+ *              held open, so the application can close them once this
+ *              returns.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_async_queue(H5VL_native_async_op_type_t op_type, H5D_t *dset, hid_t mem_type_id,
+                         const H5S_t *mem_space, const H5S_t *file_space, hid_t dxpl_id, void *rbuf,
+                         const void *wbuf, void **req)
+{
+    H5VL_native_async_queue_t *queue     = &H5VL_native_async_queue_g;
+    H5VL_native_async_op_t *   op        = NULL;    /* New operation */
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+    HDassert(req);
+
+    /* Set up the operation */
+    if (NULL == (op = H5FL_CALLOC(H5VL_native_async_op_t)))
+        HGOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate asynchronous operation")
+    op->type         = op_type;
+    op->state        = H5VL_NATIVE_ASYNC_QUEUED;
+    op->status       = H5VL_REQUEST_STATUS_IN_PROGRESS;
+    op->err_stack_id = H5I_INVALID_HID;
+    op->dset         = dset;
+    op->mem_type_id  = H5I_INVALID_HID;
+    op->dxpl_id      = H5P_DATASET_XFER_DEFAULT;
+    op->rbuf         = rbuf;
+    op->wbuf         = wbuf;
+    op->dset_key     = dset->shared;
+    op->file_key     = H5F_SHARED(dset->oloc.file);
+
+    if (op_type != H5VL_NATIVE_ASYNC_CLOSE) {
+        if (H5I_inc_ref(mem_type_id, FALSE) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTINC, FAIL, "can't hold memory datatype")
+        op->mem_type_id = mem_type_id;
+        if (mem_space && NULL == (op->mem_space = H5S_copy(mem_space, FALSE, TRUE)))
+            HGOTO_ERROR(H5E_VOL, H5E_CANTCOPY, FAIL, "can't copy memory dataspace")
+        if (file_space && NULL == (op->file_space = H5S_copy(file_space, FALSE, TRUE)))
+            HGOTO_ERROR(H5E_VOL, H5E_CANTCOPY, FAIL, "can't copy file dataspace")
+        if (dxpl_id != H5P_DATASET_XFER_DEFAULT) {
+            H5P_genplist_t *plist; /* DXPL */
+
+            if (NULL == (plist = (H5P_genplist_t *)H5P_object_verify(dxpl_id, H5P_DATASET_XFER)))
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset transfer property list")
+            if ((op->dxpl_id = H5P_copy_plist(plist, FALSE)) < 0)
+                HGOTO_ERROR(H5E_VOL, H5E_CANTCOPY, FAIL, "can't copy DXPL")
+        } /* end if */
+    }     /* end if */
+
+    /* Queue the operation, and start the background threads if they aren't
+     * running.  (If a thread can't be started, the operations are run by
+     * whoever waits for them.)
+     */
+    H5TS_mutex_lock_simple(&queue->lock);
+    queue->shutdown = FALSE;
+    while (queue->nthreads < H5VL_NATIVE_ASYNC_NTHREADS) {
+        pthread_t thread; /* New background thread */
+
+        if (0 != HDpthread_create(&thread, NULL, H5VL__native_async_thread, NULL))
+            break;
+        HDpthread_detach(thread);
+        queue->nthreads++;
+    } /* end while */
+    op->prev = queue->tail;
+    if (queue->tail)
+        queue->tail->next = op;
+    else
+        queue->head = op;
+    queue->tail = op;
+    HDpthread_cond_signal(&queue->cond);
+    H5TS_mutex_unlock_simple(&queue->lock);
+
+    /* Set the request token */
+    *req = op;
+
+done:
+    if (ret_value < 0 && op) {
+        if (H5VL__native_async_release(op) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release operation's arguments")
+        op = H5FL_FREE(H5VL_native_async_op_t, op);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_queue() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_pending
+ *
+ * Purpose:     Check if there are unfinished operations on a dataset.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5VL__native_async_pending(const H5D_t *dset)
+{
+    H5VL_native_async_op_t *op;                /* Operation to check */
+    hbool_t                 ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    H5TS_mutex_lock_simple(&H5VL_native_async_queue_g.lock);
+    for (op = H5VL_native_async_queue_g.head; op && !ret_value; op = op->next)
+        if (op->dset == dset)
+            ret_value = TRUE;
+    H5TS_mutex_unlock_simple(&H5VL_native_async_queue_g.lock);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_async_pending() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_async_finish
+ *
+ * Purpose:     Run the queued operations on a dataset (when DSET isn't
+ *              NULL), on the datasets in a file (when FILE isn't NULL), or
+ *              all of them, in this thread.  Their results are kept for
+ *              the event sets they were inserted in.
+ *
+ *              The global library lock must be held, so none of the
+ *              operations can be in progress in a background thread.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_async_finish(const H5D_t *dset, const H5F_t *file)
+{
+    H5VL_native_async_queue_t *queue    = &H5VL_native_async_queue_g;
+    const void *               dset_key = NULL; /* Key of operations to run */
+    const void *               file_key = NULL; /* Key of operations to run */
+    H5VL_native_async_op_t *   op;              /* Operation to run */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    if (dset)
+        dset_key = dset->shared;
+    else if (file)
+        file_key = H5F_SHARED(file);
+
+    H5TS_mutex_lock_simple(&queue->lock);
+    while (NULL != (op = H5VL__native_async_next(dset_key, file_key))) {
+        op->state = H5VL_NATIVE_ASYNC_RUNNING;
+        H5TS_mutex_unlock_simple(&queue->lock);
+
+        H5VL__native_async_run(op);
+
+        H5TS_mutex_lock_simple(&queue->lock);
+    } /* end while */
+    H5TS_mutex_unlock_simple(&queue->lock);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5VL__native_async_finish() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL_native_async_term
+ *
+ * Purpose:     Run any queued operations and stop the background threads,
+ *              when the library is closing.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL_native_async_term(void)
+{
+    H5VL_native_async_queue_t *queue = &H5VL_native_async_queue_g;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    H5VL__native_async_finish(NULL, NULL);
+
+    H5TS_mutex_lock_simple(&queue->lock);
+    queue->shutdown = TRUE;
+    HDpthread_cond_broadcast(&queue->cond);
+    H5TS_mutex_unlock_simple(&queue->lock);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5VL_native_async_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_wait
+ *
+ * Purpose:     Handles the request wait callback.  An operation that hasn't
+ *              run yet is run by this thread, after the older operations
+ *              on its dataset, unless TIMEOUT is 0.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_wait(void *req, uint64_t timeout, H5VL_request_status_t *status)
+{
+    H5VL_native_async_op_t *op = (H5VL_native_async_op_t *)req;
+    H5VL_native_async_op_t *next; /* Operation to run */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(op);
+    HDassert(status);
+
+    H5TS_mutex_lock_simple(&H5VL_native_async_queue_g.lock);
+    if (timeout > 0)
+        while (op->state == H5VL_NATIVE_ASYNC_QUEUED &&
+               NULL != (next = H5VL__native_async_next(op->dset_key, NULL))) {
+            next->state = H5VL_NATIVE_ASYNC_RUNNING;
+            H5TS_mutex_unlock_simple(&H5VL_native_async_queue_g.lock);
+
+            H5VL__native_async_run(next);
+
+            H5TS_mutex_lock_simple(&H5VL_native_async_queue_g.lock);
+        } /* end while */
+    *status = op->status;
+    H5TS_mutex_unlock_simple(&H5VL_native_async_queue_g.lock);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5VL__native_request_wait() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_cancel
+ *
+ * Purpose:     Handles the request cancel callback.  Only operations that
+ *              haven't started can be canceled.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_cancel(void *req, H5VL_request_status_t *status)
+{
+    H5VL_native_async_queue_t *queue    = &H5VL_native_async_queue_g;
+    H5VL_native_async_op_t *   op       = (H5VL_native_async_op_t *)req;
+    hbool_t                    canceled = FALSE;   /* Whether the operation was canceled */
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(op);
+    HDassert(status);
+
+    H5TS_mutex_lock_simple(&queue->lock);
+    if (op->state == H5VL_NATIVE_ASYNC_QUEUED) {
+        op->state  = H5VL_NATIVE_ASYNC_DONE;
+        op->status = H5VL_REQUEST_STATUS_CANCELED;
+        if (op->prev)
+            op->prev->next = op->next;
+        else
+            queue->head = op->next;
+        if (op->next)
+            op->next->prev = op->prev;
+        else
+            queue->tail = op->prev;
+        op->prev = op->next = NULL;
+        canceled            = TRUE;
+    } /* end if */
+    H5TS_mutex_unlock_simple(&queue->lock);
+
+    if (canceled) {
+        *status = H5VL_REQUEST_STATUS_CANCELED;
+        if (H5VL__native_async_release(op) < 0)
+            HGOTO_ERROR(H5E_VOL, H5E_CANTRELEASE, FAIL, "can't release operation's arguments")
+    } /* end if */
+    else
+        *status = H5VL_REQUEST_STATUS_CANT_CANCEL;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_cancel() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_specific
+ *
+ * Purpose:     Handles the request specific callback
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_specific(void *req, H5VL_request_specific_t specific_type, va_list arguments)
+{
+    H5VL_native_async_op_t *op        = (H5VL_native_async_op_t *)req;
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(op);
+
+    switch (specific_type) {
+        case H5VL_REQUEST_GET_ERR_STACK: {
+            hid_t *err_stack_id = HDva_arg(arguments, hid_t *);
+
+            /* Hand the error stack over to the caller */
+            if (op->state != H5VL_NATIVE_ASYNC_DONE)
+                HGOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "operation hasn't finished")
+            *err_stack_id    = op->err_stack_id;
+            op->err_stack_id = H5I_INVALID_HID;
+
+            break;
+        }
+
+        case H5VL_REQUEST_WAITANY:
+        case H5VL_REQUEST_WAITSOME:
+        case H5VL_REQUEST_WAITALL:
+        default:
+            HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid specific operation")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_specific() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5VL__native_request_free
+ *
+ * Purpose:     Handles the request free callback.  An unfinished operation
+ *              is freed once it's done.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5VL__native_request_free(void *req)
+{
+    H5VL_native_async_op_t *op        = (H5VL_native_async_op_t *)req;
+    hbool_t                 done      = FALSE;   /* Whether the operation is done */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(op);
+
+    H5TS_mutex_lock_simple(&H5VL_native_async_queue_g.lock);
+    if (op->state == H5VL_NATIVE_ASYNC_DONE)
+        done = TRUE;
+    else
+        op->released = TRUE;
+    H5TS_mutex_unlock_simple(&H5VL_native_async_queue_g.lock);
+
+    if (done) {
+        if (op->err_stack_id >= 0 && H5I_dec_app_ref(op->err_stack_id) < 0)
+            HDONE_ERROR(H5E_VOL, H5E_CANTDEC, FAIL, "can't release error stack")
+        op = H5FL_FREE(H5VL_native_async_op_t, op);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5VL__native_request_free() */
+
+#endif /* H5VL_NATIVE_ASYNC */
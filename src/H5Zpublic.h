@@ -147,6 +147,17 @@ typedef int H5Z_filter_t;
  * Total number of parameters for the shuffle filter
  */
 #define H5Z_SHUFFLE_TOTAL_NPARMS 1
+/**
+ * \ingroup SHUFFLE
+ * Shuffle mode: shuffle the bytes of each element (the default)
+ */
+#define H5Z_SHUFFLE_BYTE 0
+/**
+ * \ingroup SHUFFLE
+ * Shuffle mode: shuffle the bytes of each element, then the bits in each
+ * byte-position
+ */
+#define H5Z_SHUFFLE_BIT 1
 
 /* Macros for the szip filter */
 /**
@@ -21,10 +21,35 @@
 #include "H5Tprivate.h"  /* Datatypes         			*/
 #include "H5Zpkg.h"      /* Data filters				*/
 
+#ifdef H5_HAVE_SIMD_DISPATCH
+#include <immintrin.h>
+#endif /* H5_HAVE_SIMD_DISPATCH */
+
 /* Local function prototypes */
 static herr_t H5Z__set_local_shuffle(hid_t dcpl_id, hid_t type_id, hid_t space_id);
 static size_t H5Z__filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
                                   size_t *buf_size, void **buf);
+static void   H5Z__shuffle_bytes(unsigned char *dest, const unsigned char *src, size_t bytesoftype,
+                                 size_t numofelements);
+static void   H5Z__unshuffle_bytes(unsigned char *dest, const unsigned char *src, size_t bytesoftype,
+                                   size_t numofelements);
+static void   H5Z__shuffle_bits(unsigned char *dest, const unsigned char *src, size_t nplanes, size_t nbytes);
+static void   H5Z__unshuffle_bits(unsigned char *dest, const unsigned char *src, size_t nplanes,
+                                  size_t nbytes);
+#ifdef H5_HAVE_SIMD_DISPATCH
+static size_t H5Z__shuffle_sse2(unsigned char *dest, const unsigned char *src, size_t bytesoftype,
+                                size_t numofelements);
+static size_t H5Z__unshuffle_sse2(unsigned char *dest, const unsigned char *src, size_t bytesoftype,
+                                  size_t numofelements);
+static size_t H5Z__shuffle_avx2(unsigned char *dest, const unsigned char *src, size_t bytesoftype,
+                                size_t numofelements);
+static size_t H5Z__unshuffle_avx2(unsigned char *dest, const unsigned char *src, size_t bytesoftype,
+                                  size_t numofelements);
+static size_t H5Z__shuffle_bits_sse2(unsigned char *dest, const unsigned char *src, size_t ngroups);
+static size_t H5Z__unshuffle_bits_sse2(unsigned char *dest, const unsigned char *src, size_t ngroups);
+static size_t H5Z__shuffle_bits_avx2(unsigned char *dest, const unsigned char *src, size_t ngroups);
+static size_t H5Z__unshuffle_bits_avx2(unsigned char *dest, const unsigned char *src, size_t ngroups);
+#endif /* H5_HAVE_SIMD_DISPATCH */
 
 /* This message derives from H5Z */
 const H5Z_class2_t H5Z_SHUFFLE[1] = {{
@@ -40,6 +65,36 @@ const H5Z_class2_t H5Z_SHUFFLE[1] = {{
 
 /* Local macros */
 #define H5Z_SHUFFLE_PARM_SIZE 0 /* "Local" parameter for shuffling size */
+#define H5Z_SHUFFLE_PARM_MODE 1 /* Optional parameter for shuffle mode */
+
+/* Largest element size with SSE2/AVX2 [un]shuffle kernels (which handle
+ * element sizes that are powers of two up to this)
+ */
+#define H5Z_SHUFFLE_SIMD_MAX_SIZE 16
+
+#ifdef H5_HAVE_SIMD_DISPATCH
+/* The SSE2/AVX2 kernels are written for any element size, and are inlined
+ * into callers with a constant element size, with the loops over the
+ * vectors unrolled, so that the vectors are kept in registers
+ */
+#define H5Z_SHUFFLE_INLINE H5_INLINE __attribute__((always_inline))
+#define H5Z_SHUFFLE_UNROLL _Pragma("GCC unroll 16")
+#endif /* H5_HAVE_SIMD_DISPATCH */
+
+/* Transpose the 8x8 bit matrix in a uint64_t whose bytes are its rows (least
+ * significant first): bit 'j' of byte 'i' is swapped with bit 'i' of byte 'j'.
+ */
+#define H5Z_SHUFFLE_TRANSPOSE_BITS(x)                                                                        \
+    {                                                                                                        \
+        uint64_t _t;                                                                                         \
+                                                                                                             \
+        _t  = ((x) ^ ((x) >> 7)) & (uint64_t)0x00AA00AA00AA00AAULL;                                          \
+        (x) = (x) ^ _t ^ (_t << 7);                                                                          \
+        _t  = ((x) ^ ((x) >> 14)) & (uint64_t)0x0000CCCC0000CCCCULL;                                         \
+        (x) = (x) ^ _t ^ (_t << 14);                                                                         \
+        _t  = ((x) ^ ((x) >> 28)) & (uint64_t)0x00000000F0F0F0F0ULL;                                         \
+        (x) = (x) ^ _t ^ (_t << 28);                                                                         \
+    }
 
 /*-------------------------------------------------------------------------
  * Function:	H5Z__set_local_shuffle
@@ -58,12 +113,12 @@ const H5Z_class2_t H5Z_SHUFFLE[1] = {{
 static herr_t
 H5Z__set_local_shuffle(hid_t dcpl_id, hid_t type_id, hid_t H5_ATTR_UNUSED space_id)
 {
-    H5P_genplist_t *dcpl_plist;                          /* Property list pointer */
-    const H5T_t *   type;                                /* Datatype */
-    unsigned        flags;                               /* Filter flags */
-    size_t          cd_nelmts = H5Z_SHUFFLE_USER_NPARMS; /* Number of filter parameters */
-    unsigned        cd_values[H5Z_SHUFFLE_TOTAL_NPARMS]; /* Filter parameters */
-    herr_t          ret_value = SUCCEED;                 /* Return value */
+    H5P_genplist_t *dcpl_plist;                              /* Property list pointer */
+    const H5T_t *   type;                                    /* Datatype */
+    unsigned        flags;                                   /* Filter flags */
+    size_t          cd_nelmts = H5Z_SHUFFLE_TOTAL_NPARMS + 1; /* Number of filter parameters */
+    unsigned        cd_values[H5Z_SHUFFLE_TOTAL_NPARMS + 1]; /* Filter parameters */
+    herr_t          ret_value = SUCCEED;                     /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -80,13 +135,24 @@ H5Z__set_local_shuffle(hid_t dcpl_id, hid_t type_id, hid_t H5_ATTR_UNUSED space_
                              NULL) < 0)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get shuffle parameters")
 
+    /* Keep the shuffle mode only if it isn't the default (byte shuffling), so
+     * that byte shuffled datasets can still be read by older versions of the
+     * library
+     */
+    if (cd_nelmts > H5Z_SHUFFLE_PARM_MODE && cd_values[H5Z_SHUFFLE_PARM_MODE] != H5Z_SHUFFLE_BYTE) {
+        if (cd_values[H5Z_SHUFFLE_PARM_MODE] != H5Z_SHUFFLE_BIT)
+            HGOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FAIL, "invalid shuffle mode")
+        cd_nelmts = H5Z_SHUFFLE_TOTAL_NPARMS + 1;
+    } /* end if */
+    else
+        cd_nelmts = H5Z_SHUFFLE_TOTAL_NPARMS;
+
     /* Set "local" parameter for this dataset */
     if ((cd_values[H5Z_SHUFFLE_PARM_SIZE] = (unsigned)H5T_get_size(type)) == 0)
         HGOTO_ERROR(H5E_PLINE, H5E_BADTYPE, FAIL, "bad datatype size")
 
     /* Modify the filter's parameters for this dataset */
-    if (H5P_modify_filter(dcpl_plist, H5Z_FILTER_SHUFFLE, flags, (size_t)H5Z_SHUFFLE_TOTAL_NPARMS,
-                          cd_values) < 0)
+    if (H5P_modify_filter(dcpl_plist, H5Z_FILTER_SHUFFLE, flags, cd_nelmts, cd_values) < 0)
         HGOTO_ERROR(H5E_PLINE, H5E_CANTSET, FAIL, "can't set local shuffle parameters")
 
 done:
@@ -103,6 +169,14 @@ done:
  *              Usually, the bytes in each byte position are more related to
  *              each other and putting them together will increase compression.
  *
+ *              In bit shuffle mode (H5Z_SHUFFLE_BIT), each block of bytes
+ *              from one byte-position is then split up further by bit
+ *              position: the bits in bit-position 0 of the first
+ *              (nelmts - (nelmts % 8)) bytes in the block come first, packed
+ *              into bytes (least significant bit first), followed by the
+ *              bits in bit-position 1, and so on, and then the rest of the
+ *              bytes in the block.
+ *
  * Return:	Success: Size of buffer filtered
  *		Failure: 0
  *
@@ -115,32 +189,35 @@ static size_t
 H5Z__filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[], size_t nbytes,
                     size_t *buf_size, void **buf)
 {
-    void *         dest  = NULL;  /* Buffer to deposit [un]shuffled bytes into */
-    unsigned char *_src  = NULL;  /* Alias for source buffer */
-    unsigned char *_dest = NULL;  /* Alias for destination buffer */
+    void *         dest = NULL;   /* Buffer to deposit [un]shuffled bytes into */
+    unsigned char *_src;          /* Alias for source buffer */
+    unsigned char *_dest;         /* Alias for destination buffer */
     unsigned       bytesoftype;   /* Number of bytes per element */
+    unsigned       mode;          /* Shuffle mode */
     size_t         numofelements; /* Number of elements in buffer */
-    size_t         i;             /* Local index variables */
-#ifdef NO_DUFFS_DEVICE
-    size_t j;             /* Local index variable */
-#endif                    /* NO_DUFFS_DEVICE */
-    size_t leftover;      /* Extra bytes at end of buffer */
-    size_t ret_value = 0; /* Return value */
+    size_t         leftover;      /* Extra bytes at end of buffer */
+    size_t         ret_value = 0; /* Return value */
 
     FUNC_ENTER_STATIC
 
     /* Check arguments */
-    if (cd_nelmts != H5Z_SHUFFLE_TOTAL_NPARMS || cd_values[H5Z_SHUFFLE_PARM_SIZE] == 0)
+    if ((cd_nelmts != H5Z_SHUFFLE_TOTAL_NPARMS && cd_nelmts != H5Z_SHUFFLE_TOTAL_NPARMS + 1) ||
+        cd_values[H5Z_SHUFFLE_PARM_SIZE] == 0)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid shuffle parameters")
 
-    /* Get the number of bytes per element from the parameter block */
+    /* Get the number of bytes per element and the mode from the parameter block */
     bytesoftype = cd_values[H5Z_SHUFFLE_PARM_SIZE];
+    mode        = cd_nelmts > H5Z_SHUFFLE_PARM_MODE ? cd_values[H5Z_SHUFFLE_PARM_MODE] : H5Z_SHUFFLE_BYTE;
+    if (mode != H5Z_SHUFFLE_BYTE && mode != H5Z_SHUFFLE_BIT)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, 0, "invalid shuffle mode")
 
     /* Compute the number of elements in buffer */
     numofelements = nbytes / bytesoftype;
 
-    /* Don't do anything for 1-byte elements, or "fractional" elements */
-    if (bytesoftype > 1 && numofelements > 1) {
+    /* Don't do anything for 1-byte elements (unless shuffling bits), or
+     * "fractional" elements
+     */
+    if ((bytesoftype > 1 || mode == H5Z_SHUFFLE_BIT) && numofelements > 1) {
         /* Compute the leftover bytes if there are any */
         leftover = nbytes % bytesoftype;
 
@@ -148,160 +225,1172 @@ H5Z__filter_shuffle(unsigned flags, size_t cd_nelmts, const unsigned cd_values[]
         if (NULL == (dest = H5MM_malloc(nbytes)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, 0, "memory allocation failed for shuffle buffer")
 
+        _src  = (unsigned char *)(*buf);
+        _dest = (unsigned char *)dest;
+
         if (flags & H5Z_FLAG_REVERSE) {
-            /* Get the pointer to the source buffer */
-            _src = (unsigned char *)(*buf);
+            /* Input; unshuffle bits, then bytes */
+            if (mode == H5Z_SHUFFLE_BIT) {
+                H5Z__unshuffle_bits(_dest, _src, (size_t)bytesoftype, numofelements);
+
+                /* (Unshuffle the bytes back into the input buffer) */
+                if (bytesoftype > 1) {
+                    _src  = (unsigned char *)dest;
+                    _dest = (unsigned char *)(*buf);
+                } /* end if */
+            }     /* end if */
+            if (bytesoftype > 1)
+                H5Z__unshuffle_bytes(_dest, _src, (size_t)bytesoftype, numofelements);
+        } /* end if */
+        else {
+            /* Output; shuffle bytes, then bits */
+            if (bytesoftype > 1)
+                H5Z__shuffle_bytes(_dest, _src, (size_t)bytesoftype, numofelements);
+            if (mode == H5Z_SHUFFLE_BIT) {
+                /* (Shuffle the bits back into the input buffer) */
+                if (bytesoftype > 1) {
+                    _src  = (unsigned char *)dest;
+                    _dest = (unsigned char *)(*buf);
+                } /* end if */
 
-            /* Input; unshuffle */
-            for (i = 0; i < bytesoftype; i++) {
-                _dest = ((unsigned char *)dest) + i;
+                H5Z__shuffle_bits(_dest, _src, (size_t)bytesoftype, numofelements);
+            } /* end if */
+        }     /* end else */
+
+        if (_dest == dest) {
+            /* Add leftover to the end of data */
+            if (leftover > 0)
+                H5MM_memcpy(_dest + (nbytes - leftover), ((unsigned char *)(*buf)) + (nbytes - leftover),
+                            leftover);
+
+            /* Free the input buffer */
+            H5MM_xfree(*buf);
+
+            /* Set the buffer information to return */
+            *buf      = dest;
+            *buf_size = nbytes;
+        } /* end if */
+        else
+            /* (The data ended up back in the input buffer, with the leftover
+             * bytes still at its end)
+             */
+            H5MM_xfree(dest);
+    } /* end if */
+
+    /* Set the return value */
+    ret_value = nbytes;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__filter_shuffle() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_bytes
+ *
+ * Purpose:	Shuffle NUMOFELEMENTS elements of BYTESOFTYPE bytes from SRC
+ *              into DEST, using SSE2 or AVX2 instructions where the
+ *              processor supports them.
+ *
+ * Return:	Void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__shuffle_bytes(unsigned char *dest, const unsigned char *src, size_t bytesoftype, size_t numofelements)
+{
+    const unsigned char *_src;      /* Alias for source buffer */
+    unsigned char *      _dest;     /* Alias for destination buffer */
+    size_t               first = 0; /* First element not shuffled yet */
+    size_t               nleft;     /* Number of elements not shuffled yet */
+    size_t               i;         /* Local index variables */
+#ifdef NO_DUFFS_DEVICE
+    size_t j; /* Local index variable */
+#endif        /* NO_DUFFS_DEVICE */
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_HAVE_SIMD_DISPATCH
+    /* Shuffle as many elements as possible with vector instructions */
+    if (bytesoftype <= H5Z_SHUFFLE_SIMD_MAX_SIZE && 0 == (bytesoftype & (bytesoftype - 1))) {
+        if (H5_CPU_HAS_AVX2())
+            first = H5Z__shuffle_avx2(dest, src, bytesoftype, numofelements);
+        else if (H5_CPU_HAS_SSE2())
+            first = H5Z__shuffle_sse2(dest, src, bytesoftype, numofelements);
+    } /* end if */
+#endif /* H5_HAVE_SIMD_DISPATCH */
+
+    /* Shuffle the rest of the elements */
+    nleft = numofelements - first;
+    if (nleft > 0)
+        for (i = 0; i < bytesoftype; i++) {
+            _src  = src + (first * bytesoftype) + i;
+            _dest = dest + (i * numofelements) + first;
 #define DUFF_GUTS                                                                                            \
-    *_dest = *_src++;                                                                                        \
-    _dest += bytesoftype;
+    *_dest++ = *_src;                                                                                        \
+    _src += bytesoftype;
 #ifdef NO_DUFFS_DEVICE
-                j = numofelements;
-                while (j > 0) {
-                    DUFF_GUTS;
-
-                    j--;
-                } /* end for */
-#else             /* NO_DUFFS_DEVICE */
-                {
-                    size_t duffs_index; /* Counting index for Duff's device */
-
-                    duffs_index = (numofelements + 7) / 8;
-                    switch (numofelements % 8) {
-                        default:
-                            HDassert(0 && "This Should never be executed!");
-                            break;
-                        case 0:
-                            do {
+            j = nleft;
+            while (j > 0) {
+                DUFF_GUTS;
+
+                j--;
+            } /* end for */
+#else         /* NO_DUFFS_DEVICE */
+            {
+                size_t duffs_index; /* Counting index for Duff's device */
+
+                duffs_index = (nleft + 7) / 8;
+                switch (nleft % 8) {
+                    default:
+                        HDassert(0 && "This Should never be executed!");
+                        break;
+                    case 0:
+                        do {
+                            DUFF_GUTS
+                            /* FALLTHROUGH */
+                            H5_ATTR_FALLTHROUGH
+                            case 7:
+                                DUFF_GUTS
+                                /* FALLTHROUGH */
+                                H5_ATTR_FALLTHROUGH
+                            case 6:
+                                DUFF_GUTS
+                                /* FALLTHROUGH */
+                                H5_ATTR_FALLTHROUGH
+                            case 5:
                                 DUFF_GUTS
                                 /* FALLTHROUGH */
                                 H5_ATTR_FALLTHROUGH
-                                case 7:
-                                    DUFF_GUTS
-                                    /* FALLTHROUGH */
-                                    H5_ATTR_FALLTHROUGH
-                                case 6:
-                                    DUFF_GUTS
-                                    /* FALLTHROUGH */
-                                    H5_ATTR_FALLTHROUGH
-                                case 5:
-                                    DUFF_GUTS
-                                    /* FALLTHROUGH */
-                                    H5_ATTR_FALLTHROUGH
-                                case 4:
-                                    DUFF_GUTS
-                                    /* FALLTHROUGH */
-                                    H5_ATTR_FALLTHROUGH
-                                case 3:
-                                    DUFF_GUTS
-                                    /* FALLTHROUGH */
-                                    H5_ATTR_FALLTHROUGH
-                                case 2:
-                                    DUFF_GUTS
-                                    /* FALLTHROUGH */
-                                    H5_ATTR_FALLTHROUGH
-                                case 1:
-                                    DUFF_GUTS
-                            } while (--duffs_index > 0);
-                    } /* end switch */
-                }
-#endif            /* NO_DUFFS_DEVICE */
+                            case 4:
+                                DUFF_GUTS
+                                /* FALLTHROUGH */
+                                H5_ATTR_FALLTHROUGH
+                            case 3:
+                                DUFF_GUTS
+                                /* FALLTHROUGH */
+                                H5_ATTR_FALLTHROUGH
+                            case 2:
+                                DUFF_GUTS
+                                /* FALLTHROUGH */
+                                H5_ATTR_FALLTHROUGH
+                            case 1:
+                                DUFF_GUTS
+                        } while (--duffs_index > 0);
+                } /* end switch */
+            }
+#endif        /* NO_DUFFS_DEVICE */
 #undef DUFF_GUTS
-            } /* end for */
+        } /* end for */
 
-            /* Add leftover to the end of data */
-            if (leftover > 0) {
-                /* Adjust back to end of shuffled bytes */
-                _dest -= (bytesoftype - 1); /*lint !e794 _dest is initialized */
-                H5MM_memcpy((void *)_dest, (void *)_src, leftover);
-            }
-        } /* end if */
-        else {
-            /* Get the pointer to the destination buffer */
-            _dest = (unsigned char *)dest;
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__shuffle_bytes() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_bytes
+ *
+ * Purpose:	Unshuffle NUMOFELEMENTS elements of BYTESOFTYPE bytes from
+ *              SRC into DEST, using SSE2 or AVX2 instructions where the
+ *              processor supports them.
+ *
+ * Return:	Void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__unshuffle_bytes(unsigned char *dest, const unsigned char *src, size_t bytesoftype, size_t numofelements)
+{
+    const unsigned char *_src;      /* Alias for source buffer */
+    unsigned char *      _dest;     /* Alias for destination buffer */
+    size_t               first = 0; /* First element not unshuffled yet */
+    size_t               nleft;     /* Number of elements not unshuffled yet */
+    size_t               i;         /* Local index variables */
+#ifdef NO_DUFFS_DEVICE
+    size_t j; /* Local index variable */
+#endif        /* NO_DUFFS_DEVICE */
 
-            /* Output; shuffle */
-            for (i = 0; i < bytesoftype; i++) {
-                _src = ((unsigned char *)(*buf)) + i;
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_HAVE_SIMD_DISPATCH
+    /* Unshuffle as many elements as possible with vector instructions */
+    if (bytesoftype <= H5Z_SHUFFLE_SIMD_MAX_SIZE && 0 == (bytesoftype & (bytesoftype - 1))) {
+        if (H5_CPU_HAS_AVX2())
+            first = H5Z__unshuffle_avx2(dest, src, bytesoftype, numofelements);
+        else if (H5_CPU_HAS_SSE2())
+            first = H5Z__unshuffle_sse2(dest, src, bytesoftype, numofelements);
+    } /* end if */
+#endif /* H5_HAVE_SIMD_DISPATCH */
+
+    /* Unshuffle the rest of the elements */
+    nleft = numofelements - first;
+    if (nleft > 0)
+        for (i = 0; i < bytesoftype; i++) {
+            _src  = src + (i * numofelements) + first;
+            _dest = dest + (first * bytesoftype) + i;
 #define DUFF_GUTS                                                                                            \
-    *_dest++ = *_src;                                                                                        \
-    _src += bytesoftype;
+    *_dest = *_src++;                                                                                        \
+    _dest += bytesoftype;
 #ifdef NO_DUFFS_DEVICE
-                j = numofelements;
-                while (j > 0) {
-                    DUFF_GUTS;
-
-                    j--;
-                } /* end for */
-#else             /* NO_DUFFS_DEVICE */
-                {
-                    size_t duffs_index; /* Counting index for Duff's device */
-
-                    duffs_index = (numofelements + 7) / 8;
-                    switch (numofelements % 8) {
-                        default:
-                            HDassert(0 && "This Should never be executed!");
-                            break;
-                        case 0:
-                            do {
+            j = nleft;
+            while (j > 0) {
+                DUFF_GUTS;
+
+                j--;
+            } /* end for */
+#else         /* NO_DUFFS_DEVICE */
+            {
+                size_t duffs_index; /* Counting index for Duff's device */
+
+                duffs_index = (nleft + 7) / 8;
+                switch (nleft % 8) {
+                    default:
+                        HDassert(0 && "This Should never be executed!");
+                        break;
+                    case 0:
+                        do {
+                            DUFF_GUTS
+                            /* FALLTHROUGH */
+                            H5_ATTR_FALLTHROUGH
+                            case 7:
+                                DUFF_GUTS
+                                /* FALLTHROUGH */
+                                H5_ATTR_FALLTHROUGH
+                            case 6:
                                 DUFF_GUTS
                                 /* FALLTHROUGH */
                                 H5_ATTR_FALLTHROUGH
-                                case 7:
-                                    DUFF_GUTS
-                                    /* FALLTHROUGH */
-                                    H5_ATTR_FALLTHROUGH
-                                case 6:
-                                    DUFF_GUTS
-                                    /* FALLTHROUGH */
-                                    H5_ATTR_FALLTHROUGH
-                                case 5:
-                                    DUFF_GUTS
-                                    /* FALLTHROUGH */
-                                    H5_ATTR_FALLTHROUGH
-                                case 4:
-                                    DUFF_GUTS
-                                    /* FALLTHROUGH */
-                                    H5_ATTR_FALLTHROUGH
-                                case 3:
-                                    DUFF_GUTS
-                                    /* FALLTHROUGH */
-                                    H5_ATTR_FALLTHROUGH
-                                case 2:
-                                    DUFF_GUTS
-                                    /* FALLTHROUGH */
-                                    H5_ATTR_FALLTHROUGH
-                                case 1:
-                                    DUFF_GUTS
-                            } while (--duffs_index > 0);
-                    } /* end switch */
-                }
-#endif            /* NO_DUFFS_DEVICE */
+                            case 5:
+                                DUFF_GUTS
+                                /* FALLTHROUGH */
+                                H5_ATTR_FALLTHROUGH
+                            case 4:
+                                DUFF_GUTS
+                                /* FALLTHROUGH */
+                                H5_ATTR_FALLTHROUGH
+                            case 3:
+                                DUFF_GUTS
+                                /* FALLTHROUGH */
+                                H5_ATTR_FALLTHROUGH
+                            case 2:
+                                DUFF_GUTS
+                                /* FALLTHROUGH */
+                                H5_ATTR_FALLTHROUGH
+                            case 1:
+                                DUFF_GUTS
+                        } while (--duffs_index > 0);
+                } /* end switch */
+            }
+#endif        /* NO_DUFFS_DEVICE */
 #undef DUFF_GUTS
+        } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__unshuffle_bytes() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_bits
+ *
+ * Purpose:	Shuffle the bits in each of NPLANES blocks of NBYTES bytes
+ *              (the output of H5Z__shuffle_bytes) from SRC into DEST.
+ *
+ *              The bits of each group of 8 bytes are transposed, with the
+ *              byte for each bit-position going into that bit-position's
+ *              part of the block.  Bytes after the last whole group of 8
+ *              are copied as they are.
+ *
+ * Return:	Void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__shuffle_bits(unsigned char *dest, const unsigned char *src, size_t nplanes, size_t nbytes)
+{
+    size_t ngroups = nbytes / 8; /* Number of groups of 8 bytes in each block */
+    size_t u, v;                 /* Local index variables */
+    int    i;                    /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < nplanes; u++, src += nbytes, dest += nbytes) {
+        v = 0;
+#ifdef H5_HAVE_SIMD_DISPATCH
+        if (H5_CPU_HAS_AVX2())
+            v = H5Z__shuffle_bits_avx2(dest, src, ngroups);
+        else if (H5_CPU_HAS_SSE2())
+            v = H5Z__shuffle_bits_sse2(dest, src, ngroups);
+#endif /* H5_HAVE_SIMD_DISPATCH */
+
+        for (; v < ngroups; v++) {
+            uint64_t x = 0; /* Bits of the group, one byte per row */
+
+            for (i = 0; i < 8; i++)
+                x |= (uint64_t)src[(v * 8) + (size_t)i] << (8 * i);
+            H5Z_SHUFFLE_TRANSPOSE_BITS(x)
+            for (i = 0; i < 8; i++)
+                dest[((size_t)i * ngroups) + v] = (unsigned char)(x >> (8 * i));
+        } /* end for */
+
+        /* Copy the bytes that don't make up a whole group */
+        if (nbytes % 8)
+            H5MM_memcpy(dest + (ngroups * 8), src + (ngroups * 8), nbytes % 8);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__shuffle_bits() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_bits
+ *
+ * Purpose:	Undo H5Z__shuffle_bits for NPLANES blocks of NBYTES bytes,
+ *              from SRC into DEST.
+ *
+ * Return:	Void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5Z__unshuffle_bits(unsigned char *dest, const unsigned char *src, size_t nplanes, size_t nbytes)
+{
+    size_t ngroups = nbytes / 8; /* Number of groups of 8 bytes in each block */
+    size_t u, v;                 /* Local index variables */
+    int    i;                    /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < nplanes; u++, src += nbytes, dest += nbytes) {
+        v = 0;
+#ifdef H5_HAVE_SIMD_DISPATCH
+        if (H5_CPU_HAS_AVX2())
+            v = H5Z__unshuffle_bits_avx2(dest, src, ngroups);
+        else if (H5_CPU_HAS_SSE2())
+            v = H5Z__unshuffle_bits_sse2(dest, src, ngroups);
+#endif /* H5_HAVE_SIMD_DISPATCH */
+
+        for (; v < ngroups; v++) {
+            uint64_t x = 0; /* Bits of the group, one bit-position per row */
+
+            for (i = 0; i < 8; i++)
+                x |= (uint64_t)src[((size_t)i * ngroups) + v] << (8 * i);
+            H5Z_SHUFFLE_TRANSPOSE_BITS(x)
+            for (i = 0; i < 8; i++)
+                dest[(v * 8) + (size_t)i] = (unsigned char)(x >> (8 * i));
+        } /* end for */
+
+        /* Copy the bytes that don't make up a whole group */
+        if (nbytes % 8)
+            H5MM_memcpy(dest + (ngroups * 8), src + (ngroups * 8), nbytes % 8);
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5Z__unshuffle_bits() */
+
+#ifdef H5_HAVE_SIMD_DISPATCH
+/*
+ * The SSE2 and AVX2 kernels work on blocks of 16 (SSE2) or 32 (AVX2)
+ * elements of N bytes, with N a power of two.  Unshuffling a block starts
+ * with the N vectors holding its byte-positions, and interleaves pairs of
+ * them with the "unpack" instructions, first byte by byte, then 2 bytes at
+ * a time, and so on, halving the number of "chunks" each element is split
+ * into every time, until the vectors hold whole elements.  Shuffling does
+ * the same steps backwards, splitting the even and odd units of pairs of
+ * vectors apart.
+ *
+ * The vectors are kept in an array indexed by [chunk][group], where the
+ * groups are the runs of consecutive elements (all of them to start with
+ * when unshuffling), so vector 'g' of the last step holds the g-th run of
+ * elements.  The AVX2 instructions work on each 128-bit half of a vector
+ * separately, so the halves are swapped around between the vectors holding
+ * whole elements and memory.
+ */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__deinterleave_sse2
+ *
+ * Purpose:	Split the units of UNIT bytes in LO (followed by HI) into
+ *              the even units (*EVEN) and the odd units (*ODD).  This undoes
+ *              the SSE2 "unpack" instructions for the unit size.
+ *
+ * Return:	Void
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static H5Z_SHUFFLE_INLINE void
+H5Z__deinterleave_sse2(__m128i lo, __m128i hi, size_t unit, __m128i *even, __m128i *odd)
+{
+    switch (unit) {
+        case 1: {
+            const __m128i mask = _mm_set1_epi16(0x00FF);
+
+            *even = _mm_packus_epi16(_mm_and_si128(lo, mask), _mm_and_si128(hi, mask));
+            *odd  = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+            return;
+        }
+
+        case 2:
+            /* (Gather the even 2-byte units in the low half of each vector) */
+            lo = _mm_shufflelo_epi16(lo, _MM_SHUFFLE(3, 1, 2, 0));
+            lo = _mm_shufflehi_epi16(lo, _MM_SHUFFLE(3, 1, 2, 0));
+            lo = _mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 1, 2, 0));
+            hi = _mm_shufflelo_epi16(hi, _MM_SHUFFLE(3, 1, 2, 0));
+            hi = _mm_shufflehi_epi16(hi, _MM_SHUFFLE(3, 1, 2, 0));
+            hi = _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 1, 2, 0));
+            break;
+
+        case 4:
+            lo = _mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 1, 2, 0));
+            hi = _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 1, 2, 0));
+            break;
+
+        default:
+            HDassert(8 == unit);
+            break;
+    } /* end switch */
+
+    *even = _mm_unpacklo_epi64(lo, hi);
+    *odd  = _mm_unpackhi_epi64(lo, hi);
+} /* end H5Z__deinterleave_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__interleave_sse2
+ *
+ * Purpose:	Interleave the units of UNIT bytes in A and B, into *LO
+ *              (the first half) and *HI.
+ *
+ * Return:	Void
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static H5Z_SHUFFLE_INLINE void
+H5Z__interleave_sse2(__m128i a, __m128i b, size_t unit, __m128i *lo, __m128i *hi)
+{
+    switch (unit) {
+        case 1:
+            *lo = _mm_unpacklo_epi8(a, b);
+            *hi = _mm_unpackhi_epi8(a, b);
+            break;
+
+        case 2:
+            *lo = _mm_unpacklo_epi16(a, b);
+            *hi = _mm_unpackhi_epi16(a, b);
+            break;
+
+        case 4:
+            *lo = _mm_unpacklo_epi32(a, b);
+            *hi = _mm_unpackhi_epi32(a, b);
+            break;
+
+        default:
+            HDassert(8 == unit);
+            *lo = _mm_unpacklo_epi64(a, b);
+            *hi = _mm_unpackhi_epi64(a, b);
+            break;
+    } /* end switch */
+} /* end H5Z__interleave_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_sse2_size
+ *
+ * Purpose:	Shuffle blocks of 16 elements with SSE2 instructions.
+ *
+ * Return:	Number of elements shuffled
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static H5Z_SHUFFLE_INLINE size_t
+H5Z__shuffle_sse2_size(unsigned char *dest, const unsigned char *src, size_t bytesoftype,
+                       size_t numofelements)
+{
+    __m128i v[H5Z_SHUFFLE_SIMD_MAX_SIZE]; /* Vectors for a block, by [chunk][group] */
+    size_t  nvec = numofelements - (numofelements % 16); /* Number of elements to shuffle */
+    size_t  elmt;                                        /* First element in the block */
+
+    HDassert(bytesoftype > 1 && bytesoftype <= H5Z_SHUFFLE_SIMD_MAX_SIZE);
+
+    for (elmt = 0; elmt < nvec; elmt += 16) {
+        __m128i w[H5Z_SHUFFLE_SIMD_MAX_SIZE]; /* Vectors for the next step */
+        size_t  ngroups;                      /* Number of groups (twice the size of the units split apart) */
+        size_t  u;                            /* Local index variable */
+
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < bytesoftype; u++)
+            v[u] = _mm_loadu_si128((const __m128i *)(src + (elmt * bytesoftype) + (u * 16)));
+
+        H5Z_SHUFFLE_UNROLL
+        for (ngroups = bytesoftype; ngroups > 1; ngroups /= 2) {
+            /* (Pair 'u' is split into the g-th groups of chunks 2c and 2c+1,
+             * where c & g are the chunk & group the pair is in)
+             */
+            H5Z_SHUFFLE_UNROLL
+            for (u = 0; u < bytesoftype / 2; u++) {
+                size_t c = u / (ngroups / 2); /* Chunk the pair is in */
+
+                H5Z__deinterleave_sse2(v[2 * u], v[(2 * u) + 1], ngroups / 2, &w[u + (c * (ngroups / 2))],
+                                       &w[u + ((c + 1) * (ngroups / 2))]);
             } /* end for */
+            H5Z_SHUFFLE_UNROLL
+            for (u = 0; u < bytesoftype; u++)
+                v[u] = w[u];
+        } /* end for */
 
-            /* Add leftover to the end of data */
-            if (leftover > 0) {
-                /* Adjust back to end of shuffled bytes */
-                _src -= (bytesoftype - 1); /*lint !e794 _src is initialized */
-                H5MM_memcpy((void *)_dest, (void *)_src, leftover);
-            }
-        } /* end else */
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < bytesoftype; u++)
+            _mm_storeu_si128((__m128i *)(dest + (u * numofelements) + elmt), v[u]);
+    } /* end for */
+
+    return nvec;
+} /* end H5Z__shuffle_sse2_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_sse2
+ *
+ * Purpose:	Shuffle blocks of 16 elements with SSE2 instructions.
+ *
+ * Return:	Number of elements shuffled (the rest must be shuffled by
+ *              the caller)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static size_t
+H5Z__shuffle_sse2(unsigned char *dest, const unsigned char *src, size_t bytesoftype, size_t numofelements)
+{
+    size_t ret_value = 0; /* Return value */
 
-        /* Free the input buffer */
-        H5MM_xfree(*buf);
+    FUNC_ENTER_STATIC_NOERR
 
-        /* Set the buffer information to return */
-        *buf      = dest;
-        *buf_size = nbytes;
-    } /* end else */
+    switch (bytesoftype) {
+        case 2:
+            ret_value = H5Z__shuffle_sse2_size(dest, src, (size_t)2, numofelements);
+            break;
 
-    /* Set the return value */
-    ret_value = nbytes;
+        case 4:
+            ret_value = H5Z__shuffle_sse2_size(dest, src, (size_t)4, numofelements);
+            break;
+
+        case 8:
+            ret_value = H5Z__shuffle_sse2_size(dest, src, (size_t)8, numofelements);
+            break;
+
+        default:
+            HDassert(16 == bytesoftype);
+            ret_value = H5Z__shuffle_sse2_size(dest, src, (size_t)16, numofelements);
+            break;
+    } /* end switch */
 
-done:
     FUNC_LEAVE_NOAPI(ret_value)
-}
+} /* end H5Z__shuffle_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_sse2_size
+ *
+ * Purpose:	Unshuffle blocks of 16 elements with SSE2 instructions.
+ *
+ * Return:	Number of elements unshuffled
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static H5Z_SHUFFLE_INLINE size_t
+H5Z__unshuffle_sse2_size(unsigned char *dest, const unsigned char *src, size_t bytesoftype,
+                         size_t numofelements)
+{
+    __m128i v[H5Z_SHUFFLE_SIMD_MAX_SIZE]; /* Vectors for a block, by [chunk][group] */
+    size_t  nvec = numofelements - (numofelements % 16); /* Number of elements to unshuffle */
+    size_t  elmt;                                        /* First element in the block */
+
+    HDassert(bytesoftype > 1 && bytesoftype <= H5Z_SHUFFLE_SIMD_MAX_SIZE);
+
+    for (elmt = 0; elmt < nvec; elmt += 16) {
+        __m128i w[H5Z_SHUFFLE_SIMD_MAX_SIZE]; /* Vectors for the next step */
+        size_t  ngroups;                      /* Number of groups (the size of the units interleaved) */
+        size_t  u;                            /* Local index variable */
+
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < bytesoftype; u++)
+            v[u] = _mm_loadu_si128((const __m128i *)(src + (u * numofelements) + elmt));
+
+        H5Z_SHUFFLE_UNROLL
+        for (ngroups = 1; ngroups < bytesoftype; ngroups *= 2) {
+            /* (The g-th groups of chunks 2c and 2c+1 are interleaved into
+             * pair 'u', where c & g are the chunk & group of the pair)
+             */
+            H5Z_SHUFFLE_UNROLL
+            for (u = 0; u < bytesoftype / 2; u++) {
+                size_t c = u / ngroups; /* Chunk of the pair */
+                size_t g = u % ngroups; /* Group of the pair */
+
+                H5Z__interleave_sse2(v[(2 * c * ngroups) + g], v[((2 * c + 1) * ngroups) + g], ngroups,
+                                     &w[2 * u], &w[(2 * u) + 1]);
+            } /* end for */
+            H5Z_SHUFFLE_UNROLL
+            for (u = 0; u < bytesoftype; u++)
+                v[u] = w[u];
+        } /* end for */
+
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < bytesoftype; u++)
+            _mm_storeu_si128((__m128i *)(dest + (elmt * bytesoftype) + (u * 16)), v[u]);
+    } /* end for */
+
+    return nvec;
+} /* end H5Z__unshuffle_sse2_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_sse2
+ *
+ * Purpose:	Unshuffle blocks of 16 elements with SSE2 instructions.
+ *
+ * Return:	Number of elements unshuffled (the rest must be unshuffled by
+ *              the caller)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static size_t
+H5Z__unshuffle_sse2(unsigned char *dest, const unsigned char *src, size_t bytesoftype, size_t numofelements)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (bytesoftype) {
+        case 2:
+            ret_value = H5Z__unshuffle_sse2_size(dest, src, (size_t)2, numofelements);
+            break;
+
+        case 4:
+            ret_value = H5Z__unshuffle_sse2_size(dest, src, (size_t)4, numofelements);
+            break;
+
+        case 8:
+            ret_value = H5Z__unshuffle_sse2_size(dest, src, (size_t)8, numofelements);
+            break;
+
+        default:
+            HDassert(16 == bytesoftype);
+            ret_value = H5Z__unshuffle_sse2_size(dest, src, (size_t)16, numofelements);
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__unshuffle_sse2() */
+
+/*
+ * The bit shuffle kernels work on 2 (SSE2) or 4 (AVX2) groups of 8 bytes at
+ * a time.  Shuffling uses the "movemask" instructions, which gather the
+ * most significant bit of each byte in a vector: shifting the vector left
+ * by one bit between them gathers the bits of every bit-position in turn,
+ * ready to be stored in that bit-position's part of the block.  Unshuffling
+ * loads the bytes of each group from the 8 bit-positions into a 64-bit
+ * part of a vector, and transposes the bits in all of them at once, like
+ * H5Z_SHUFFLE_TRANSPOSE_BITS.
+ */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__gather_bits_sse2
+ *
+ * Purpose:	Gather bit-position 'k' of each byte in X into the 16-bit
+ *              value stored at OUT + (k * STRIDE), for k from 7 down to 0.
+ *
+ * Return:	Void
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static H5_INLINE void
+H5Z__gather_bits_sse2(__m128i x, unsigned char *out, size_t stride)
+{
+    int k; /* Local index variable */
+
+    for (k = 7; k >= 0; k--) {
+        uint16_t bits = (uint16_t)_mm_movemask_epi8(x);
+
+        HDmemcpy(out + ((size_t)k * stride), &bits, sizeof(bits));
+        x = _mm_slli_epi64(x, 1);
+    } /* end for */
+} /* end H5Z__gather_bits_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__transpose_bits_sse2
+ *
+ * Purpose:	Transpose the 8x8 bit matrix in each 64-bit part of X, as
+ *              H5Z_SHUFFLE_TRANSPOSE_BITS does.
+ *
+ * Return:	The transposed matrices
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static H5_INLINE __m128i
+H5Z__transpose_bits_sse2(__m128i x)
+{
+    __m128i t;
+
+    t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x, 7)), _mm_set1_epi64x(0x00AA00AA00AA00AALL));
+    x = _mm_xor_si128(_mm_xor_si128(x, t), _mm_slli_epi64(t, 7));
+    t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x, 14)), _mm_set1_epi64x(0x0000CCCC0000CCCCLL));
+    x = _mm_xor_si128(_mm_xor_si128(x, t), _mm_slli_epi64(t, 14));
+    t = _mm_and_si128(_mm_xor_si128(x, _mm_srli_epi64(x, 28)), _mm_set1_epi64x(0x00000000F0F0F0F0LL));
+    x = _mm_xor_si128(_mm_xor_si128(x, t), _mm_slli_epi64(t, 28));
+
+    return x;
+} /* end H5Z__transpose_bits_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_bits_sse2
+ *
+ * Purpose:	Shuffle the bits of pairs of groups of 8 bytes in a block of
+ *              NGROUPS groups, with SSE2 instructions.
+ *
+ * Return:	Number of groups shuffled (the rest must be shuffled by the
+ *              caller)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static size_t
+H5Z__shuffle_bits_sse2(unsigned char *dest, const unsigned char *src, size_t ngroups)
+{
+    size_t ndone = ngroups - (ngroups % 2); /* Number of groups to shuffle */
+    size_t v;                               /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (v = 0; v < ndone; v += 2)
+        H5Z__gather_bits_sse2(_mm_loadu_si128((const __m128i *)(src + (v * 8))), dest + v, ngroups);
+
+    FUNC_LEAVE_NOAPI(ndone)
+} /* end H5Z__shuffle_bits_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_bits_sse2
+ *
+ * Purpose:	Unshuffle the bits of pairs of groups of 8 bytes in a block
+ *              of NGROUPS groups, with SSE2 instructions.
+ *
+ * Return:	Number of groups unshuffled (the rest must be unshuffled by
+ *              the caller)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_SSE2 static size_t
+H5Z__unshuffle_bits_sse2(unsigned char *dest, const unsigned char *src, size_t ngroups)
+{
+    size_t ndone = ngroups - (ngroups % 2); /* Number of groups to unshuffle */
+    size_t v;                               /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (v = 0; v < ndone; v += 2) {
+        uint16_t rows[8]; /* Bytes of the groups for each bit-position */
+        __m128i  x;       /* Bytes from each bit-position, by group */
+        int      k;       /* Local index variable */
+
+        for (k = 0; k < 8; k++)
+            HDmemcpy(&rows[k], src + ((size_t)k * ngroups) + v, sizeof(rows[k]));
+
+        /* (Put the bytes from the bit-positions for each group together) */
+        x = _mm_setr_epi16((short)rows[0], (short)rows[1], (short)rows[2], (short)rows[3], (short)rows[4],
+                           (short)rows[5], (short)rows[6], (short)rows[7]);
+        x = _mm_packus_epi16(_mm_and_si128(x, _mm_set1_epi16(0x00FF)), _mm_srli_epi16(x, 8));
+
+        _mm_storeu_si128((__m128i *)(dest + (v * 8)), H5Z__transpose_bits_sse2(x));
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(ndone)
+} /* end H5Z__unshuffle_bits_sse2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__deinterleave_avx2
+ *
+ * Purpose:	AVX2 version of H5Z__deinterleave_sse2, for each 128-bit
+ *              half of the vectors.
+ *
+ * Return:	Void
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static H5Z_SHUFFLE_INLINE void
+H5Z__deinterleave_avx2(__m256i lo, __m256i hi, size_t unit, __m256i *even, __m256i *odd)
+{
+    switch (unit) {
+        case 1: {
+            const __m256i mask = _mm256_set1_epi16(0x00FF);
+
+            *even = _mm256_packus_epi16(_mm256_and_si256(lo, mask), _mm256_and_si256(hi, mask));
+            *odd  = _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+            return;
+        }
+
+        case 2:
+            /* (Gather the even 2-byte units in the low quarter of each vector half) */
+            lo = _mm256_shufflelo_epi16(lo, _MM_SHUFFLE(3, 1, 2, 0));
+            lo = _mm256_shufflehi_epi16(lo, _MM_SHUFFLE(3, 1, 2, 0));
+            lo = _mm256_shuffle_epi32(lo, _MM_SHUFFLE(3, 1, 2, 0));
+            hi = _mm256_shufflelo_epi16(hi, _MM_SHUFFLE(3, 1, 2, 0));
+            hi = _mm256_shufflehi_epi16(hi, _MM_SHUFFLE(3, 1, 2, 0));
+            hi = _mm256_shuffle_epi32(hi, _MM_SHUFFLE(3, 1, 2, 0));
+            break;
+
+        case 4:
+            lo = _mm256_shuffle_epi32(lo, _MM_SHUFFLE(3, 1, 2, 0));
+            hi = _mm256_shuffle_epi32(hi, _MM_SHUFFLE(3, 1, 2, 0));
+            break;
+
+        default:
+            HDassert(8 == unit);
+            break;
+    } /* end switch */
+
+    *even = _mm256_unpacklo_epi64(lo, hi);
+    *odd  = _mm256_unpackhi_epi64(lo, hi);
+} /* end H5Z__deinterleave_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__interleave_avx2
+ *
+ * Purpose:	AVX2 version of H5Z__interleave_sse2, for each 128-bit half
+ *              of the vectors.
+ *
+ * Return:	Void
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static H5Z_SHUFFLE_INLINE void
+H5Z__interleave_avx2(__m256i a, __m256i b, size_t unit, __m256i *lo, __m256i *hi)
+{
+    switch (unit) {
+        case 1:
+            *lo = _mm256_unpacklo_epi8(a, b);
+            *hi = _mm256_unpackhi_epi8(a, b);
+            break;
+
+        case 2:
+            *lo = _mm256_unpacklo_epi16(a, b);
+            *hi = _mm256_unpackhi_epi16(a, b);
+            break;
+
+        case 4:
+            *lo = _mm256_unpacklo_epi32(a, b);
+            *hi = _mm256_unpackhi_epi32(a, b);
+            break;
+
+        default:
+            HDassert(8 == unit);
+            *lo = _mm256_unpacklo_epi64(a, b);
+            *hi = _mm256_unpackhi_epi64(a, b);
+            break;
+    } /* end switch */
+} /* end H5Z__interleave_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_avx2_size
+ *
+ * Purpose:	Shuffle blocks of 32 elements with AVX2 instructions.
+ *
+ * Return:	Number of elements shuffled
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static H5Z_SHUFFLE_INLINE size_t
+H5Z__shuffle_avx2_size(unsigned char *dest, const unsigned char *src, size_t bytesoftype,
+                       size_t numofelements)
+{
+    __m256i v[H5Z_SHUFFLE_SIMD_MAX_SIZE]; /* Vectors for a block, by [chunk][group] */
+    size_t  half = bytesoftype / 2;                      /* Half the number of vectors */
+    size_t  nvec = numofelements - (numofelements % 32); /* Number of elements to shuffle */
+    size_t  elmt;                                        /* First element in the block */
+
+    HDassert(bytesoftype > 1 && bytesoftype <= H5Z_SHUFFLE_SIMD_MAX_SIZE);
+
+    for (elmt = 0; elmt < nvec; elmt += 32) {
+        __m256i w[H5Z_SHUFFLE_SIMD_MAX_SIZE]; /* Vectors for the next step */
+        size_t  ngroups;                      /* Number of groups (twice the size of the units split apart) */
+        size_t  u;                            /* Local index variable */
+
+        /* Load the block, with the first 16 elements in the low halves of the
+         * vectors and the last 16 in the high halves
+         */
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < bytesoftype; u++)
+            w[u] = _mm256_loadu_si256((const __m256i *)(src + (elmt * bytesoftype) + (u * 32)));
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < half; u++) {
+            v[2 * u]     = _mm256_permute2x128_si256(w[u], w[half + u], 0x20);
+            v[2 * u + 1] = _mm256_permute2x128_si256(w[u], w[half + u], 0x31);
+        } /* end for */
+
+        H5Z_SHUFFLE_UNROLL
+        for (ngroups = bytesoftype; ngroups > 1; ngroups /= 2) {
+            /* (Pair 'u' is split into the g-th groups of chunks 2c and 2c+1,
+             * where c & g are the chunk & group the pair is in)
+             */
+            H5Z_SHUFFLE_UNROLL
+            for (u = 0; u < bytesoftype / 2; u++) {
+                size_t c = u / (ngroups / 2); /* Chunk the pair is in */
+
+                H5Z__deinterleave_avx2(v[2 * u], v[(2 * u) + 1], ngroups / 2, &w[u + (c * (ngroups / 2))],
+                                       &w[u + ((c + 1) * (ngroups / 2))]);
+            } /* end for */
+            H5Z_SHUFFLE_UNROLL
+            for (u = 0; u < bytesoftype; u++)
+                v[u] = w[u];
+        } /* end for */
+
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < bytesoftype; u++)
+            _mm256_storeu_si256((__m256i *)(dest + (u * numofelements) + elmt), v[u]);
+    } /* end for */
+
+    return nvec;
+} /* end H5Z__shuffle_avx2_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_avx2
+ *
+ * Purpose:	Shuffle blocks of 32 elements with AVX2 instructions.
+ *
+ * Return:	Number of elements shuffled (the rest must be shuffled by
+ *              the caller)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static size_t
+H5Z__shuffle_avx2(unsigned char *dest, const unsigned char *src, size_t bytesoftype, size_t numofelements)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (bytesoftype) {
+        case 2:
+            ret_value = H5Z__shuffle_avx2_size(dest, src, (size_t)2, numofelements);
+            break;
+
+        case 4:
+            ret_value = H5Z__shuffle_avx2_size(dest, src, (size_t)4, numofelements);
+            break;
+
+        case 8:
+            ret_value = H5Z__shuffle_avx2_size(dest, src, (size_t)8, numofelements);
+            break;
+
+        default:
+            HDassert(16 == bytesoftype);
+            ret_value = H5Z__shuffle_avx2_size(dest, src, (size_t)16, numofelements);
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__shuffle_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_avx2_size
+ *
+ * Purpose:	Unshuffle blocks of 32 elements with AVX2 instructions.
+ *
+ * Return:	Number of elements unshuffled
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static H5Z_SHUFFLE_INLINE size_t
+H5Z__unshuffle_avx2_size(unsigned char *dest, const unsigned char *src, size_t bytesoftype,
+                         size_t numofelements)
+{
+    __m256i v[H5Z_SHUFFLE_SIMD_MAX_SIZE]; /* Vectors for a block, by [chunk][group] */
+    size_t  half = bytesoftype / 2;                      /* Half the number of vectors */
+    size_t  nvec = numofelements - (numofelements % 32); /* Number of elements to unshuffle */
+    size_t  elmt;                                        /* First element in the block */
+
+    HDassert(bytesoftype > 1 && bytesoftype <= H5Z_SHUFFLE_SIMD_MAX_SIZE);
+
+    for (elmt = 0; elmt < nvec; elmt += 32) {
+        __m256i w[H5Z_SHUFFLE_SIMD_MAX_SIZE]; /* Vectors for the next step */
+        size_t  ngroups;                      /* Number of groups (the size of the units interleaved) */
+        size_t  u;                            /* Local index variable */
+
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < bytesoftype; u++)
+            v[u] = _mm256_loadu_si256((const __m256i *)(src + (u * numofelements) + elmt));
+
+        H5Z_SHUFFLE_UNROLL
+        for (ngroups = 1; ngroups < bytesoftype; ngroups *= 2) {
+            /* (The g-th groups of chunks 2c and 2c+1 are interleaved into
+             * pair 'u', where c & g are the chunk & group of the pair)
+             */
+            H5Z_SHUFFLE_UNROLL
+            for (u = 0; u < bytesoftype / 2; u++) {
+                size_t c = u / ngroups; /* Chunk of the pair */
+                size_t g = u % ngroups; /* Group of the pair */
+
+                H5Z__interleave_avx2(v[(2 * c * ngroups) + g], v[((2 * c + 1) * ngroups) + g], ngroups,
+                                     &w[2 * u], &w[(2 * u) + 1]);
+            } /* end for */
+            H5Z_SHUFFLE_UNROLL
+            for (u = 0; u < bytesoftype; u++)
+                v[u] = w[u];
+        } /* end for */
+
+        /* Store the block, putting the low halves of the vectors (the first
+         * 16 elements) before the high halves
+         */
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < half; u++) {
+            w[u]        = _mm256_permute2x128_si256(v[2 * u], v[2 * u + 1], 0x20);
+            w[half + u] = _mm256_permute2x128_si256(v[2 * u], v[2 * u + 1], 0x31);
+        } /* end for */
+        H5Z_SHUFFLE_UNROLL
+        for (u = 0; u < bytesoftype; u++)
+            _mm256_storeu_si256((__m256i *)(dest + (elmt * bytesoftype) + (u * 32)), w[u]);
+    } /* end for */
+
+    return nvec;
+} /* end H5Z__unshuffle_avx2_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_avx2
+ *
+ * Purpose:	Unshuffle blocks of 32 elements with AVX2 instructions.
+ *
+ * Return:	Number of elements unshuffled (the rest must be unshuffled by
+ *              the caller)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static size_t
+H5Z__unshuffle_avx2(unsigned char *dest, const unsigned char *src, size_t bytesoftype, size_t numofelements)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    switch (bytesoftype) {
+        case 2:
+            ret_value = H5Z__unshuffle_avx2_size(dest, src, (size_t)2, numofelements);
+            break;
+
+        case 4:
+            ret_value = H5Z__unshuffle_avx2_size(dest, src, (size_t)4, numofelements);
+            break;
+
+        case 8:
+            ret_value = H5Z__unshuffle_avx2_size(dest, src, (size_t)8, numofelements);
+            break;
+
+        default:
+            HDassert(16 == bytesoftype);
+            ret_value = H5Z__unshuffle_avx2_size(dest, src, (size_t)16, numofelements);
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__unshuffle_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__gather_bits_avx2
+ *
+ * Purpose:	AVX2 version of H5Z__gather_bits_sse2, storing 32-bit
+ *              values.
+ *
+ * Return:	Void
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static H5_INLINE void
+H5Z__gather_bits_avx2(__m256i x, unsigned char *out, size_t stride)
+{
+    int k; /* Local index variable */
+
+    for (k = 7; k >= 0; k--) {
+        uint32_t bits = (uint32_t)_mm256_movemask_epi8(x);
+
+        HDmemcpy(out + ((size_t)k * stride), &bits, sizeof(bits));
+        x = _mm256_slli_epi64(x, 1);
+    } /* end for */
+} /* end H5Z__gather_bits_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__transpose_bits_avx2
+ *
+ * Purpose:	AVX2 version of H5Z__transpose_bits_sse2.
+ *
+ * Return:	The transposed matrices
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static H5_INLINE __m256i
+H5Z__transpose_bits_avx2(__m256i x)
+{
+    __m256i t;
+
+    t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi64(x, 7)),
+                         _mm256_set1_epi64x(0x00AA00AA00AA00AALL));
+    x = _mm256_xor_si256(_mm256_xor_si256(x, t), _mm256_slli_epi64(t, 7));
+    t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi64(x, 14)),
+                         _mm256_set1_epi64x(0x0000CCCC0000CCCCLL));
+    x = _mm256_xor_si256(_mm256_xor_si256(x, t), _mm256_slli_epi64(t, 14));
+    t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srli_epi64(x, 28)),
+                         _mm256_set1_epi64x(0x00000000F0F0F0F0LL));
+    x = _mm256_xor_si256(_mm256_xor_si256(x, t), _mm256_slli_epi64(t, 28));
+
+    return x;
+} /* end H5Z__transpose_bits_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__shuffle_bits_avx2
+ *
+ * Purpose:	Shuffle the bits of runs of 4 groups of 8 bytes in a block of
+ *              NGROUPS groups, with AVX2 instructions.
+ *
+ * Return:	Number of groups shuffled (the rest must be shuffled by the
+ *              caller)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static size_t
+H5Z__shuffle_bits_avx2(unsigned char *dest, const unsigned char *src, size_t ngroups)
+{
+    size_t ndone = ngroups - (ngroups % 4); /* Number of groups to shuffle */
+    size_t v;                               /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (v = 0; v < ndone; v += 4)
+        H5Z__gather_bits_avx2(_mm256_loadu_si256((const __m256i *)(src + (v * 8))), dest + v, ngroups);
+
+    FUNC_LEAVE_NOAPI(ndone)
+} /* end H5Z__shuffle_bits_avx2() */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z__unshuffle_bits_avx2
+ *
+ * Purpose:	Unshuffle the bits of runs of 4 groups of 8 bytes in a block
+ *              of NGROUPS groups, with AVX2 instructions.
+ *
+ * Return:	Number of groups unshuffled (the rest must be unshuffled by
+ *              the caller)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_AVX2 static size_t
+H5Z__unshuffle_bits_avx2(unsigned char *dest, const unsigned char *src, size_t ngroups)
+{
+    size_t ndone = ngroups - (ngroups % 4); /* Number of groups to unshuffle */
+    size_t v;                               /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (v = 0; v < ndone; v += 4) {
+        uint32_t rows[8]; /* Bytes of the groups for each bit-position */
+        __m256i  x;       /* Bytes from each bit-position, by group */
+        int      k;       /* Local index variable */
+
+        for (k = 0; k < 8; k++)
+            HDmemcpy(&rows[k], src + ((size_t)k * ngroups) + v, sizeof(rows[k]));
+
+        /* (Put the bytes from the bit-positions for each group together) */
+        x = _mm256_setr_epi32((int)rows[0], (int)rows[1], (int)rows[2], (int)rows[3], (int)rows[4],
+                              (int)rows[5], (int)rows[6], (int)rows[7]);
+        x = _mm256_shuffle_epi8(x, _mm256_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15, 0,
+                                                    4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15));
+        x = _mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+
+        _mm256_storeu_si256((__m256i *)(dest + (v * 8)), H5Z__transpose_bits_avx2(x));
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(ndone)
+} /* end H5Z__unshuffle_bits_avx2() */
+#endif /* H5_HAVE_SIMD_DISPATCH */
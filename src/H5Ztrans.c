@@ -54,17 +54,30 @@ typedef struct H5Z_node {
     H5Z_num_val      value;
 } H5Z_node;
 
+/* Forms of the instructions in a compiled transform */
+typedef enum {
+    H5Z_XFORM_INST_LOAD, /* Push a block of the data ("x") on the stack    */
+    H5Z_XFORM_INST_VC,   /* Top block OP constant                          */
+    H5Z_XFORM_INST_CV,   /* Constant OP top block                          */
+    H5Z_XFORM_INST_VV    /* Second block OP top block, popping the top one */
+} H5Z_xform_inst_form_t;
+
+/* An instruction in a compiled transform */
+typedef struct {
+    H5Z_xform_inst_form_t form;  /* Form of the instruction                          */
+    H5Z_token_type        op;    /* Operation (H5Z_XFORM_PLUS, _MINUS, _MULT, _DIVIDE) */
+    double                value; /* Constant operand, for H5Z_XFORM_INST_VC & _CV      */
+} H5Z_xform_inst_t;
+
 struct H5Z_data_xform_t {
-    char *           xform_exp;
-    H5Z_node *       parse_root;
-    H5Z_datval_ptrs *dat_val_pointers;
+    char *            xform_exp;
+    H5Z_node *        parse_root;
+    H5Z_datval_ptrs * dat_val_pointers;
+    H5Z_xform_inst_t *prog;       /* Parse tree compiled to a postfix program    */
+    size_t            prog_len;   /* Number of instructions in the program       */
+    size_t            prog_depth; /* Largest number of blocks the program stacks */
 };
 
-typedef struct result {
-    H5Z_token_type type;
-    H5Z_num_val    value;
-} H5Z_result;
-
 /* The token */
 typedef struct {
     const char *tok_expr; /* Holds the original expression        */
@@ -90,188 +103,96 @@ static void       H5Z__do_op(H5Z_node *tree);
 static hbool_t    H5Z__op_is_numbs(H5Z_node *_tree);
 static hbool_t    H5Z__op_is_numbs2(H5Z_node *_tree);
 static hid_t      H5Z__xform_find_type(const H5T_t *type);
-static herr_t     H5Z__xform_eval_full(H5Z_node *tree, const size_t array_size, const hid_t array_type,
-                                       H5Z_result *res);
+static herr_t     H5Z__xform_compile_tree(const H5Z_node *tree, H5Z_xform_inst_t *prog, size_t *len,
+                                          size_t *depth, size_t *max_depth);
+static herr_t     H5Z__xform_compile(H5Z_data_xform_t *data_xform_prop);
+static herr_t     H5Z__xform_eval_prog(const H5Z_data_xform_t *data_xform_prop, void *array,
+                                       size_t array_size, hid_t array_type);
 static void       H5Z__xform_destroy_parse_tree(H5Z_node *tree);
 static void *     H5Z__xform_parse(const char *expression, H5Z_datval_ptrs *dat_val_pointers);
 static void *     H5Z__xform_copy_tree(H5Z_node *tree, H5Z_datval_ptrs *dat_val_pointers,
                                        H5Z_datval_ptrs *new_dat_val_pointers);
 static void       H5Z__xform_reduce_tree(H5Z_node *tree);
 
-/* PGCC (11.8-0) has trouble with the command *p++ = *p OP tree_val. It increments P first before
- * doing the operation.  So I break down the command into two lines:
- *     *p = *p OP tree_val; p++;
- * Actually, the behavior of *p++ = *p OP tree_val is undefined. (SLU - 2012/3/19)
+/* Number of elements a compiled transform is applied to at a time.  Small enough
+ * that the program's stack of blocks stays in the L1 cache for the widest types.
+ */
+#define H5Z_XFORM_BLOCK_NELMTS 1024
+
+/* Value of a number node in the parse tree */
+#define H5Z_XFORM_NODE_VAL(NODE)                                                                             \
+    ((NODE)->type == H5Z_XFORM_INTEGER ? (double)(NODE)->value.int_val : (NODE)->value.float_val)
+
+/* Apply one arithmetic instruction of a compiled transform to the N elements of
+ * the block on top of the stack.  As in the original tree evaluation, an operation
+ * with a constant is done in double precision and an operation between two
+ * blocks in the buffer's type.
  */
-#define H5Z_XFORM_DO_OP1(RESL, RESR, TYPE, OP, SIZE)                                                         \
+#define H5Z_XFORM_DO_INST(TYPE, OP, INST, TOP, NBLOCK, N)                                                    \
     {                                                                                                        \
-        size_t u;                                                                                            \
-                                                                                                             \
-        if (((RESL).type == H5Z_XFORM_SYMBOL) && ((RESR).type != H5Z_XFORM_SYMBOL)) {                        \
-            TYPE * p;                                                                                        \
-            double tree_val;                                                                                 \
+        const double val = (INST)->value;                                                                    \
+        size_t       u;                                                                                      \
                                                                                                              \
-            tree_val =                                                                                       \
-                ((RESR).type == H5Z_XFORM_INTEGER ? (double)(RESR).value.int_val : (RESR).value.float_val);  \
-            p = (TYPE *)(RESL).value.dat_val;                                                                \
+        if ((INST)->form == H5Z_XFORM_INST_VC)                                                               \
+            for (u = 0; u < (N); u++)                                                                        \
+                (TOP)[u] = (TYPE)((double)(TOP)[u] OP val);                                                  \
+        else if ((INST)->form == H5Z_XFORM_INST_CV)                                                          \
+            for (u = 0; u < (N); u++)                                                                        \
+                (TOP)[u] = (TYPE)(val OP(double)(TOP)[u]);                                                   \
+        else {                                                                                               \
+            TYPE *pl = (TOP) - (NBLOCK);                                                                     \
                                                                                                              \
-            for (u = 0; u < (SIZE); u++) {                                                                   \
-                *p = (TYPE)((double)*p OP tree_val);                                                         \
-                p++;                                                                                         \
-            }                                                                                                \
+            for (u = 0; u < (N); u++)                                                                        \
+                pl[u] = (TYPE)(pl[u] OP(TOP)[u]);                                                            \
+            (TOP) = pl;                                                                                      \
         }                                                                                                    \
-        else if (((RESR).type == H5Z_XFORM_SYMBOL) && ((RESL).type != H5Z_XFORM_SYMBOL)) {                   \
-            TYPE * p;                                                                                        \
-            double tree_val;                                                                                 \
+    }
+
+/* Run a compiled transform over an array of TYPE, one block at a time.  When
+ * the data is used only once in the expression, the program works on the array
+ * in place; otherwise the blocks the program pushes are copies in 'stack' and
+ * the result is copied back over the array's block.
+ */
+#define H5Z_XFORM_DO_PROG(TYPE)                                                                              \
+    {                                                                                                        \
+        TYPE * data = (TYPE *)array;                                                                         \
+        size_t start;                                                                                        \
                                                                                                              \
-            /* The case that the left operand is nothing, like -x or +x */                                   \
-            if ((RESL).type == H5Z_XFORM_ERROR)                                                              \
-                tree_val = 0;                                                                                \
-            else                                                                                             \
-                tree_val = ((RESL).type == H5Z_XFORM_INTEGER ? (double)(RESL).value.int_val                  \
-                                                             : (RESL).value.float_val);                      \
+        if (data_xform_prop->prog_depth > 1)                                                                 \
+            if (NULL == (stack = H5MM_malloc(data_xform_prop->prog_depth * nblock * sizeof(TYPE))))          \
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL,                                                 \
+                            "Ran out of memory trying to allocate space for data in data transform")         \
                                                                                                              \
-            p = (TYPE *)(RESR).value.dat_val;                                                                \
-            for (u = 0; u < (SIZE); u++) {                                                                   \
-                *p = (TYPE)(tree_val OP(double) * p);                                                        \
-                p++;                                                                                         \
-            }                                                                                                \
-        }                                                                                                    \
-        else if (((RESL).type == H5Z_XFORM_SYMBOL) && ((RESR).type == H5Z_XFORM_SYMBOL)) {                   \
-            TYPE *pl = (TYPE *)(RESL).value.dat_val;                                                         \
-            TYPE *pr = (TYPE *)(RESR).value.dat_val;                                                         \
+        for (start = 0; start < array_size; start += nblock) {                                               \
+            size_t n   = MIN(nblock, array_size - start);                                                    \
+            TYPE * top = NULL;                                                                               \
+            size_t k;                                                                                        \
                                                                                                              \
-            for (u = 0; u < (SIZE); u++) {                                                                   \
-                *pl = (TYPE)(*pl OP * pr);                                                                   \
-                pl++;                                                                                        \
-                pr++;                                                                                        \
+            for (k = 0; k < data_xform_prop->prog_len; k++) {                                                \
+                const H5Z_xform_inst_t *inst = &data_xform_prop->prog[k];                                    \
+                                                                                                             \
+                if (inst->form == H5Z_XFORM_INST_LOAD) {                                                     \
+                    if (stack) {                                                                             \
+                        top = top ? top + nblock : (TYPE *)stack;                                            \
+                        H5MM_memcpy(top, data + start, n * sizeof(TYPE));                                    \
+                    }                                                                                        \
+                    else                                                                                     \
+                        top = data + start;                                                                  \
+                }                                                                                            \
+                else if (inst->op == H5Z_XFORM_PLUS)                                                         \
+                    H5Z_XFORM_DO_INST(TYPE, +, inst, top, nblock, n)                                         \
+                else if (inst->op == H5Z_XFORM_MINUS)                                                        \
+                    H5Z_XFORM_DO_INST(TYPE, -, inst, top, nblock, n)                                         \
+                else if (inst->op == H5Z_XFORM_MULT)                                                         \
+                    H5Z_XFORM_DO_INST(TYPE, *, inst, top, nblock, n)                                         \
+                else                                                                                         \
+                    H5Z_XFORM_DO_INST(TYPE, /, inst, top, nblock, n)                                         \
             }                                                                                                \
+                                                                                                             \
+            if (stack)                                                                                       \
+                H5MM_memcpy(data + start, stack, n * sizeof(TYPE));                                          \
         }                                                                                                    \
-        else                                                                                                 \
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unexpected type conversion operation")                \
-    }
-
-#if H5_SIZEOF_LONG_DOUBLE != 0
-#if CHAR_MIN >= 0
-#define H5Z_XFORM_TYPE_OP(RESL, RESR, TYPE, OP, SIZE)                                                        \
-    {                                                                                                        \
-        if ((TYPE) == H5T_NATIVE_CHAR)                                                                       \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_SCHAR)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), signed char, OP, (SIZE))                                        \
-        else if ((TYPE) == H5T_NATIVE_SHORT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_USHORT)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))                                     \
-        else if ((TYPE) == H5T_NATIVE_INT)                                                                   \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))                                                \
-        else if ((TYPE) == H5T_NATIVE_UINT)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))                                       \
-        else if ((TYPE) == H5T_NATIVE_LONG)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_ULONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_LLONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))                                          \
-        else if ((TYPE) == H5T_NATIVE_ULLONG)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE))                                 \
-        else if ((TYPE) == H5T_NATIVE_FLOAT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_DOUBLE)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))                                             \
-        else if ((TYPE) == H5T_NATIVE_LDOUBLE)                                                               \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long double, OP, (SIZE))                                        \
-    }
-#else /* CHAR_MIN >= 0 */
-#define H5Z_XFORM_TYPE_OP(RESL, RESR, TYPE, OP, SIZE)                                                        \
-    {                                                                                                        \
-        if ((TYPE) == H5T_NATIVE_CHAR)                                                                       \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_UCHAR)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned char, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_SHORT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_USHORT)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))                                     \
-        else if ((TYPE) == H5T_NATIVE_INT)                                                                   \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))                                                \
-        else if ((TYPE) == H5T_NATIVE_UINT)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))                                       \
-        else if ((TYPE) == H5T_NATIVE_LONG)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_ULONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_LLONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))                                          \
-        else if ((TYPE) == H5T_NATIVE_ULLONG)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE))                                 \
-        else if ((TYPE) == H5T_NATIVE_FLOAT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_DOUBLE)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))                                             \
-        else if ((TYPE) == H5T_NATIVE_LDOUBLE)                                                               \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long double, OP, (SIZE))                                        \
-    }
-#endif /* CHAR_MIN >= 0 */
-#else
-#if CHAR_MIN >= 0
-#define H5Z_XFORM_TYPE_OP(RESL, RESR, TYPE, OP, SIZE)                                                        \
-    {                                                                                                        \
-        if ((TYPE) == H5T_NATIVE_CHAR)                                                                       \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_SCHAR)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), signed char, OP, (SIZE))                                        \
-        else if ((TYPE) == H5T_NATIVE_SHORT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_USHORT)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))                                     \
-        else if ((TYPE) == H5T_NATIVE_INT)                                                                   \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))                                                \
-        else if ((TYPE) == H5T_NATIVE_UINT)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))                                       \
-        else if ((TYPE) == H5T_NATIVE_LONG)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_ULONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_LLONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))                                          \
-        else if ((TYPE) == H5T_NATIVE_ULLONG)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE))                                 \
-        else if ((TYPE) == H5T_NATIVE_FLOAT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_DOUBLE)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))                                             \
     }
-#else /* CHAR_MIN >= 0 */
-#define H5Z_XFORM_TYPE_OP(RESL, RESR, TYPE, OP, SIZE)                                                        \
-    {                                                                                                        \
-        if ((TYPE) == H5T_NATIVE_CHAR)                                                                       \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), char, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_UCHAR)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned char, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_SHORT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), short, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_USHORT)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned short, OP, (SIZE))                                     \
-        else if ((TYPE) == H5T_NATIVE_INT)                                                                   \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), int, OP, (SIZE))                                                \
-        else if ((TYPE) == H5T_NATIVE_UINT)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned int, OP, (SIZE))                                       \
-        else if ((TYPE) == H5T_NATIVE_LONG)                                                                  \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long, OP, (SIZE))                                               \
-        else if ((TYPE) == H5T_NATIVE_ULONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long, OP, (SIZE))                                      \
-        else if ((TYPE) == H5T_NATIVE_LLONG)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), long long, OP, (SIZE))                                          \
-        else if ((TYPE) == H5T_NATIVE_ULLONG)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), unsigned long long, OP, (SIZE))                                 \
-        else if ((TYPE) == H5T_NATIVE_FLOAT)                                                                 \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), float, OP, (SIZE))                                              \
-        else if ((TYPE) == H5T_NATIVE_DOUBLE)                                                                \
-            H5Z_XFORM_DO_OP1((RESL), (RESR), double, OP, (SIZE))                                             \
-    }
-#endif /* CHAR_MIN >= 0 */
-#endif /*H5_SIZEOF_LONG_DOUBLE */
 
 #define H5Z_XFORM_DO_OP3(OP)                                                                                 \
     {                                                                                                        \
@@ -995,8 +916,8 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5Z_xform_eval
  * Purpose:     If the transform is trivial, this function applies it.
- *              Otherwise, it calls H5Z__xform_eval_full to do the full
- *              transform.
+ *              Otherwise, it calls H5Z__xform_eval_prog to run the
+ *              compiled transform.
  * Return:      SUCCEED if transform applied successfully, FAIL otherwise
  * Programmer:  Leon Arber
  *              5/1/04
@@ -1006,11 +927,9 @@ done:
 herr_t
 H5Z_xform_eval(H5Z_data_xform_t *data_xform_prop, void *array, size_t array_size, const H5T_t *buf_type)
 {
-    H5Z_node * tree;
-    hid_t      array_type;
-    H5Z_result res;
-    size_t     i;
-    herr_t     ret_value = SUCCEED; /* Return value */
+    H5Z_node *tree;
+    hid_t     array_type;
+    herr_t    ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
@@ -1063,152 +982,218 @@ H5Z_xform_eval(H5Z_data_xform_t *data_xform_prop, void *array, size_t array_size
 #endif
 
     } /* end if */
-    /* Otherwise, do the full data transform */
-    else {
-        /* Optimization for linear transform: */
-        if (data_xform_prop->dat_val_pointers->num_ptrs == 1)
-            data_xform_prop->dat_val_pointers->ptr_dat_val[0] = array;
+    /* Otherwise, run the compiled transform */
+    else if (H5Z__xform_eval_prog(data_xform_prop, array, array_size, array_type) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
 
-        /* If it's a quadratic transform, we have no choice but to store multiple copies of the data */
-        else {
-            for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++) {
-                if (NULL == (data_xform_prop->dat_val_pointers->ptr_dat_val[i] = (void *)H5MM_malloc(
-                                 array_size * H5T_get_size((H5T_t *)H5I_object(array_type)))))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL,
-                                "Ran out of memory trying to allocate space for data in data transform")
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_xform_eval() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__xform_eval_prog
+ *
+ * Purpose:     Applies the compiled transform in data_xform_prop to array.
+ *
+ * Notes:       The program runs over the array one block of
+ *              H5Z_XFORM_BLOCK_NELMTS elements at a time, so that the
+ *              whole expression is evaluated in a single pass over the
+ *              array, with at most a few blocks of temporary storage
+ *              for a polynomial transform (ie, one that uses the data
+ *              more than once).
+ *
+ * Return:      SUCCEED if transform applied successfully, FAIL otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__xform_eval_prog(const H5Z_data_xform_t *data_xform_prop, void *array, size_t array_size,
+                     hid_t array_type)
+{
+    size_t nblock;              /* Number of elements in a block */
+    void * stack     = NULL;    /* Blocks of a polynomial transform */
+    herr_t ret_value = SUCCEED; /* Return value */
 
-                H5MM_memcpy(data_xform_prop->dat_val_pointers->ptr_dat_val[i], array,
-                            array_size * H5T_get_size((H5T_t *)H5I_object(array_type)));
-            } /* end for */
-        }     /* end else */
+    FUNC_ENTER_STATIC
 
-        if (H5Z__xform_eval_full(tree, array_size, array_type, &res) < 0)
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
+    /* check args */
+    HDassert(data_xform_prop);
+    HDassert(data_xform_prop->prog);
 
-        if (data_xform_prop->dat_val_pointers->num_ptrs > 1)
-            H5MM_memcpy(array, res.value.dat_val, array_size * H5T_get_size((H5T_t *)H5I_object(array_type)));
+    if (array_size == 0)
+        HGOTO_DONE(SUCCEED)
+    nblock = MIN(array_size, H5Z_XFORM_BLOCK_NELMTS);
 
-        /* Free the temporary arrays we used */
-        if (data_xform_prop->dat_val_pointers->num_ptrs > 1)
-            for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++)
-                H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val[i]);
-    } /* end else */
+    if (array_type == H5T_NATIVE_CHAR)
+        H5Z_XFORM_DO_PROG(char)
+#if CHAR_MIN >= 0
+    else if (array_type == H5T_NATIVE_SCHAR)
+        H5Z_XFORM_DO_PROG(signed char)
+#else  /* CHAR_MIN >= 0 */
+    else if (array_type == H5T_NATIVE_UCHAR)
+        H5Z_XFORM_DO_PROG(unsigned char)
+#endif /* CHAR_MIN >= 0 */
+    else if (array_type == H5T_NATIVE_SHORT)
+        H5Z_XFORM_DO_PROG(short)
+    else if (array_type == H5T_NATIVE_USHORT)
+        H5Z_XFORM_DO_PROG(unsigned short)
+    else if (array_type == H5T_NATIVE_INT)
+        H5Z_XFORM_DO_PROG(int)
+    else if (array_type == H5T_NATIVE_UINT)
+        H5Z_XFORM_DO_PROG(unsigned int)
+    else if (array_type == H5T_NATIVE_LONG)
+        H5Z_XFORM_DO_PROG(long)
+    else if (array_type == H5T_NATIVE_ULONG)
+        H5Z_XFORM_DO_PROG(unsigned long)
+    else if (array_type == H5T_NATIVE_LLONG)
+        H5Z_XFORM_DO_PROG(long long)
+    else if (array_type == H5T_NATIVE_ULLONG)
+        H5Z_XFORM_DO_PROG(unsigned long long)
+    else if (array_type == H5T_NATIVE_FLOAT)
+        H5Z_XFORM_DO_PROG(float)
+    else if (array_type == H5T_NATIVE_DOUBLE)
+        H5Z_XFORM_DO_PROG(double)
+#if H5_SIZEOF_LONG_DOUBLE != 0
+    else if (array_type == H5T_NATIVE_LDOUBLE)
+        H5Z_XFORM_DO_PROG(long double)
+#endif
+    else
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "Unexpected type conversion operation")
 
 done:
-    if (ret_value < 0) {
-        /* If we ran out of memory above copying the array for temp storage (which we easily can for
-         * polynomial transforms of high order) we free those arrays which we already allocated */
-        if (data_xform_prop->dat_val_pointers->num_ptrs > 1)
-            for (i = 0; i < data_xform_prop->dat_val_pointers->num_ptrs; i++)
-                if (data_xform_prop->dat_val_pointers->ptr_dat_val[i])
-                    H5MM_xfree(data_xform_prop->dat_val_pointers->ptr_dat_val[i]);
-    } /* end if */
+    H5MM_xfree(stack);
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5Z_xform_eval() */
+} /* end H5Z__xform_eval_prog() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5Z__xform_eval_full
- *
- * Purpose:     Does a full evaluation of the parse tree contained in tree
- *              and applies this transform to array.
+ * Function:    H5Z__xform_compile_tree
  *
- * Notes:       In the case of a polynomial data transform (ie, the left and right
- *              subtree are both of type H5Z_XFORM_SYMBOL), the convention is
- *              that the left hand side will accumulate changes and, at the end,
- *              the new data will be copied from the lhs.
+ * Purpose:     Compiles the parse tree contained in tree into a postfix
+ *              program, appending its instructions to prog (when prog
+ *              is NULL, the instructions are only counted).
  *
- * Return:      Nothing
+ * Notes:       Subtrees without a symbol have been reduced to numbers by
+ *              H5Z__xform_reduce_tree and become the constant operands of
+ *              the instructions.  The program keeps a stack of blocks of
+ *              data; depth is the number of blocks on the stack after the
+ *              instructions for tree and max_depth the most there ever are.
  *
- * Programmer:  Leon Arber
- *              5/1/04
+ * Return:      SUCCEED if the tree could be compiled, FAIL otherwise
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5Z__xform_eval_full(H5Z_node *tree, const size_t array_size, const hid_t array_type, H5Z_result *res)
+H5Z__xform_compile_tree(const H5Z_node *tree, H5Z_xform_inst_t *prog, size_t *len, size_t *depth,
+                        size_t *max_depth)
 {
-    H5Z_result resl, resr;
-    herr_t     ret_value = SUCCEED; /* Return value */
+    H5Z_xform_inst_t inst;                /* Instruction for the root of the tree */
+    hbool_t          lsym;                /* Whether the left subtree has a symbol */
+    hbool_t          rsym;                /* Whether the right subtree has a symbol */
+    herr_t           ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
     /* check args */
     HDassert(tree);
 
-    HDmemset(&resl, 0, sizeof(H5Z_result));
-    HDmemset(&resr, 0, sizeof(H5Z_result));
+    HDmemset(&inst, 0, sizeof(inst));
 
-    if (tree->type == H5Z_XFORM_INTEGER) {
-        res->type          = H5Z_XFORM_INTEGER;
-        res->value.int_val = tree->value.int_val;
+    if (tree->type == H5Z_XFORM_SYMBOL) {
+        inst.form = H5Z_XFORM_INST_LOAD;
+        if (++(*depth) > *max_depth)
+            *max_depth = *depth;
     } /* end if */
-    else if (tree->type == H5Z_XFORM_FLOAT) {
-        res->type            = H5Z_XFORM_FLOAT;
-        res->value.float_val = tree->value.float_val;
+    else if (tree->type == H5Z_XFORM_PLUS || tree->type == H5Z_XFORM_MINUS || tree->type == H5Z_XFORM_MULT ||
+             tree->type == H5Z_XFORM_DIVIDE) {
+        HDassert(tree->rchild);
+
+        lsym = tree->lchild && tree->lchild->type != H5Z_XFORM_INTEGER &&
+               tree->lchild->type != H5Z_XFORM_FLOAT;
+        rsym = tree->rchild->type != H5Z_XFORM_INTEGER && tree->rchild->type != H5Z_XFORM_FLOAT;
+
+        if (lsym && H5Z__xform_compile_tree(tree->lchild, prog, len, depth, max_depth) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error compiling data transform")
+        if (rsym && H5Z__xform_compile_tree(tree->rchild, prog, len, depth, max_depth) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error compiling data transform")
+
+        inst.op = tree->type;
+        if (lsym && rsym) {
+            inst.form = H5Z_XFORM_INST_VV;
+            (*depth)--;
+        } /* end if */
+        else if (lsym) {
+            inst.form  = H5Z_XFORM_INST_VC;
+            inst.value = H5Z_XFORM_NODE_VAL(tree->rchild);
+        } /* end if */
+        else if (rsym) {
+            /* The case that the left operand is nothing, like -x or +x */
+            inst.form  = H5Z_XFORM_INST_CV;
+            inst.value = tree->lchild ? H5Z_XFORM_NODE_VAL(tree->lchild) : 0.0;
+        } /* end if */
+        else
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unexpected type conversion operation")
     } /* end if */
-    else if (tree->type == H5Z_XFORM_SYMBOL) {
-        res->type = H5Z_XFORM_SYMBOL;
+    else
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid expression tree")
 
-        /*since dat_val stores the address of the array which is really stored in the dat_val_pointers,
-         * here we make dat_val store a pointer to the array itself instead of the address of it so that the
-         * rest of the code below works normally. */
-        res->value.dat_val = *((void **)(tree->value.dat_val));
-    } /* end if */
-    else {
-        if (tree->lchild && H5Z__xform_eval_full(tree->lchild, array_size, array_type, &resl) < 0)
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
-        if (H5Z__xform_eval_full(tree->rchild, array_size, array_type, &resr) < 0)
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error while performing data transform")
-
-        res->type = H5Z_XFORM_SYMBOL;
-
-        /* For each type of operation:
-         * 1.  See if "x" is on left hand side, right hand side, or if both sides are "x"
-         * 2.  Figure out what type of data we're going to be manipulating
-         * 3.  Do the operation on the data. */
-        switch (tree->type) {
-            case H5Z_XFORM_PLUS:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, +, array_size)
-                break;
+    if (prog)
+        prog[*len] = inst;
+    (*len)++;
 
-            case H5Z_XFORM_MINUS:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, -, array_size)
-                break;
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z__xform_compile_tree() */
 
-            case H5Z_XFORM_MULT:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, *, array_size)
-                break;
+/*-------------------------------------------------------------------------
+ * Function:    H5Z__xform_compile
+ *
+ * Purpose:     Compiles the parse tree of a data transform into the postfix
+ *              program that H5Z__xform_eval_prog runs.  Trivial transforms
+ *              (whose tree is a single number) get no program.
+ *
+ * Return:      SUCCEED if the tree could be compiled, FAIL otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5Z__xform_compile(H5Z_data_xform_t *data_xform_prop)
+{
+    size_t len       = 0;       /* Number of instructions */
+    size_t depth     = 0;       /* Number of blocks on the stack */
+    size_t max_depth = 0;       /* Most blocks on the stack */
+    herr_t ret_value = SUCCEED; /* Return value */
 
-            case H5Z_XFORM_DIVIDE:
-                H5Z_XFORM_TYPE_OP(resl, resr, array_type, /, array_size)
-                break;
+    FUNC_ENTER_STATIC
 
-            case H5Z_XFORM_ERROR:
-            case H5Z_XFORM_INTEGER:
-            case H5Z_XFORM_FLOAT:
-            case H5Z_XFORM_SYMBOL:
-            case H5Z_XFORM_LPAREN:
-            case H5Z_XFORM_RPAREN:
-            case H5Z_XFORM_END:
-            default:
-                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid expression tree")
-        } /* end switch */
+    /* check args */
+    HDassert(data_xform_prop);
+    HDassert(data_xform_prop->parse_root);
+    HDassert(data_xform_prop->prog == NULL);
 
-        /* The result stores a pointer to the new data */
-        /* So, if the left hand side got its data modified, the result stores a pointers
-         * to the left hand side's data, ditto for rhs */
-        if (resl.type == H5Z_XFORM_SYMBOL)
-            res->value.dat_val = resl.value.dat_val;
-        else if (resr.type == H5Z_XFORM_SYMBOL)
-            res->value.dat_val = resr.value.dat_val;
-        else
-            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error during transform evaluation")
-    } /* end else */
+    if (data_xform_prop->parse_root->type == H5Z_XFORM_INTEGER ||
+        data_xform_prop->parse_root->type == H5Z_XFORM_FLOAT)
+        HGOTO_DONE(SUCCEED)
+
+    /* Count the instructions, then generate them */
+    if (H5Z__xform_compile_tree(data_xform_prop->parse_root, NULL, &len, &depth, &max_depth) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error compiling data transform")
+    HDassert(depth == 1);
+
+    if (NULL == (data_xform_prop->prog = (H5Z_xform_inst_t *)H5MM_malloc(len * sizeof(H5Z_xform_inst_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate memory for compiled data transform")
+
+    len = depth = max_depth = 0;
+    if (H5Z__xform_compile_tree(data_xform_prop->parse_root, data_xform_prop->prog, &len, &depth,
+                                &max_depth) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "error compiling data transform")
+
+    data_xform_prop->prog_len   = len;
+    data_xform_prop->prog_depth = max_depth;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5Z__xform_eval_full() */
+} /* end H5Z__xform_compile() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5Z_find_type
@@ -1578,6 +1563,10 @@ H5Z_xform_create(const char *expr)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL,
                     "error copying the parse tree, did not find correct number of \"variables\"")
 
+    /* Compile the parse tree, so that the transform is applied in a single pass over the data */
+    if (H5Z__xform_compile(data_xform_prop) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "unable to compile data transform")
+
     /* Assign return value */
     ret_value = data_xform_prop;
 
@@ -1587,6 +1576,8 @@ done:
         if (data_xform_prop) {
             if (data_xform_prop->parse_root)
                 H5Z__xform_destroy_parse_tree(data_xform_prop->parse_root);
+            if (data_xform_prop->prog)
+                H5MM_xfree(data_xform_prop->prog);
             if (data_xform_prop->xform_exp)
                 H5MM_xfree(data_xform_prop->xform_exp);
             if (count > 0 && data_xform_prop->dat_val_pointers->ptr_dat_val)
@@ -1624,6 +1615,9 @@ H5Z_xform_destroy(H5Z_data_xform_t *data_xform_prop)
         /* Destroy the parse tree */
         H5Z__xform_destroy_parse_tree(data_xform_prop->parse_root);
 
+        /* Free the compiled transform */
+        H5MM_xfree(data_xform_prop->prog);
+
         /* Free the expression */
         H5MM_xfree(data_xform_prop->xform_exp);
 
@@ -1713,6 +1707,10 @@ H5Z_xform_copy(H5Z_data_xform_t **data_xform_prop)
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL,
                         "error copying the parse tree, did not find correct number of \"variables\"")
 
+        /* Compile the new parse tree */
+        if (H5Z__xform_compile(new_data_xform_prop) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unable to compile data transform")
+
         /* Copy new information on top of old information */
         *data_xform_prop = new_data_xform_prop;
     } /* end if */
@@ -1723,6 +1721,8 @@ done:
         if (new_data_xform_prop) {
             if (new_data_xform_prop->parse_root)
                 H5Z__xform_destroy_parse_tree(new_data_xform_prop->parse_root);
+            if (new_data_xform_prop->prog)
+                H5MM_xfree(new_data_xform_prop->prog);
             if (new_data_xform_prop->xform_exp)
                 H5MM_xfree(new_data_xform_prop->xform_exp);
             H5MM_xfree(new_data_xform_prop);
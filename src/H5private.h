@@ -122,6 +122,13 @@
 #include <sys/file.h>
 #endif
 
+/*
+ * preadv()/pwritev() in sys/uio.h are used for vector I/O in the sec2 VFD.
+ */
+#ifdef H5_HAVE_PREADWRITEV
+#include <sys/uio.h>
+#endif
+
 /*
  * Resource usage is not Posix.1 but HDF5 uses it anyway for some performance
  * and debugging code if available.
@@ -367,6 +374,20 @@
 #endif
 #endif /* __cplusplus */
 
+/*
+ * SSE2 and AVX2 code selected at run time.  Functions using these
+ * instructions (from <immintrin.h>) are marked with H5_ATTR_SSE2 or
+ * H5_ATTR_AVX2, so that the rest of the library is still built for the
+ * baseline processor, and must only be called when H5_CPU_HAS_SSE2() or
+ * H5_CPU_HAS_AVX2() is true.
+ */
+#ifdef H5_HAVE_SIMD_DISPATCH
+#define H5_ATTR_SSE2      __attribute__((target("sse2")))
+#define H5_ATTR_AVX2      __attribute__((target("avx2")))
+#define H5_CPU_HAS_SSE2() __builtin_cpu_supports("sse2")
+#define H5_CPU_HAS_AVX2() __builtin_cpu_supports("avx2")
+#endif /* H5_HAVE_SIMD_DISPATCH */
+
 /*
  * Networking headers used by the mirror VFD and related tests and utilities.
  */
@@ -1217,9 +1238,15 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDmktime
 #define HDmktime(T) mktime(T)
 #endif /* HDmktime */
+#ifndef HDmmap
+#define HDmmap(A, L, P, F, D, O) mmap(A, L, P, F, D, O)
+#endif /* HDmmap */
 #ifndef HDmodf
 #define HDmodf(X, Y) modf(X, Y)
 #endif /* HDmodf */
+#ifndef HDmunmap
+#define HDmunmap(A, L) munmap(A, L)
+#endif /* HDmunmap */
 #ifndef HDnanosleep
 #define HDnanosleep(N, O) nanosleep(N, O)
 #endif /* HDnanosleep */
@@ -1256,6 +1283,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpread
 #define HDpread(F, B, C, O) pread(F, B, C, O)
 #endif /* HDpread */
+#ifndef HDpreadv
+#define HDpreadv(F, V, C, O) preadv(F, V, C, O)
+#endif /* HDpreadv */
 #ifndef HDprintf
 #define HDprintf printf
 #endif /* HDprintf */
@@ -1268,6 +1298,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpthread_attr_setscope
 #define HDpthread_attr_setscope(A, S) pthread_attr_setscope(A, S)
 #endif /* HDpthread_attr_setscope */
+#ifndef HDpthread_cond_broadcast
+#define HDpthread_cond_broadcast(C) pthread_cond_broadcast(C)
+#endif /* HDpthread_cond_broadcast */
 #ifndef HDpthread_cond_init
 #define HDpthread_cond_init(C, A) pthread_cond_init(C, A)
 #endif /* HDpthread_cond_init */
@@ -1280,6 +1313,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpthread_create
 #define HDpthread_create(R, A, F, U) pthread_create(R, A, F, U)
 #endif /* HDpthread_create */
+#ifndef HDpthread_detach
+#define HDpthread_detach(T) pthread_detach(T)
+#endif /* HDpthread_detach */
 #ifndef HDpthread_equal
 #define HDpthread_equal(T1, T2) pthread_equal(T1, T2)
 #endif /* HDpthread_equal */
@@ -1301,6 +1337,15 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpthread_mutex_unlock
 #define HDpthread_mutex_unlock(M) pthread_mutex_unlock(M)
 #endif /* HDpthread_mutex_unlock */
+#ifndef HDpthread_mutexattr_destroy
+#define HDpthread_mutexattr_destroy(A) pthread_mutexattr_destroy(A)
+#endif /* HDpthread_mutexattr_destroy */
+#ifndef HDpthread_mutexattr_init
+#define HDpthread_mutexattr_init(A) pthread_mutexattr_init(A)
+#endif /* HDpthread_mutexattr_init */
+#ifndef HDpthread_mutexattr_settype
+#define HDpthread_mutexattr_settype(A, T) pthread_mutexattr_settype(A, T)
+#endif /* HDpthread_mutexattr_settype */
 #ifndef HDpthread_self
 #define HDpthread_self() pthread_self()
 #endif /* HDpthread_self */
@@ -1322,6 +1367,9 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDpwrite
 #define HDpwrite(F, B, C, O) pwrite(F, B, C, O)
 #endif /* HDpwrite */
+#ifndef HDpwritev
+#define HDpwritev(F, V, C, O) pwritev(F, V, C, O)
+#endif /* HDpwritev */
 #ifndef HDqsort
 #define HDqsort(M, N, Z, F) qsort(M, N, Z, F)
 #endif /* HDqsort*/
@@ -2109,6 +2157,12 @@ typedef struct H5_api_struct {
 #define H5_API_LOCK   H5TS_mutex_lock(&H5_g.init_lock);
 #define H5_API_UNLOCK H5TS_mutex_unlock(&H5_g.init_lock);
 
+/* Macros for letting other threads into the library during blocking I/O */
+#define H5_API_YIELD(yielded)  H5TS_mutex_yield(&H5_g.init_lock, &(yielded));
+#define H5_API_RESUME(yielded)                                                                               \
+    if (yielded)                                                                                             \
+        H5TS_mutex_lock(&H5_g.init_lock);
+
 /* Macros for thread cancellation-safe mechanism */
 #define H5_API_UNSET_CANCEL H5TS_cancel_count_inc();
 
@@ -2124,6 +2178,8 @@ extern H5_api_t H5_g;
 /* disable locks (sequential version) */
 #define H5_API_LOCK
 #define H5_API_UNLOCK
+#define H5_API_YIELD(yielded) (yielded) = FALSE;
+#define H5_API_RESUME(yielded) (void)(yielded);
 
 /* disable cancelability (sequential version) */
 #define H5_API_UNSET_CANCEL
@@ -838,6 +838,10 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5D_CHUNK_IDX_SINGLE");
                                     break;
 
+                                case H5D_CHUNK_IDX_SHARD:
+                                    H5RS_acat(rs, "H5D_CHUNK_IDX_SHARD");
+                                    break;
+
                                 case H5D_CHUNK_IDX_NTYPES:
                                     H5RS_acat(rs, "ERROR: H5D_CHUNK_IDX_NTYPES (invalid value)");
                                     break;
@@ -3484,6 +3488,22 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5VL_NATIVE_DATASET_GET_OFFSET");
                                     break;
 
+                                case H5VL_NATIVE_DATASET_READ_MULTI:
+                                    H5RS_acat(rs, "H5VL_NATIVE_DATASET_READ_MULTI");
+                                    break;
+
+                                case H5VL_NATIVE_DATASET_WRITE_MULTI:
+                                    H5RS_acat(rs, "H5VL_NATIVE_DATASET_WRITE_MULTI");
+                                    break;
+
+                                case H5VL_NATIVE_DATASET_GET_MAPPED_DATA:
+                                    H5RS_acat(rs, "H5VL_NATIVE_DATASET_GET_MAPPED_DATA");
+                                    break;
+
+                                case H5VL_NATIVE_DATASET_CHUNK_READ_MULTI:
+                                    H5RS_acat(rs, "H5VL_NATIVE_DATASET_CHUNK_READ_MULTI");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)optional);
                                     break;
@@ -165,6 +165,7 @@ static void     check_flush_cache__flush_op_eviction_test(H5F_t *file_ptr);
 static unsigned check_get_entry_status(unsigned paged);
 static unsigned check_expunge_entry(unsigned paged);
 static unsigned check_multiple_read_protect(unsigned paged);
+static unsigned check_clock_read_protect(unsigned paged);
 static unsigned check_move_entry(unsigned paged);
 static void     check_move_entry__run_test(H5F_t *file_ptr, unsigned test_num,
                                            struct move_entry_test_spec *spec_ptr);
@@ -13385,6 +13386,162 @@ check_multiple_read_protect(unsigned paged)
 
 } /* check_multiple_read_protect() */
 
+/*-------------------------------------------------------------------------
+ * Function:    check_clock_read_protect()
+ *
+ * Purpose:    Verify that read only protects leave entries in place on
+ *         the LRU list when the cache uses the CLOCK replacement
+ *         policy, and that referenced entries get a second chance
+ *         before they are evicted.
+ *
+ * Return:    void
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+check_clock_read_protect(unsigned paged)
+{
+    H5F_t *       file_ptr  = NULL;
+    H5C_t *       cache_ptr = NULL;
+    test_entry_t *entry_ptr = NULL;
+    int32_t       i;
+
+    if (paged)
+        TESTING("CLOCK replacement policy for read only protects (paged aggr)")
+    else
+        TESTING("CLOCK replacement policy for read only protects")
+
+    pass = TRUE;
+
+    /* allocate a cache with room for eight small entries, and switch it
+     * to the CLOCK replacement policy.
+     *
+     * Fill the cache with small entries (0, 7) using write protects, so
+     * none of them is marked as referenced.
+     *
+     * Read protect (0) twice.  It should stay on the LRU list.  Load (8),
+     * which must evict (1) instead of the protected (0).
+     *
+     * Unprotect (0) twice, which should mark it as referenced.  Load (9),
+     * which should give (0) a second chance and evict (2) instead.
+     *
+     * Finally, read protect (0) and pin it on unprotect, which must move
+     * it off of the LRU list.
+     */
+
+    if (pass) {
+
+        reset_entries();
+
+        file_ptr  = setup_cache((size_t)(2 * 1024), (size_t)(1 * 1024), paged);
+        cache_ptr = file_ptr->shared->cache;
+
+        if (H5C_set_clock_rp(cache_ptr, TRUE) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5C_set_clock_rp() failed.\n";
+        }
+    }
+
+    for (i = 0; pass && i < 8; i++) {
+
+        protect_entry(file_ptr, SMALL_ENTRY_TYPE, i);
+        unprotect_entry(file_ptr, SMALL_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
+    }
+
+    if (pass) {
+
+        entry_ptr = &((entries[SMALL_ENTRY_TYPE])[0]);
+
+        protect_entry_ro(file_ptr, SMALL_ENTRY_TYPE, 0);
+        protect_entry_ro(file_ptr, SMALL_ENTRY_TYPE, 0);
+
+        if (pass && ((!entry_ptr->header.protected_in_lru) || (entry_ptr->header.ro_ref_count != 2) ||
+                     (cache_ptr->pl_len != 0) || (cache_ptr->clock_pl_len != 1) ||
+                     (cache_ptr->LRU_list_len != 8))) {
+
+            pass         = FALSE;
+            failure_mssg = "Unexpected in place protect status 1.\n";
+        }
+    }
+
+    if (pass) {
+
+        protect_entry(file_ptr, SMALL_ENTRY_TYPE, 8);
+        unprotect_entry(file_ptr, SMALL_ENTRY_TYPE, 8, H5C__NO_FLAGS_SET);
+
+        if (pass && ((!entry_in_cache(cache_ptr, SMALL_ENTRY_TYPE, 0)) ||
+                     (entry_in_cache(cache_ptr, SMALL_ENTRY_TYPE, 1)) || (!entry_ptr->header.is_protected))) {
+
+            pass         = FALSE;
+            failure_mssg = "Unexpected eviction 1.\n";
+        }
+    }
+
+    if (pass) {
+
+        unprotect_entry(file_ptr, SMALL_ENTRY_TYPE, 0, H5C__NO_FLAGS_SET);
+        unprotect_entry(file_ptr, SMALL_ENTRY_TYPE, 0, H5C__NO_FLAGS_SET);
+
+        if (pass && ((entry_ptr->header.is_protected) || (entry_ptr->header.protected_in_lru) ||
+                     (!entry_ptr->header.clock_ref) || (cache_ptr->clock_pl_len != 0) ||
+                     (cache_ptr->clock_pl_size != 0))) {
+
+            pass         = FALSE;
+            failure_mssg = "Unexpected in place protect status 2.\n";
+        }
+    }
+
+    if (pass) {
+
+        protect_entry(file_ptr, SMALL_ENTRY_TYPE, 9);
+        unprotect_entry(file_ptr, SMALL_ENTRY_TYPE, 9, H5C__NO_FLAGS_SET);
+
+        if (pass && ((!entry_in_cache(cache_ptr, SMALL_ENTRY_TYPE, 0)) || (entry_ptr->header.clock_ref) ||
+                     (entry_in_cache(cache_ptr, SMALL_ENTRY_TYPE, 2)))) {
+
+            pass         = FALSE;
+            failure_mssg = "Unexpected eviction 2.\n";
+        }
+    }
+
+    if (pass) {
+
+        protect_entry_ro(file_ptr, SMALL_ENTRY_TYPE, 0);
+        unprotect_entry(file_ptr, SMALL_ENTRY_TYPE, 0, H5C__PIN_ENTRY_FLAG);
+
+        if (pass && ((!entry_ptr->header.is_pinned) || (entry_ptr->header.protected_in_lru) ||
+                     (cache_ptr->pel_len != 1) || (cache_ptr->clock_pl_len != 0) ||
+                     (cache_ptr->LRU_list_len != 7))) {
+
+            pass         = FALSE;
+            failure_mssg = "Unexpected in place protect status 3.\n";
+        }
+
+        unpin_entry(SMALL_ENTRY_TYPE, 0);
+    }
+
+    if (pass) {
+
+        takedown_cache(file_ptr, FALSE, FALSE);
+    }
+
+    if (pass) {
+        PASSED();
+    }
+    else {
+        H5_FAILED();
+    }
+
+    if (!pass) {
+
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n", FUNC, failure_mssg);
+    }
+
+    return (unsigned)!pass;
+
+} /* check_clock_read_protect() */
+
 /*-------------------------------------------------------------------------
  * Function:    check_move_entry()
  *
@@ -35956,6 +36113,7 @@ main(void)
         nerrs += check_get_entry_status(paged);
         nerrs += check_expunge_entry(paged);
         nerrs += check_multiple_read_protect(paged);
+        nerrs += check_clock_read_protect(paged);
         nerrs += check_move_entry(paged);
         nerrs += check_pin_protected_entry(paged);
         nerrs += check_resize_entry(paged);
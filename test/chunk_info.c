@@ -282,6 +282,8 @@ index_type_str(H5D_chunk_index_t idx_type)
             return ("Version 2 B-tree index type");
         case H5D_CHUNK_IDX_BTREE:
             return ("Version 1 B-tree index type (default)");
+        case H5D_CHUNK_IDX_SHARD:
+            return ("Sharded version 2 B-tree index type");
         case H5D_CHUNK_IDX_NTYPES:
         default:
             return ("invalid index type");
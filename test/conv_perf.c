@@ -0,0 +1,158 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Microbenchmark for the hardware datatype conversions.
+ *
+ * For each pair of native types below, converts a buffer of 2^N elements
+ * (2^22 by default, or N given on the command line) in place with
+ * H5Tconvert(), both without an exception callback (which lets the library
+ * use vector instructions) and with a callback that leaves the exceptions to
+ * the library (which converts the elements one at a time), and prints the
+ * throughput of each, in millions of elements per second.
+ *
+ * This program isn't run by the tests; it's built so that the speed of the
+ * conversions can be checked by hand.
+ */
+
+#include "h5test.h"
+
+/* Default & largest number of elements, as powers of two */
+#define CONV_PERF_DEF_EXP 22
+#define CONV_PERF_MAX_EXP 28
+
+/* Number of times each buffer is converted */
+#define CONV_PERF_NREPS 10
+
+/* Conversion exception callback, leaving all the exceptions to the library */
+static H5T_conv_ret_t
+except_unhandled(H5T_conv_except_t H5_ATTR_UNUSED except_type, hid_t H5_ATTR_UNUSED src_id,
+                 hid_t H5_ATTR_UNUSED dst_id, void H5_ATTR_UNUSED *src_buf, void H5_ATTR_UNUSED *dst_buf,
+                 void H5_ATTR_UNUSED *user_data)
+{
+    return H5T_CONV_UNHANDLED;
+}
+
+/* Fill a buffer with n values of a native type, a few of them out of the range
+ * of the narrower types
+ */
+static void
+fill_values(hid_t type, unsigned char *buf, size_t n)
+{
+    hbool_t is_double = H5Tequal(type, H5T_NATIVE_DOUBLE) > 0;
+    hbool_t is_float  = H5Tequal(type, H5T_NATIVE_FLOAT) > 0;
+    hbool_t is_int    = H5Tequal(type, H5T_NATIVE_INT) > 0;
+    size_t  u;
+
+    for (u = 0; u < n; u++) {
+        double x = (double)(HDrandom() % 200001 - 100000) * ((u % 64) ? 0.5 : 1e5);
+
+        if (is_double)
+            ((double *)buf)[u] = x;
+        else if (is_float)
+            ((float *)buf)[u] = (float)x;
+        else if (is_int)
+            ((int *)buf)[u] = (int)x;
+        else
+            ((short *)buf)[u] = (short)x;
+    } /* end for */
+}
+
+/* Time the conversion of n elements from src to dst.  Returns 0 on success,
+ * -1 on failure.
+ */
+static int
+time_conv(const char *name, hid_t src, hid_t dst, hid_t cb_dxpl, size_t n)
+{
+    size_t         src_size = H5Tget_size(src);
+    size_t         buf_size = n * MAX(src_size, H5Tget_size(dst));
+    unsigned char *buf      = NULL;
+    unsigned char *saved    = NULL;
+    double         secs[2]  = {0.0, 0.0};
+    int            with_cb;
+    int            i;
+
+    if (NULL == (buf = (unsigned char *)HDmalloc(buf_size)))
+        goto error;
+    if (NULL == (saved = (unsigned char *)HDmalloc(n * src_size)))
+        goto error;
+    fill_values(src, saved, n);
+
+    for (with_cb = 0; with_cb < 2; with_cb++)
+        for (i = 0; i < CONV_PERF_NREPS; i++) {
+            double start;
+
+            HDmemcpy(buf, saved, n * src_size);
+            start = H5_get_time();
+            if (H5Tconvert(src, dst, n, buf, NULL, with_cb ? cb_dxpl : H5P_DEFAULT) < 0)
+                goto error;
+            secs[with_cb] += H5_get_time() - start;
+        } /* end for */
+
+    HDfprintf(stdout, "  %-22s %10.2f Melmts/s %10.2f Melmts/s\n", name,
+              secs[0] > 0.0 ? ((double)(n * CONV_PERF_NREPS) / secs[0]) / 1000000.0 : 0.0,
+              secs[1] > 0.0 ? ((double)(n * CONV_PERF_NREPS) / secs[1]) / 1000000.0 : 0.0);
+
+    HDfree(saved);
+    HDfree(buf);
+
+    return 0;
+
+error:
+    HDfree(saved);
+    HDfree(buf);
+
+    return -1;
+}
+
+int
+main(int argc, char *argv[])
+{
+    hid_t  cb_dxpl = H5I_INVALID_HID;
+    int    nexp    = CONV_PERF_DEF_EXP;
+    size_t n;
+
+    if (argc > 1 && ((nexp = HDatoi(argv[1])) < 1 || nexp > CONV_PERF_MAX_EXP)) {
+        HDfprintf(stderr, "usage: %s [power of two elements (1 to %d)]\n", argv[0], CONV_PERF_MAX_EXP);
+        HDexit(EXIT_FAILURE);
+    }
+    n = (size_t)1 << nexp;
+
+    if ((cb_dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        goto error;
+    if (H5Pset_type_conv_cb(cb_dxpl, except_unhandled, NULL) < 0)
+        goto error;
+
+    HDsrandom(42);
+    HDfprintf(stdout, "%zu elements:  %22s %19s\n", n, "no callback", "callback");
+    if (time_conv("double -> float", H5T_NATIVE_DOUBLE, H5T_NATIVE_FLOAT, cb_dxpl, n) < 0 ||
+        time_conv("float -> double", H5T_NATIVE_FLOAT, H5T_NATIVE_DOUBLE, cb_dxpl, n) < 0 ||
+        time_conv("float -> int", H5T_NATIVE_FLOAT, H5T_NATIVE_INT, cb_dxpl, n) < 0 ||
+        time_conv("double -> int", H5T_NATIVE_DOUBLE, H5T_NATIVE_INT, cb_dxpl, n) < 0 ||
+        time_conv("int -> float", H5T_NATIVE_INT, H5T_NATIVE_FLOAT, cb_dxpl, n) < 0 ||
+        time_conv("int -> double", H5T_NATIVE_INT, H5T_NATIVE_DOUBLE, cb_dxpl, n) < 0 ||
+        time_conv("int -> short", H5T_NATIVE_INT, H5T_NATIVE_SHORT, cb_dxpl, n) < 0 ||
+        time_conv("short -> signed char", H5T_NATIVE_SHORT, H5T_NATIVE_SCHAR, cb_dxpl, n) < 0)
+        goto error;
+
+    if (H5Pclose(cb_dxpl) < 0)
+        goto error;
+
+    HDexit(EXIT_SUCCESS);
+
+error:
+    HDfprintf(stderr, "failed\n");
+    H5E_BEGIN_TRY { H5Pclose(cb_dxpl); }
+    H5E_END_TRY;
+
+    HDexit(EXIT_FAILURE);
+}
@@ -36,6 +36,7 @@
 #define DATASETNAME10 "read_w_valid_cache"
 #define DATASETNAME11 "unallocated_chunk"
 #define DATASETNAME12 "unfiltered_data"
+#define DATASETNAME13 "read_chunks"
 
 #define RANK     2
 #define NX       16
@@ -2071,6 +2072,198 @@ error:
     return 1;
 } /* test_read_unallocated_chunk() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_read_chunks
+ *
+ * Purpose:     Test H5Dread_chunks: several compressed chunks, some held
+ *              dirty in the chunk cache and some never written, read in
+ *              one call and packed in order of address.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifdef H5_HAVE_FILTER_DEFLATE
+static int
+test_read_chunks(hid_t file)
+{
+    hid_t   dataspace = -1, dataset = -1;
+    hid_t   mem_space = -1;
+    hid_t   cparms = -1, dxpl = -1;
+    hsize_t dims[2]       = {NX, NY};
+    hsize_t maxdims[2]    = {H5S_UNLIMITED, H5S_UNLIMITED};
+    hsize_t chunk_dims[2] = {CHUNK_NX, CHUNK_NY};
+    hsize_t mem_dims[2]   = {NX - CHUNK_NX, NY};
+    hsize_t start[2]      = {0, 0};
+    int     data[NX][NY];
+    int     direct_buf[CHUNK_NX][CHUNK_NY]; /* chunk decompressed from H5Dread_chunks' buffer */
+    size_t  nchunks = (NX / CHUNK_NX) * (NY / CHUNK_NY);
+    size_t  count   = nchunks + 1;  /* every chunk, backwards, and the first one again */
+    hsize_t offsets[((NX / CHUNK_NX) * (NY / CHUNK_NY) + 1) * RANK];
+    haddr_t addrs[(NX / CHUNK_NX) * (NY / CHUNK_NY) + 1];
+    hsize_t sizes[(NX / CHUNK_NX) * (NY / CHUNK_NY) + 1];
+    hsize_t buf_offsets[(NX / CHUNK_NX) * (NY / CHUNK_NY) + 1];
+    hsize_t storage_size;
+    hsize_t total = 0;
+    haddr_t addr;
+    unsigned filters[(NX / CHUNK_NX) * (NY / CHUNK_NY) + 1];
+    unsigned filter_mask;
+    void *   outbuf = NULL;
+    herr_t   status;
+    int      ret;
+    size_t   u, v;
+    int      i, j, n;
+
+    TESTING("H5Dread_chunks");
+
+    /* Create a compressed dataset */
+    if ((dataspace = H5Screate_simple(RANK, dims, maxdims)) < 0)
+        goto error;
+    if ((mem_space = H5Screate_simple(RANK, mem_dims, NULL)) < 0)
+        goto error;
+    if ((cparms = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(cparms, RANK, chunk_dims) < 0)
+        goto error;
+    if (H5Pset_deflate(cparms, 9) < 0)
+        goto error;
+    if ((dataset = H5Dcreate2(file, DATASETNAME13, H5T_NATIVE_INT, dataspace, H5P_DEFAULT, cparms,
+                              H5P_DEFAULT)) < 0)
+        goto error;
+    if ((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        goto error;
+
+    /* Write all rows of chunks but the last; they stay in the chunk cache */
+    for (i = n = 0; i < NX; i++)
+        for (j = 0; j < NY; j++)
+            data[i][j] = n++;
+    if (H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, start, NULL, mem_dims, NULL) < 0)
+        goto error;
+    if (H5Dwrite(dataset, H5T_NATIVE_INT, mem_space, dataspace, dxpl, data) < 0)
+        goto error;
+
+    /* Request every chunk, last to first, and the first one again */
+    for (u = 0; u < nchunks; u++) {
+        offsets[u * RANK]     = ((nchunks - 1 - u) / (NY / CHUNK_NY)) * CHUNK_NX;
+        offsets[u * RANK + 1] = ((nchunks - 1 - u) % (NY / CHUNK_NY)) * CHUNK_NY;
+    }
+    offsets[nchunks * RANK]     = 0;
+    offsets[nchunks * RANK + 1] = 0;
+
+    /* Query the chunks' sizes (this writes the cached chunks to the file) */
+    if (H5Dread_chunks(dataset, dxpl, count, offsets, filters, sizes, buf_offsets, 0, NULL) < 0)
+        goto error;
+    for (u = 0; u < count; u++) {
+        if (offsets[u * RANK] >= NX - CHUNK_NX) {
+            if (sizes[u] != 0)
+                goto error;
+            continue;
+        }
+        if (H5Dget_chunk_storage_size(dataset, &offsets[u * RANK], &storage_size) < 0)
+            goto error;
+        if (sizes[u] != storage_size || filters[u] != 0)
+            goto error;
+        if (H5Dget_chunk_info_by_coord(dataset, &offsets[u * RANK], &filter_mask, &addr, &storage_size) < 0)
+            goto error;
+        addrs[u] = addr;
+        total += sizes[u];
+    }
+
+    /* The chunks must be packed in order of address */
+    for (u = 0; u < count; u++)
+        for (v = 0; v < count; v++)
+            if (sizes[u] > 0 && sizes[v] > 0 && addrs[u] < addrs[v] && buf_offsets[u] >= buf_offsets[v])
+                goto error;
+
+    /* A buffer that's too small must be rejected */
+    if (NULL == (outbuf = HDmalloc((size_t)total)))
+        goto error;
+    H5E_BEGIN_TRY
+    {
+        status = H5Dread_chunks(dataset, dxpl, count, offsets, filters, sizes, buf_offsets, (size_t)total - 1,
+                                outbuf);
+    }
+    H5E_END_TRY;
+    if (status >= 0)
+        goto error;
+
+    /* Read the chunks and check their contents */
+    if (H5Dread_chunks(dataset, dxpl, count, offsets, filters, sizes, buf_offsets, (size_t)total, outbuf) < 0)
+        goto error;
+    for (u = 0; u < count; u++) {
+        uLong z_dst_nbytes = (uLong)sizeof(direct_buf);
+
+        if (sizes[u] == 0)
+            continue;
+        if (buf_offsets[u] + sizes[u] > total)
+            goto error;
+
+        ret = uncompress((Bytef *)direct_buf, &z_dst_nbytes, (const Bytef *)outbuf + buf_offsets[u],
+                         (uLong)sizes[u]);
+        if (Z_OK != ret) {
+            HDfprintf(stderr, "deflate error\n");
+            goto error;
+        }
+
+        for (i = 0; i < CHUNK_NX; i++)
+            for (j = 0; j < CHUNK_NY; j++)
+                if (direct_buf[i][j] !=
+                    data[offsets[u * RANK] + (hsize_t)i][offsets[u * RANK + 1] + (hsize_t)j]) {
+                    HDprintf("\n    Read different values than written.");
+                    HDprintf("    Chunk %u, at index %d,%d\n", (unsigned)u, i, j);
+                    goto error;
+                }
+    }
+
+    /* Read a single chunk, which is looked up on its own */
+    if (H5Dread_chunks(dataset, dxpl, 1, &offsets[(nchunks - 1) * RANK], filters, sizes, buf_offsets,
+                       (size_t)total, outbuf) < 0)
+        goto error;
+    if (sizes[0] != sizes[nchunks - 1] || buf_offsets[0] != 0)
+        goto error;
+
+    /* Offsets off chunk boundaries must be rejected */
+    offsets[0] = 1;
+    H5E_BEGIN_TRY
+    {
+        status = H5Dread_chunks(dataset, dxpl, 1, offsets, filters, sizes, buf_offsets, 0, NULL);
+    }
+    H5E_END_TRY;
+    if (status >= 0)
+        goto error;
+
+    /* Close/release resources. */
+    H5Dclose(dataset);
+    H5Sclose(mem_space);
+    H5Sclose(dataspace);
+    H5Pclose(cparms);
+    H5Pclose(dxpl);
+
+    HDfree(outbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dataset);
+        H5Sclose(mem_space);
+        H5Sclose(dataspace);
+        H5Pclose(cparms);
+        H5Pclose(dxpl);
+    }
+    H5E_END_TRY;
+
+    if (outbuf)
+        HDfree(outbuf);
+
+    H5_FAILED();
+    return 1;
+} /* test_read_chunks() */
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
 /*-------------------------------------------------------------------------
  * Function:    test_single_chunk
  *
@@ -2276,6 +2469,9 @@ main(void)
 #endif /* H5_HAVE_FILTER_DEFLATE */
     nerrors += test_read_unfiltered_dset(file_id);
     nerrors += test_read_unallocated_chunk(file_id);
+#ifdef H5_HAVE_FILTER_DEFLATE
+    nerrors += test_read_chunks(file_id);
+#endif /* H5_HAVE_FILTER_DEFLATE */
 
     /* Loop over test configurations */
     for (config = 0; config < CONFIG_END; config++) {
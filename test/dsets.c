@@ -83,6 +83,13 @@ const char *FILENAME[] = {"dataset",             /* 0 */
                           "power2up",            /* 24 */
                           "version_bounds",      /* 25 */
                           "alloc_0sized",        /* 26 */
+                          "multi_dset",          /* 27 */
+                          "filter_threads",      /* 28 */
+                          "chunk_idx_cache",     /* 29 */
+                          "shared_chunk_cache",  /* 30 */
+                          "chunk_prefetch",      /* 31 */
+                          "chunk_coalesce",      /* 32 */
+                          "chunk_shard",         /* 33 */
                           NULL};
 
 #define OHMIN_FILENAME_A "ohdr_min_a"
@@ -128,6 +135,7 @@ const char *FILENAME[] = {"dataset",             /* 0 */
 #define DSET_SET_LOCAL_NAME            "set_local"
 #define DSET_SET_LOCAL_NAME_2          "set_local_2"
 #define DSET_ONEBYTE_SHUF_NAME         "onebyte_shuffle"
+#define DSET_SHUF_MODES_NAME           "shuffle_modes_%u_%u"
 #define DSET_NBIT_INT_NAME             "nbit_int"
 #define DSET_NBIT_FLOAT_NAME           "nbit_float"
 #define DSET_NBIT_DOUBLE_NAME          "nbit_double"
@@ -3121,6 +3129,185 @@ error:
     return FAIL;
 } /* end test_onebyte_shuffle() */
 
+/*-------------------------------------------------------------------------
+ * Function:  test_shuffle_modes
+ *
+ * Purpose:   Tests the byte and bit modes of the shuffle filter with
+ *            element sizes from 1 to SHUF_MODES_MAX_SIZE bytes: checks
+ *            the shuffled chunk against the expected layout, and that the
+ *            data reads back unchanged.  The number of elements isn't a
+ *            multiple of 8 or of the number of elements shuffled at once
+ *            by the SSE2/AVX2 code.
+ *
+ * Return:    Success:    0
+ *            Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+#define SHUF_MODES_MAX_SIZE 16
+#define SHUF_MODES_NELMTS   1003
+static herr_t
+test_shuffle_modes(hid_t file)
+{
+    hid_t          dataset = H5I_INVALID_HID, space = H5I_INVALID_HID;
+    hid_t          type = H5I_INVALID_HID, dc = H5I_INVALID_HID, dcpl = H5I_INVALID_HID;
+    char           name[32];
+    const hsize_t  size[1]   = {SHUF_MODES_NELMTS};
+    hsize_t        offset[1] = {0};
+    unsigned char *orig_data = NULL, *new_data = NULL, *expected = NULL, *plane;
+    size_t         nbytes = SHUF_MODES_NELMTS * SHUF_MODES_MAX_SIZE;
+    size_t         ngroups;
+    size_t         cd_nelmts;
+    unsigned       cd_values[2];
+    unsigned       filter_config;
+    uint32_t       filter_mask;
+    unsigned       elmt_size, mode;
+    size_t         i, j, k;
+
+    TESTING("shuffle filter modes");
+
+    if (NULL == (orig_data = (unsigned char *)HDmalloc(nbytes)))
+        TEST_ERROR
+    if (NULL == (new_data = (unsigned char *)HDmalloc(nbytes)))
+        TEST_ERROR
+    if (NULL == (expected = (unsigned char *)HDmalloc(nbytes)))
+        TEST_ERROR
+    for (i = 0; i < nbytes; i++)
+        orig_data[i] = (unsigned char)HDrandom();
+
+    if ((space = H5Screate_simple(1, size, NULL)) < 0)
+        TEST_ERROR
+
+    for (elmt_size = 1; elmt_size <= SHUF_MODES_MAX_SIZE; elmt_size++)
+        for (mode = H5Z_SHUFFLE_BYTE; mode <= H5Z_SHUFFLE_BIT; mode++) {
+            if ((type = H5Tcreate(H5T_OPAQUE, (size_t)elmt_size)) < 0)
+                TEST_ERROR
+            if (H5Tset_tag(type, "shuffle test") < 0)
+                TEST_ERROR
+            if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+                TEST_ERROR
+            if (H5Pset_chunk(dc, 1, size) < 0)
+                TEST_ERROR
+            if (mode == H5Z_SHUFFLE_BIT) {
+                if (H5Pset_bitshuffle(dc) < 0)
+                    TEST_ERROR
+            }
+            else if (H5Pset_shuffle(dc) < 0)
+                TEST_ERROR
+
+            HDsnprintf(name, sizeof(name), DSET_SHUF_MODES_NAME, elmt_size, mode);
+            if ((dataset = H5Dcreate2(file, name, type, space, H5P_DEFAULT, dc, H5P_DEFAULT)) < 0)
+                TEST_ERROR
+            if (H5Dwrite(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, orig_data) < 0)
+                TEST_ERROR
+
+            /* The mode is only stored for bit shuffling */
+            if ((dcpl = H5Dget_create_plist(dataset)) < 0)
+                TEST_ERROR
+            cd_nelmts = 2;
+            if (H5Pget_filter_by_id2(dcpl, H5Z_FILTER_SHUFFLE, NULL, &cd_nelmts, cd_values, (size_t)0, NULL,
+                                     &filter_config) < 0)
+                TEST_ERROR
+            if (cd_nelmts != (mode == H5Z_SHUFFLE_BIT ? 2 : 1) || cd_values[0] != elmt_size)
+                FAIL_PUTS_ERROR("    wrong shuffle filter parameters")
+            if (H5Pclose(dcpl) < 0)
+                TEST_ERROR
+
+            /* Shuffle the data by hand */
+            for (j = 0; j < elmt_size; j++)
+                for (i = 0; i < SHUF_MODES_NELMTS; i++)
+                    expected[(j * SHUF_MODES_NELMTS) + i] = orig_data[(i * elmt_size) + j];
+            if (mode == H5Z_SHUFFLE_BIT) {
+                ngroups = SHUF_MODES_NELMTS / 8;
+                HDmemcpy(new_data, expected, SHUF_MODES_NELMTS * elmt_size);
+                for (j = 0; j < elmt_size; j++) {
+                    plane = new_data + (j * SHUF_MODES_NELMTS);
+                    for (k = 0; k < 8; k++)
+                        for (i = 0; i < ngroups; i++) {
+                            unsigned bits = 0;
+                            unsigned u;
+
+                            for (u = 0; u < 8; u++)
+                                bits |= (unsigned)((plane[(i * 8) + u] >> k) & 1) << u;
+                            expected[(j * SHUF_MODES_NELMTS) + (k * ngroups) + i] = (unsigned char)bits;
+                        }
+                }
+            }
+
+            /* Compare with the chunk in the file */
+            if (H5Dread_chunk(dataset, H5P_DEFAULT, offset, &filter_mask, new_data) < 0)
+                TEST_ERROR
+            if (filter_mask != 0 || HDmemcmp(new_data, expected, SHUF_MODES_NELMTS * elmt_size) != 0) {
+                H5_FAILED();
+                HDprintf("    Wrong shuffled data for %u-byte elements, %s mode\n", elmt_size,
+                         mode == H5Z_SHUFFLE_BIT ? "bit" : "byte");
+                goto error;
+            }
+
+            /* Read the data back */
+            HDmemset(new_data, 0, nbytes);
+            if (H5Dread(dataset, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, new_data) < 0)
+                TEST_ERROR
+            if (HDmemcmp(new_data, orig_data, SHUF_MODES_NELMTS * elmt_size) != 0) {
+                H5_FAILED();
+                HDprintf("    Read different values than written for %u-byte elements, %s mode\n", elmt_size,
+                         mode == H5Z_SHUFFLE_BIT ? "bit" : "byte");
+                goto error;
+            }
+
+            if (H5Dclose(dataset) < 0)
+                TEST_ERROR
+            if (H5Pclose(dc) < 0)
+                TEST_ERROR
+            if (H5Tclose(type) < 0)
+                TEST_ERROR
+        }
+
+    /* An unknown mode should be rejected */
+    cd_values[0] = 0;
+    cd_values[1] = H5Z_SHUFFLE_BIT + 1;
+    if ((dc = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if (H5Pset_chunk(dc, 1, size) < 0)
+        TEST_ERROR
+    if (H5Pset_filter(dc, H5Z_FILTER_SHUFFLE, H5Z_FLAG_OPTIONAL, (size_t)2, cd_values) < 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY
+    {
+        dataset = H5Dcreate2(file, "shuffle_modes_bad", H5T_NATIVE_INT, space, H5P_DEFAULT, dc, H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (dataset >= 0)
+        FAIL_PUTS_ERROR("    created dataset with unknown shuffle mode")
+    if (H5Pclose(dc) < 0)
+        TEST_ERROR
+
+    if (H5Sclose(space) < 0)
+        TEST_ERROR
+    HDfree(orig_data);
+    HDfree(new_data);
+    HDfree(expected);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dataset);
+        H5Pclose(dcpl);
+        H5Pclose(dc);
+        H5Tclose(type);
+        H5Sclose(space);
+    }
+    H5E_END_TRY;
+    HDfree(orig_data);
+    HDfree(new_data);
+    HDfree(expected);
+
+    return FAIL;
+} /* end test_shuffle_modes() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_nbit_int
  *
@@ -13104,6 +13291,1520 @@ error:
     return FAIL;
 } /* end test_power2up() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_multi_dset_io
+ *
+ * Purpose:     Tests H5Dwrite_multi and H5Dread_multi, with a mix of
+ *              contiguous datasets (which can be accessed with a single
+ *              vector request), a contiguous dataset requiring datatype
+ *              conversion and a chunked dataset.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define MULTI_NDSETS 5
+#define MULTI_NELMTS 100
+static herr_t
+test_multi_dset_io(hid_t fapl)
+{
+    char         filename[FILENAME_BUF_SIZE];
+    hid_t        fid    = -1;                       /* File ID */
+    hid_t        dcpl   = -1;                       /* Dataset creation property list */
+    hid_t        sid    = -1;                       /* Dataspace ID */
+    hid_t        hs_sid = -1;                       /* Dataspace ID for hyperslab selection */
+    hid_t        dset_ids[MULTI_NDSETS];            /* Dataset IDs */
+    hid_t        mem_type_ids[MULTI_NDSETS];        /* Memory datatype IDs */
+    hid_t        mem_space_ids[MULTI_NDSETS];       /* Memory dataspace IDs */
+    hid_t        file_space_ids[MULTI_NDSETS];      /* File dataspace IDs */
+    const void * wbufs[MULTI_NDSETS];               /* Write buffers */
+    void *       rbufs[MULTI_NDSETS];               /* Read buffers */
+    int          wdata[MULTI_NDSETS][MULTI_NELMTS]; /* Data written */
+    int          rdata[MULTI_NDSETS][MULTI_NELMTS]; /* Data read */
+    short        wdata_s[MULTI_NELMTS];             /* Data written, for conversion */
+    short        rdata_s[MULTI_NELMTS];             /* Data read, for conversion */
+    char         dset_name[32];                     /* Dataset name */
+    hsize_t      dims[1]   = {MULTI_NELMTS};        /* Dataset dimensions */
+    hsize_t      chunk[1]  = {16};                  /* Chunk dimensions */
+    hsize_t      start[1]  = {10};                  /* Hyperslab start */
+    hsize_t      stride[1] = {3};                   /* Hyperslab stride */
+    hsize_t      count[1]  = {20};                  /* Hyperslab count */
+    size_t       u, v;                              /* Local index variables */
+
+    TESTING("multi-dataset I/O");
+
+    h5_fixname(FILENAME[27], fapl, filename, sizeof filename);
+
+    for (u = 0; u < MULTI_NDSETS; u++)
+        dset_ids[u] = -1;
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((hs_sid = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sselect_hyperslab(hs_sid, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 1, chunk) < 0)
+        FAIL_STACK_ERROR
+
+    /* Datasets 0-3 are contiguous, dataset 4 is chunked */
+    for (u = 0; u < MULTI_NDSETS; u++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "multi_%u", (unsigned)u);
+        if ((dset_ids[u] = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT,
+                                      u == MULTI_NDSETS - 1 ? dcpl : H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+
+        for (v = 0; v < MULTI_NELMTS; v++)
+            wdata[u][v] = (int)(u * 1000 + v);
+        mem_type_ids[u]   = H5T_NATIVE_INT;
+        mem_space_ids[u]  = H5S_ALL;
+        file_space_ids[u] = H5S_ALL;
+        wbufs[u]          = wdata[u];
+        rbufs[u]          = rdata[u];
+    } /* end for */
+
+    /* Dataset 1 uses a hyperslab selection in memory and the file */
+    mem_space_ids[1]  = hs_sid;
+    file_space_ids[1] = hs_sid;
+
+    /* Write and read back the contiguous datasets without conversion */
+    if (H5Dwrite_multi(MULTI_NDSETS - 2, dset_ids, mem_type_ids, mem_space_ids, file_space_ids,
+                       H5P_DEFAULT, wbufs) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rdata, 0, sizeof(rdata));
+    if (H5Dread_multi(MULTI_NDSETS - 2, dset_ids, mem_type_ids, mem_space_ids, file_space_ids, H5P_DEFAULT,
+                      rbufs) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < MULTI_NDSETS - 2; u++)
+        for (v = 0; v < MULTI_NELMTS; v++) {
+            int expect = wdata[u][v];
+
+            /* Only every third element from 10 to 67 is selected for dataset 1 */
+            if (u == 1 && (v < 10 || v > 67 || (v - 10) % 3 != 0))
+                expect = 0;
+            if (rdata[u][v] != expect) {
+                H5_FAILED();
+                HDprintf("    dataset %u, element %u: read %d, expected %d\n", (unsigned)u, (unsigned)v,
+                         rdata[u][v], expect);
+                goto error;
+            } /* end if */
+        }     /* end for */
+
+    /* Dataset 3 is accessed as shorts, requiring conversion */
+    for (v = 0; v < MULTI_NELMTS; v++)
+        wdata_s[v] = (short)(v * 2);
+    mem_type_ids[3] = H5T_NATIVE_SHORT;
+    wbufs[3]        = wdata_s;
+    rbufs[3]        = rdata_s;
+
+    /* Write and read back all of the datasets */
+    for (v = 0; v < MULTI_NELMTS; v++)
+        wdata[0][v] = -wdata[0][v];
+    if (H5Dwrite_multi(MULTI_NDSETS, dset_ids, mem_type_ids, mem_space_ids, file_space_ids, H5P_DEFAULT,
+                       wbufs) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rdata, 0, sizeof(rdata));
+    HDmemset(rdata_s, 0, sizeof(rdata_s));
+    if (H5Dread_multi(MULTI_NDSETS, dset_ids, mem_type_ids, mem_space_ids, file_space_ids, H5P_DEFAULT,
+                      rbufs) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < MULTI_NDSETS; u++) {
+        if (u == 1 || u == 3)
+            continue;
+        if (HDmemcmp(wdata[u], rdata[u], sizeof(wdata[u])) != 0)
+            FAIL_PUTS_ERROR("incorrect data read")
+    } /* end for */
+    if (HDmemcmp(wdata_s, rdata_s, sizeof(wdata_s)) != 0)
+        FAIL_PUTS_ERROR("incorrect converted data read")
+
+    /* Check the data with H5Dread */
+    if (H5Dread(dset_ids[3], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata[3]) < 0)
+        FAIL_STACK_ERROR
+    for (v = 0; v < MULTI_NELMTS; v++)
+        if (rdata[3][v] != (int)wdata_s[v])
+            FAIL_PUTS_ERROR("incorrect data read with H5Dread")
+    if (H5Dread(dset_ids[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata[0]) < 0)
+        FAIL_STACK_ERROR
+    if (HDmemcmp(wdata[0], rdata[0], sizeof(wdata[0])) != 0)
+        FAIL_PUTS_ERROR("incorrect data read with H5Dread")
+
+    /* A zero count is a no-op */
+    if (H5Dread_multi(0, dset_ids, mem_type_ids, mem_space_ids, file_space_ids, H5P_DEFAULT, rbufs) < 0)
+        FAIL_STACK_ERROR
+
+    for (u = 0; u < MULTI_NDSETS; u++)
+        if (H5Dclose(dset_ids[u]) < 0)
+            FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(hs_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (u = 0; u < MULTI_NDSETS; u++)
+            H5Dclose(dset_ids[u]);
+        H5Pclose(dcpl);
+        H5Sclose(hs_sid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_multi_dset_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_filter_threads
+ *
+ * Purpose:     Tests filtering chunks with several threads (see
+ *              H5Pset_chunk_filter_threads), when reading and writing
+ *              chunks that don't fit in the chunk cache, and when
+ *              flushing chunks from the cache.  Also tests datasets with
+ *              unfiltered partial edge chunks.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define FILTER_THREADS_DIM   60
+#define FILTER_THREADS_CHUNK 8
+static herr_t
+test_chunk_filter_threads(hid_t fapl)
+{
+    char     filename[FILENAME_BUF_SIZE];
+    hid_t    fid      = -1;                                           /* File ID */
+    hid_t    dcpl     = -1;                                           /* Dataset creation property list */
+    hid_t    dapl     = -1;                                           /* Dataset access property list */
+    hid_t    dapl2    = -1;                                           /* Dataset's access property list */
+    hid_t    sid      = -1;                                           /* Dataspace ID */
+    hid_t    dsid     = -1;                                           /* Dataset ID */
+    hsize_t  dims[2]  = {FILTER_THREADS_DIM, FILTER_THREADS_DIM};     /* Dataset dimensions */
+    hsize_t  chunk[2] = {FILTER_THREADS_CHUNK, FILTER_THREADS_CHUNK}; /* Chunk dimensions */
+    hsize_t  start[2] = {3, 5};                                       /* Hyperslab start */
+    hsize_t  count[2] = {40, 50};                                     /* Hyperslab count */
+    int *    wbuf     = NULL;                                         /* Data written */
+    int *    rbuf     = NULL;                                         /* Data read */
+    unsigned nthreads;                                                /* # of filter threads */
+    unsigned edge;                                                    /* Whether to filter partial edge chunks */
+    herr_t   ret;                                                     /* Generic return value */
+    size_t   u, v;                                                    /* Local index variables */
+
+    TESTING("filtering chunks with several threads");
+
+    h5_fixname(FILENAME[28], fapl, filename, sizeof filename);
+
+    if (NULL == (wbuf = (int *)HDmalloc(FILTER_THREADS_DIM * FILTER_THREADS_DIM * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(FILTER_THREADS_DIM * FILTER_THREADS_DIM * sizeof(int))))
+        TEST_ERROR
+
+    /* Check the property */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_filter_threads(dapl, &nthreads) < 0)
+        FAIL_STACK_ERROR
+    if (nthreads != 1)
+        FAIL_PUTS_ERROR("wrong default number of filter threads")
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_chunk_filter_threads(dapl, 0);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        FAIL_PUTS_ERROR("zero filter threads allowed")
+    if (H5Pset_chunk_filter_threads(dapl, 4) < 0)
+        FAIL_STACK_ERROR
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+
+    for (edge = 0; edge < 2; edge++) {
+        char dset_name[32]; /* Dataset name */
+
+        if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+            FAIL_STACK_ERROR
+        if (edge && H5Pset_chunk_opts(dcpl, H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pset_shuffle(dcpl) < 0)
+            FAIL_STACK_ERROR
+#ifdef H5_HAVE_FILTER_DEFLATE
+        if (H5Pset_deflate(dcpl, 6) < 0)
+            FAIL_STACK_ERROR
+#endif /* H5_HAVE_FILTER_DEFLATE */
+        if (H5Pset_fletcher32(dcpl) < 0)
+            FAIL_STACK_ERROR
+
+        /* Write and read back the whole dataset without a chunk cache */
+        if (H5Pset_chunk_cache(dapl, 0, 0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        HDsnprintf(dset_name, sizeof(dset_name), "filter_threads_%u", edge);
+        if ((dsid = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+            FAIL_STACK_ERROR
+
+        /* The dataset's access property list should have the setting */
+        if ((dapl2 = H5Dget_access_plist(dsid)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pget_chunk_filter_threads(dapl2, &nthreads) < 0)
+            FAIL_STACK_ERROR
+        if (nthreads != 4)
+            FAIL_PUTS_ERROR("wrong number of filter threads for dataset")
+        if (H5Pclose(dapl2) < 0)
+            FAIL_STACK_ERROR
+
+        for (u = 0; u < FILTER_THREADS_DIM * FILTER_THREADS_DIM; u++)
+            wbuf[u] = (int)(u * 7 + edge);
+        if (H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, FILTER_THREADS_DIM * FILTER_THREADS_DIM * sizeof(int));
+        if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(wbuf, rbuf, FILTER_THREADS_DIM * FILTER_THREADS_DIM * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("incorrect data read without chunk cache")
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+
+        /* Update part of the dataset through the chunk cache, so that the
+         * chunks are filtered when the dataset is closed */
+        if (H5Pset_chunk_cache(dapl, 521, 1024 * 1024, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        if ((dsid = H5Dopen2(fid, dset_name, dapl)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        for (u = 0; u < FILTER_THREADS_DIM; u++)
+            for (v = 0; v < FILTER_THREADS_DIM; v++)
+                if (u >= start[0] && u < start[0] + count[0] && v >= start[1] && v < start[1] + count[1])
+                    wbuf[u * FILTER_THREADS_DIM + v] = -wbuf[u * FILTER_THREADS_DIM + v];
+        if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sselect_all(sid) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+
+        /* Check the data, filtering chunks one at a time */
+        if ((dsid = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, FILTER_THREADS_DIM * FILTER_THREADS_DIM * sizeof(int));
+        if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(wbuf, rbuf, FILTER_THREADS_DIM * FILTER_THREADS_DIM * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("incorrect data read after flushing chunk cache")
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+
+        if (H5Pclose(dcpl) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dsid);
+        H5Pclose(dapl2);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    return FAIL;
+} /* end test_chunk_filter_threads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_index_cache
+ *
+ * Purpose:     Tests the file's chunk index cache (see
+ *              H5Pset_chunk_index_cache), with a cache that's smaller than
+ *              the number of chunks, when chunks are written, read again
+ *              after the dataset is reopened, removed by shrinking the
+ *              dataset, and when a dataset is deleted and created again
+ *              with the same name.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define IDX_CACHE_DIM    60
+#define IDX_CACHE_CHUNK  8
+#define IDX_CACHE_NENTS  16
+#define IDX_CACHE_SHRINK 20
+#define IDX_CACHE_NELMTS (IDX_CACHE_DIM * IDX_CACHE_DIM)
+static herr_t
+test_chunk_index_cache(hid_t fapl)
+{
+    char    filename[FILENAME_BUF_SIZE];
+    hid_t   fid            = -1;                                     /* File ID */
+    hid_t   my_fapl        = -1;                                     /* File access property list */
+    hid_t   fapl2          = -1;                                     /* File's access property list */
+    hid_t   dcpl           = -1;                                     /* Dataset creation property list */
+    hid_t   sid            = -1;                                     /* Dataspace ID */
+    hid_t   dsid           = -1;                                     /* Dataset ID */
+    hsize_t dims[2]        = {IDX_CACHE_DIM, IDX_CACHE_DIM};         /* Dataset dimensions */
+    hsize_t chunk[2]       = {IDX_CACHE_CHUNK, IDX_CACHE_CHUNK};     /* Chunk dimensions */
+    hsize_t max_dims[3][2] = {{IDX_CACHE_DIM, IDX_CACHE_DIM},        /* Max. dimensions: fixed array, */
+                              {H5S_UNLIMITED, IDX_CACHE_DIM},        /* extensible array */
+                              {H5S_UNLIMITED, H5S_UNLIMITED}};       /* & v2 B-tree indices */
+    hsize_t start[2]       = {0, 0};                                 /* Hyperslab start */
+    hsize_t count[2]       = {IDX_CACHE_DIM, IDX_CACHE_DIM / 2};     /* Hyperslab count */
+    int *   wbuf           = NULL;                                   /* Data written */
+    int *   rbuf           = NULL;                                   /* Data read */
+    size_t  nents;                                                   /* # of cache entries */
+    size_t  u, v;                                                    /* Local index variables */
+    int     i;                                                       /* Local index variable */
+
+    TESTING("chunk index cache");
+
+    h5_fixname(FILENAME[29], fapl, filename, sizeof filename);
+
+    if (NULL == (wbuf = (int *)HDmalloc(IDX_CACHE_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(IDX_CACHE_NELMTS * sizeof(int))))
+        TEST_ERROR
+
+    /* Check the property */
+    if ((my_fapl = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_index_cache(my_fapl, &nents) < 0)
+        FAIL_STACK_ERROR
+    if (nents != 8192)
+        FAIL_PUTS_ERROR("wrong default size of chunk index cache")
+    if (H5Pset_chunk_index_cache(my_fapl, IDX_CACHE_NENTS) < 0)
+        FAIL_STACK_ERROR
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* The file's access property list should have the setting */
+    if ((fapl2 = H5Fget_access_plist(fid)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_index_cache(fapl2, &nents) < 0)
+        FAIL_STACK_ERROR
+    if (nents != IDX_CACHE_NENTS)
+        FAIL_PUTS_ERROR("wrong size of chunk index cache for file")
+    if (H5Pclose(fapl2) < 0)
+        FAIL_STACK_ERROR
+
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+        FAIL_STACK_ERROR
+
+    for (i = 0; i < 3; i++) {
+        char dset_name[32]; /* Dataset name */
+
+        HDsnprintf(dset_name, sizeof(dset_name), "chunk_idx_cache_%d", i);
+        if ((sid = H5Screate_simple(2, dims, max_dims[i])) < 0)
+            FAIL_STACK_ERROR
+
+        /* Write the left half of the dataset, leaving the other chunks
+         * unallocated */
+        if ((dsid = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        for (u = 0; u < IDX_CACHE_DIM; u++)
+            for (v = 0; v < IDX_CACHE_DIM; v++)
+                wbuf[u * IDX_CACHE_DIM + v] = v < count[1] ? (int)(u * IDX_CACHE_DIM + v + 1) : 0;
+        if (H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sselect_all(sid) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+
+        /* Read the dataset after reopening it, twice, with the chunk records
+         * coming from the chunk index cache the second time */
+        for (u = 0; u < 2; u++) {
+            if ((dsid = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            HDmemset(rbuf, 0xff, IDX_CACHE_NELMTS * sizeof(int));
+            if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+                FAIL_STACK_ERROR
+            if (HDmemcmp(wbuf, rbuf, IDX_CACHE_NELMTS * sizeof(int)) != 0)
+                FAIL_PUTS_ERROR("incorrect data read after writing part of dataset")
+            if (H5Dclose(dsid) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+
+        /* Write the whole dataset, allocating the chunks that were
+         * recorded as unallocated */
+        if ((dsid = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        for (u = 0; u < IDX_CACHE_NELMTS; u++)
+            wbuf[u] = (int)(u * 3 + (size_t)i);
+        if (H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+        if ((dsid = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, IDX_CACHE_NELMTS * sizeof(int));
+        if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(wbuf, rbuf, IDX_CACHE_NELMTS * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("incorrect data read after writing whole dataset")
+
+        /* Shrink the dataset, removing chunks, and extend it again: the
+         * removed chunks must read as fill values */
+        if (max_dims[i][0] == H5S_UNLIMITED) {
+            hsize_t new_dims[2] = {IDX_CACHE_SHRINK, IDX_CACHE_DIM}; /* Shrunk dimensions */
+
+            if (H5Dset_extent(dsid, new_dims) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dset_extent(dsid, dims) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dclose(dsid) < 0)
+                FAIL_STACK_ERROR
+            if ((dsid = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            HDmemset(wbuf + IDX_CACHE_SHRINK * IDX_CACHE_DIM, 0,
+                     (IDX_CACHE_DIM - IDX_CACHE_SHRINK) * IDX_CACHE_DIM * sizeof(int));
+            HDmemset(rbuf, 0xff, IDX_CACHE_NELMTS * sizeof(int));
+            if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+                FAIL_STACK_ERROR
+            if (HDmemcmp(wbuf, rbuf, IDX_CACHE_NELMTS * sizeof(int)) != 0)
+                FAIL_PUTS_ERROR("incorrect data read after shrinking and extending dataset")
+        } /* end if */
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+
+        /* Delete the dataset and create it again with other data: none of
+         * the records of the old dataset may be used */
+        if (H5Ldelete(fid, dset_name, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        if ((dsid = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        for (u = 0; u < IDX_CACHE_NELMTS; u++)
+            wbuf[u] = -(int)(u * 5 + (size_t)i);
+        if (H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+        if ((dsid = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, IDX_CACHE_NELMTS * sizeof(int));
+        if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(wbuf, rbuf, IDX_CACHE_NELMTS * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("incorrect data read after recreating dataset")
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+
+        /* Check the data after reopening the file */
+        if (H5Fclose(fid) < 0)
+            FAIL_STACK_ERROR
+        if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, my_fapl)) < 0)
+            FAIL_STACK_ERROR
+        if ((dsid = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, IDX_CACHE_NELMTS * sizeof(int));
+        if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(wbuf, rbuf, IDX_CACHE_NELMTS * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("incorrect data read after reopening file")
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+        if (H5Fclose(fid) < 0)
+            FAIL_STACK_ERROR
+        if ((fid = H5Fopen(filename, H5F_ACC_RDWR, my_fapl)) < 0)
+            FAIL_STACK_ERROR
+
+        if (H5Sclose(sid) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(my_fapl) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dsid);
+        H5Pclose(dcpl);
+        H5Pclose(fapl2);
+        H5Pclose(my_fapl);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    return FAIL;
+} /* end test_chunk_index_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_shared_chunk_cache
+ *
+ * Purpose:     Tests the raw data chunk cache shared by the datasets of a
+ *              file (see H5Pset_shared_chunk_cache): that the chunks of
+ *              several datasets, written in turn through a cache that can
+ *              only hold a few of them, are flushed to the file correctly
+ *              when they're evicted for each other, that chunks whose hash
+ *              values collide don't evict each other, and that the cache
+ *              statistics are reported by H5Dget_access_plist.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define SHARED_CACHE_NDSETS 3
+#define SHARED_CACHE_DIM    40
+#define SHARED_CACHE_CHUNK  10
+#define SHARED_CACHE_NBYTES (3 * SHARED_CACHE_CHUNK * SHARED_CACHE_CHUNK * sizeof(int))
+#define SHARED_CACHE_NELMTS (SHARED_CACHE_DIM * SHARED_CACHE_DIM)
+#define SHARED_CACHE_NSLOTS 8
+static herr_t
+test_shared_chunk_cache(hid_t fapl)
+{
+    char     filename[FILENAME_BUF_SIZE];
+    hid_t    fid     = -1;                                     /* File ID */
+    hid_t    my_fapl = -1;                                     /* File access property list */
+    hid_t    dcpl    = -1;                                     /* Dataset creation property list */
+    hid_t    dapl    = -1;                                     /* Dataset access property list */
+    hid_t    dapl2   = -1;                                     /* Dataset's access property list */
+    hid_t    sid     = -1;                                     /* Dataspace ID */
+    hid_t    mem_sid = -1;                                     /* Memory dataspace ID */
+    hid_t    dsid[SHARED_CACHE_NDSETS] = {-1, -1, -1};         /* Dataset IDs */
+    hsize_t  dims[2]   = {SHARED_CACHE_DIM, SHARED_CACHE_DIM};     /* Dataset dimensions */
+    hsize_t  chunk[2]  = {SHARED_CACHE_CHUNK, SHARED_CACHE_CHUNK}; /* Chunk dimensions */
+    hsize_t  start[2];                                             /* Hyperslab start */
+    hsize_t  count[2]  = {SHARED_CACHE_CHUNK, SHARED_CACHE_CHUNK}; /* Hyperslab count */
+    hsize_t  dims1[1]  = {SHARED_CACHE_NSLOTS * 2};                /* 1-D dataset dimensions */
+    hsize_t  chunk1[1] = {1};                                      /* 1-D chunk dimensions */
+    hsize_t  start1[1];                                            /* 1-D hyperslab start */
+    hsize_t  count1[1] = {1};                                      /* 1-D hyperslab count */
+    int *    wbuf[SHARED_CACHE_NDSETS] = {NULL, NULL, NULL};       /* Data written */
+    int *    rbuf = NULL;                                          /* Data read */
+    int      val;                                                  /* Value read */
+    size_t   nbytes;                                               /* Shared cache size */
+    unsigned nhits, nmisses, nevictions;                           /* Chunk cache statistics */
+    size_t   u, v;                                                 /* Local index variables */
+    int      i, n;                                                 /* Local index variables */
+
+    TESTING("chunk cache shared by the datasets of a file");
+
+    h5_fixname(FILENAME[30], fapl, filename, sizeof filename);
+
+    for (i = 0; i < SHARED_CACHE_NDSETS; i++)
+        if (NULL == (wbuf[i] = (int *)HDmalloc(SHARED_CACHE_NELMTS * sizeof(int))))
+            TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(SHARED_CACHE_NELMTS * sizeof(int))))
+        TEST_ERROR
+
+    /* Check the property (turning the datasets' chunk caches back on) */
+    if ((my_fapl = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_cache(my_fapl, 0, (size_t)521, (size_t)(1024 * 1024), 0.75) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_shared_chunk_cache(my_fapl, &nbytes) < 0)
+        FAIL_STACK_ERROR
+    if (nbytes != 0)
+        FAIL_PUTS_ERROR("shared chunk cache is on by default")
+    if (H5Pset_shared_chunk_cache(my_fapl, SHARED_CACHE_NBYTES) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_shared_chunk_cache(my_fapl, &nbytes) < 0)
+        FAIL_STACK_ERROR
+    if (nbytes != SHARED_CACHE_NBYTES)
+        FAIL_PUTS_ERROR("wrong size of shared chunk cache")
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create the datasets, with filters so that chunks change size when
+     * they're flushed */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_shuffle(dcpl) < 0)
+        FAIL_STACK_ERROR
+#ifdef H5_HAVE_FILTER_DEFLATE
+    if (H5Pset_deflate(dcpl, 6) < 0)
+        FAIL_STACK_ERROR
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((mem_sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < SHARED_CACHE_NDSETS; i++) {
+        char dset_name[32]; /* Dataset name */
+
+        HDsnprintf(dset_name, sizeof(dset_name), "shared_cache_%d", i);
+        if ((dsid[i] = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        for (u = 0; u < SHARED_CACHE_NELMTS; u++)
+            wbuf[i][u] = (int)(u * 7) + i;
+    } /* end for */
+
+    /* Write the chunks of the datasets in turn, one at a time, so that the
+     * dirty chunks of each dataset are evicted to make room for the others */
+    for (u = 0; u < SHARED_CACHE_DIM; u += SHARED_CACHE_CHUNK)
+        for (v = 0; v < SHARED_CACHE_DIM; v += SHARED_CACHE_CHUNK)
+            for (i = 0; i < SHARED_CACHE_NDSETS; i++) {
+                start[0] = u;
+                start[1] = v;
+                if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                    FAIL_STACK_ERROR
+                if (H5Dwrite(dsid[i], H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, wbuf[i]) < 0)
+                    FAIL_STACK_ERROR
+            } /* end for */
+    if (H5Sselect_all(sid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read the datasets back, and check that chunks were evicted */
+    for (i = 0; i < SHARED_CACHE_NDSETS; i++) {
+        HDmemset(rbuf, 0, SHARED_CACHE_NELMTS * sizeof(int));
+        if (H5Dread(dsid[i], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(wbuf[i], rbuf, SHARED_CACHE_NELMTS * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("incorrect data read through shared chunk cache")
+
+        if ((dapl2 = H5Dget_access_plist(dsid[i])) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pget_chunk_cache_stats(dapl2, &nhits, &nmisses, &nevictions) < 0)
+            FAIL_STACK_ERROR
+        if (nevictions == 0 || nmisses == 0)
+            FAIL_PUTS_ERROR("no chunks evicted from shared chunk cache")
+        if (H5Pclose(dapl2) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    for (i = 0; i < SHARED_CACHE_NDSETS; i++)
+        if (H5Dclose(dsid[i]) < 0)
+            FAIL_STACK_ERROR
+
+    /* Check the data after reopening the file */
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if ((fid = H5Fopen(filename, H5F_ACC_RDWR, my_fapl)) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < SHARED_CACHE_NDSETS; i++) {
+        char dset_name[32]; /* Dataset name */
+
+        HDsnprintf(dset_name, sizeof(dset_name), "shared_cache_%d", i);
+        if ((dsid[i] = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, SHARED_CACHE_NELMTS * sizeof(int));
+        if (H5Dread(dsid[i], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        if (HDmemcmp(wbuf[i], rbuf, SHARED_CACHE_NELMTS * sizeof(int)) != 0)
+            FAIL_PUTS_ERROR("incorrect data read after reopening file")
+        if (H5Dclose(dsid[i]) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Read two chunks whose hash values collide in turn, in a dataset with a
+     * small hash table: they must both stay in the cache.  (Chunks aren't
+     * read ahead, so that only these two are cached.) */
+    if (H5Pset_chunk(dcpl, 1, chunk1) < 0)
+        FAIL_STACK_ERROR
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk_cache(dapl, SHARED_CACHE_NSLOTS, H5D_CHUNK_CACHE_NBYTES_DEFAULT,
+                           H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk_prefetch(dapl, (size_t)0, FALSE) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(1, dims1, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(mem_sid) < 0)
+        FAIL_STACK_ERROR
+    if ((mem_sid = H5Screate_simple(1, count1, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dsid[0] = H5Dcreate2(fid, "shared_cache_1d", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dwrite(dsid[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf[0]) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(dsid[0]) < 0)
+        FAIL_STACK_ERROR
+    if ((dsid[0] = H5Dopen2(fid, "shared_cache_1d", dapl)) < 0)
+        FAIL_STACK_ERROR
+    for (n = 0; n < 10; n++) {
+        start1[0] = (n % 2) ? SHARED_CACHE_NSLOTS : 0;
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start1, NULL, count1, NULL) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dread(dsid[0], H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, &val) < 0)
+            FAIL_STACK_ERROR
+        if (val != wbuf[0][start1[0]])
+            FAIL_PUTS_ERROR("incorrect data read from 1-D dataset")
+    } /* end for */
+    if ((dapl2 = H5Dget_access_plist(dsid[0])) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_cache_stats(dapl2, &nhits, &nmisses, &nevictions) < 0)
+        FAIL_STACK_ERROR
+    if (nmisses != 2 || nhits != 8 || nevictions != 0)
+        FAIL_PUTS_ERROR("colliding chunks evicted each other")
+    if (H5Pclose(dapl2) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(dsid[0]) < 0)
+        FAIL_STACK_ERROR
+
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(mem_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(my_fapl) < 0)
+        FAIL_STACK_ERROR
+
+    for (i = 0; i < SHARED_CACHE_NDSETS; i++)
+        HDfree(wbuf[i]);
+    HDfree(rbuf);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (i = 0; i < SHARED_CACHE_NDSETS; i++)
+            H5Dclose(dsid[i]);
+        H5Pclose(dapl2);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Pclose(my_fapl);
+        H5Sclose(mem_sid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    for (i = 0; i < SHARED_CACHE_NDSETS; i++)
+        HDfree(wbuf[i]);
+    HDfree(rbuf);
+    return FAIL;
+} /* end test_shared_chunk_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_prefetch
+ *
+ * Purpose:     Tests reading chunks ahead (see H5Pset_chunk_prefetch):
+ *              that reading a dataset one chunk at a time, in order, finds
+ *              the chunks after the first few in the chunk cache, that
+ *              nothing is read ahead when it's turned off, and that chunks
+ *              are read ahead of a scan that doesn't start at the first
+ *              chunk only when asked to.  Datasets with and without
+ *              filters are checked.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define PREFETCH_NCHUNKS 16
+#define PREFETCH_CHUNK   4
+#define PREFETCH_NELMTS  (PREFETCH_NCHUNKS * PREFETCH_CHUNK)
+#define PREFETCH_START   5
+static herr_t
+test_chunk_prefetch(hid_t fapl)
+{
+    char     filename[FILENAME_BUF_SIZE];
+    hid_t    fid     = -1;                        /* File ID */
+    hid_t    my_fapl = -1;                        /* File access property list */
+    hid_t    dcpl    = -1;                        /* Dataset creation property list */
+    hid_t    dapl    = -1;                        /* Dataset access property list */
+    hid_t    dapl2   = -1;                        /* Dataset's access property list */
+    hid_t    sid     = -1;                        /* Dataspace ID */
+    hid_t    mem_sid = -1;                        /* Memory dataspace ID */
+    hid_t    dsid    = -1;                        /* Dataset ID */
+    hsize_t  dims[1]  = {PREFETCH_NELMTS};        /* Dataset dimensions */
+    hsize_t  chunk[1] = {PREFETCH_CHUNK};         /* Chunk dimensions */
+    hsize_t  start[1];                            /* Hyperslab start */
+    hsize_t  count[1] = {PREFETCH_CHUNK};         /* Hyperslab count */
+    int      wbuf[PREFETCH_NELMTS];               /* Data written */
+    int      rbuf[PREFETCH_CHUNK];                /* Data read */
+    size_t   nchunks;                             /* # of chunks to read ahead */
+    hbool_t  always;                              /* Whether to always read ahead */
+    unsigned nhits, nmisses, nevictions;          /* Chunk cache statistics */
+    unsigned exp_nhits;                           /* Expected # of chunk cache hits */
+    unsigned first;                               /* First chunk read */
+    char     dset_name[16];                       /* Dataset name */
+    int      filtered;                            /* Whether the dataset is filtered */
+    int      pass;                                /* Local index variable */
+    size_t   u, v;                                /* Local index variables */
+
+    TESTING("reading chunks ahead");
+
+    h5_fixname(FILENAME[31], fapl, filename, sizeof filename);
+
+    for (u = 0; u < PREFETCH_NELMTS; u++)
+        wbuf[u] = (int)(u * 7 + 1);
+
+    /* Check the defaults and the property */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_prefetch(dapl, &nchunks, &always) < 0)
+        FAIL_STACK_ERROR
+    if (nchunks != 8 || always != FALSE)
+        FAIL_PUTS_ERROR("wrong default read-ahead settings")
+    if (H5Pset_chunk_prefetch(dapl, (size_t)3, TRUE) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_prefetch(dapl, &nchunks, &always) < 0)
+        FAIL_STACK_ERROR
+    if (nchunks != 3 || always != TRUE)
+        FAIL_PUTS_ERROR("wrong read-ahead settings")
+
+    /* Turn the datasets' chunk caches back on */
+    if ((my_fapl = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_cache(my_fapl, 0, (size_t)521, (size_t)(1024 * 1024), 0.75) < 0)
+        FAIL_STACK_ERROR
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((mem_sid = H5Screate_simple(1, count, NULL)) < 0)
+        FAIL_STACK_ERROR
+
+    for (filtered = 0; filtered < 2; filtered++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "prefetch_%d", filtered);
+
+        /* Create the dataset & write it */
+        if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pset_chunk(dcpl, 1, chunk) < 0)
+            FAIL_STACK_ERROR
+        if (filtered) {
+            if (H5Pset_shuffle(dcpl) < 0)
+                FAIL_STACK_ERROR
+#ifdef H5_HAVE_FILTER_DEFLATE
+            if (H5Pset_deflate(dcpl, 6) < 0)
+                FAIL_STACK_ERROR
+#endif /* H5_HAVE_FILTER_DEFLATE */
+        } /* end if */
+        if ((dsid = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pclose(dcpl) < 0)
+            FAIL_STACK_ERROR
+
+        /* Read the dataset one chunk at a time, in order from the first
+         * chunk with the default settings, with reading ahead turned off,
+         * and in order from a later chunk without and with reading ahead
+         * of every read
+         */
+        for (pass = 0; pass < 4; pass++) {
+            switch (pass) {
+                case 0:
+                    nchunks   = 8;
+                    always    = FALSE;
+                    first     = 0;
+                    exp_nhits = PREFETCH_NCHUNKS - 2;
+                    break;
+                case 1:
+                    nchunks   = 0;
+                    always    = FALSE;
+                    first     = 0;
+                    exp_nhits = 0;
+                    break;
+                case 2:
+                    nchunks   = 8;
+                    always    = FALSE;
+                    first     = PREFETCH_START;
+                    exp_nhits = 8;
+                    break;
+                default:
+                    nchunks   = 8;
+                    always    = TRUE;
+                    first     = PREFETCH_START;
+                    exp_nhits = 9;
+                    break;
+            } /* end switch */
+            if (H5Pset_chunk_prefetch(dapl, nchunks, always) < 0)
+                FAIL_STACK_ERROR
+            if ((dsid = H5Dopen2(fid, dset_name, dapl)) < 0)
+                FAIL_STACK_ERROR
+            for (u = first; u < PREFETCH_NCHUNKS; u++) {
+                start[0] = u * PREFETCH_CHUNK;
+                if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                    FAIL_STACK_ERROR
+                if (H5Dread(dsid, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, rbuf) < 0)
+                    FAIL_STACK_ERROR
+                for (v = 0; v < PREFETCH_CHUNK; v++)
+                    if (rbuf[v] != wbuf[start[0] + v])
+                        FAIL_PUTS_ERROR("incorrect data read")
+            } /* end for */
+            if ((dapl2 = H5Dget_access_plist(dsid)) < 0)
+                FAIL_STACK_ERROR
+            if (H5Pget_chunk_cache_stats(dapl2, &nhits, &nmisses, &nevictions) < 0)
+                FAIL_STACK_ERROR
+            if (nhits != exp_nhits || nmisses != PREFETCH_NCHUNKS - first)
+                FAIL_PUTS_ERROR("wrong number of chunks read ahead")
+            if (H5Pclose(dapl2) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dclose(dsid) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+        if (H5Sselect_all(sid) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(mem_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(my_fapl) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dsid);
+        H5Pclose(dapl2);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Pclose(my_fapl);
+        H5Sclose(mem_sid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_chunk_prefetch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_coalesce
+ *
+ * Purpose:     Tests reading uncached chunks together (see
+ *              H5Pset_chunk_coalesce): that a dataset whose chunks were
+ *              written out of order, with some chunks never written, reads
+ *              back the same whether its chunks are read together or one
+ *              at a time, for whole and strided selections, with and
+ *              without type conversion, and with gaps and read sizes that
+ *              split the chunks into several runs.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define COALESCE_DIM   40
+#define COALESCE_CHUNK 4
+#define COALESCE_NELMTS (COALESCE_DIM * COALESCE_DIM)
+#define COALESCE_FILL  -1
+static herr_t
+test_chunk_coalesce(hid_t fapl)
+{
+    char       filename[FILENAME_BUF_SIZE];
+    hid_t      fid     = -1;                                     /* File ID */
+    hid_t      dcpl    = -1;                                     /* Dataset creation property list */
+    hid_t      dapl    = -1;                                     /* Dataset access property list */
+    hid_t      sid     = -1;                                     /* Dataspace ID */
+    hid_t      mem_sid = -1;                                     /* Memory dataspace ID */
+    hid_t      dsid    = -1;                                     /* Dataset ID */
+    hsize_t    dims[2]   = {COALESCE_DIM, COALESCE_DIM};         /* Dataset dimensions */
+    hsize_t    chunk[2]  = {COALESCE_CHUNK, COALESCE_CHUNK};     /* Chunk dimensions */
+    hsize_t    start[2];                                         /* Hyperslab start */
+    hsize_t    stride[2] = {3, 5};                               /* Hyperslab stride */
+    hsize_t    count[2];                                         /* Hyperslab count */
+    int *      wbuf  = NULL;                                     /* Data written */
+    int *      rbuf  = NULL;                                     /* Data read */
+    long long *lbuf  = NULL;                                     /* Data read, converted */
+    int *      ebuf  = NULL;                                     /* Data expected */
+    int        fill  = COALESCE_FILL;                            /* Fill value */
+    size_t     max_size, max_gap;                                /* Settings for reading chunks together */
+    size_t     settings[4][2] = {{0, 0},
+                                 {1024 * 1024, 4096},
+                                 {1024 * 1024, 0},
+                                 {3 * COALESCE_CHUNK * COALESCE_CHUNK * sizeof(int), 64}}; /* Settings tried */
+    int        n, strided;                                       /* Local index variables */
+    size_t     u, i, j;                                          /* Local index variables */
+
+    TESTING("reading uncached chunks together");
+
+    h5_fixname(FILENAME[32], fapl, filename, sizeof filename);
+
+    if (NULL == (wbuf = (int *)HDmalloc(COALESCE_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(COALESCE_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (lbuf = (long long *)HDmalloc(COALESCE_NELMTS * sizeof(long long))))
+        TEST_ERROR
+    if (NULL == (ebuf = (int *)HDmalloc(COALESCE_NELMTS * sizeof(int))))
+        TEST_ERROR
+    for (u = 0; u < COALESCE_NELMTS; u++)
+        wbuf[u] = (int)u;
+
+    /* Check the defaults and the property */
+    if ((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_coalesce(dapl, &max_size, &max_gap) < 0)
+        FAIL_STACK_ERROR
+    if (max_size != 1024 * 1024 || max_gap != 4096)
+        FAIL_PUTS_ERROR("wrong default settings for reading chunks together")
+    if (H5Pset_chunk_coalesce(dapl, (size_t)100, (size_t)10) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_coalesce(dapl, &max_size, &max_gap) < 0)
+        FAIL_STACK_ERROR
+    if (max_size != 100 || max_gap != 10)
+        FAIL_PUTS_ERROR("wrong settings for reading chunks together")
+
+    /* Keep the chunks out of the cache */
+    if (H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0)
+        FAIL_STACK_ERROR
+    if ((dsid = H5Dcreate2(fid, "coalesce", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Write the rows of chunks from the last to the first, so the chunks
+     * aren't stored in order, leaving out every seventh row & column of
+     * chunks */
+    for (u = 0; u < COALESCE_NELMTS; u++)
+        ebuf[u] = ((u / COALESCE_DIM) / COALESCE_CHUNK) % 7 == 3 ||
+                          ((u % COALESCE_DIM) / COALESCE_CHUNK) % 7 == 3
+                      ? COALESCE_FILL
+                      : wbuf[u];
+    if ((mem_sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    count[0] = count[1] = COALESCE_CHUNK;
+    for (i = COALESCE_DIM / COALESCE_CHUNK; i > 0; i--)
+        for (j = 0; j < COALESCE_DIM / COALESCE_CHUNK; j++) {
+            if ((i - 1) % 7 == 3 || j % 7 == 3)
+                continue;
+            start[0] = (i - 1) * COALESCE_CHUNK;
+            start[1] = j * COALESCE_CHUNK;
+            if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            if (H5Sselect_hyperslab(mem_sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dwrite(dsid, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, wbuf) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+    if (H5Dclose(dsid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Read the dataset back with each setting, whole and with a strided
+     * selection, as ints and long longs */
+    start[0] = 1;
+    start[1] = 2;
+    count[0] = (COALESCE_DIM - start[0] + stride[0] - 1) / stride[0];
+    count[1] = (COALESCE_DIM - start[1] + stride[1] - 1) / stride[1];
+    for (n = 0; n < 4; n++) {
+        if (H5Pset_chunk_coalesce(dapl, settings[n][0], settings[n][1]) < 0)
+            FAIL_STACK_ERROR
+        if ((dsid = H5Dopen2(fid, "coalesce", dapl)) < 0)
+            FAIL_STACK_ERROR
+
+        for (strided = 0; strided < 2; strided++) {
+            if (strided) {
+                if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+                    FAIL_STACK_ERROR
+            } /* end if */
+            else if (H5Sselect_all(sid) < 0)
+                FAIL_STACK_ERROR
+            if (H5Sselect_copy(mem_sid, sid) < 0)
+                FAIL_STACK_ERROR
+
+            for (u = 0; u < COALESCE_NELMTS; u++) {
+                rbuf[u] = -2;
+                lbuf[u] = -2;
+            } /* end for */
+            if (H5Dread(dsid, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, rbuf) < 0)
+                FAIL_STACK_ERROR
+            if (H5Dread(dsid, H5T_NATIVE_LLONG, mem_sid, sid, H5P_DEFAULT, lbuf) < 0)
+                FAIL_STACK_ERROR
+            for (i = 0; i < COALESCE_DIM; i++)
+                for (j = 0; j < COALESCE_DIM; j++) {
+                    int selected = !strided || ((i >= start[0] && (i - start[0]) % stride[0] == 0) &&
+                                                (j >= start[1] && (j - start[1]) % stride[1] == 0));
+                    int exp      = selected ? ebuf[i * COALESCE_DIM + j] : -2;
+
+                    if (rbuf[i * COALESCE_DIM + j] != exp || lbuf[i * COALESCE_DIM + j] != (long long)exp) {
+                        HDprintf("    setting %d, %s: value at [%zu][%zu] is %d, expected %d\n", n,
+                                 strided ? "strided" : "whole", i, j, rbuf[i * COALESCE_DIM + j], exp);
+                        FAIL_PUTS_ERROR("incorrect data read")
+                    } /* end if */
+                }     /* end for */
+        }             /* end for */
+
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    if (H5Pclose(dapl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(mem_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(lbuf);
+    HDfree(ebuf);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dsid);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Sclose(mem_sid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(lbuf);
+    HDfree(ebuf);
+    return FAIL;
+} /* end test_chunk_coalesce() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_chunk_shard
+ *
+ * Purpose:     Tests storing chunks in shards (see H5Pset_chunk_shard):
+ *              the property's settings, and that unfiltered and filtered
+ *              datasets with sharded chunks read back what was written,
+ *              after partial overwrites, after reopening the file and
+ *              after shrinking and extending the dataset, and that they
+ *              report their chunks.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define SHARD_DIM    40
+#define SHARD_CHUNK  4
+#define SHARD_NELMTS (SHARD_DIM * SHARD_DIM)
+#define SHARD_FILL   -1
+static herr_t
+test_chunk_shard(hid_t fapl)
+{
+    char              filename[FILENAME_BUF_SIZE];
+    char              dset_name[16];                                /* Dataset name */
+    hid_t             fid     = -1;                                 /* File ID */
+    hid_t             dcpl    = -1;                                 /* Dataset creation property list */
+    hid_t             dcpl2   = -1;                                 /* Dataset's creation property list */
+    hid_t             sid     = -1;                                 /* Dataspace ID */
+    hid_t             mem_sid = -1;                                 /* Memory dataspace ID */
+    hid_t             dsid    = -1;                                 /* Dataset ID */
+    hsize_t           dims[2]     = {SHARD_DIM, SHARD_DIM};         /* Dataset dimensions */
+    hsize_t           max_dims[2] = {H5S_UNLIMITED, H5S_UNLIMITED}; /* Maximum dataset dimensions */
+    hsize_t           small[2]    = {SHARD_DIM / 2, SHARD_DIM / 2}; /* Dataset dimensions after shrinking */
+    hsize_t           chunk[2]    = {SHARD_CHUNK, SHARD_CHUNK};     /* Chunk dimensions */
+    hsize_t           shard[2]    = {3, 2};                         /* Chunks per shard */
+    hsize_t           sdims[2];                                     /* Chunks per shard retrieved */
+    hsize_t           start[2];                                     /* Hyperslab start */
+    hsize_t           count[2];                                     /* Hyperslab count */
+    hsize_t           nchunks;                                      /* # of chunks written */
+    hsize_t           offset[2];                                    /* Offset of chunk */
+    haddr_t           addr;                                         /* Address of chunk */
+    hsize_t           size;                                         /* Size of chunk */
+    unsigned          filter_mask;                                  /* Filter mask of chunk */
+    H5D_chunk_index_t idx_type;                                     /* Dataset chunk index type */
+    int *             wbuf = NULL;                                  /* Data written */
+    int *             rbuf = NULL;                                  /* Data read */
+    int *             ebuf = NULL;                                  /* Data expected */
+    int               fill = SHARD_FILL;                            /* Fill value */
+    int               filtered, pass;                               /* Local index variables */
+    size_t            u, i, j;                                      /* Local index variables */
+
+    TESTING("storing chunks in shards");
+
+    h5_fixname(FILENAME[33], fapl, filename, sizeof filename);
+
+    if (NULL == (wbuf = (int *)HDmalloc(SHARD_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (rbuf = (int *)HDmalloc(SHARD_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (ebuf = (int *)HDmalloc(SHARD_NELMTS * sizeof(int))))
+        TEST_ERROR
+
+    /* Check the property */
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    H5E_BEGIN_TRY
+    {
+        if (H5Pset_chunk_shard(dcpl, 2, shard) >= 0)
+            FAIL_PUTS_ERROR("shards set without chunks")
+    }
+    H5E_END_TRY;
+    if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_shard(dcpl, 2, sdims) != 0)
+        FAIL_PUTS_ERROR("chunks are sharded by default")
+    H5E_BEGIN_TRY
+    {
+        if (H5Pset_chunk_shard(dcpl, 1, shard) >= 0)
+            FAIL_PUTS_ERROR("shards set with wrong dimensionality")
+    }
+    H5E_END_TRY;
+    if (H5Pset_chunk_shard(dcpl, 2, shard) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_shard(dcpl, 2, sdims) != 2)
+        FAIL_PUTS_ERROR("chunks aren't sharded")
+    if (sdims[0] != shard[0] || sdims[1] != shard[1])
+        FAIL_PUTS_ERROR("wrong shard dimensions")
+    if (H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fill) < 0)
+        FAIL_STACK_ERROR
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((sid = H5Screate_simple(2, dims, max_dims)) < 0)
+        FAIL_STACK_ERROR
+    if ((mem_sid = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+
+    for (filtered = 0; filtered < 2; filtered++) {
+        if (filtered) {
+            if (H5Pset_shuffle(dcpl) < 0)
+                FAIL_STACK_ERROR
+#ifdef H5_HAVE_FILTER_DEFLATE
+            if (H5Pset_deflate(dcpl, 6) < 0)
+                FAIL_STACK_ERROR
+#endif /* H5_HAVE_FILTER_DEFLATE */
+            if (H5Pset_fletcher32(dcpl) < 0)
+                FAIL_STACK_ERROR
+        } /* end if */
+        HDsnprintf(dset_name, sizeof(dset_name), "shard_%d", filtered);
+
+        if ((dsid = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dget_chunk_index_type(dsid, &idx_type) < 0)
+            FAIL_STACK_ERROR
+        if (idx_type != H5D_CHUNK_IDX_SHARD)
+            FAIL_PUTS_ERROR("should be using sharded chunk index")
+
+        /* Write the dataset, then overwrite a block across chunks and
+         * shards with data that compresses differently */
+        for (u = 0; u < SHARD_NELMTS; u++)
+            ebuf[u] = wbuf[u] = (int)(u / 7);
+        if (H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+        start[0] = 5;
+        start[1] = 3;
+        count[0] = 17;
+        count[1] = 29;
+        for (i = 0; i < SHARD_DIM; i++)
+            for (j = 0; j < SHARD_DIM; j++) {
+                wbuf[i * SHARD_DIM + j] = (int)((i * 7919 + j * 104729) % 65521);
+                if (i >= start[0] && i < start[0] + count[0] && j >= start[1] && j < start[1] + count[1])
+                    ebuf[i * SHARD_DIM + j] = wbuf[i * SHARD_DIM + j];
+            } /* end for */
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sselect_copy(mem_sid, sid) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dwrite(dsid, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, wbuf) < 0)
+            FAIL_STACK_ERROR
+        if (H5Sselect_all(sid) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+
+        /* Read the dataset back, before and after reopening the file */
+        for (pass = 0; pass < 2; pass++) {
+            if (pass) {
+                if (H5Fclose(fid) < 0)
+                    FAIL_STACK_ERROR
+                if ((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+                    FAIL_STACK_ERROR
+            } /* end if */
+            if ((dsid = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            HDmemset(rbuf, 0, SHARD_NELMTS * sizeof(int));
+            if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+                FAIL_STACK_ERROR
+            for (u = 0; u < SHARD_NELMTS; u++)
+                if (rbuf[u] != ebuf[u]) {
+                    HDprintf("    %s, pass %d: value at %zu is %d, expected %d\n", dset_name, pass, u, rbuf[u],
+                             ebuf[u]);
+                    FAIL_PUTS_ERROR("incorrect data read")
+                } /* end if */
+            if (pass == 0 && H5Dclose(dsid) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+
+        /* Check the shard dimensions & chunks of the reopened dataset */
+        if ((dcpl2 = H5Dget_create_plist(dsid)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pget_chunk_shard(dcpl2, 2, sdims) != 2 || sdims[0] != shard[0] || sdims[1] != shard[1])
+            FAIL_PUTS_ERROR("wrong shard dimensions for dataset")
+        if (H5Pclose(dcpl2) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dget_num_chunks(dsid, sid, &nchunks) < 0)
+            FAIL_STACK_ERROR
+        if (nchunks != (SHARD_DIM / SHARD_CHUNK) * (SHARD_DIM / SHARD_CHUNK))
+            FAIL_PUTS_ERROR("wrong number of chunks")
+        for (u = 0; u < nchunks; u++) {
+            if (H5Dget_chunk_info(dsid, sid, u, offset, &filter_mask, &addr, &size) < 0)
+                FAIL_STACK_ERROR
+            if (addr == HADDR_UNDEF || size == 0 || filter_mask != 0)
+                FAIL_PUTS_ERROR("wrong chunk info")
+            if (!filtered && size != SHARD_CHUNK * SHARD_CHUNK * sizeof(int))
+                FAIL_PUTS_ERROR("wrong size of unfiltered chunk")
+        } /* end for */
+        if (!filtered) {
+            haddr_t addr2; /* Address of next chunk in shard */
+
+            /* Chunks next to each other in a shard are next to each other in the file */
+            offset[0] = 0;
+            offset[1] = 0;
+            if (H5Dget_chunk_info_by_coord(dsid, offset, &filter_mask, &addr, &size) < 0)
+                FAIL_STACK_ERROR
+            offset[1] = SHARD_CHUNK;
+            if (H5Dget_chunk_info_by_coord(dsid, offset, &filter_mask, &addr2, &size) < 0)
+                FAIL_STACK_ERROR
+            if (addr2 != addr + size)
+                FAIL_PUTS_ERROR("chunks in a shard aren't contiguous")
+        } /* end if */
+
+        /* Shrink the dataset, which removes chunks & shards, then extend
+         * it again */
+        if (H5Dset_extent(dsid, small) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dset_extent(dsid, dims) < 0)
+            FAIL_STACK_ERROR
+        if (H5Dget_num_chunks(dsid, sid, &nchunks) < 0)
+            FAIL_STACK_ERROR
+        if (nchunks != (small[0] / SHARD_CHUNK) * (small[1] / SHARD_CHUNK))
+            FAIL_PUTS_ERROR("wrong number of chunks after shrinking")
+        if (H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            FAIL_STACK_ERROR
+        for (i = 0; i < SHARD_DIM; i++)
+            for (j = 0; j < SHARD_DIM; j++) {
+                int exp = (i < small[0] && j < small[1]) ? ebuf[i * SHARD_DIM + j] : SHARD_FILL;
+
+                if (rbuf[i * SHARD_DIM + j] != exp) {
+                    HDprintf("    %s: value at [%zu][%zu] is %d, expected %d\n", dset_name, i, j,
+                             rbuf[i * SHARD_DIM + j], exp);
+                    FAIL_PUTS_ERROR("incorrect data read after shrinking")
+                } /* end if */
+            }     /* end for */
+
+        if (H5Dclose(dsid) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Delete the datasets, releasing their shards */
+    if (H5Ldelete(fid, "shard_0", H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if (H5Ldelete(fid, "shard_1", H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(mem_sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(ebuf);
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dsid);
+        H5Pclose(dcpl2);
+        H5Pclose(dcpl);
+        H5Sclose(mem_sid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    HDfree(ebuf);
+    return FAIL;
+} /* end test_chunk_shard() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_scatter
  *
@@ -15211,6 +16912,7 @@ main(void)
                 nerrors += (test_tconv(file) < 0 ? 1 : 0);
                 nerrors += (test_filters(file, my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_onebyte_shuffle(file) < 0 ? 1 : 0);
+                nerrors += (test_shuffle_modes(file) < 0 ? 1 : 0);
                 nerrors += (test_nbit_int(file) < 0 ? 1 : 0);
                 nerrors += (test_nbit_float(file) < 0 ? 1 : 0);
                 nerrors += (test_nbit_double(file) < 0 ? 1 : 0);
@@ -15263,6 +16965,13 @@ main(void)
                 nerrors += (test_zero_dim_dset(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_storage_size(my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_power2up(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_multi_dset_io(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_filter_threads(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_index_cache(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_shared_chunk_cache(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_prefetch(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_coalesce(my_fapl) < 0 ? 1 : 0);
+                nerrors += (test_chunk_shard(my_fapl) < 0 ? 1 : 0);
 
                 nerrors += (test_swmr_non_latest(envval, my_fapl) < 0 ? 1 : 0);
                 nerrors += (test_earray_hdr_fd(envval, my_fapl) < 0 ? 1 : 0);
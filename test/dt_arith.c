@@ -23,6 +23,11 @@
 /* Number of elements in each random test */
 #define NTESTELEM 10000
 
+/* Number of elements converted by test_conv_vec(), which is enough for a few
+ * blocks of the widest vectors plus a few elements left over
+ */
+#define CONV_VEC_NELMTS 101
+
 /* Epsilon for floating-point comparisons */
 #define FP_EPSILON 0.000001F
 
@@ -883,6 +888,199 @@ error:
     return MAX((int)fails_this_test, 1);
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    vec_except_unhandled
+ *
+ * Purpose:     Conversion exception callback for test_conv_vec(), which
+ *              leaves all the exceptions to the library.
+ *
+ * Return:      H5T_CONV_UNHANDLED
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5T_conv_ret_t
+vec_except_unhandled(H5T_conv_except_t H5_ATTR_UNUSED except_type, hid_t H5_ATTR_UNUSED src_id,
+                     hid_t H5_ATTR_UNUSED dst_id, void H5_ATTR_UNUSED *src_buf, void H5_ATTR_UNUSED *dst_buf,
+                     void *user_data)
+{
+    (*(unsigned *)user_data)++;
+
+    return H5T_CONV_UNHANDLED;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_vec_1
+ *
+ * Purpose:     Converts a buffer of CONV_VEC_NELMTS elements from SRC to
+ *              DST in place, with the source values taken from SVALS in
+ *              turn, and checks the results against DVALS.  The buffer is
+ *              converted once without an exception callback (which lets
+ *              the library use vectorized conversions) and once with a
+ *              callback that leaves the exceptions to the library, which
+ *              must give the same results.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_vec_1(const char *name, hid_t src, hid_t dst, const void *svals, const void *dvals, size_t nvals)
+{
+    hid_t          dxpl_id = H5I_INVALID_HID;
+    size_t         src_size, dst_size;
+    unsigned char *buf = NULL;
+    unsigned       nexcepts;
+    unsigned       fails_this_test = 0;
+    int            with_cb;
+    size_t         u;
+
+    src_size = H5Tget_size(src);
+    dst_size = H5Tget_size(dst);
+    if (NULL == (buf = (unsigned char *)HDmalloc(CONV_VEC_NELMTS * MAX(src_size, dst_size))))
+        goto error;
+    if ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        goto error;
+    if (H5Pset_type_conv_cb(dxpl_id, vec_except_unhandled, &nexcepts) < 0)
+        goto error;
+
+    for (with_cb = 0; with_cb < 2; with_cb++) {
+        for (u = 0; u < CONV_VEC_NELMTS; u++)
+            HDmemcpy(buf + (u * src_size), (const unsigned char *)svals + ((u % nvals) * src_size), src_size);
+
+        nexcepts = 0;
+        if (H5Tconvert(src, dst, (size_t)CONV_VEC_NELMTS, buf, NULL, with_cb ? dxpl_id : H5P_DEFAULT) < 0)
+            goto error;
+
+        for (u = 0; u < CONV_VEC_NELMTS; u++)
+            if (HDmemcmp(buf + (u * dst_size), (const unsigned char *)dvals + ((u % nvals) * dst_size),
+                         dst_size) != 0) {
+                if (0 == fails_this_test++)
+                    H5_FAILED();
+                HDprintf("    %s: element %zu (value %zu) is wrong %s the exception callback\n", name, u,
+                         u % nvals, with_cb ? "with" : "without");
+                break;
+            } /* end if */
+    }         /* end for */
+
+    /* (The values for narrowing conversions must include some out of range) */
+    if (0 == nexcepts && dst_size <= src_size) {
+        if (0 == fails_this_test++)
+            H5_FAILED();
+        HDprintf("    %s: the exception callback wasn't called\n", name);
+    } /* end if */
+
+    if (H5Pclose(dxpl_id) < 0)
+        goto error;
+    HDfree(buf);
+
+    return (int)fails_this_test;
+
+error:
+    H5E_BEGIN_TRY { H5Pclose(dxpl_id); }
+    H5E_END_TRY;
+    HDfree(buf);
+
+    return MAX((int)fails_this_test, 1);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_vec
+ *
+ * Purpose:     Tests the hardware conversions which have vectorized
+ *              versions, with values at and beyond the limits of the
+ *              destination's range, in buffers with enough elements for
+ *              both the vectorized conversions and the elements left over.
+ *              Without an exception callback, values out of range must be
+ *              clamped to the destination's minimum or maximum, or set to
+ *              infinity for a 'float' destination.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_vec(void)
+{
+    const double      inf           = (double)H5T_NATIVE_DOUBLE_POS_INF_g;
+    const double      double_vals[] = {0.0, -2.5, 1e-50, (double)FLT_MAX, -(double)FLT_MAX,
+                                       (double)FLT_MAX + 1e30, -((double)FLT_MAX + 1e30), DBL_MAX, -DBL_MAX,
+                                       inf, -inf};
+    const float       float_vals[]  = {0.0F, -2.5F, 0.0F, FLT_MAX, -FLT_MAX, (float)inf, (float)-inf,
+                                       (float)inf, (float)-inf, (float)inf, (float)-inf};
+    const float       f2i_vals[]    = {0.0F, -2.5F, 2.5F, 2147483520.0F, 2147483648.0F, -2147483648.0F, 1e20F,
+                                       -1e20F, (float)inf, (float)-inf};
+    const int         f2i_ints[]    = {0, -2, 2, 2147483520, INT_MAX, INT_MIN, INT_MAX, INT_MIN, INT_MAX,
+                                       INT_MIN};
+    const double      d2i_vals[]    = {-2.5, 2147483647.0, 2147483647.9, 2147483648.0, -2147483648.9,
+                                       -2147483649.0, 1e300, -1e300, inf, -inf};
+    const int         d2i_ints[]    = {-2, INT_MAX, INT_MAX, INT_MAX, INT_MIN, INT_MIN, INT_MAX, INT_MIN,
+                                       INT_MAX, INT_MIN};
+    const int         i2f_vals[]    = {0, -1, INT_MAX, INT_MIN, 16777217};
+    const float       i2f_floats[]  = {0.0F, -1.0F, 2147483648.0F, -2147483648.0F, 16777216.0F};
+    const double      i2d_doubles[] = {0.0, -1.0, 2147483647.0, -2147483648.0, 16777217.0};
+    const int         i2s_vals[]    = {0, -1, 32767, 32768, -32768, -32769, INT_MAX, INT_MIN};
+    const short       i2s_shorts[]  = {0, -1, 32767, 32767, -32768, -32768, 32767, -32768};
+    const short       s2c_vals[]    = {-5, 127, 128, -128, -129, SHRT_MAX, SHRT_MIN};
+    const signed char s2c_chars[]   = {-5, 127, 127, -128, -128, 127, -128};
+    double            f2d_doubles[NELMTS(float_vals)];
+    size_t            u;
+    int               nerrors = 0;
+
+    TESTING("hard conversions with vector instructions");
+
+    /* The vectorized conversions are for 4-byte ints, 2-byte shorts, etc. */
+    if (sizeof(int) != 4 || sizeof(short) != 2 || sizeof(float) != 4 || sizeof(double) != 8) {
+        SKIPPED();
+        return 0;
+    } /* end if */
+
+    for (u = 0; u < NELMTS(float_vals); u++)
+        f2d_doubles[u] = (double)float_vals[u];
+
+    nerrors += test_conv_vec_1("double -> float", H5T_NATIVE_DOUBLE, H5T_NATIVE_FLOAT, double_vals,
+                               float_vals, NELMTS(double_vals));
+    nerrors += test_conv_vec_1("float -> double", H5T_NATIVE_FLOAT, H5T_NATIVE_DOUBLE, float_vals,
+                               f2d_doubles, NELMTS(float_vals));
+    nerrors += test_conv_vec_1("float -> int", H5T_NATIVE_FLOAT, H5T_NATIVE_INT, f2i_vals, f2i_ints,
+                               NELMTS(f2i_vals));
+    nerrors += test_conv_vec_1("double -> int", H5T_NATIVE_DOUBLE, H5T_NATIVE_INT, d2i_vals, d2i_ints,
+                               NELMTS(d2i_vals));
+    nerrors += test_conv_vec_1("int -> float", H5T_NATIVE_INT, H5T_NATIVE_FLOAT, i2f_vals, i2f_floats,
+                               NELMTS(i2f_vals));
+    nerrors += test_conv_vec_1("int -> double", H5T_NATIVE_INT, H5T_NATIVE_DOUBLE, i2f_vals, i2d_doubles,
+                               NELMTS(i2f_vals));
+    nerrors += test_conv_vec_1("int -> short", H5T_NATIVE_INT, H5T_NATIVE_SHORT, i2s_vals, i2s_shorts,
+                               NELMTS(i2s_vals));
+    nerrors += test_conv_vec_1("short -> signed char", H5T_NATIVE_SHORT, H5T_NATIVE_SCHAR, s2c_vals,
+                               s2c_chars, NELMTS(s2c_vals));
+
+    if (nerrors)
+        goto error;
+
+    PASSED();
+
+    /* Restore the default error handler (set in h5_reset()) */
+    h5_restore_err();
+
+    reset_hdf5();
+
+    return 0;
+
+error:
+    HDfflush(stdout);
+
+    /* Restore the default error handler (set in h5_reset()) */
+    h5_restore_err();
+
+    reset_hdf5();
+
+    return nerrors;
+}
+
 /*-------------------------------------------------------------------------
  * Function:    test_derived_flt
  *
@@ -5423,6 +5621,9 @@ main(void)
     /* Test a few special values for hardware float-integer conversions */
     nerrors += (unsigned long)test_particular_fp_integer();
 
+    /* Test the limits of the hardware conversions with vectorized versions */
+    nerrors += (unsigned long)test_conv_vec();
+
     /*----------------------------------------------------------------------
      * Software tests
      *----------------------------------------------------------------------
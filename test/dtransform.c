@@ -17,6 +17,11 @@
 #define COLS      18
 #define FLOAT_TOL 0.0001F
 
+/* Number of elements in the dataset for test_long (enough for several blocks of
+ * the library's compiled transforms, plus a partial block)
+ */
+#define LONG_NELMTS 4099
+
 static int init_test(hid_t file_id);
 static int test_copy(const hid_t dxpl_id_c_to_f_copy, const hid_t dxpl_id_polynomial_copy);
 static int test_trivial(const hid_t dxpl_id_simple);
@@ -24,6 +29,7 @@ static int test_poly(const hid_t dxpl_id_polynomial);
 static int test_specials(hid_t file);
 static int test_set(void);
 static int test_getset(const hid_t dxpl_id_simple);
+static int test_long(hid_t file);
 
 /* These are needed for multiple tests, so are declared here globally and are init'ed in init_test */
 hid_t dset_id_int         = -1;
@@ -388,6 +394,8 @@ main(void)
         TEST_ERROR;
     if (test_specials(file_id) < 0)
         TEST_ERROR;
+    if (test_long(file_id) < 0)
+        TEST_ERROR;
 
     /* Close the objects we opened/created */
     if (H5Dclose(dset_id_int) < 0)
@@ -943,3 +951,94 @@ error:
 
     return -1;
 }
+
+static int
+test_long(hid_t file)
+{
+    hid_t       dxpl_id = -1, dset_id = -1, dataspace = -1;
+    hsize_t     dim     = LONG_NELMTS;
+    int *       data    = NULL;
+    int *       int_buf = NULL;
+    double *    dbl_buf = NULL;
+    size_t      u;
+    const char *poly   = "(x+1)*(x-2) - x/4";
+    const char *linear = "(x-32)*5/9";
+
+    TESTING("data transform of a long dataset")
+
+    if (NULL == (data = (int *)HDmalloc(LONG_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (int_buf = (int *)HDmalloc(LONG_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if (NULL == (dbl_buf = (double *)HDmalloc(LONG_NELMTS * sizeof(double))))
+        TEST_ERROR
+    for (u = 0; u < LONG_NELMTS; u++)
+        data[u] = (int)(u % 2001) - 1000;
+
+    if ((dataspace = H5Screate_simple(1, &dim, NULL)) < 0)
+        TEST_ERROR
+    if ((dset_id = H5Dcreate2(file, "/long", H5T_NATIVE_INT, dataspace, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) < 0)
+        TEST_ERROR
+    if ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR
+
+    /*-----------------------------
+     * Polynomial transform
+     *----------------------------*/
+    if (H5Pset_data_transform(dxpl_id, poly) < 0)
+        TEST_ERROR
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl_id, int_buf) < 0)
+        TEST_ERROR
+    for (u = 0; u < LONG_NELMTS; u++)
+        if (int_buf[u] != (data[u] + 1) * (data[u] - 2) - data[u] / 4) {
+            H5_FAILED();
+            HDfprintf(stderr, "    ERROR: element %zu is %d, should be %d\n", u, int_buf[u],
+                      (data[u] + 1) * (data[u] - 2) - data[u] / 4);
+            goto error;
+        }
+
+    /*-----------------------------
+     * Linear transform
+     *----------------------------*/
+    if (H5Pset_data_transform(dxpl_id, linear) < 0)
+        TEST_ERROR
+    if (H5Dread(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, dxpl_id, dbl_buf) < 0)
+        TEST_ERROR
+    for (u = 0; u < LONG_NELMTS; u++)
+        if (!H5_DBL_ABS_EQUAL(dbl_buf[u], ((double)data[u] - 32.0) * 5.0 / 9.0)) {
+            H5_FAILED();
+            HDfprintf(stderr, "    ERROR: element %zu is %f, should be %f\n", u, dbl_buf[u],
+                      ((double)data[u] - 32.0) * 5.0 / 9.0);
+            goto error;
+        }
+
+    if (H5Pclose(dxpl_id) < 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Sclose(dataspace) < 0)
+        TEST_ERROR
+    HDfree(dbl_buf);
+    HDfree(int_buf);
+    HDfree(data);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl_id);
+        H5Dclose(dset_id);
+        H5Sclose(dataspace);
+    }
+    H5E_END_TRY
+    HDfree(dbl_buf);
+    HDfree(int_buf);
+    HDfree(data);
+
+    return -1;
+}
@@ -0,0 +1,143 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Microbenchmark for the ID tables.
+ *
+ * For 10^3 up to 10^7 IDs (or 10^N, with N given on the command line), in
+ * a user-defined ID type, times:
+ *
+ *      - registering the IDs
+ *      - looking each ID up, in random order
+ *      - looking each ID up twice in a row, in random order (the second
+ *        lookup hits the last-accessed ID)
+ *      - removing the IDs, in random order
+ *
+ * and prints the throughput of each, in millions of operations per second.
+ *
+ * This program isn't run by the tests; it's built so that the speed of the
+ * ID tables can be checked by hand.
+ */
+
+#include "h5test.h"
+
+/* Smallest & default largest number of IDs, as powers of ten */
+#define ID_PERF_MIN_EXP 3
+#define ID_PERF_MAX_EXP 7
+
+/* Shuffle the first n IDs in an array */
+static void
+shuffle_ids(hid_t *ids, size_t n)
+{
+    size_t u;
+
+    for (u = n - 1; u > 0; u--) {
+        size_t v   = (size_t)HDrandom() % (u + 1);
+        hid_t  tmp = ids[u];
+
+        ids[u] = ids[v];
+        ids[v] = tmp;
+    }
+}
+
+/* Print the throughput of n operations that took 'secs' seconds */
+static void
+print_rate(const char *op, size_t n, double secs)
+{
+    HDfprintf(stdout, "  %-14s %10.3f s %10.2f Mops/s\n", op, secs,
+              secs > 0.0 ? ((double)n / secs) / 1000000.0 : 0.0);
+}
+
+/* Time the operations on n IDs.  Returns 0 on success, -1 on failure. */
+static int
+time_ids(size_t n)
+{
+    H5I_type_t type = H5I_BADID;
+    hid_t *    ids  = NULL;
+    char       obj  = 0; /* (All the IDs refer to this) */
+    double     start;
+    size_t     u;
+
+    if (NULL == (ids = (hid_t *)HDmalloc(n * sizeof(hid_t))))
+        goto error;
+    if ((type = H5Iregister_type((size_t)0, 0, NULL)) < 0)
+        goto error;
+
+    HDfprintf(stdout, "%zu IDs:\n", n);
+
+    /* Register */
+    start = H5_get_time();
+    for (u = 0; u < n; u++)
+        if ((ids[u] = H5Iregister(type, &obj)) < 0)
+            goto error;
+    print_rate("register", n, H5_get_time() - start);
+
+    /* Look up */
+    shuffle_ids(ids, n);
+    start = H5_get_time();
+    for (u = 0; u < n; u++)
+        if (NULL == H5Iobject_verify(ids[u], type))
+            goto error;
+    print_rate("lookup", n, H5_get_time() - start);
+
+    /* Look up, twice in a row */
+    start = H5_get_time();
+    for (u = 0; u < n; u++)
+        if (NULL == H5Iobject_verify(ids[u], type) || NULL == H5Iobject_verify(ids[u], type))
+            goto error;
+    print_rate("lookup twice", 2 * n, H5_get_time() - start);
+
+    /* Remove */
+    shuffle_ids(ids, n);
+    start = H5_get_time();
+    for (u = 0; u < n; u++)
+        if (NULL == H5Iremove_verify(ids[u], type))
+            goto error;
+    print_rate("remove", n, H5_get_time() - start);
+
+    if (H5Idestroy_type(type) < 0)
+        goto error;
+    HDfree(ids);
+
+    return 0;
+
+error:
+    if (type >= 0)
+        H5Idestroy_type(type);
+    HDfree(ids);
+
+    return -1;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int    max_exp = ID_PERF_MAX_EXP;
+    size_t n       = 1;
+    int    i;
+
+    if (argc > 1 && (max_exp = HDatoi(argv[1])) < ID_PERF_MIN_EXP) {
+        HDfprintf(stderr, "usage: %s [max. power of ten IDs (at least %d)]\n", argv[0], ID_PERF_MIN_EXP);
+        HDexit(EXIT_FAILURE);
+    }
+
+    HDsrandom(42);
+    for (i = 0; i < ID_PERF_MIN_EXP; i++)
+        n *= 10;
+    for (i = ID_PERF_MIN_EXP; i <= max_exp; i++, n *= 10)
+        if (time_ids(n) < 0) {
+            HDfprintf(stderr, "failed with %zu IDs\n", n);
+            HDexit(EXIT_FAILURE);
+        }
+
+    HDexit(EXIT_SUCCESS);
+}
@@ -1355,6 +1355,182 @@ error:
     return -1;
 } /* end test_future_ids() */
 
+/* Number of IDs for test_many_ids() */
+#define NUM_MANY_IDS 10000
+
+/* User data for many_ids_iterate_cb() */
+typedef struct {
+    hid_t *ids;     /* IDs registered */
+    int *  objs;    /* Objects for the IDs (the index of each ID) */
+    int    nvisits; /* # of IDs visited */
+    int    nerrors; /* # of errors found */
+} many_ids_ud_t;
+
+/* Callback for H5Iiterate(), which removes the ID after the one visited */
+static herr_t
+many_ids_iterate_cb(hid_t id, void *_udata)
+{
+    many_ids_ud_t *udata = (many_ids_ud_t *)_udata;
+    int *          obj;
+
+    udata->nvisits++;
+
+    /* Only every fourth ID should be left when it's visited */
+    obj = (int *)H5Iobject_verify(id, H5Iget_type(id));
+    if (NULL == obj || udata->ids[*obj] != id || (*obj % 4) != 0) {
+        udata->nerrors++;
+        return H5_ITER_CONT;
+    }
+
+    /* Remove the next ID left in the type (every other ID was removed
+     * before iterating), which shouldn't be visited afterwards
+     */
+    if (*obj + 2 < NUM_MANY_IDS)
+        if (H5Iremove_verify(udata->ids[*obj + 2], H5Iget_type(id)) != &udata->objs[*obj + 2])
+            udata->nerrors++;
+
+    return H5_ITER_CONT;
+}
+
+/* Test many IDs in one type, so that the ID table grows and shrinks, and
+ * removing IDs while iterating over them
+ */
+static int
+test_many_ids(void)
+{
+    H5I_type_t    myType = H5I_BADID;
+    hid_t *       ids    = NULL;
+    int *         objs   = NULL;
+    void *        testPtr;
+    hsize_t       num_members;
+    many_ids_ud_t udata;
+    herr_t        err;
+    int           i;
+
+    ids  = (hid_t *)HDmalloc(NUM_MANY_IDS * sizeof(hid_t));
+    objs = (int *)HDmalloc(NUM_MANY_IDS * sizeof(int));
+    CHECK_PTR(ids, "HDmalloc");
+    CHECK_PTR(objs, "HDmalloc");
+    if (NULL == ids || NULL == objs)
+        goto out;
+
+    myType = H5Iregister_type((size_t)0, 0, NULL);
+    CHECK(myType, H5I_BADID, "H5Iregister_type");
+    if (myType == H5I_BADID)
+        goto out;
+
+    /* Register the IDs */
+    for (i = 0; i < NUM_MANY_IDS; i++) {
+        objs[i] = i;
+        ids[i]  = H5Iregister(myType, &objs[i]);
+        CHECK(ids[i], H5I_INVALID_HID, "H5Iregister");
+        if (ids[i] == H5I_INVALID_HID)
+            goto out;
+    }
+
+    err = H5Inmembers(myType, &num_members);
+    CHECK(err, FAIL, "H5Inmembers");
+    VERIFY(num_members, NUM_MANY_IDS, "H5Inmembers");
+
+    for (i = 0; i < NUM_MANY_IDS; i++) {
+        testPtr = H5Iobject_verify(ids[i], myType);
+        CHECK_PTR_EQ(testPtr, &objs[i], "H5Iobject_verify");
+        if (testPtr != &objs[i])
+            goto out;
+    }
+
+    /* Remove every other ID and check that only the others are left */
+    for (i = 1; i < NUM_MANY_IDS; i += 2) {
+        testPtr = H5Iremove_verify(ids[i], myType);
+        CHECK_PTR_EQ(testPtr, &objs[i], "H5Iremove_verify");
+        if (testPtr != &objs[i])
+            goto out;
+    }
+
+    err = H5Inmembers(myType, &num_members);
+    CHECK(err, FAIL, "H5Inmembers");
+    VERIFY(num_members, NUM_MANY_IDS / 2, "H5Inmembers");
+
+    for (i = 0; i < NUM_MANY_IDS; i++) {
+        H5E_BEGIN_TRY
+        testPtr = H5Iobject_verify(ids[i], myType);
+        H5E_END_TRY
+
+        if (i % 2) {
+            CHECK_PTR_NULL(testPtr, "H5Iobject_verify");
+            if (testPtr != NULL)
+                goto out;
+        }
+        else {
+            CHECK_PTR_EQ(testPtr, &objs[i], "H5Iobject_verify");
+            if (testPtr != &objs[i])
+                goto out;
+        }
+    }
+
+    /* Iterate over the IDs, removing half of the rest along the way */
+    udata.ids     = ids;
+    udata.objs    = objs;
+    udata.nvisits = 0;
+    udata.nerrors = 0;
+    err           = H5Iiterate(myType, many_ids_iterate_cb, &udata);
+    CHECK(err, FAIL, "H5Iiterate");
+    VERIFY(udata.nerrors, 0, "H5Iiterate");
+    VERIFY(udata.nvisits, NUM_MANY_IDS / 4, "H5Iiterate");
+
+    err = H5Inmembers(myType, &num_members);
+    CHECK(err, FAIL, "H5Inmembers");
+    VERIFY(num_members, NUM_MANY_IDS / 4, "H5Inmembers");
+
+    /* Clear the type & check that the IDs can't be found */
+    err = H5Iclear_type(myType, TRUE);
+    CHECK(err, FAIL, "H5Iclear_type");
+
+    err = H5Inmembers(myType, &num_members);
+    CHECK(err, FAIL, "H5Inmembers");
+    VERIFY(num_members, 0, "H5Inmembers");
+
+    H5E_BEGIN_TRY
+    testPtr = H5Iobject_verify(ids[0], myType);
+    H5E_END_TRY
+    CHECK_PTR_NULL(testPtr, "H5Iobject_verify");
+    if (testPtr != NULL)
+        goto out;
+
+    /* Register some more IDs in the emptied type */
+    for (i = 0; i < 10; i++) {
+        ids[i] = H5Iregister(myType, &objs[i]);
+        CHECK(ids[i], H5I_INVALID_HID, "H5Iregister");
+        if (ids[i] == H5I_INVALID_HID)
+            goto out;
+    }
+    for (i = 0; i < 10; i++) {
+        testPtr = H5Iobject_verify(ids[i], myType);
+        CHECK_PTR_EQ(testPtr, &objs[i], "H5Iobject_verify");
+        if (testPtr != &objs[i])
+            goto out;
+    }
+
+    err = H5Idestroy_type(myType);
+    CHECK(err, FAIL, "H5Idestroy_type");
+    if (err < 0)
+        goto out;
+
+    HDfree(ids);
+    HDfree(objs);
+
+    return 0;
+
+out:
+    /* Clean up type if it has been allocated */
+    if (myType >= 0)
+        H5Idestroy_type(myType);
+    HDfree(ids);
+    HDfree(objs);
+
+    return -1;
+}
+
 void
 test_ids(void)
 {
@@ -1375,4 +1551,6 @@ test_ids(void)
         TestErrPrintf("ID remove during H5Iclear_type test failed\n");
     if (test_future_ids() < 0)
         TestErrPrintf("Future ID test failed\n");
+    if (test_many_ids() < 0)
+        TestErrPrintf("Many IDs test failed\n");
 }
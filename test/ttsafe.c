@@ -113,6 +113,11 @@ main(int argc, char *argv[])
 #endif /* H5_HAVE_PTHREAD_H */
     AddTest("acreate", tts_acreate, cleanup_acreate, "multi-attribute creation", NULL);
     AddTest("attr_vlen", tts_attr_vlen, cleanup_attr_vlen, "multi-file-attribute-vlen read", NULL);
+    AddTest("rawread", tts_rawread, cleanup_rawread, "concurrent raw data reads", NULL);
+#ifndef H5_HAVE_WIN_THREADS
+    /* Asynchronous operations are only run in the background with pthreads */
+    AddTest("async", tts_async, cleanup_async, "asynchronous dataset I/O", NULL);
+#endif /* H5_HAVE_WIN_THREADS */
 
 #else /* H5_HAVE_THREADSAFE */
 
@@ -0,0 +1,233 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing for asynchronous dataset I/O with the native VOL connector.
+ * ------------------------------------------------------------------
+ *
+ * Purpose: Verify that H5Dwrite_async(), H5Dread_async() and
+ *          H5Dclose_async() are run by the library's background thread,
+ *          in order for each dataset, and that the event set reports
+ *          their progress and errors.
+ *
+ *          --Hold the API lock, so the background thread can't run, and
+ *            check that a queued write is reported as in progress, then
+ *            release it and check that the write finishes without
+ *            waiting on the event set
+ *          --Queue two writes, a read & a close of the same dataset, and
+ *            check that the read sees the second write
+ *          --Queue a write with mismatched dataspaces, and check that its
+ *            error is reported by the event set
+ *          --Queue a write, then close the file, and check that the data
+ *            was written
+ *
+ ********************************************************************/
+
+#include "ttsafe.h"
+
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+
+#define FILENAME     "ttsafe_async.h5"
+#define DSET_NAME    "data"
+#define DSET_NELMTS  (256 * 1024)
+#define MAX_WAIT_SEC 60
+
+/* Value of element 'u' for write 'n' */
+#define ASYNC_VALUE(n, u) ((int)(u) * 3 + (n))
+
+/*
+ **********************************************************************
+ * tts_async_check
+ *
+ * Returns the number of elements of a buffer that don't hold the
+ * values of write 'n'.
+ **********************************************************************
+ */
+static int
+tts_async_check(const int *buf, int n)
+{
+    size_t u;
+    int    nerrors = 0;
+
+    for (u = 0; u < DSET_NELMTS; u++)
+        if (buf[u] != ASYNC_VALUE(n, u))
+            nerrors++;
+
+    return nerrors;
+} /* end tts_async_check() */
+
+/*
+ **********************************************************************
+ * Thread safe test - asynchronous dataset I/O
+ **********************************************************************
+ */
+void
+tts_async(void)
+{
+    hid_t           fid  = H5I_INVALID_HID;
+    hid_t           sid  = H5I_INVALID_HID;
+    hid_t           sid2 = H5I_INVALID_HID;
+    hid_t           dsid = H5I_INVALID_HID;
+    hid_t           esid = H5I_INVALID_HID;
+    int *           wbuf[2];
+    int *           rbuf;
+    hsize_t         dims[1]  = {DSET_NELMTS};
+    hsize_t         dims2[1] = {DSET_NELMTS / 2};
+    size_t          count, num_in_progress, num_errs, num_cleared;
+    hbool_t         acquired, op_failed;
+    unsigned int    lock_count;
+    H5ES_err_info_t err_info;
+    double          start_time;
+    size_t          u;
+    int             n;
+    herr_t          ret;
+
+    for (n = 0; n < 2; n++) {
+        wbuf[n] = (int *)HDmalloc(DSET_NELMTS * sizeof(int));
+        CHECK_PTR(wbuf[n], "HDmalloc");
+        for (u = 0; u < DSET_NELMTS; u++)
+            wbuf[n][u] = ASYNC_VALUE(n, u);
+    } /* end for */
+    rbuf = (int *)HDmalloc(DSET_NELMTS * sizeof(int));
+    CHECK_PTR(rbuf, "HDmalloc");
+
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, H5I_INVALID_HID, "H5Fcreate");
+    sid = H5Screate_simple(1, dims, NULL);
+    CHECK(sid, H5I_INVALID_HID, "H5Screate_simple");
+    dsid = H5Dcreate2(fid, DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dsid, H5I_INVALID_HID, "H5Dcreate2");
+    esid = H5EScreate();
+    CHECK(esid, H5I_INVALID_HID, "H5EScreate");
+
+    /* Queue a write while holding the API lock: it can't start until the
+     * lock is released, and then finishes in the background
+     */
+    ret = H5TSmutex_acquire(1, &acquired);
+    CHECK(ret, FAIL, "H5TSmutex_acquire");
+    VERIFY(acquired, TRUE, "H5TSmutex_acquire");
+    ret = H5Dwrite_async(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf[0], esid);
+    CHECK(ret, FAIL, "H5Dwrite_async");
+    ret = H5ESget_count(esid, &count);
+    CHECK(ret, FAIL, "H5ESget_count");
+    VERIFY(count, 1, "H5ESget_count");
+    ret = H5ESwait(esid, 0, &num_in_progress, &op_failed);
+    CHECK(ret, FAIL, "H5ESwait");
+    VERIFY(num_in_progress, 1, "H5ESwait");
+    ret = H5TSmutex_release(&lock_count);
+    CHECK(ret, FAIL, "H5TSmutex_release");
+    VERIFY(lock_count, 1, "H5TSmutex_release");
+
+    start_time = H5_get_time();
+    do {
+        ret = H5ESwait(esid, 0, &num_in_progress, &op_failed);
+        CHECK(ret, FAIL, "H5ESwait");
+    } while (num_in_progress > 0 && H5_get_time() - start_time < MAX_WAIT_SEC);
+    VERIFY(num_in_progress, 0, "write in the background");
+    VERIFY(op_failed, FALSE, "write in the background");
+
+    /* Queue writes, a read and a close of the dataset: the read must see
+     * the second write
+     */
+    ret = H5Dwrite_async(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf[0], esid);
+    CHECK(ret, FAIL, "H5Dwrite_async");
+    ret = H5Dwrite_async(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf[1], esid);
+    CHECK(ret, FAIL, "H5Dwrite_async");
+    HDmemset(rbuf, 0, DSET_NELMTS * sizeof(int));
+    ret = H5Dread_async(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, rbuf, esid);
+    CHECK(ret, FAIL, "H5Dread_async");
+    ret = H5Dclose_async(dsid, esid);
+    CHECK(ret, FAIL, "H5Dclose_async");
+    ret = H5ESwait(esid, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed);
+    CHECK(ret, FAIL, "H5ESwait");
+    VERIFY(num_in_progress, 0, "H5ESwait");
+    VERIFY(op_failed, FALSE, "H5ESwait");
+    VERIFY(tts_async_check(rbuf, 1), 0, "H5Dread_async");
+
+    /* Queue a write with a memory dataspace that's too small: the error
+     * shows up in the event set
+     */
+    dsid = H5Dopen2(fid, DSET_NAME, H5P_DEFAULT);
+    CHECK(dsid, H5I_INVALID_HID, "H5Dopen2");
+    sid2 = H5Screate_simple(1, dims2, NULL);
+    CHECK(sid2, H5I_INVALID_HID, "H5Screate_simple");
+    ret = H5Dwrite_async(dsid, H5T_NATIVE_INT, sid2, H5S_ALL, H5P_DEFAULT, wbuf[0], esid);
+    CHECK(ret, FAIL, "H5Dwrite_async");
+    ret = H5Sclose(sid2);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5ESwait(esid, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed);
+    CHECK(ret, FAIL, "H5ESwait");
+    VERIFY(op_failed, TRUE, "H5ESwait");
+    ret = H5ESget_err_count(esid, &num_errs);
+    CHECK(ret, FAIL, "H5ESget_err_count");
+    VERIFY(num_errs, 1, "H5ESget_err_count");
+    ret = H5ESget_err_info(esid, 1, &err_info, &num_cleared);
+    CHECK(ret, FAIL, "H5ESget_err_info");
+    VERIFY(num_cleared, 1, "H5ESget_err_info");
+    VERIFY_STR(err_info.api_name, "H5Dwrite_async", "H5ESget_err_info");
+    CHECK(err_info.err_stack_id, H5I_INVALID_HID, "H5ESget_err_info");
+    ret = H5Eclose_stack(err_info.err_stack_id);
+    CHECK(ret, FAIL, "H5Eclose_stack");
+    H5free_memory(err_info.api_name);
+    H5free_memory(err_info.api_args);
+    H5free_memory(err_info.app_file_name);
+    H5free_memory(err_info.app_func_name);
+
+    /* Queue a write and close the file: the write is finished first.  (An
+     * event set with failed operations won't take new ones, so start over
+     * with a new one.)
+     */
+    ret = H5ESclose(esid);
+    CHECK(ret, FAIL, "H5ESclose");
+    esid = H5EScreate();
+    CHECK(esid, H5I_INVALID_HID, "H5EScreate");
+    ret = H5Dwrite_async(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf[0], esid);
+    CHECK(ret, FAIL, "H5Dwrite_async");
+    ret = H5Dclose(dsid);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    ret = H5ESwait(esid, H5ES_WAIT_FOREVER, &num_in_progress, &op_failed);
+    CHECK(ret, FAIL, "H5ESwait");
+    VERIFY(num_in_progress, 0, "H5ESwait");
+    VERIFY(op_failed, FALSE, "H5ESwait");
+
+    fid = H5Fopen(FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(fid, H5I_INVALID_HID, "H5Fopen");
+    dsid = H5Dopen2(fid, DSET_NAME, H5P_DEFAULT);
+    CHECK(dsid, H5I_INVALID_HID, "H5Dopen2");
+    ret = H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+    CHECK(ret, FAIL, "H5Dread");
+    VERIFY(tts_async_check(rbuf, 0), 0, "H5Dwrite_async before H5Fclose");
+
+    ret = H5Dclose(dsid);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5ESclose(esid);
+    CHECK(ret, FAIL, "H5ESclose");
+
+    HDfree(rbuf);
+    HDfree(wbuf[1]);
+    HDfree(wbuf[0]);
+} /* end tts_async() */
+
+void
+cleanup_async(void)
+{
+    HDunlink(FILENAME);
+} /* end cleanup_async() */
+
+#endif /* defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS) */
@@ -0,0 +1,275 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing for concurrent raw data reads.
+ * ------------------------------------------------------------------
+ *
+ * Purpose: Verify that the library lets other threads in while a
+ *          thread is reading raw data from a file driver that supports
+ *          it (H5FD_FEAT_CONCURRENT_READ), and that threads reading
+ *          their own files get the right data.
+ *
+ *          --Create NUM_THREADS files, each with a large contiguous
+ *            dataset
+ *          --Check that an H5Dread() with the sec2 driver releases and
+ *            takes the API lock again, and that one with the log driver
+ *            (which doesn't support concurrent reads) doesn't
+ *          --Read all the files from one thread, then from NUM_THREADS
+ *            threads at once, verifying the data
+ *
+ *          With medium verbosity, the times for the serial and the
+ *          concurrent reads are printed.
+ *
+ ********************************************************************/
+
+#include "ttsafe.h"
+
+#ifdef H5_HAVE_THREADSAFE
+
+#define FILENAME    "ttsafe_rawread%d.h5"
+#define DSET_NAME   "data"
+#define NUM_THREADS 8
+#define DSET_NELMTS (1024 * 1024)
+#define NUM_READS   4
+
+static void *tts_rawread_thread(void *client_data);
+static int   tts_rawread_file(int file_idx, hid_t fapl, int *rbuf);
+static int   tts_rawread_lock_count(hid_t fapl, hbool_t read_all);
+
+/* Value of element 'u' of the dataset in file 'i' */
+#define RAWREAD_VALUE(i, u) ((int)(u) + (i))
+
+/*
+ **********************************************************************
+ * tts_rawread_file
+ *
+ * Read the dataset in a file NUM_READS times & verify its contents.
+ * Returns the number of errors found.
+ **********************************************************************
+ */
+static int
+tts_rawread_file(int file_idx, hid_t fapl, int *rbuf)
+{
+    char   filename[32]; /* Name of the file */
+    hid_t  fid  = H5I_INVALID_HID;
+    hid_t  dsid = H5I_INVALID_HID;
+    size_t u;
+    int    n;
+    int    nerrors = 0;
+    herr_t ret;
+
+    HDsnprintf(filename, sizeof(filename), FILENAME, file_idx);
+
+    fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl);
+    CHECK(fid, H5I_INVALID_HID, "H5Fopen");
+    dsid = H5Dopen2(fid, DSET_NAME, H5P_DEFAULT);
+    CHECK(dsid, H5I_INVALID_HID, "H5Dopen2");
+
+    for (n = 0; n < NUM_READS; n++) {
+        HDmemset(rbuf, 0, DSET_NELMTS * sizeof(int));
+
+        ret = H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+        CHECK(ret, FAIL, "H5Dread");
+
+        for (u = 0; u < DSET_NELMTS; u++)
+            if (rbuf[u] != RAWREAD_VALUE(file_idx, u)) {
+                nerrors++;
+                break;
+            } /* end if */
+    }         /* end for */
+
+    ret = H5Dclose(dsid);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    return nerrors;
+} /* end tts_rawread_file() */
+
+/*
+ **********************************************************************
+ * tts_rawread_lock_count
+ *
+ * Returns the number of times the API lock is taken while reading all
+ * of the dataset in the first file, or none of it.
+ **********************************************************************
+ */
+static int
+tts_rawread_lock_count(hid_t fapl, hbool_t read_all)
+{
+    char         filename[32]; /* Name of the file */
+    hid_t        fid  = H5I_INVALID_HID;
+    hid_t        dsid = H5I_INVALID_HID;
+    hid_t        sid  = H5I_INVALID_HID;
+    unsigned int before = 0, after = 0; /* API lock attempt counts */
+    int *        rbuf;
+    herr_t       ret;
+
+    rbuf = (int *)HDmalloc(DSET_NELMTS * sizeof(int));
+    CHECK_PTR(rbuf, "HDmalloc");
+
+    HDsnprintf(filename, sizeof(filename), FILENAME, 0);
+    fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl);
+    CHECK(fid, H5I_INVALID_HID, "H5Fopen");
+    dsid = H5Dopen2(fid, DSET_NAME, H5P_DEFAULT);
+    CHECK(dsid, H5I_INVALID_HID, "H5Dopen2");
+    sid = H5Dget_space(dsid);
+    CHECK(sid, H5I_INVALID_HID, "H5Dget_space");
+    if (!read_all) {
+        ret = H5Sselect_none(sid);
+        CHECK(ret, FAIL, "H5Sselect_none");
+    } /* end if */
+
+    ret = H5TSmutex_get_attempt_count(&before);
+    CHECK(ret, FAIL, "H5TSmutex_get_attempt_count");
+    ret = H5Dread(dsid, H5T_NATIVE_INT, sid, sid, H5P_DEFAULT, rbuf);
+    CHECK(ret, FAIL, "H5Dread");
+    ret = H5TSmutex_get_attempt_count(&after);
+    CHECK(ret, FAIL, "H5TSmutex_get_attempt_count");
+
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Dclose(dsid);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    HDfree(rbuf);
+
+    return (int)(after - before);
+} /* end tts_rawread_lock_count() */
+
+/*
+ **********************************************************************
+ * Thread safe test - concurrent raw data reads
+ **********************************************************************
+ */
+void
+tts_rawread(void)
+{
+    H5TS_thread_t threads[NUM_THREADS];    /* Thread declaration */
+    int           thread_idx[NUM_THREADS]; /* Index of the file for each thread */
+    char          filename[32];            /* Name of a file */
+    hid_t         fid  = H5I_INVALID_HID;
+    hid_t         sid  = H5I_INVALID_HID;
+    hid_t         dsid = H5I_INVALID_HID;
+    hid_t         fapl = H5I_INVALID_HID;
+    int *         buf  = NULL;
+    double        start_time, serial_time, concurrent_time;
+    hsize_t       dims[1] = {DSET_NELMTS};
+    size_t        u;
+    int           i;
+    int           nerrors = 0;
+    herr_t        ret;
+
+    buf = (int *)HDmalloc(DSET_NELMTS * sizeof(int));
+    CHECK_PTR(buf, "HDmalloc");
+
+    /* Create the files */
+    sid = H5Screate_simple(1, dims, NULL);
+    CHECK(sid, H5I_INVALID_HID, "H5Screate_simple");
+    for (i = 0; i < NUM_THREADS; i++) {
+        for (u = 0; u < DSET_NELMTS; u++)
+            buf[u] = RAWREAD_VALUE(i, u);
+
+        HDsnprintf(filename, sizeof(filename), FILENAME, i);
+        fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(fid, H5I_INVALID_HID, "H5Fcreate");
+        dsid = H5Dcreate2(fid, DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(dsid, H5I_INVALID_HID, "H5Dcreate2");
+        ret = H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf);
+        CHECK(ret, FAIL, "H5Dwrite");
+        ret = H5Dclose(dsid);
+        CHECK(ret, FAIL, "H5Dclose");
+        ret = H5Fclose(fid);
+        CHECK(ret, FAIL, "H5Fclose");
+    } /* end for */
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* A read with the sec2 driver should take the API lock once more than
+     * a read that doesn't touch the file, after the driver read.  The log
+     * driver doesn't allow concurrent reads.
+     */
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl, H5I_INVALID_HID, "H5Pcreate");
+    ret = H5Pset_fapl_sec2(fapl);
+    CHECK(ret, FAIL, "H5Pset_fapl_sec2");
+    VERIFY(tts_rawread_lock_count(fapl, TRUE) - tts_rawread_lock_count(fapl, FALSE), 1,
+           "H5Dread with the sec2 driver");
+    ret = H5Pset_fapl_log(fapl, NULL, (unsigned long long)0, (size_t)0);
+    CHECK(ret, FAIL, "H5Pset_fapl_log");
+    VERIFY(tts_rawread_lock_count(fapl, TRUE) - tts_rawread_lock_count(fapl, FALSE), 0,
+           "H5Dread with the log driver");
+    ret = H5Pclose(fapl);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    /* Read all the files from this thread */
+    start_time = H5_get_time();
+    for (i = 0; i < NUM_THREADS; i++)
+        nerrors += tts_rawread_file(i, H5P_DEFAULT, buf);
+    serial_time = H5_get_time() - start_time;
+    VERIFY(nerrors, 0, "serial reads");
+
+    /* Read each file from its own thread */
+    start_time = H5_get_time();
+    for (i = 0; i < NUM_THREADS; i++) {
+        thread_idx[i] = i;
+        threads[i]    = H5TS_create_thread(tts_rawread_thread, NULL, &thread_idx[i]);
+    } /* end for */
+    for (i = 0; i < NUM_THREADS; i++)
+        H5TS_wait_for_thread(threads[i]);
+    concurrent_time = H5_get_time() - start_time;
+
+    /* (Each thread reports the number of errors it found in its index) */
+    for (i = 0; i < NUM_THREADS; i++)
+        VERIFY(thread_idx[i], 0, "concurrent reads");
+
+    if (GetTestVerbosity() >= VERBO_MED)
+        HDprintf("    Read %d x %d MB: %.3f s from one thread, %.3f s from %d threads\n", NUM_THREADS * NUM_READS,
+                 (int)((DSET_NELMTS * sizeof(int)) / (1024 * 1024)), serial_time, concurrent_time,
+                 NUM_THREADS);
+
+    HDfree(buf);
+} /* end tts_rawread() */
+
+/* Start execution for each thread */
+static void *
+tts_rawread_thread(void *client_data)
+{
+    int *file_idx = (int *)client_data; /* Index of the file to read */
+    int *rbuf;                          /* Buffer for the data */
+
+    rbuf = (int *)HDmalloc(DSET_NELMTS * sizeof(int));
+    CHECK_PTR(rbuf, "HDmalloc");
+
+    *file_idx = tts_rawread_file(*file_idx, H5P_DEFAULT, rbuf);
+
+    HDfree(rbuf);
+
+    return NULL;
+} /* end tts_rawread_thread() */
+
+void
+cleanup_rawread(void)
+{
+    char filename[32]; /* Name of a file */
+    int  i;
+
+    for (i = 0; i < NUM_THREADS; i++) {
+        HDsnprintf(filename, sizeof(filename), FILENAME, i);
+        HDunlink(filename);
+    } /* end for */
+} /* end cleanup_rawread() */
+
+#endif /*H5_HAVE_THREADSAFE*/
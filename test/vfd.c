@@ -62,10 +62,18 @@ const char *FILENAME[] = {"sec2_file",          /*0*/
                           "splitter_rw_file",   /*11*/
                           "splitter_wo_file",   /*12*/
                           "splitter.log",       /*13*/
+                          "vector_file",        /*14*/
+                          "iouring_file",       /*15*/
+                          "mmap_file",          /*16*/
                           NULL};
 
 #define LOG_FILENAME "log_vfd_out.log"
 
+#define VECTOR_COUNT    8
+#define VECTOR_BUF_SIZE 256
+
+#define MMAP_DIM 1000
+
 #define COMPAT_BASENAME       "family_v16_"
 #define MULTI_COMPAT_BASENAME "multi_file_v16"
 #define SPLITTER_DATASET_NAME "dataset"
@@ -157,10 +165,13 @@ test_sec2(void)
         TEST_ERROR
     if (!(driver_flags & H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
         TEST_ERROR
+    if (!(driver_flags & H5FD_FEAT_CONCURRENT_READ))
+        TEST_ERROR
     /* Check for extra flags not accounted for above */
     if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
                          H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_POSIX_COMPAT_HANDLE |
-                         H5FD_FEAT_SUPPORTS_SWMR_IO | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE))
+                         H5FD_FEAT_SUPPORTS_SWMR_IO | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE |
+                         H5FD_FEAT_CONCURRENT_READ))
         TEST_ERROR
 
     if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
@@ -299,10 +310,12 @@ test_core(void)
         TEST_ERROR
     if (!(driver_flags & H5FD_FEAT_CAN_USE_FILE_IMAGE_CALLBACKS))
         TEST_ERROR
+    if (!(driver_flags & H5FD_FEAT_CONCURRENT_READ))
+        TEST_ERROR
     /* Check for extra flags not accounted for above */
-    if (driver_flags !=
-        (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
-         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_ALLOW_FILE_IMAGE | H5FD_FEAT_CAN_USE_FILE_IMAGE_CALLBACKS))
+    if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
+                         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_ALLOW_FILE_IMAGE |
+                         H5FD_FEAT_CAN_USE_FILE_IMAGE_CALLBACKS | H5FD_FEAT_CONCURRENT_READ))
         TEST_ERROR
 
     if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
@@ -804,6 +817,322 @@ error:
 #endif /*H5_HAVE_DIRECT*/
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring
+ *
+ * Purpose:     Tests the file handle interface for the io_uring driver
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring(void)
+{
+#ifdef H5_HAVE_IOURING
+    hid_t         fid          = -1;     /* file ID                      */
+    hid_t         fapl_id      = -1;     /* file access property list ID */
+    hid_t         fapl_id_out  = -1;     /* from H5Fget_access_plist     */
+    hid_t         driver_id    = -1;     /* ID for this VFD              */
+    unsigned long driver_flags = 0;      /* VFD feature flags            */
+    unsigned      queue_depth  = 0;      /* io_uring queue depth         */
+    char          filename[1024];        /* filename                     */
+    void *        os_file_handle = NULL; /* OS file handle               */
+#endif /* H5_HAVE_IOURING */
+
+    TESTING("io_uring file driver");
+
+#ifndef H5_HAVE_IOURING
+    SKIPPED();
+    return 0;
+#else  /* H5_HAVE_IOURING */
+
+    /* Set property list and file name for the io_uring driver */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_iouring(fapl_id, 16) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[15], fapl_id, filename, sizeof(filename));
+
+    /* Verify the file access properties */
+    if (H5Pget_fapl_iouring(fapl_id, &queue_depth) < 0)
+        TEST_ERROR;
+    if (queue_depth != 16)
+        TEST_ERROR;
+
+    /* Check that the VFD feature flags are correct */
+    if ((driver_id = H5Pget_driver(fapl_id)) < 0)
+        TEST_ERROR
+    if (H5FDdriver_query(driver_id, &driver_flags) < 0)
+        TEST_ERROR
+    if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA | H5FD_FEAT_DATA_SIEVE |
+                         H5FD_FEAT_AGGREGATE_SMALLDATA | H5FD_FEAT_POSIX_COMPAT_HANDLE |
+                         H5FD_FEAT_SUPPORTS_SWMR_IO | H5FD_FEAT_DEFAULT_VFD_COMPATIBLE |
+                         H5FD_FEAT_CONCURRENT_READ))
+        TEST_ERROR
+
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR;
+
+    /* Retrieve the access property list... */
+    if ((fapl_id_out = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver and its properties are correct */
+    if (H5FD_IOURING != H5Pget_driver(fapl_id_out))
+        TEST_ERROR;
+    queue_depth = 0;
+    if (H5Pget_fapl_iouring(fapl_id_out, &queue_depth) < 0)
+        TEST_ERROR;
+    if (queue_depth != 16)
+        TEST_ERROR;
+
+    /* ...and close the property list */
+    if (H5Pclose(fapl_id_out) < 0)
+        TEST_ERROR;
+
+    /* Check that we can get an operating-system-specific handle from
+     * the library.
+     */
+    if (H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle) < 0)
+        TEST_ERROR;
+    if (os_file_handle == NULL)
+        FAIL_PUTS_ERROR("NULL os-specific vfd/file handle was returned from H5Fget_vfd_handle");
+
+    /* Close and delete the file */
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[15], fapl_id);
+
+    /* Close the fapl */
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_id);
+        H5Pclose(fapl_id_out);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return -1;
+#endif /* H5_HAVE_IOURING */
+} /* end test_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_mmap
+ *
+ * Purpose:     Tests the read-only mmap driver, reading raw data through
+ *              the file's mapping and getting a pointer into it
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_mmap(void)
+{
+#ifdef H5_HAVE_MMAP
+    hid_t         fid          = -1;     /* file ID                      */
+    hid_t         fapl_id      = -1;     /* file access property list ID */
+    hid_t         fapl_id_out  = -1;     /* from H5Fget_access_plist     */
+    hid_t         dcpl_id      = -1;     /* dataset creation plist ID    */
+    hid_t         sid          = -1;     /* dataspace ID                 */
+    hid_t         mem_sid      = -1;     /* memory dataspace ID          */
+    hid_t         did          = -1;     /* dataset ID                   */
+    hid_t         driver_id    = -1;     /* ID for this VFD              */
+    unsigned long driver_flags = 0;      /* VFD feature flags            */
+    hsize_t       dims[1]      = {MMAP_DIM};
+    hsize_t       chunk_dims[1] = {MMAP_DIM / 10};
+    hsize_t       start[1], count[1];
+    hsize_t       size;                  /* size of mapped data          */
+    const void *  mapped;                /* pointer to mapped data       */
+    int *         wbuf = NULL;           /* data written                 */
+    int *         rbuf = NULL;           /* data read                    */
+    char          filename[1024];        /* filename                     */
+    void *        os_file_handle = NULL; /* OS file handle               */
+    int           i;
+#endif /* H5_HAVE_MMAP */
+
+    TESTING("mmap file driver");
+
+#ifndef H5_HAVE_MMAP
+    SKIPPED();
+    return 0;
+#else  /* H5_HAVE_MMAP */
+
+    if (NULL == (wbuf = (int *)HDmalloc(MMAP_DIM * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (rbuf = (int *)HDcalloc(MMAP_DIM, sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < MMAP_DIM; i++)
+        wbuf[i] = i * 3 + 1;
+
+    /* Set property list and file name for the mmap driver */
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5Pset_fapl_mmap(fapl_id) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[16], fapl_id, filename, sizeof(filename));
+
+    /* Check that the VFD feature flags are correct */
+    if ((driver_id = H5Pget_driver(fapl_id)) < 0)
+        TEST_ERROR
+    if (H5FDdriver_query(driver_id, &driver_flags) < 0)
+        TEST_ERROR
+    if (driver_flags !=
+        (H5FD_FEAT_POSIX_COMPAT_HANDLE | H5FD_FEAT_CONCURRENT_READ | H5FD_FEAT_MEMORY_MAPPED))
+        TEST_ERROR
+
+    /* The driver can't create files */
+    H5E_BEGIN_TRY
+    {
+        fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    }
+    H5E_END_TRY;
+    if (fid >= 0)
+        FAIL_PUTS_ERROR("file created with the read-only mmap driver");
+
+    /* Write a contiguous and a chunked dataset with the default driver */
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((did = H5Dcreate2(fid, "contig", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+    if (H5Dclose(did) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, chunk_dims) < 0)
+        TEST_ERROR;
+    if ((did = H5Dcreate2(fid, "chunked", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+    if (H5Dclose(did) < 0)
+        TEST_ERROR;
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    /* The driver can't open files for writing */
+    H5E_BEGIN_TRY
+    {
+        fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id);
+    }
+    H5E_END_TRY;
+    if (fid >= 0)
+        FAIL_PUTS_ERROR("file opened for writing with the read-only mmap driver");
+
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver is correct */
+    if ((fapl_id_out = H5Fget_access_plist(fid)) < 0)
+        TEST_ERROR;
+    if (H5FD_MMAP != H5Pget_driver(fapl_id_out))
+        TEST_ERROR;
+    if (H5Pclose(fapl_id_out) < 0)
+        TEST_ERROR;
+
+    /* Check that we can get an operating-system-specific handle from
+     * the library.
+     */
+    if (H5Fget_vfd_handle(fid, H5P_DEFAULT, &os_file_handle) < 0)
+        TEST_ERROR;
+    if (os_file_handle == NULL)
+        FAIL_PUTS_ERROR("NULL os-specific vfd/file handle was returned from H5Fget_vfd_handle");
+
+    /* Read the whole contiguous dataset, then a part of it */
+    if ((did = H5Dopen2(fid, "contig", H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(wbuf, rbuf, MMAP_DIM * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("contiguous data read doesn't match data written");
+    HDmemset(rbuf, 0, MMAP_DIM * sizeof(int));
+    start[0] = 17;
+    count[0] = MMAP_DIM / 2;
+    if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if ((mem_sid = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+    if (H5Dread(did, H5T_NATIVE_INT, mem_sid, sid, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(wbuf + start[0], rbuf, count[0] * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("contiguous hyperslab read doesn't match data written");
+
+    /* Get a pointer to the contiguous dataset's data */
+    if (H5Dget_mapped_data(did, &mapped, &size) < 0)
+        TEST_ERROR;
+    if (NULL == mapped || size != MMAP_DIM * sizeof(int))
+        FAIL_PUTS_ERROR("contiguous dataset's data not mapped");
+    if (HDmemcmp(wbuf, mapped, MMAP_DIM * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("mapped data doesn't match data written");
+    if (H5Dclose(did) < 0)
+        TEST_ERROR;
+
+    /* Read the chunked dataset, whose data can't be mapped */
+    HDmemset(rbuf, 0, MMAP_DIM * sizeof(int));
+    if ((did = H5Dopen2(fid, "chunked", H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (HDmemcmp(wbuf, rbuf, MMAP_DIM * sizeof(int)) != 0)
+        FAIL_PUTS_ERROR("chunked data read doesn't match data written");
+    if (H5Dget_mapped_data(did, &mapped, &size) < 0)
+        TEST_ERROR;
+    if (NULL != mapped || size != 0)
+        FAIL_PUTS_ERROR("chunked dataset's data mapped");
+    if (H5Dclose(did) < 0)
+        TEST_ERROR;
+
+    /* Close and delete the file */
+    if (H5Fclose(fid) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[16], fapl_id);
+
+    /* Close everything else */
+    if (H5Sclose(mem_sid) < 0)
+        TEST_ERROR;
+    if (H5Sclose(sid) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Sclose(mem_sid);
+        H5Sclose(sid);
+        H5Pclose(dcpl_id);
+        H5Pclose(fapl_id);
+        H5Pclose(fapl_id_out);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    HDfree(wbuf);
+    HDfree(rbuf);
+    return -1;
+#endif /* H5_HAVE_MMAP */
+} /* end test_mmap() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_family_opens
  *
@@ -3304,6 +3633,184 @@ error:
 
 #undef SPLITTER_TEST_FAULT
 
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io_driver
+ *
+ * Purpose:     Tests vector reads and writes with the H5FDread_vector()
+ *              and H5FDwrite_vector() calls, for the driver set in
+ *              FAPL_ID.  The entries are out of order, adjacent to each
+ *              other, separated by holes, and partly beyond the end of
+ *              the file.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io_driver(const char *driver_name, hid_t fapl_id)
+{
+    H5FD_t *       lf = NULL;                           /* VFD struct pointer           */
+    char           filename[1024];                      /* filename                     */
+    char           msg[80];                             /* test message                 */
+    H5FD_mem_t     types[VECTOR_COUNT];                 /* memory types of the entries  */
+    haddr_t        addrs[VECTOR_COUNT];                 /* addresses of the entries     */
+    size_t         sizes[VECTOR_COUNT];                 /* sizes of the entries         */
+    const void *   wbufs[VECTOR_COUNT];                 /* write buffers                */
+    void *         rbufs[VECTOR_COUNT];                 /* read buffers                 */
+    unsigned char  wbuf[VECTOR_COUNT][VECTOR_BUF_SIZE]; /* data written                 */
+    unsigned char  rbuf[VECTOR_COUNT][VECTOR_BUF_SIZE]; /* data read                    */
+    unsigned char  zbuf[VECTOR_BUF_SIZE];               /* zeroed data                  */
+    haddr_t        eof;                                 /* end of the written data      */
+    int            i;                                   /* local index variable         */
+
+    HDsnprintf(msg, sizeof(msg), "vector I/O with %s file driver", driver_name);
+    TESTING(msg);
+
+    h5_fixname(FILENAME[14], fapl_id, filename, sizeof(filename));
+
+    if (NULL == (lf = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR
+    if (H5FDset_eoa(lf, H5FD_MEM_DRAW, (haddr_t)(4 * VECTOR_COUNT * VECTOR_BUF_SIZE)) < 0)
+        TEST_ERROR
+
+    /* Set up the entries: pairs of adjacent entries separated by holes of
+     * increasing size, listed in reverse address order.  The last entry
+     * is shorter than the others.
+     */
+    eof = 0;
+    for (i = 0; i < VECTOR_COUNT; i++) {
+        int j = VECTOR_COUNT - 1 - i;
+
+        types[j] = H5FD_MEM_DRAW;
+        addrs[j] = (haddr_t)(i * VECTOR_BUF_SIZE + (i / 2) * (i / 2) * 16);
+        sizes[j] = (i == VECTOR_COUNT - 1) ? VECTOR_BUF_SIZE / 2 : VECTOR_BUF_SIZE;
+        HDmemset(wbuf[j], 'a' + i, VECTOR_BUF_SIZE);
+        wbufs[j] = wbuf[j];
+        rbufs[j] = rbuf[j];
+        eof      = MAX(eof, addrs[j] + sizes[j]);
+    } /* end for */
+
+    /* An empty vector is legal */
+    if (H5FDwrite_vector(lf, H5P_DEFAULT, 0, NULL, NULL, NULL, NULL) < 0)
+        TEST_ERROR
+    if (H5FDread_vector(lf, H5P_DEFAULT, 0, NULL, NULL, NULL, NULL) < 0)
+        TEST_ERROR
+
+    /* Write the entries and read them back */
+    if (H5FDwrite_vector(lf, H5P_DEFAULT, VECTOR_COUNT, types, addrs, sizes, wbufs) < 0)
+        TEST_ERROR
+    HDmemset(rbuf, 0xff, sizeof(rbuf));
+    if (H5FDread_vector(lf, H5P_DEFAULT, VECTOR_COUNT, types, addrs, sizes, rbufs) < 0)
+        TEST_ERROR
+    for (i = 0; i < VECTOR_COUNT; i++)
+        if (HDmemcmp(rbuf[i], wbuf[i], sizes[i]) != 0)
+            FAIL_PUTS_ERROR("data read doesn't match data written")
+
+    /* Each entry should read the same as a single-block read */
+    for (i = 0; i < VECTOR_COUNT; i++) {
+        HDmemset(rbuf[0], 0xff, VECTOR_BUF_SIZE);
+        if (H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, addrs[i], sizes[i], rbuf[0]) < 0)
+            TEST_ERROR
+        if (HDmemcmp(rbuf[0], wbuf[i], sizes[i]) != 0)
+            FAIL_PUTS_ERROR("single-block read doesn't match data written")
+    } /* end for */
+
+    /* Entries beyond the end of the file read as zeros, including the
+     * part of an entry straddling the end of the file.
+     */
+    HDmemset(zbuf, 0, sizeof(zbuf));
+    HDmemset(rbuf, 0xff, sizeof(rbuf));
+    addrs[0] = eof - VECTOR_BUF_SIZE / 2;
+    sizes[0] = VECTOR_BUF_SIZE;
+    addrs[1] = eof + VECTOR_BUF_SIZE;
+    sizes[1] = VECTOR_BUF_SIZE;
+    if (H5FDread_vector(lf, H5P_DEFAULT, 2, types, addrs, sizes, rbufs) < 0)
+        TEST_ERROR
+    if (HDmemcmp(rbuf[0], wbuf[0], VECTOR_BUF_SIZE / 2) != 0)
+        FAIL_PUTS_ERROR("data read before the end of the file doesn't match data written")
+    if (HDmemcmp(rbuf[0] + VECTOR_BUF_SIZE / 2, zbuf, VECTOR_BUF_SIZE / 2) != 0)
+        FAIL_PUTS_ERROR("data read past the end of the file isn't zeroed")
+    if (HDmemcmp(rbuf[1], zbuf, VECTOR_BUF_SIZE) != 0)
+        FAIL_PUTS_ERROR("data read past the end of the file isn't zeroed")
+
+    /* Entries beyond the end of the address space are an error */
+    addrs[0] = (haddr_t)(4 * VECTOR_COUNT * VECTOR_BUF_SIZE);
+    sizes[0] = VECTOR_BUF_SIZE;
+    H5E_BEGIN_TRY
+    {
+        if (H5FDread_vector(lf, H5P_DEFAULT, 1, types, addrs, sizes, rbufs) >= 0)
+            FAIL_PUTS_ERROR("vector read past the end of the address space succeeded")
+    }
+    H5E_END_TRY;
+
+    if (H5FDclose(lf) < 0)
+        TEST_ERROR
+    lf = NULL;
+    h5_delete_test_file(FILENAME[14], fapl_id);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        if (lf)
+            H5FDclose(lf);
+    }
+    H5E_END_TRY;
+    return -1;
+} /* end test_vector_io_driver() */
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io
+ *
+ * Purpose:     Tests vector I/O with the SEC2 driver, which may implement
+ *              it with preadv()/pwritev(), the io_uring driver (if it's
+ *              built), with a queue depth smaller than the vector, and the
+ *              STDIO driver, which doesn't implement it and uses the
+ *              library's fallback.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io(void)
+{
+    hid_t fapl_id = -1; /* file access property list ID */
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR
+    if (H5Pset_fapl_sec2(fapl_id) < 0)
+        TEST_ERROR
+    if (test_vector_io_driver("sec2", fapl_id) < 0)
+        TEST_ERROR
+#ifdef H5_HAVE_IOURING
+    if (H5Pset_fapl_iouring(fapl_id, VECTOR_COUNT / 2) < 0)
+        TEST_ERROR
+    if (test_vector_io_driver("io_uring", fapl_id) < 0)
+        TEST_ERROR
+#endif /* H5_HAVE_IOURING */
+    if (H5Pset_fapl_stdio(fapl_id) < 0)
+        TEST_ERROR
+    if (test_vector_io_driver("stdio", fapl_id) < 0)
+        TEST_ERROR
+    if (H5Pclose(fapl_id) < 0)
+        TEST_ERROR
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl_id);
+    }
+    H5E_END_TRY;
+    return -1;
+} /* end test_vector_io() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -3325,6 +3832,8 @@ main(void)
     nerrors += test_sec2() < 0 ? 1 : 0;
     nerrors += test_core() < 0 ? 1 : 0;
     nerrors += test_direct() < 0 ? 1 : 0;
+    nerrors += test_iouring() < 0 ? 1 : 0;
+    nerrors += test_mmap() < 0 ? 1 : 0;
     nerrors += test_family() < 0 ? 1 : 0;
     nerrors += test_family_compat() < 0 ? 1 : 0;
     nerrors += test_family_member_fapl() < 0 ? 1 : 0;
@@ -3335,6 +3844,7 @@ main(void)
     nerrors += test_windows() < 0 ? 1 : 0;
     nerrors += test_ros3() < 0 ? 1 : 0;
     nerrors += test_splitter() < 0 ? 1 : 0;
+    nerrors += test_vector_io() < 0 ? 1 : 0;
 
     if (nerrors) {
         HDprintf("***** %d Virtual File Driver TEST%s FAILED! *****\n", nerrors, nerrors > 1 ? "S" : "");
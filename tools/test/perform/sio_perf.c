@@ -932,6 +932,9 @@ report_parameters(struct options *opts)
         else if (opts->vfd == direct) {
             HDfprintf(output, "direct\n");
         }
+        else if (opts->vfd == iouring) {
+            HDfprintf(output, "iouring\n");
+        }
     }
 
     {
@@ -1184,6 +1187,9 @@ parse_command_line(int argc, const char *argv[])
                 else if (!HDstrcasecmp(opt_arg, "direct")) {
                     cl_opts->vfd = direct;
                 }
+                else if (!HDstrcasecmp(opt_arg, "iouring")) {
+                    cl_opts->vfd = iouring;
+                }
                 else {
                     HDfprintf(stderr, "sio_perf: invalid --api option %s\n", opt_arg);
                     HDexit(EXIT_FAILURE);
@@ -1420,7 +1426,7 @@ usage(const char *prog)
     HDprintf("      the total size of the object increases exponentially.\n");
     HDprintf("\n");
     HDprintf("  VFD  - is an HDF5 file driver specifier. Valid values are:\n");
-    HDprintf("          sec2, stdio, core, split, multi, family, direct\n");
+    HDprintf("          sec2, stdio, core, split, multi, family, direct, iouring\n");
     HDprintf("\n");
     HDprintf("  Dimension access order:\n");
     HDprintf("      Data access starts at the cardinal origin of the dataset using the\n");
@@ -17,10 +17,16 @@
  *   -f : compress with Z_FILTERED
  *   -h : compress with Z_HUFFMAN_ONLY
  *   -1 to -9 : compression level
+ *
+ * After the compressed write test, the throughput of the shuffle filter
+ * is reported for each element size and shuffle mode.
  */
 
+#define H5Z_FRIEND /*suppress error about including H5Zpkg      */
+
 /* our header files */
 #include "h5test.h"
+#include "H5Zpkg.h"
 #include "h5tools.h"
 #include "h5tools_utils.h"
 
@@ -37,6 +43,11 @@
 /* report 0.0 in case t is zero too */
 #define MB_PER_SEC(bytes, t)                                                                                 \
     ((fabs(t) < (double)0.0000000001F) ? (double)0.0F : ((((double)bytes) / (double)ONE_MB) / (t)))
+#define GB_PER_SEC(bytes, t)                                                                                 \
+    ((fabs(t) < (double)0.0000000001F) ? (double)0.0F : ((((double)bytes) / (double)ONE_GB) / (t)))
+
+/* largest element size to time the shuffle filter with */
+#define MAX_SHUFFLE_SIZE 16
 
 #ifndef TRUE
 #define TRUE 1
@@ -533,6 +544,101 @@ do_write_test(unsigned long file_size, unsigned long min_buf_size, unsigned long
     }
 }
 
+/*
+ * Function:    shuffle_buffer
+ * Purpose:     Run the shuffle filter on a buffer.
+ * Returns:     Time taken, in seconds
+ */
+static double
+shuffle_buffer(unsigned flags, unsigned elmt_size, unsigned mode, void **buf, size_t buf_len)
+{
+    unsigned       cd_values[H5Z_SHUFFLE_TOTAL_NPARMS + 1];
+    size_t         cd_nelmts = H5Z_SHUFFLE_TOTAL_NPARMS;
+    size_t         buf_size  = buf_len;
+    struct timeval timer_start, timer_stop;
+
+    cd_values[0] = elmt_size;
+    cd_values[1] = mode;
+    if (mode != H5Z_SHUFFLE_BYTE)
+        cd_nelmts++;
+
+    HDgettimeofday(&timer_start, NULL);
+
+    if ((H5Z_SHUFFLE->filter)(flags, cd_nelmts, cd_values, buf_len, &buf_size, buf) != buf_len) {
+        cleanup();
+        error("shuffle filter failed");
+    }
+
+    HDgettimeofday(&timer_stop, NULL);
+
+    return ((double)timer_stop.tv_sec + ((double)timer_stop.tv_usec) / (double)MICROSECOND) -
+           ((double)timer_start.tv_sec + ((double)timer_start.tv_usec) / (double)MICROSECOND);
+}
+
+/*
+ * Function:    do_shuffle_test
+ * Purpose:     Report the throughput of the shuffle filter (in both
+ *              directions) for each element size that's a power of two,
+ *              in both shuffle modes, shuffling FILE_SIZE bytes of data in
+ *              buffers of BUF_SIZE bytes.
+ * Returns:     Nothing
+ */
+static void
+do_shuffle_test(unsigned long file_size, unsigned long buf_size)
+{
+    unsigned long iters = file_size / buf_size;
+    unsigned long u;
+    Bytef *       src, *orig;
+    unsigned      elmt_size, mode;
+
+    if (iters == 0)
+        iters = 1;
+
+    /* (The filter frees the buffer it's given, so it must come from the library) */
+    src  = (Bytef *)H5allocate_memory(buf_size, FALSE);
+    orig = (Bytef *)HDmalloc(buf_size);
+
+    if (!src || !orig) {
+        cleanup();
+        error("out of memory");
+    }
+
+    /* (Slowly changing values, like the data that shuffling is meant for) */
+    for (u = 0; u < buf_size; u++)
+        orig[u] = (Bytef)((u / 64) + (unsigned long)(HDrandom() & 0x3));
+
+    HDfprintf(stdout, "Shuffle filter, buffer size == %luKB\n", buf_size / ONE_KB);
+
+    for (elmt_size = 1; elmt_size <= MAX_SHUFFLE_SIZE; elmt_size *= 2)
+        for (mode = H5Z_SHUFFLE_BYTE; mode <= H5Z_SHUFFLE_BIT; mode++) {
+            double        shuffle_time = 0.0, unshuffle_time = 0.0;
+            unsigned long i;
+
+            /* (Byte shuffling doesn't do anything to 1-byte elements) */
+            if (elmt_size == 1 && mode == H5Z_SHUFFLE_BYTE)
+                continue;
+
+            HDmemcpy(src, orig, buf_size);
+
+            for (i = 0; i < iters; i++) {
+                shuffle_time += shuffle_buffer(0, elmt_size, mode, (void **)&src, buf_size);
+                unshuffle_time += shuffle_buffer(H5Z_FLAG_REVERSE, elmt_size, mode, (void **)&src, buf_size);
+            }
+
+            if (HDmemcmp(src, orig, buf_size) != 0) {
+                cleanup();
+                error("shuffled data doesn't match the original data");
+            }
+
+            HDfprintf(stdout, "\t%2u-byte elements, %s shuffle: %.2fGB/s, unshuffle: %.2fGB/s\n", elmt_size,
+                      mode == H5Z_SHUFFLE_BYTE ? "byte" : "bit ", GB_PER_SEC(iters * buf_size, shuffle_time),
+                      GB_PER_SEC(iters * buf_size, unshuffle_time));
+        }
+
+    HDfree(orig);
+    H5free_memory(src);
+}
+
 /*
  * Function:    main
  * Purpose:     Run the program
@@ -614,6 +720,7 @@ main(int argc, const char *argv[])
 
     get_unique_name();
     do_write_test(file_size, min_buf_size, max_buf_size);
+    do_shuffle_test(file_size, max_buf_size);
     cleanup();
     return EXIT_SUCCESS;
 }